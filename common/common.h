@@ -10,6 +10,8 @@
 #include <optional>
 #include <tuple>
 #include <array>
+#include <cstring>
+#include <cmath>
 
 #ifdef __llvm__
 #pragma clang diagnostic push
@@ -372,6 +374,109 @@ struct bitfield_type {
 
 static_assert(sizeof(bitfield_type) == 1);
 
+// quantized storage types: read and written as float, stored in 16 bits
+
+struct half_type {
+	uint16_t v = 0;
+};
+struct unorm16_type { // [0, 1] in steps of 1 / 65535
+	uint16_t v = 0;
+};
+template<int32_t denominator>
+struct fixed16_type { // value = v / denominator
+	static constexpr float scale = float(denominator);
+	static constexpr float inverse_scale = 1.0f / float(denominator);
+
+	int16_t v = 0;
+};
+
+static_assert(sizeof(half_type) == 2);
+static_assert(sizeof(unorm16_type) == 2);
+static_assert(sizeof(fixed16_type<1>) == 2);
+
+template<typename T>
+struct is_quantized_type_s : public std::false_type {};
+template<>
+struct is_quantized_type_s<half_type> : public std::true_type {};
+template<>
+struct is_quantized_type_s<unorm16_type> : public std::true_type {};
+template<int32_t denominator>
+struct is_quantized_type_s<fixed16_type<denominator>> : public std::true_type {};
+
+template<typename T>
+constexpr bool is_quantized_type = is_quantized_type_s<std::remove_cv_t<T>>::value;
+
+template<typename T>
+struct is_fixed16_type_s : public std::false_type {};
+template<int32_t denominator>
+struct is_fixed16_type_s<fixed16_type<denominator>> : public std::true_type {};
+
+template<typename T>
+constexpr bool is_fixed16_type = is_fixed16_type_s<std::remove_cv_t<T>>::value;
+
+// the conversions below round to nearest even, matching F16C and cvtps2dq, so that scalar and vector paths agree bit for bit
+
+inline float dequantize(half_type h) {
+	uint32_t const sign = uint32_t(h.v & 0x8000ui32) << 16;
+	uint32_t const exp_mantissa = uint32_t(h.v & 0x7FFFui32) << 13;
+
+	float scaled = 0.0f;
+	std::memcpy(&scaled, &exp_mantissa, sizeof(float));
+	scaled *= 5.192296858534827628530496329220096e+33f; // 2^112
+
+	uint32_t bits = 0;
+	std::memcpy(&bits, &scaled, sizeof(float));
+	if(exp_mantissa >= 0x0F800000ui32)
+		bits |= 0x7F800000ui32; // infinity and nan
+	bits |= sign;
+
+	float result = 0.0f;
+	std::memcpy(&result, &bits, sizeof(float));
+	return result;
+}
+inline float dequantize(unorm16_type u) {
+	return float(u.v) * (1.0f / 65535.0f);
+}
+template<int32_t denominator>
+float dequantize(fixed16_type<denominator> f) {
+	return float(f.v) * fixed16_type<denominator>::inverse_scale;
+}
+
+inline half_type quantize_half(float value) {
+	uint32_t bits = 0;
+	std::memcpy(&bits, &value, sizeof(float));
+
+	uint32_t const sign = (bits >> 16) & 0x8000ui32;
+	uint32_t const abs_bits = bits & 0x7FFFFFFFui32;
+
+	if(abs_bits > 0x7F800000ui32)
+		return half_type{ uint16_t(sign | 0x7E00ui32) };
+	if(abs_bits < 0x38800000ui32) { // subnormal result: adding 0.5 makes the fpu round to the 2^-24 ulp of the half
+		float scaled = 0.0f;
+		std::memcpy(&scaled, &abs_bits, sizeof(float));
+		scaled += 0.5f;
+		uint32_t scaled_bits = 0;
+		std::memcpy(&scaled_bits, &scaled, sizeof(float));
+		return half_type{ uint16_t(sign | (scaled_bits - 0x3F000000ui32)) };
+	}
+	uint32_t const rebased = abs_bits - 0x38000000ui32;
+	uint32_t const rounded = (rebased + 0x0FFFui32 + ((rebased >> 13) & 1ui32)) >> 13;
+	return half_type{ uint16_t(sign | std::min(rounded, 0x7C00ui32)) };
+}
+
+template<typename T>
+T quantize(float value) {
+	static_assert(is_quantized_type<T>);
+
+	if constexpr(std::is_same_v<T, half_type>) {
+		return quantize_half(value);
+	} else if constexpr(std::is_same_v<T, unorm16_type>) {
+		return unorm16_type{ uint16_t(std::lrint(std::min(std::max(value * 65535.0f, 0.0f), 65535.0f))) };
+	} else {
+		return T{ int16_t(std::lrint(std::min(std::max(value * T::scale, -32768.0f), 32767.0f))) };
+	}
+}
+
 inline void bit_vector_set(bitfield_type* v, int32_t index, bool value) {
 	const int32_t real_index = index >> 3;
 	const uint32_t sub_index = uint32_t(index) & 7ui32;
@@ -502,6 +607,50 @@ public:
 	}
 };
 
+// view of one column of an interleaved (AoSoA) column group: values are stored in blocks of
+// lanes consecutive elements, and the start of each block is block_stride elements after the last
+template<typename T, typename index_type, int32_t lanes, int32_t block_stride>
+struct tagged_interleaved_view {
+	static_assert(lanes > 0 && (lanes & (lanes - 1)) == 0);
+	static_assert(block_stride >= lanes);
+private:
+	T* const ptr = nullptr;
+public:
+#ifdef _DEBUG
+	int32_t size = 0;
+#endif
+
+	constexpr tagged_interleaved_view(T* p, int32_t s) noexcept : ptr(p)
+#ifdef _DEBUG
+		, size(s)
+#endif
+	{}
+
+	// index -1 (the null tag) maps to the last lane of the padding block in front of ptr
+	static constexpr int32_t physical_index(int32_t i) noexcept {
+		return ((i & ~(lanes - 1)) / lanes) * block_stride + (i & (lanes - 1));
+	}
+
+	T& operator[](index_type i) const noexcept {
+		return ptr[physical_index(to_index(i))];
+	}
+	T* data() const noexcept {
+		return ptr;
+	}
+	explicit operator bool() const noexcept {
+		return ptr != nullptr;
+	}
+	constexpr operator tagged_interleaved_view<const T, index_type, lanes, block_stride>() const noexcept {
+		return tagged_interleaved_view<const T, index_type, lanes, block_stride>(ptr,
+#ifdef _DEBUG
+			size
+#else
+			0
+#endif
+			);
+	}
+};
+
 template<typename index_type>
 void bit_vector_set(tagged_array_view<bitfield_type, index_type> v, index_type index, bool value) {
 	bit_vector_set(v.data(), to_index(index), value);
@@ -572,6 +721,12 @@ struct supports_index {
 	using const_row = tagged_array_view<const int32_t, int32_t>;
 };
 
+// what get_row<index>() returns for a generated container: a tagged_array_view, or a tagged_interleaved_view for grouped columns
+template<typename container, typename index>
+using row_type = typename supports_index<container, index>::row;
+template<typename container, typename index>
+using const_row_type = typename supports_index<container, index>::const_row;
+
 #define GET_SET(container_name) \
 template<typename INDEX, typename tag_type> \
 RELEASE_INLINE auto get(tag_type t) noexcept -> std::enable_if_t<decltype(container_name)::supports_index<INDEX>, decltype(container_name)::get_type<INDEX>> { \
@@ -0,0 +1,238 @@
+#include "access_profiling.h"
+
+#ifdef CONTAINER_ACCESS_PROFILING
+
+#include <mutex>
+#include <string>
+#include <algorithm>
+#include <cstring>
+#include <Windows.h>
+
+#undef min
+#undef max
+
+namespace access_profiling {
+	thread_local int32_t local_phase = -1;
+	std::atomic<int32_t> global_phase = 0;
+
+	namespace {
+		struct profile_registry {
+			std::mutex lock;
+			std::vector<container_profile*> profiles;
+			char const* phase_names[max_phases] = { "(no phase)" };
+			int32_t phase_count = 1;
+		};
+
+		// function local so that containers with static storage duration can register during static initialization
+		profile_registry& get_registry() {
+			static profile_registry registry;
+			return registry;
+		}
+
+		constexpr float group_affinity_threshold = 0.75f;
+	}
+
+	container_profile::container_profile(char const* n, std::initializer_list<char const*> names, std::initializer_list<char const*> types, std::initializer_list<size_t> sizes) :
+		name(n), column_names(names), column_types(types), column_sizes(sizes),
+		counters(std::make_unique<column_counters[]>(size_t(max_phases) * names.size())) {
+
+		auto& registry = get_registry();
+		std::lock_guard<std::mutex> guard(registry.lock);
+		registry.profiles.push_back(this);
+	}
+
+	int32_t phase_id(char const* phase_name) {
+		if(!phase_name)
+			return 0;
+
+		auto& registry = get_registry();
+		std::lock_guard<std::mutex> guard(registry.lock);
+		for(int32_t i = 1; i < registry.phase_count; ++i) {
+			if(std::strcmp(registry.phase_names[i], phase_name) == 0)
+				return i;
+		}
+		if(registry.phase_count == max_phases)
+			return 0;
+		registry.phase_names[registry.phase_count] = phase_name;
+		return registry.phase_count++;
+	}
+
+	void set_phase(char const* phase_name) {
+		auto const id = phase_id(phase_name);
+		local_phase = id;
+		global_phase.store(id, std::memory_order_relaxed);
+	}
+
+	void reset() {
+		auto& registry = get_registry();
+		std::lock_guard<std::mutex> guard(registry.lock);
+		for(auto p : registry.profiles) {
+			for(int32_t i = max_phases * p->column_count(); i-- > 0; ) {
+				for(auto& a : p->counters[i].accesses)
+					a.store(0ui64, std::memory_order_relaxed);
+				p->counters[i].bytes.store(0ui64, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	namespace {
+		uint64_t bytes_in(container_profile const& p, int32_t phase, int32_t column) {
+			return p.counters[phase * p.column_count() + column].bytes.load(std::memory_order_relaxed);
+		}
+
+		// bytes moved by both columns within the same phases: the sum over phases of the smaller of the two
+		uint64_t co_access(container_profile const& p, int32_t phase_count, int32_t a, int32_t b) {
+			uint64_t total = 0;
+			for(int32_t ph = 0; ph < phase_count; ++ph)
+				total += std::min(bytes_in(p, ph, a), bytes_in(p, ph, b));
+			return total;
+		}
+
+		float affinity(std::vector<uint64_t> const& co, std::vector<uint64_t> const& totals, int32_t a, int32_t b) {
+			auto const larger = std::max(totals[a], totals[b]);
+			return larger != 0 ? float(double(co[a * totals.size() + b]) / double(larger)) : 0.0f;
+		}
+
+		// complete-linkage clustering: two columns share a group only if every pair in the merged group
+		// moves mostly the same bytes in the same phases. Only power of two sized, non bitfield columns
+		// that were accessed at all are candidates, as required by container_generator groups
+		std::vector<std::vector<int32_t>> propose_groups(container_profile const& p, std::vector<uint64_t> const& co, std::vector<uint64_t> const& totals) {
+			int32_t const count = p.column_count();
+			std::vector<int32_t> cluster_of(count, -1);
+			std::vector<std::vector<int32_t>> clusters;
+
+			for(int32_t i = 0; i < count; ++i) {
+				auto const sz = p.column_sizes[i];
+				if(totals[i] != 0 && (sz == 1 || sz == 2 || sz == 4 || sz == 8)) {
+					cluster_of[i] = int32_t(clusters.size());
+					clusters.push_back(std::vector<int32_t>{ i });
+				}
+			}
+
+			std::vector<std::pair<int32_t, int32_t>> pairs;
+			for(int32_t a = 0; a < count; ++a) {
+				for(int32_t b = a + 1; b < count; ++b) {
+					if(cluster_of[a] != -1 && cluster_of[b] != -1 && affinity(co, totals, a, b) >= group_affinity_threshold)
+						pairs.emplace_back(a, b);
+				}
+			}
+			std::sort(pairs.begin(), pairs.end(), [&](std::pair<int32_t, int32_t> const& x, std::pair<int32_t, int32_t> const& y) {
+				return affinity(co, totals, x.first, x.second) > affinity(co, totals, y.first, y.second);
+			});
+
+			for(auto const& pr : pairs) {
+				auto const ca = cluster_of[pr.first];
+				auto const cb = cluster_of[pr.second];
+				if(ca == cb)
+					continue;
+
+				bool all_close = true;
+				for(auto x : clusters[ca]) {
+					for(auto y : clusters[cb])
+						all_close = all_close && affinity(co, totals, x, y) >= group_affinity_threshold;
+				}
+				if(all_close) {
+					for(auto y : clusters[cb]) {
+						cluster_of[y] = ca;
+						clusters[ca].push_back(y);
+					}
+					clusters[cb].clear();
+				}
+			}
+
+			std::vector<std::vector<int32_t>> result;
+			for(auto& c : clusters) {
+				if(c.size() > 1) {
+					// largest members first so that the block has no internal padding
+					std::stable_sort(c.begin(), c.end(), [&p](int32_t x, int32_t y) { return p.column_sizes[x] > p.column_sizes[y]; });
+					result.push_back(std::move(c));
+				}
+			}
+			return result;
+		}
+
+		void write_profile(std::string& out, container_profile const& p, char const* const* phase_names, int32_t phase_count) {
+			int32_t const count = p.column_count();
+
+			out += "container ";
+			out += p.name;
+			out += "\r\n\r\nphase, column, get, set, get_row, bytes\r\n";
+
+			std::vector<uint64_t> totals(count, 0ui64);
+			for(int32_t ph = 0; ph < phase_count; ++ph) {
+				for(int32_t c = 0; c < count; ++c) {
+					auto const& counters = p.counters[ph * count + c];
+					auto const bytes = counters.bytes.load(std::memory_order_relaxed);
+					totals[c] += bytes;
+					if(counters.accesses[0].load(std::memory_order_relaxed) == 0 && counters.accesses[1].load(std::memory_order_relaxed) == 0 && counters.accesses[2].load(std::memory_order_relaxed) == 0)
+						continue;
+
+					out += phase_names[ph];
+					out += ", ";
+					out += p.column_names[c];
+					for(auto& a : counters.accesses) {
+						out += ", ";
+						out += std::to_string(a.load(std::memory_order_relaxed));
+					}
+					out += ", " + std::to_string(bytes) + "\r\n";
+				}
+			}
+
+			out += "\r\ncolumn, type, total bytes\r\n";
+			for(int32_t c = 0; c < count; ++c)
+				out += std::string(p.column_names[c]) + ", " + p.column_types[c] + ", " + std::to_string(totals[c]) + "\r\n";
+
+			std::vector<uint64_t> co(size_t(count) * size_t(count), 0ui64);
+			for(int32_t a = 0; a < count; ++a) {
+				for(int32_t b = a; b < count; ++b) {
+					co[a * count + b] = co_access(p, phase_count, a, b);
+					co[b * count + a] = co[a * count + b];
+				}
+			}
+
+			out += "\r\nco-access bytes";
+			for(int32_t c = 0; c < count; ++c)
+				out += std::string(", ") + p.column_names[c];
+			out += "\r\n";
+			for(int32_t a = 0; a < count; ++a) {
+				out += p.column_names[a];
+				for(int32_t b = 0; b < count; ++b)
+					out += ", " + std::to_string(co[a * count + b]);
+				out += "\r\n";
+			}
+
+			out += "\r\ncold columns:";
+			for(int32_t c = 0; c < count; ++c) {
+				if(totals[c] == 0)
+					out += std::string(" ") + p.column_names[c];
+			}
+			out += "\r\n\r\nproposed groups:\r\n";
+			for(auto const& g : propose_groups(p, co, totals)) {
+				out += "group {\r\n";
+				for(auto c : g)
+					out += std::string("\t") + p.column_names[c] + ", " + p.column_types[c] + "\r\n";
+				out += "}\r\n";
+			}
+			out += "\r\n";
+		}
+	}
+
+	void write_report(char const* file_name) {
+		auto& registry = get_registry();
+		std::string out;
+		{
+			std::lock_guard<std::mutex> guard(registry.lock);
+			for(auto p : registry.profiles)
+				write_profile(out, *p, registry.phase_names, registry.phase_count);
+		}
+
+		const auto handle = CreateFileA(file_name, GENERIC_WRITE | GENERIC_READ, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if(handle != INVALID_HANDLE_VALUE) {
+			DWORD written;
+			WriteFile(handle, out.c_str(), DWORD(out.length()), &written, nullptr);
+			CloseHandle(handle);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,77 @@
+#pragma once
+#include <stdint.h>
+
+// Column access instrumentation for the generated containers.
+// Build with CONTAINER_ACCESS_PROFILING defined to count get / set / get_row calls per column and
+// per update phase; without it (all standard configurations) every hook below expands to nothing.
+
+#ifdef CONTAINER_ACCESS_PROFILING
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <initializer_list>
+
+namespace access_profiling {
+	constexpr int32_t max_phases = 64;
+
+	enum class access_kind : int32_t {
+		get = 0,
+		set = 1,
+		get_row = 2,
+		count = 3
+	};
+
+	struct column_counters {
+		std::atomic<uint64_t> accesses[int32_t(access_kind::count)] = {};
+		std::atomic<uint64_t> bytes = 0;
+	};
+
+	// the phase of the current thread; threads that never set one (for example parallel_for workers)
+	// fall back to the last phase set from any thread
+	extern thread_local int32_t local_phase;
+	extern std::atomic<int32_t> global_phase;
+
+	inline int32_t current_phase() noexcept {
+		return local_phase >= 0 ? local_phase : global_phase.load(std::memory_order_relaxed);
+	}
+
+	class container_profile {
+	public:
+		char const* const name;
+		std::vector<char const*> const column_names;
+		std::vector<char const*> const column_types;
+		std::vector<size_t> const column_sizes; // 0 for bitfields
+		std::unique_ptr<column_counters[]> counters; // [phase * column_count + column]
+
+		container_profile(char const* n, std::initializer_list<char const*> names, std::initializer_list<char const*> types, std::initializer_list<size_t> sizes);
+
+		int32_t column_count() const noexcept { return int32_t(column_names.size()); }
+
+		void record(int32_t column, access_kind kind, uint64_t bytes) noexcept {
+			auto& c = counters[current_phase() * column_count() + column];
+			c.accesses[int32_t(kind)].fetch_add(1ui64, std::memory_order_relaxed);
+			c.bytes.fetch_add(bytes, std::memory_order_relaxed);
+		}
+	};
+
+	int32_t phase_id(char const* phase_name); // phase 0 is unnamed; returns 0 once max_phases is exhausted
+	void set_phase(char const* phase_name); // nullptr returns to the unnamed phase
+	void reset();
+
+	// writes, per container: access counts and bytes per column and phase, total bytes per column,
+	// the co-access matrix, cold columns and proposed column groups (in container description syntax)
+	void write_report(char const* file_name);
+}
+
+#define CONTAINER_ACCESS_RECORD(profile, column, kind, bytes) profile.record(column, access_profiling::access_kind::kind, uint64_t(bytes))
+#define CONTAINER_ACCESS_PHASE(phase_name) access_profiling::set_phase(phase_name)
+#define CONTAINER_ACCESS_REPORT(file_name) access_profiling::write_report(file_name)
+
+#else
+
+#define CONTAINER_ACCESS_RECORD(profile, column, kind, bytes)
+#define CONTAINER_ACCESS_PHASE(phase_name)
+#define CONTAINER_ACCESS_REPORT(file_name)
+
+#endif
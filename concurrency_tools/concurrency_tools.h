@@ -34,6 +34,9 @@ public:
 	}
 	jsf_prng& operator=(jsf_prng const&) noexcept = default;
 	jsf_prng& operator=(jsf_prng&&) noexcept = default;
+
+	bool operator==(jsf_prng const& o) const noexcept { return a == o.a && b == o.b && c == o.c && d == o.d; }
+	bool operator!=(jsf_prng const& o) const noexcept { return !(*this == o); }
 };
 
 jsf_prng& get_local_generator();
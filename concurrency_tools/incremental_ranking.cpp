@@ -0,0 +1,81 @@
+#include "incremental_ranking.h"
+#include <algorithm>
+
+namespace {
+	constexpr int32_t full_sort_fraction = 4; // a full sort is used once more than 1 / full_sort_fraction of the keys changed
+}
+
+bool incremental_ranking::before(int32_t a, int32_t b) const {
+	auto const& ka = keys[a];
+	auto const& kb = keys[b];
+	if(ka.group != kb.group)
+		return ka.group < kb.group;
+	if(ka.score != kb.score)
+		return ka.score > kb.score;
+	return a < b;
+}
+
+void incremental_ranking::set(int32_t item, ranking_key k) {
+	if(item >= int32_t(keys.size())) {
+		keys.resize(size_t(item + 1));
+		rank_of.resize(size_t(item + 1), -1);
+		seen.resize(size_t(item + 1), uint8_t(0));
+	}
+
+	seen[item] = uint8_t(1);
+	if(rank_of[item] == -1) {
+		keys[item] = k;
+		order.push_back(item);
+		++changed_keys;
+	} else if(keys[item] != k) {
+		keys[item] = k;
+		++changed_keys;
+	}
+}
+
+bool incremental_ranking::update() {
+	changes.clear();
+
+	auto const removed_from = std::stable_partition(order.begin(), order.end(), [this](int32_t i) { return seen[i] != 0; });
+	bool const any_removed = removed_from != order.end();
+	for(auto it = removed_from; it != order.end(); ++it) {
+		changes.push_back(rank_change{ *it, rank_of[*it], -1 });
+		rank_of[*it] = -1;
+	}
+	order.erase(removed_from, order.end());
+
+	if(changed_keys != 0 || any_removed) {
+		if(changed_keys * full_sort_fraction > int32_t(order.size())) {
+			std::sort(order.begin(), order.end(), [this](int32_t a, int32_t b) { return before(a, b); });
+		} else {
+			for(size_t i = 1; i < order.size(); ++i) {
+				auto const item = order[i];
+				size_t j = i;
+				for(; j > 0 && before(item, order[j - 1]); --j)
+					order[j] = order[j - 1];
+				order[j] = item;
+			}
+		}
+
+		for(int32_t r = 0; r < int32_t(order.size()); ++r) {
+			auto const item = order[r];
+			if(rank_of[item] != r) {
+				changes.push_back(rank_change{ item, rank_of[item], r });
+				rank_of[item] = r;
+			}
+		}
+	}
+
+	std::fill(seen.begin(), seen.end(), uint8_t(0));
+	changed_keys = 0;
+
+	if(changes.size() != 0)
+		++generation_count;
+	return changes.size() != 0;
+}
+
+bool incremental_ranking::boundary_moved(int32_t count) const {
+	return std::any_of(changes.begin(), changes.end(), [count](rank_change const& c) {
+		return (c.old_rank != -1 && c.old_rank < count) != (c.new_rank != -1 && c.new_rank < count);
+	});
+}
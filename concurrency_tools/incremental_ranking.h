@@ -0,0 +1,52 @@
+#pragma once
+#include <stdint.h>
+#include <vector>
+
+// Ranking of items (small integer ids) that is kept in order between updates.
+// Items are ordered by group (ascending), then by score (descending), then by id. Between two calls to update
+// every present item is given its current key with set; items that were not set are dropped from the ranking.
+// When no key changed update does nothing; when only a few did the previous order is repaired by insertion,
+// which costs a single pass plus the distance the changed items moved, and only ranks that moved are reported.
+
+struct ranking_key {
+	int32_t group = 0; // lower groups rank first, regardless of score
+	float score = 0.0f;
+
+	bool operator==(ranking_key const& o) const { return group == o.group && score == o.score; }
+	bool operator!=(ranking_key const& o) const { return !(*this == o); }
+};
+
+struct rank_change {
+	int32_t item = 0;
+	int32_t old_rank = -1; // -1 for an item that was not ranked before
+	int32_t new_rank = -1; // -1 for an item that was dropped
+};
+
+class incremental_ranking {
+private:
+	std::vector<int32_t> order;
+	std::vector<int32_t> rank_of; // -1 when not ranked
+	std::vector<ranking_key> keys;
+	std::vector<uint8_t> seen;
+	std::vector<rank_change> changes;
+	int32_t changed_keys = 0;
+	uint32_t generation_count = 0;
+
+	bool before(int32_t a, int32_t b) const;
+public:
+	void set(int32_t item, ranking_key k);
+
+	// repairs the order; returns true if any rank changed, in which case the changes are listed by changed()
+	bool update();
+
+	int32_t size() const { return int32_t(order.size()); }
+	int32_t rank(int32_t item) const { return item < int32_t(rank_of.size()) ? rank_of[item] : -1; } // 0 based
+	int32_t at(int32_t rank) const { return order[rank]; }
+	std::vector<int32_t> const& ordered_items() const { return order; }
+
+	std::vector<rank_change> const& changed() const { return changes; } // from the last update
+	uint32_t generation() const { return generation_count; } // the number of updates that changed any rank
+
+	// true if the last update moved an item across the boundary between the first count ranks and the rest
+	bool boundary_moved(int32_t count) const;
+};
@@ -0,0 +1,133 @@
+#pragma once
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+#include "common\\common.h"
+
+// Sorted order of a set of items (anything to_index accepts) that is kept between refreshes.
+// assign replaces the set: items that were in the sorted part of the previous order keep their relative order,
+// everything else follows them unordered. sort_prefix then only has to make the first count rows correct. With a
+// previous order available that order is repaired by insertion, which costs a single pass plus the distance the
+// changed items moved (falling back to a full sort if too many moved); without one the rows are selected with
+// nth_element and only the requested ones are sorted, so asking for the next page later continues from there.
+// reset drops the previous order, which must be done whenever the comparison changes.
+
+template<typename T>
+class sorted_view {
+private:
+	std::vector<T> order;
+	std::vector<uint8_t> marks; // by to_index, only non zero inside assign
+	uint32_t kept = 0; // leading rows that are in the order of the last sort, although their keys may have changed
+	uint32_t sorted = 0; // leading rows known to be in order
+
+	template<typename LESS>
+	bool repair(uint32_t count, LESS const& less);
+public:
+	static constexpr uint32_t repair_moves_per_row = 8;
+
+	template<typename iterator>
+	void assign(iterator first, iterator last);
+
+	// afterwards the first count rows (or all of them, if there are fewer) are the smallest under less, in order
+	template<typename LESS>
+	void sort_prefix(uint32_t count, LESS const& less);
+	template<typename LESS>
+	void sort(LESS const& less) { sort_prefix(uint32_t(order.size()), less); }
+
+	void reset() { kept = 0; sorted = 0; }
+	void clear() { order.clear(); kept = 0; sorted = 0; }
+
+	uint32_t size() const { return uint32_t(order.size()); }
+	uint32_t sorted_count() const { return sorted; }
+	T const* begin() const { return order.data(); }
+	T const* end() const { return order.data() + order.size(); }
+	T operator[](uint32_t i) const { return order[i]; }
+};
+
+template<typename T>
+template<typename iterator>
+void sorted_view<T>::assign(iterator first, iterator last) {
+	for(auto it = first; it != last; ++it) {
+		const auto i = uint32_t(to_index(*it));
+		if(i >= marks.size())
+			marks.resize(i + 1, 0ui8);
+		marks[i] = 1ui8;
+	}
+
+	uint32_t out = 0;
+	uint32_t out_sorted = 0;
+	const uint32_t old_sorted = std::max(sorted, kept); // kept is only non zero if nothing was sorted since the last assign
+	for(uint32_t i = 0; i < order.size(); ++i) {
+		const auto m = uint32_t(to_index(order[i]));
+		if(m < marks.size() && marks[m] == 1ui8) {
+			marks[m] = 2ui8;
+			order[out++] = order[i];
+			if(i < old_sorted)
+				out_sorted = out;
+		}
+	}
+	order.resize(out);
+
+	for(auto it = first; it != last; ++it) {
+		auto& m = marks[uint32_t(to_index(*it))];
+		if(m == 1ui8) {
+			m = 2ui8;
+			order.push_back(*it);
+		}
+	}
+	for(auto v : order)
+		marks[uint32_t(to_index(v))] = 0ui8;
+
+	kept = out_sorted;
+	sorted = 0;
+}
+
+template<typename T>
+template<typename LESS>
+bool sorted_view<T>::repair(uint32_t count, LESS const& less) {
+	uint64_t budget = uint64_t(count) * repair_moves_per_row + 64ui64;
+	for(uint32_t i = 1; i < count; ++i) {
+		if(!less(order[i], order[i - 1]))
+			continue;
+		const T v = order[i];
+		uint32_t j = i;
+		do {
+			order[j] = order[j - 1];
+			--j;
+			if(--budget == 0) {
+				order[j] = v;
+				return false;
+			}
+		} while(j > 0 && less(v, order[j - 1]));
+		order[j] = v;
+	}
+	return true;
+}
+
+template<typename T>
+template<typename LESS>
+void sorted_view<T>::sort_prefix(uint32_t count, LESS const& less) {
+	count = std::min(count, uint32_t(order.size()));
+	if(sorted >= count)
+		return;
+
+	if(kept != 0) {
+		// the rows carried over are nearly in order: repair them, order just enough of the rest and merge the two
+		if(!repair(kept, less))
+			std::sort(order.begin(), order.begin() + kept, less);
+
+		const uint32_t rest = uint32_t(order.size()) - kept;
+		const uint32_t rest_count = std::min(count, rest);
+		std::nth_element(order.begin() + kept, order.begin() + kept + rest_count, order.end(), less);
+		std::sort(order.begin() + kept, order.begin() + kept + rest_count, less);
+		std::inplace_merge(order.begin(), order.begin() + kept, order.begin() + kept + rest_count, less);
+
+		sorted = rest_count == rest ? uint32_t(order.size()) : count;
+		kept = 0;
+		return;
+	}
+
+	std::nth_element(order.begin() + sorted, order.begin() + count, order.end(), less);
+	std::sort(order.begin() + sorted, order.begin() + count, less);
+	sorted = count;
+}
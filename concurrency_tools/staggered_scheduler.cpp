@@ -0,0 +1,48 @@
+#include "staggered_scheduler.h"
+#include <algorithm>
+
+void staggered_scheduler::begin_tick() {
+	++tick;
+	tick_microseconds = 0.0f;
+}
+
+schedule_slice staggered_scheduler::next_slice(int32_t phase, uint32_t period, uint32_t granularity, uint32_t item_count) {
+	auto& p = phases[phase];
+	p.period = std::max(period, 1ui32);
+	p.granularity = std::max(granularity, 1ui32);
+	p.item_count = item_count;
+
+	p.cursor = std::min(p.cursor, item_count);
+
+	// a finished pass waits for the end of its period before the next one starts
+	uint32_t pass_tick = tick - p.pass_start;
+	if(p.cursor == item_count) {
+		if(pass_tick < p.period)
+			return schedule_slice{};
+		p.last_pass_ticks = pass_tick;
+		p.pass_start = tick;
+		p.cursor = 0;
+		pass_tick = 0;
+	}
+
+	if(item_count == 0)
+		return schedule_slice{};
+
+	// where the pass should be at the end of this tick; an overdue pass is finished now
+	uint64_t const target = pass_tick + 1 >= p.period ? uint64_t(item_count) : (uint64_t(item_count) * (pass_tick + 1) + p.period - 1) / p.period;
+	uint64_t const rounded = ((target + p.granularity - 1) / p.granularity) * p.granularity;
+	if(rounded <= p.cursor)
+		return schedule_slice{};
+
+	schedule_slice result;
+	result.first = p.cursor;
+	result.ticks = p.last_pass_ticks != 0 ? p.last_pass_ticks : p.period;
+	if(rounded >= item_count) {
+		result.last = item_count;
+		result.completes_set = true;
+	} else {
+		result.last = uint32_t(rounded);
+	}
+	p.cursor = result.last;
+	return result;
+}
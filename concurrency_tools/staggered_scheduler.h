@@ -0,0 +1,108 @@
+#pragma once
+#include <stdint.h>
+#include <chrono>
+#include <vector>
+#include "simple_serialize\\simple_serialize.hpp"
+
+// Rolling-window scheduler for amortized update phases.
+// Each phase walks its work set [0, item_count) in contiguous slices, one pass per period ticks. The slices are
+// sized in work units only: after tick k of a pass the pass has covered (k + 1) / period of the set, so a phase that
+// was not run for a few ticks, or whose set grew, catches up within the same period, and a pass that is overdue is
+// finished at once. Which items a tick processes therefore depends only on the tick count and the work set sizes,
+// never on how fast the machine is. The position of every phase is saved with the game.
+// The time the phases take is measured against a per-tick budget; that is only used to defer work outside the
+// simulation (such as refreshing the interface) on ticks that ran over. Slice sizes never depend on measured time, as
+// that would make the simulation depend on the machine it runs on.
+
+struct schedule_slice {
+	uint32_t first = 0;
+	uint32_t last = 0;
+	uint32_t ticks = 0; // ticks since the items of the slice were last processed: the length of the previous pass, or the period before the first
+	bool completes_set = false; // last is the end of the work set: the next pass starts again from 0
+};
+
+class staggered_scheduler {
+public:
+	constexpr static float default_budget_microseconds = 20'000.0f;
+private:
+	struct phase_state {
+		// saved with the game
+		uint32_t cursor = 0;
+		uint32_t pass_start = 1; // tick on which the current pass started; the first tick is 1
+		uint32_t last_pass_ticks = 0; // 0 until a pass has finished
+
+		// refreshed by every next_slice
+		uint32_t period = 1;
+		uint32_t granularity = 1;
+		uint32_t item_count = 0;
+	};
+
+	std::vector<phase_state> phases;
+	uint32_t tick = 0;
+	float budget_microseconds = default_budget_microseconds;
+	float tick_microseconds = 0.0f;
+
+	friend class serialization::serializer<staggered_scheduler>;
+public:
+	staggered_scheduler() {}
+	staggered_scheduler(int32_t phase_count) : phases(size_t(phase_count)) {}
+
+	void set_budget(float microseconds) { budget_microseconds = microseconds; }
+	float budget() const { return budget_microseconds; }
+
+	// advances to the next tick; every phase should then ask for its slice once
+	void begin_tick();
+	// whether the phases measured this tick took longer than the budget
+	bool over_budget() const { return tick_microseconds > budget_microseconds; }
+
+	// the phase's slice for this tick, which may be empty; slices are multiples of granularity, except for the
+	// one that completes the set. A phase whose work set changes size keeps its place, clamped to the new size
+	schedule_slice next_slice(int32_t phase, uint32_t period, uint32_t granularity, uint32_t item_count);
+	// adds time spent on a slice to this tick's total
+	void record_time(float microseconds) { tick_microseconds += microseconds; }
+
+	// calls f(schedule_slice) for the phase's next slice, if not empty, and measures it
+	template<typename F>
+	void run(int32_t phase, uint32_t period, uint32_t granularity, uint32_t item_count, F&& f) {
+		auto const s = next_slice(phase, period, granularity, item_count);
+		if(s.first == s.last)
+			return;
+
+		auto const start = std::chrono::steady_clock::now();
+		f(s);
+		record_time(std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count());
+	}
+};
+
+template<>
+class serialization::serializer<staggered_scheduler> {
+public:
+	static constexpr bool has_static_size = false;
+	static constexpr bool has_simple_serialize = false;
+
+	static void serialize_object(std::byte* &output, staggered_scheduler const& obj) {
+		serialize(output, obj.tick);
+		serialize(output, uint32_t(obj.phases.size()));
+		for(auto& p : obj.phases) {
+			serialize(output, p.cursor);
+			serialize(output, p.pass_start);
+			serialize(output, p.last_pass_ticks);
+		}
+	}
+	static void deserialize_object(std::byte const* &input, staggered_scheduler& obj) {
+		deserialize(input, obj.tick);
+		uint32_t count = 0;
+		deserialize(input, count);
+		for(uint32_t i = 0; i < count; ++i) {
+			staggered_scheduler::phase_state p;
+			deserialize(input, p.cursor);
+			deserialize(input, p.pass_start);
+			deserialize(input, p.last_pass_ticks);
+			if(i < obj.phases.size())
+				obj.phases[i] = p;
+		}
+	}
+	static size_t size(staggered_scheduler const& obj) {
+		return sizeof(uint32_t) * (2 + 3 * obj.phases.size());
+	}
+};
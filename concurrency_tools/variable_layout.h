@@ -53,10 +53,10 @@ namespace variable_layout_detail {
 	template<typename index, typename tag_type, int32_t size, typename index_type, typename member_type, typename ... REST>
 	struct vlayout_traits<index, variable_layout_tagged_vector_impl<tag_type, size, index_type, member_type, REST ...>> {
 		using get_type = std::conditional_t<std::is_same_v<index, index_type>,
-			member_type&,
+			std::conditional_t<is_quantized_type<member_type>, float, member_type&>,
 			typename vlayout_traits<index, variable_layout_tagged_vector_impl<tag_type, size, REST...>>::get_type>;
 		using const_get_type = std::conditional_t<std::is_same_v<index, index_type>,
-			member_type const&,
+			std::conditional_t<is_quantized_type<member_type>, float, member_type const&>,
 			typename vlayout_traits<index, variable_layout_tagged_vector_impl<tag_type, size, REST...>>::const_get_type>;
 		constexpr static bool supports_index = std::is_same_v<index, index_type> || vlayout_traits<index, variable_layout_tagged_vector_impl<tag_type, size, REST...>>::supports_index;
 	};
@@ -67,6 +67,10 @@ namespace variable_layout_detail {
 		template<typename T>
 		using value_type = std::conditional_t<std::is_same_v<T, index_type>, member_type, typename variable_layout_tagged_vector_impl<tag_type, size, REST ...>::template value_type<T>>;
 
+		// quantized members are read and written as float; get returns by value
+		using member_get_type = std::conditional_t<is_quantized_type<member_type>, float, member_type&>;
+		using member_const_get_type = std::conditional_t<is_quantized_type<member_type>, float, member_type const&>;
+
 		constexpr static uint32_t members_count = 
 			sizeof(member_type) <= 64 ? 
 				(uint32_t(size) + (64ui32 / uint32_t(sizeof(member_type))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(member_type)) - 1ui32) :
@@ -94,16 +98,20 @@ namespace variable_layout_detail {
 
 		template<typename T>
 		RELEASE_INLINE static auto get(tag_type i, data const& dat)
-			-> std::conditional_t<std::is_same_v<T, index_type>, member_type const&, decltype(variable_layout_tagged_vector_impl<tag_type, size, REST ...>::template get<T>(i, dat))> {
-			if constexpr(std::is_same_v<T, index_type>)
+			-> std::conditional_t<std::is_same_v<T, index_type>, member_const_get_type, decltype(variable_layout_tagged_vector_impl<tag_type, size, REST ...>::template get<T>(i, dat))> {
+			if constexpr(std::is_same_v<T, index_type> && is_quantized_type<member_type>)
+				return dequantize(dat.values[to_index(i)]);
+			else if constexpr(std::is_same_v<T, index_type>)
 				return dat.values[to_index(i)];
 			else
 				return variable_layout_tagged_vector_impl<tag_type, size, REST ...>::template get<T>(i, dat);
 		}
 		template<typename T>
 		RELEASE_INLINE static auto get(tag_type i, data& dat) 
-			-> std::conditional_t<std::is_same_v<T, index_type>, member_type&, decltype(variable_layout_tagged_vector_impl<tag_type, size, REST ...>::template get<T>(i, dat))> {
-			if constexpr(std::is_same_v<T, index_type>)
+			-> std::conditional_t<std::is_same_v<T, index_type>, member_get_type, decltype(variable_layout_tagged_vector_impl<tag_type, size, REST ...>::template get<T>(i, dat))> {
+			if constexpr(std::is_same_v<T, index_type> && is_quantized_type<member_type>)
+				return dequantize(dat.values[to_index(i)]);
+			else if constexpr(std::is_same_v<T, index_type>)
 				return dat.values[to_index(i)];
 			else
 				return variable_layout_tagged_vector_impl<tag_type, size, REST ...>::template get<T>(i, dat);
@@ -133,7 +141,9 @@ namespace variable_layout_detail {
 		}
 		template<typename U, typename T>
 		RELEASE_INLINE static std::enable_if_t<std::is_trivially_copyable_v<T>> set(tag_type i, data& dat, T val) {
-			if constexpr(std::is_same_v<U, index_type>)
+			if constexpr(std::is_same_v<U, index_type> && is_quantized_type<member_type>)
+				dat.values[to_index(i)] = quantize<member_type>(float(val));
+			else if constexpr(std::is_same_v<U, index_type>)
 				dat.values[to_index(i)] = val;
 			else
 				variable_layout_tagged_vector_impl<tag_type, size, REST ...>::template set<U>(i, dat, val);
@@ -59,14 +59,24 @@ namespace ve {
 	}
 
 	template<typename value_base, typename zero_is_null, typename individuator, typename U>
-	RELEASE_INLINE auto load(tag_type<value_base, zero_is_null, individuator> e, U const* source) -> std::enable_if_t<!std::is_same_v<std::remove_cv_t<U>, bitfield_type>, decay_tag<U>> {
+	RELEASE_INLINE auto load(tag_type<value_base, zero_is_null, individuator> e, U const* source) -> std::enable_if_t<!std::is_same_v<std::remove_cv_t<U>, bitfield_type> && !is_quantized_type<U>, decay_tag<U>> {
 		return source[to_index(e)];
 	}
 
 	template<typename U>
-	RELEASE_INLINE auto load(int32_t e, U const* source) -> std::enable_if_t < !std::is_same_v<std::remove_cv_t<U>, bitfield_type>, decay_tag<U>> {
+	RELEASE_INLINE auto load(int32_t e, U const* source) -> std::enable_if_t < !std::is_same_v<std::remove_cv_t<U>, bitfield_type> && !is_quantized_type<U>, decay_tag<U>> {
 		return source[e];
 	}
+
+	template<typename value_base, typename zero_is_null, typename individuator, typename U>
+	RELEASE_INLINE auto load(tag_type<value_base, zero_is_null, individuator> e, U const* source) -> std::enable_if_t<is_quantized_type<U>, float> {
+		return dequantize(source[to_index(e)]);
+	}
+
+	template<typename U>
+	RELEASE_INLINE auto load(int32_t e, U const* source) -> std::enable_if_t<is_quantized_type<U>, float> {
+		return dequantize(source[e]);
+	}
 	
 	template<typename value_base, typename zero_is_null, typename individuator, typename U>
 	RELEASE_INLINE auto load(tag_type<value_base, zero_is_null, individuator> e,
@@ -105,6 +115,105 @@ namespace ve {
 		dest[e] = value;
 	}
 
+	template<typename value_base, typename zero_is_null, typename individuator, typename U>
+	RELEASE_INLINE auto store(tag_type<value_base, zero_is_null, individuator> e, U* dest, float value) -> std::enable_if_t<is_quantized_type<U>> {
+		dest[to_index(e)] = quantize<U>(value);
+	}
+	template<typename U>
+	RELEASE_INLINE auto store(int32_t e, U* dest, float value) -> std::enable_if_t<is_quantized_type<U>> {
+		dest[e] = quantize<U>(value);
+	}
+
+	// interleaved column groups: an aligned executor offset is a multiple of vector_size, so it maps onto the start of
+	// a single block and stays one vector load / store. An unaligned or partial vector may start inside a block and run
+	// into the next one; it is then gathered, and stored lane by lane
+
+	namespace ve_impl {
+		template<typename view_type>
+		RELEASE_INLINE int_vector interleaved_lanes(uint32_t first, uint32_t count) {
+			int_vector physical;
+			for(uint32_t j = 0; j < uint32_t(vector_size); ++j)
+				physical.set(j, view_type::physical_index(int32_t(first + (j < count ? j : 0ui32))));
+			return physical;
+		}
+		template<typename view_type, typename V>
+		RELEASE_INLINE void store_interleaved_lanes(uint32_t first, uint32_t count, view_type dest, V values) {
+			using U = std::remove_pointer_t<decltype(dest.data())>;
+			for(uint32_t j = 0; j < count; ++j) {
+				if constexpr(is_quantized_type<U>)
+					dest.data()[view_type::physical_index(int32_t(first + j))] = quantize<U>(values[j]);
+				else
+					dest.data()[view_type::physical_index(int32_t(first + j))] = U(values[j]);
+			}
+		}
+	}
+
+	template<typename value_base, typename zero_is_null, typename individuator, typename U, int32_t lanes, int32_t stride>
+	RELEASE_INLINE auto load(tag_type<value_base, zero_is_null, individuator> e,
+		tagged_interleaved_view<U, typename ve_identity<tag_type<value_base, zero_is_null, individuator>>::type, lanes, stride> source) {
+		return ve::load(tagged_interleaved_view<U, tag_type<value_base, zero_is_null, individuator>, lanes, stride>::physical_index(to_index(e)), source.data());
+	}
+	template<typename T, int32_t i, typename U, int32_t lanes, int32_t stride>
+	RELEASE_INLINE auto load(contiguous_tags<typename ve_identity<T>::type, i> e, tagged_interleaved_view<U, T, lanes, stride> source) {
+		static_assert(lanes == vector_size);
+		return ve::load(contiguous_tags<int32_t, i>((e.value / uint32_t(lanes)) * uint32_t(stride)), source.data());
+	}
+	template<typename T, int32_t i, typename U, int32_t lanes, int32_t stride>
+	RELEASE_INLINE auto load(unaligned_contiguous_tags<typename ve_identity<T>::type, i> e, tagged_interleaved_view<U, T, lanes, stride> source) {
+		static_assert(lanes == vector_size);
+		if((e.value & uint32_t(lanes - 1)) == 0)
+			return ve::load(unaligned_contiguous_tags<int32_t, i>((e.value / uint32_t(lanes)) * uint32_t(stride)), source.data());
+		return ve::load(ve_impl::interleaved_lanes<tagged_interleaved_view<U, T, lanes, stride>>(e.value, uint32_t(lanes)), source.data());
+	}
+	template<typename T, typename U, int32_t lanes, int32_t stride>
+	RELEASE_INLINE auto load(partial_contiguous_tags<typename ve_identity<T>::type> e, tagged_interleaved_view<U, T, lanes, stride> source) {
+		static_assert(lanes == vector_size);
+		if((e.value & uint32_t(lanes - 1)) == 0)
+			return ve::load(partial_contiguous_tags<int32_t>((e.value / uint32_t(lanes)) * uint32_t(stride), e.subcount), source.data());
+		return partial_mask(e, ve::load(ve_impl::interleaved_lanes<tagged_interleaved_view<U, T, lanes, stride>>(e.value, e.subcount), source.data()));
+	}
+	template<typename T, typename U, int32_t lanes, int32_t stride>
+	RELEASE_INLINE auto load(tagged_vector<typename ve_identity<T>::type> indices, tagged_interleaved_view<U, T, lanes, stride> source) {
+		int_vector physical;
+		for(uint32_t j = 0; j < uint32_t(vector_size); ++j)
+			physical.set(j, tagged_interleaved_view<U, T, lanes, stride>::physical_index(to_index(indices[j])));
+		return ve::load(physical, source.data());
+	}
+
+	template<typename value_base, typename zero_is_null, typename individuator, typename U, int32_t lanes, int32_t stride, typename V>
+	RELEASE_INLINE void store(tag_type<value_base, zero_is_null, individuator> e,
+		tagged_interleaved_view<U, typename ve_identity<tag_type<value_base, zero_is_null, individuator>>::type, lanes, stride> dest, V value) {
+		ve::store(tagged_interleaved_view<U, tag_type<value_base, zero_is_null, individuator>, lanes, stride>::physical_index(to_index(e)), dest.data(), value);
+	}
+	template<typename T, int32_t i, typename U, int32_t lanes, int32_t stride, typename V>
+	RELEASE_INLINE void store(contiguous_tags<typename ve_identity<T>::type, i> e, tagged_interleaved_view<U, T, lanes, stride> dest, V values) {
+		static_assert(lanes == vector_size);
+		ve::store(contiguous_tags<int32_t, i>((e.value / uint32_t(lanes)) * uint32_t(stride)), dest.data(), values);
+	}
+	template<typename T, int32_t i, typename U, int32_t lanes, int32_t stride, typename V>
+	RELEASE_INLINE void store(unaligned_contiguous_tags<typename ve_identity<T>::type, i> e, tagged_interleaved_view<U, T, lanes, stride> dest, V values) {
+		static_assert(lanes == vector_size);
+		if((e.value & uint32_t(lanes - 1)) == 0)
+			ve::store(unaligned_contiguous_tags<int32_t, i>((e.value / uint32_t(lanes)) * uint32_t(stride)), dest.data(), values);
+		else
+			ve_impl::store_interleaved_lanes(e.value, uint32_t(lanes), dest, values);
+	}
+	template<typename T, typename U, int32_t lanes, int32_t stride, typename V>
+	RELEASE_INLINE void store(partial_contiguous_tags<typename ve_identity<T>::type> e, tagged_interleaved_view<U, T, lanes, stride> dest, V values) {
+		static_assert(lanes == vector_size);
+		if((e.value & uint32_t(lanes - 1)) == 0)
+			ve::store(partial_contiguous_tags<int32_t>((e.value / uint32_t(lanes)) * uint32_t(stride), e.subcount), dest.data(), values);
+		else
+			ve_impl::store_interleaved_lanes(e.value, e.subcount, dest, values);
+	}
+	template<typename T, typename U, int32_t lanes, int32_t stride, typename V>
+	RELEASE_INLINE void store(tagged_vector<typename ve_identity<T>::type> indices, tagged_interleaved_view<U, T, lanes, stride> dest, V values) {
+		int_vector physical;
+		for(uint32_t j = 0; j < uint32_t(vector_size); ++j)
+			physical.set(j, tagged_interleaved_view<U, T, lanes, stride>::physical_index(to_index(indices[j])));
+		ve::store(physical, dest.data(), values);
+	}
+
 	template<typename A, typename B, typename C>
 	struct _has_prefetch : std::false_type {};
 	template<typename A, typename C>
@@ -235,7 +344,7 @@ namespace ve {
 
 	template<typename tag_type, typename F>
 	RELEASE_INLINE void execute_subsequence(uint32_t start, uint32_t end, F&& functor) {
-		const auto count = start - end;
+		const auto count = end - start;
 		const uint32_t full_units = count & ~uint32_t(vector_size - 1);
 		const uint32_t remainder = count - full_units;
 
@@ -338,18 +447,24 @@ namespace ve {
 	}
 
 	struct serial_exact {
+		constexpr static bool parallel = false;
+
 		template<typename tag_type, typename F>
 		RELEASE_INLINE static void execute(uint32_t count, F&& functor) {
 			execute_serial<tag_type>(count, functor);
 		}
 	};
 	struct serial_unaligned {
+		constexpr static bool parallel = false;
+
 		template<typename tag_type, typename F>
 		RELEASE_INLINE static void execute(uint32_t count, F&& functor) {
 			execute_serial_unaligned<tag_type>(count, functor);
 		}
 	};
 	struct serial {
+		constexpr static bool parallel = false;
+
 		template<typename tag_type, typename F>
 		RELEASE_INLINE static void execute(uint32_t count, F&& functor) {
 			assert(count % ve::vector_size == 0);
@@ -357,6 +472,8 @@ namespace ve {
 		}
 	};
 	struct par {
+		constexpr static bool parallel = true;
+
 		template<typename tag_type, typename F>
 		RELEASE_INLINE static void execute(uint32_t count, F&& functor) {
 			assert(count % ve::vector_size == 0);
@@ -364,6 +481,8 @@ namespace ve {
 		}
 	};
 	struct par_exact {
+		constexpr static bool parallel = true;
+
 		template<typename tag_type, typename F>
 		RELEASE_INLINE static void execute(uint32_t count, F&& functor) {
 			execute_parallel_exact<tag_type>(count, functor);
@@ -674,4 +793,401 @@ namespace ve {
 
 		policy::template execute<int32_t>(size, ve_impl::vector_zero_operator(destination.data()));
 	}
+
+	// grouped operations
+	//
+	// Segmented operations work on consecutive runs of an array, described by segment_count + 1 offsets:
+	// segment s covers [starts[s], starts[s + 1]). The parallel policies hand out whole segments, so the
+	// result for a segment does not depend on the policy. Indices are offsets from the data() of the
+	// view they index into.
+
+	constexpr uint32_t scan_partitions = 64ui32;
+	constexpr uint32_t compress_partitions = 64ui32;
+	constexpr uint32_t scatter_partitions = 16ui32;
+	constexpr uint32_t sort_partitions = 16ui32;
+	constexpr uint32_t sort_digits = 256ui32;
+
+	namespace ve_impl {
+		template<typename policy, typename F>
+		RELEASE_INLINE void for_each_segment(uint32_t segment_count, F&& f) {
+			if constexpr(policy::parallel) {
+				concurrency::parallel_for(0ui32, segment_count, [&f](uint32_t s) { f(s); });
+			} else {
+				for(uint32_t s = 0; s < segment_count; ++s)
+					f(s);
+			}
+		}
+
+		template<typename T, int32_t i>
+		RELEASE_INLINE int32_t lane_bits(contiguous_tags<T, i>) { return full_mask; }
+		template<typename T, int32_t i>
+		RELEASE_INLINE int32_t lane_bits(unaligned_contiguous_tags<T, i>) { return full_mask; }
+		template<typename T>
+		RELEASE_INLINE int32_t lane_bits(partial_contiguous_tags<T> e) { return int32_t((1ui32 << e.subcount) - 1ui32); }
+
+		template<typename T, int32_t i>
+		RELEASE_INLINE uint32_t lane_count(contiguous_tags<T, i>) { return uint32_t(vector_size); }
+		template<typename T, int32_t i>
+		RELEASE_INLINE uint32_t lane_count(unaligned_contiguous_tags<T, i>) { return uint32_t(vector_size); }
+		template<typename T>
+		RELEASE_INLINE uint32_t lane_count(partial_contiguous_tags<T> e) { return e.subcount; }
+
+		template<typename U>
+		struct add_into_operator {
+			U* const dest;
+			U const* const added;
+
+			add_into_operator(U* d, U const* a) : dest(d), added(a) {};
+
+			template<typename T>
+			RELEASE_INLINE void operator()(T executor) {
+				store(executor, dest, load(executor, dest) + load(executor, added));
+			}
+		};
+
+		template<typename U>
+		struct add_constant_operator {
+			U* const dest;
+			U const value;
+
+			add_constant_operator(U* d, U v) : dest(d), value(v) {};
+
+			template<typename T>
+			RELEASE_INLINE void operator()(T executor) {
+				store(executor, dest, load(executor, dest) + value_to_vector_type<U>(value));
+			}
+		};
+
+		struct segment_reduce_operator {
+			float const* const values;
+			fp_vector accumulator;
+
+			segment_reduce_operator(float const* v) : values(v) {};
+
+			template<typename T>
+			RELEASE_INLINE void operator()(T executor) {
+				accumulator = accumulator + load(executor, values);
+			}
+		};
+
+		struct segment_gather_reduce_operator {
+			int32_t const* const indices;
+			float const* const values;
+			fp_vector accumulator;
+
+			segment_gather_reduce_operator(int32_t const* i, float const* v) : indices(i), values(v) {};
+
+			template<typename T>
+			RELEASE_INLINE void operator()(T executor) {
+				// the masked off lanes of a partial executor load index 0
+				accumulator = accumulator + select(first_lanes(lane_count(executor)), load(load(executor, indices), values), fp_vector());
+			}
+		};
+
+		template<typename U>
+		struct scan_operator {
+			U const* const values;
+			U* const out;
+			value_to_vector_type<U> carry;
+
+			scan_operator(U const* v, U* o) : values(v), out(o), carry(U(0)) {};
+
+			template<typename T>
+			RELEASE_INLINE void operator()(T executor) {
+				auto const sums = inclusive_prefix_sum(load(executor, values)) + carry;
+				store(executor, out, sums);
+				carry = value_to_vector_type<U>(sums[vector_size - 1]);
+			}
+		};
+
+		template<typename F>
+		struct compress_operator {
+			F& predicate;
+			int32_t* const out;
+			uint32_t count = 0;
+
+			compress_operator(F& p, int32_t* o) : predicate(p), out(o) {};
+
+			template<typename T>
+			RELEASE_INLINE void operator()(T executor) {
+				auto const bits = compress_mask(predicate(executor)) & lane_bits(executor);
+				store(unaligned_contiguous_tags<int32_t>(count), out, compressed_lane_indices(bits) + int_vector(int32_t(executor.value)));
+				count += __popcnt(uint32_t(bits));
+			}
+		};
+
+		template<typename U>
+		struct gather_operator {
+			int32_t const* const indices;
+			U const* const source;
+			U* const dest;
+
+			gather_operator(int32_t const* i, U const* s, U* d) : indices(i), source(s), dest(d) {};
+
+			template<typename T>
+			RELEASE_INLINE void operator()(T executor) {
+				store(executor, dest, load(load(executor, indices), source));
+			}
+		};
+
+		template<typename U>
+		RELEASE_INLINE void scatter_add_lanes(int_vector indices, value_to_vector_type<U> values, U* dest, int32_t bits) {
+			if(bits == full_mask && !has_conflicts(indices)) {
+				auto const sums = load(indices, (U const*)dest) + values;
+				for(int32_t j = 0; j < vector_size; ++j)
+					dest[indices[j]] = sums[j];
+			} else {
+				// lanes sharing a destination: add one lane at a time, in lane order
+				for(int32_t j = 0; j < vector_size; ++j) {
+					if((bits & (1 << j)) != 0)
+						dest[indices[j]] += values[j];
+				}
+			}
+		}
+
+		template<typename U>
+		struct scatter_add_operator {
+			int32_t const* const indices;
+			U const* const values;
+			U* const dest;
+
+			scatter_add_operator(int32_t const* i, U const* v, U* d) : indices(i), values(v), dest(d) {};
+
+			template<typename T>
+			RELEASE_INLINE void operator()(T executor) {
+				scatter_add_lanes<U>(load(executor, indices), load(executor, values), dest, lane_bits(executor));
+			}
+		};
+
+		template<typename U>
+		struct scatter_add_constant_operator {
+			int32_t const* const indices;
+			U const value;
+			U* const dest;
+
+			scatter_add_constant_operator(int32_t const* i, U v, U* d) : indices(i), value(v), dest(d) {};
+
+			template<typename T>
+			RELEASE_INLINE void operator()(T executor) {
+				scatter_add_lanes<U>(load(executor, indices), value_to_vector_type<U>(value), dest, lane_bits(executor));
+			}
+		};
+
+		// each partition adds into its own zeroed copy of the destination; the copies are then added
+		// to the destination in partition order, so the result does not depend on scheduling
+		template<typename U, typename F>
+		void parallel_scatter_add(uint32_t size, uint32_t destination_size, U* dest, F const& make_operator) {
+			std::vector<U> partials(size_t(scatter_partitions) * size_t(destination_size), U(0));
+
+			concurrency::parallel_for(0ui32, scatter_partitions, [&partials, &make_operator, size, destination_size](uint32_t i) {
+				auto const r = generate_partition_range<scatter_partitions, 16ui32>(int32_t(i), int32_t(size));
+				execute_subsequence<int32_t>(r.low, r.high, make_operator(partials.data() + size_t(i) * size_t(destination_size)));
+			});
+			concurrency::parallel_for(0ui32, destination_size, 256ui32, [&partials, dest, destination_size](uint32_t d) {
+				auto const end = std::min(d + 256ui32, destination_size);
+				for(uint32_t i = 0; i < scatter_partitions; ++i)
+					execute_subsequence<int32_t>(d, end, add_into_operator<U>(dest, partials.data() + size_t(i) * size_t(destination_size)));
+			});
+		}
+	}
+
+	// out[s] = sum of values[starts[s]] ... values[starts[s + 1] - 1]
+	template<typename seg_type, typename itype, typename S, typename T, typename policy = serial_exact>
+	auto segmented_reduce(uint32_t segment_count, tagged_array_view<S, seg_type> starts, tagged_array_view<T, itype> values, tagged_array_view<float, seg_type> out, policy p = serial_exact())
+		-> std::enable_if_t<std::is_same_v<std::remove_cv_t<S>, int32_t> && std::is_same_v<std::remove_cv_t<T>, float>, void> {
+
+		ve_impl::for_each_segment<policy>(segment_count, [s_ptr = starts.data(), v_ptr = values.data(), o_ptr = out.data()](uint32_t s) {
+			ve_impl::segment_reduce_operator op(v_ptr);
+			execute_subsequence<int32_t>(uint32_t(s_ptr[s]), uint32_t(s_ptr[s + 1]), op);
+			o_ptr[s] = op.accumulator.reduce();
+		});
+	}
+
+	// out[s] = sum of values[indices[k]] for k in [starts[s], starts[s + 1]); for example the pops listed per province
+	template<typename seg_type, typename itype, typename vtype, typename S, typename I, typename T, typename policy = serial_exact>
+	auto segmented_gather_reduce(uint32_t segment_count, tagged_array_view<S, seg_type> starts, tagged_array_view<I, itype> indices, tagged_array_view<T, vtype> values,
+		tagged_array_view<float, seg_type> out, policy p = serial_exact())
+		-> std::enable_if_t<std::is_same_v<std::remove_cv_t<S>, int32_t> && std::is_same_v<std::remove_cv_t<I>, int32_t> && std::is_same_v<std::remove_cv_t<T>, float>, void> {
+
+		ve_impl::for_each_segment<policy>(segment_count, [s_ptr = starts.data(), i_ptr = indices.data(), v_ptr = values.data(), o_ptr = out.data()](uint32_t s) {
+			ve_impl::segment_gather_reduce_operator op(i_ptr, v_ptr);
+			execute_subsequence<int32_t>(uint32_t(s_ptr[s]), uint32_t(s_ptr[s + 1]), op);
+			o_ptr[s] = op.accumulator.reduce();
+		});
+	}
+
+	// out[i] = values[0] + ... + values[i]; values and out may be the same array. The parallel policies scan
+	// scan_partitions ranges independently and then offset them, so float results can differ from the serial scan
+	// in the last bits (but not between runs)
+	template<typename itype, typename T, typename U, typename policy = serial_exact>
+	auto inclusive_scan(uint32_t size, tagged_array_view<T, itype> values, tagged_array_view<U, itype> out, policy p = serial_exact())
+		-> std::enable_if_t<std::is_same_v<std::remove_cv_t<T>, U> && (std::is_same_v<U, float> || std::is_same_v<U, int32_t>), void> {
+
+		if constexpr(!policy::parallel) {
+			ve_impl::scan_operator<U> op(values.data(), out.data());
+			execute_subsequence<int32_t>(0ui32, size, op);
+		} else {
+			U offsets[scan_partitions] = {};
+			concurrency::parallel_for(0ui32, scan_partitions, [v_ptr = values.data(), o_ptr = out.data(), size, &offsets](uint32_t i) {
+				auto const r = generate_partition_range<scan_partitions, 16ui32>(int32_t(i), int32_t(size));
+				ve_impl::scan_operator<U> op(v_ptr, o_ptr);
+				execute_subsequence<int32_t>(r.low, r.high, op);
+				offsets[i] = r.high != r.low ? o_ptr[r.high - 1] : U(0);
+			});
+
+			U running = U(0);
+			for(uint32_t i = 0; i < scan_partitions; ++i) {
+				auto const partition_total = offsets[i];
+				offsets[i] = running;
+				running += partition_total;
+			}
+
+			concurrency::parallel_for(1ui32, scan_partitions, [o_ptr = out.data(), size, &offsets](uint32_t i) {
+				auto const r = generate_partition_range<scan_partitions, 16ui32>(int32_t(i), int32_t(size));
+				execute_subsequence<int32_t>(r.low, r.high, ve_impl::add_constant_operator<U>(o_ptr, offsets[i]));
+			});
+		}
+	}
+
+	// an inclusive scan restarted at the start of every segment
+	template<typename seg_type, typename itype, typename S, typename T, typename U, typename policy = serial_exact>
+	auto segmented_inclusive_scan(uint32_t segment_count, tagged_array_view<S, seg_type> starts, tagged_array_view<T, itype> values, tagged_array_view<U, itype> out, policy p = serial_exact())
+		-> std::enable_if_t<std::is_same_v<std::remove_cv_t<S>, int32_t> && std::is_same_v<std::remove_cv_t<T>, U> && (std::is_same_v<U, float> || std::is_same_v<U, int32_t>), void> {
+
+		ve_impl::for_each_segment<policy>(segment_count, [s_ptr = starts.data(), v_ptr = values.data(), o_ptr = out.data()](uint32_t s) {
+			ve_impl::scan_operator<U> op(v_ptr, o_ptr);
+			execute_subsequence<int32_t>(uint32_t(s_ptr[s]), uint32_t(s_ptr[s + 1]), op);
+		});
+	}
+
+	// writes, in ascending order, the offsets i < size for which predicate(executor) (a mask_vector) is set,
+	// and returns how many were written. out must have room for to_vector_size(size) values, as whole vectors
+	// are stored. Under the parallel policies the predicate is called concurrently; the output is the same
+	template<typename F, typename policy = serial_exact>
+	uint32_t compress_to_indices(uint32_t size, F&& predicate, tagged_array_view<int32_t, int32_t> out, policy p = serial_exact()) {
+		if constexpr(!policy::parallel) {
+			ve_impl::compress_operator<std::remove_reference_t<F>> op(predicate, out.data());
+			execute_subsequence<int32_t>(0ui32, size, op);
+			return op.count;
+		} else {
+			// each partition compacts into the start of its own range, which is then moved down in order
+			uint32_t counts[compress_partitions] = {};
+			concurrency::parallel_for(0ui32, compress_partitions, [&predicate, o_ptr = out.data(), size, &counts](uint32_t i) {
+				auto const r = generate_partition_range<compress_partitions, 16ui32>(int32_t(i), int32_t(size));
+				ve_impl::compress_operator<std::remove_reference_t<F>> op(predicate, o_ptr + r.low);
+				execute_subsequence<int32_t>(r.low, r.high, op);
+				counts[i] = op.count;
+			});
+
+			uint32_t total = counts[0];
+			for(uint32_t i = 1; i < compress_partitions; ++i) {
+				auto const r = generate_partition_range<compress_partitions, 16ui32>(int32_t(i), int32_t(size));
+				if(counts[i] != 0 && total != r.low)
+					std::memmove(out.data() + total, out.data() + r.low, counts[i] * sizeof(int32_t));
+				total += counts[i];
+			}
+			return total;
+		}
+	}
+
+	// destination[i] = source[indices[i]]
+	template<typename itype, typename stype, typename I, typename T, typename U, typename policy = serial_exact>
+	auto gather(uint32_t size, tagged_array_view<I, itype> indices, tagged_array_view<T, stype> source, tagged_array_view<U, itype> destination, policy p = serial_exact())
+		-> std::enable_if_t<std::is_same_v<std::remove_cv_t<I>, int32_t> && std::is_same_v<std::remove_cv_t<T>, U> && (std::is_same_v<U, float> || std::is_same_v<U, int32_t>), void> {
+
+		policy::template execute<int32_t>(size, ve_impl::gather_operator<U>(indices.data(), source.data(), destination.data()));
+	}
+
+	// destination[indices[i]] += values[i]; repeated indices (also within one vector) all contribute.
+	// destination_size bounds the indices and sizes the per partition copies made by the parallel policies
+	template<typename itype, typename dtype, typename I, typename T, typename U, typename policy = serial_exact>
+	auto scatter_add(uint32_t size, tagged_array_view<I, itype> indices, tagged_array_view<T, itype> values, uint32_t destination_size, tagged_array_view<U, dtype> destination, policy p = serial_exact())
+		-> std::enable_if_t<std::is_same_v<std::remove_cv_t<I>, int32_t> && std::is_same_v<std::remove_cv_t<T>, U> && (std::is_same_v<U, float> || std::is_same_v<U, int32_t>), void> {
+
+		if constexpr(!policy::parallel) {
+			execute_subsequence<int32_t>(0ui32, size, ve_impl::scatter_add_operator<U>(indices.data(), values.data(), destination.data()));
+		} else {
+			ve_impl::parallel_scatter_add(size, destination_size, destination.data(), [i_ptr = indices.data(), v_ptr = values.data()](U* d) {
+				return ve::ve_impl::scatter_add_operator<U>(i_ptr, v_ptr, d);
+			});
+		}
+	}
+
+	// counts[bins[i]] += 1
+	template<typename itype, typename btype, typename I, typename policy = serial_exact>
+	auto histogram(uint32_t size, tagged_array_view<I, itype> bins, uint32_t bin_count, tagged_array_view<int32_t, btype> counts, policy p = serial_exact())
+		-> std::enable_if_t<std::is_same_v<std::remove_cv_t<I>, int32_t>, void> {
+
+		if constexpr(!policy::parallel) {
+			execute_subsequence<int32_t>(0ui32, size, ve_impl::scatter_add_constant_operator<int32_t>(bins.data(), 1, counts.data()));
+		} else {
+			ve_impl::parallel_scatter_add(size, bin_count, counts.data(), [b_ptr = bins.data()](int32_t* d) {
+				return ve::ve_impl::scatter_add_constant_operator<int32_t>(b_ptr, 1, d);
+			});
+		}
+	}
+
+	// totals[bins[i]] += weights[i]
+	template<typename itype, typename btype, typename I, typename T, typename policy = serial_exact>
+	auto weighted_histogram(uint32_t size, tagged_array_view<I, itype> bins, tagged_array_view<T, itype> weights, uint32_t bin_count, tagged_array_view<float, btype> totals, policy p = serial_exact())
+		-> std::enable_if_t<std::is_same_v<std::remove_cv_t<I>, int32_t> && std::is_same_v<std::remove_cv_t<T>, float>, void> {
+
+		scatter_add(size, bins, weights, bin_count, totals, p);
+	}
+
+	// stably sorts values by their keys, which are reordered alongside, on the low key_bits bits of the keys, eight
+	// bits per pass. The parallel policies count and then place fixed partitions, each pass visiting the partitions
+	// in order, so the result does not depend on the policy
+	template<typename T, typename policy = serial_exact>
+	void radix_sort_by_key(uint32_t size, uint64_t* keys, T* values, uint32_t key_bits, policy p = serial_exact()) {
+		constexpr uint32_t partitions = policy::parallel ? sort_partitions : 1ui32;
+
+		std::vector<uint64_t> key_buffer(size);
+		std::vector<T> value_buffer(size);
+		std::vector<uint32_t> offsets(size_t(partitions) * size_t(sort_digits));
+
+		uint64_t* from_keys = keys;
+		T* from_values = values;
+		uint64_t* to_keys = key_buffer.data();
+		T* to_values = value_buffer.data();
+
+		for(uint32_t shift = 0; shift < key_bits; shift += 8ui32) {
+			std::fill(offsets.begin(), offsets.end(), 0ui32);
+
+			ve_impl::for_each_segment<policy>(partitions, [&offsets, from_keys, size, shift](uint32_t i) {
+				auto const r = generate_partition_range<partitions, 1ui32>(int32_t(i), int32_t(size));
+				uint32_t* const counts = offsets.data() + i * sort_digits;
+				for(uint32_t k = r.low; k < r.high; ++k)
+					++counts[uint32_t(from_keys[k] >> shift) & (sort_digits - 1ui32)];
+			});
+
+			// digit major, partition minor: equal digits keep their partition order
+			uint32_t running = 0;
+			for(uint32_t d = 0; d < sort_digits; ++d) {
+				for(uint32_t i = 0; i < partitions; ++i) {
+					auto const count = offsets[i * sort_digits + d];
+					offsets[i * sort_digits + d] = running;
+					running += count;
+				}
+			}
+
+			ve_impl::for_each_segment<policy>(partitions, [&offsets, from_keys, from_values, to_keys, to_values, size, shift](uint32_t i) {
+				auto const r = generate_partition_range<partitions, 1ui32>(int32_t(i), int32_t(size));
+				uint32_t* const positions = offsets.data() + i * sort_digits;
+				for(uint32_t k = r.low; k < r.high; ++k) {
+					auto const position = positions[uint32_t(from_keys[k] >> shift) & (sort_digits - 1ui32)]++;
+					to_keys[position] = from_keys[k];
+					to_values[position] = std::move(from_values[k]);
+				}
+			});
+
+			std::swap(from_keys, to_keys);
+			std::swap(from_values, to_values);
+		}
+
+		if(from_keys != keys) {
+			std::copy_n(from_keys, size, keys);
+			std::move(from_values, from_values + size, values);
+		}
+	}
 }
\ No newline at end of file
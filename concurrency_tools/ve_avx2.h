@@ -886,6 +886,62 @@ namespace ve {
 		0x00000000
 	};
 
+	// lanes [0, count) set
+	RELEASE_INLINE mask_vector first_lanes(uint32_t count) {
+		return _mm256_loadu_ps((float const*)(load_masks + 8ui32 - count));
+	}
+
+	// lane i holds v[0] + ... + v[i]
+	RELEASE_INLINE fp_vector inclusive_prefix_sum(fp_vector v) {
+		__m256 x = _mm256_add_ps(v, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(v), 4)));
+		x = _mm256_add_ps(x, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(x), 8)));
+		// each 128 bit half is now scanned; carry the total of the low half into the high half
+		auto const half_totals = _mm256_permute_ps(x, _MM_SHUFFLE(3, 3, 3, 3));
+		return _mm256_add_ps(x, _mm256_permute2f128_ps(half_totals, half_totals, 0x08));
+	}
+	RELEASE_INLINE int_vector inclusive_prefix_sum(int_vector v) {
+		__m256i x = _mm256_add_epi32(v, _mm256_slli_si256(v, 4));
+		x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+		auto const half_totals = _mm256_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+		return _mm256_add_epi32(x, _mm256_permute2x128_si256(half_totals, half_totals, 0x08));
+	}
+
+	namespace ve_impl {
+		// entry b packs, one per nibble, the indices of the set bits of b in ascending order
+		struct compressed_lanes_table {
+			uint32_t values[256];
+
+			constexpr compressed_lanes_table() : values() {
+				for(uint32_t b = 0; b < 256; ++b) {
+					uint32_t count = 0;
+					for(uint32_t j = 0; j < 8; ++j) {
+						if((b & (1ui32 << j)) != 0)
+							values[b] |= j << (4ui32 * count++);
+					}
+				}
+			}
+		};
+		inline constexpr compressed_lanes_table compressed_lanes{};
+	}
+
+	// the indices of the lanes set in a compress_mask result, packed into the first lanes
+	RELEASE_INLINE int_vector compressed_lane_indices(int32_t mask_bits) {
+		auto const packed = _mm256_set1_epi32(int32_t(ve_impl::compressed_lanes.values[mask_bits & full_mask]));
+		return _mm256_and_si256(_mm256_srlv_epi32(packed, _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28)), _mm256_set1_epi32(0x0F));
+	}
+
+	// true if any two lanes hold the same value; rotations by 1 through 4 lanes compare every pair
+	RELEASE_INLINE bool has_conflicts(int_vector v) {
+		auto const r1 = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0));
+		auto const r2 = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(2, 3, 4, 5, 6, 7, 0, 1));
+		auto const r3 = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(3, 4, 5, 6, 7, 0, 1, 2));
+		auto const r4 = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3));
+		auto const equal = _mm256_or_si256(
+			_mm256_or_si256(_mm256_cmpeq_epi32(v, r1), _mm256_cmpeq_epi32(v, r2)),
+			_mm256_or_si256(_mm256_cmpeq_epi32(v, r3), _mm256_cmpeq_epi32(v, r4)));
+		return _mm256_movemask_epi8(equal) != 0;
+	}
+
 	template<typename F>
 	class alignas(__m256i) true_accumulator : public F {
 	private:
@@ -1324,6 +1380,20 @@ namespace ve {
 		_mm256_maskstore_ps(dest + e.value, mask, values);
 	}
 
+	template<int32_t i>
+	RELEASE_INLINE void store(contiguous_tags<int32_t, i> e, int32_t* dest, int_vector values) {
+		assert((intptr_t(dest + e.value) & 31) == 0);
+		return _mm256_store_si256((__m256i*)(dest + e.value), values);
+	}
+	template<int32_t i>
+	RELEASE_INLINE void store(unaligned_contiguous_tags<int32_t, i> e, int32_t* dest, int_vector values) {
+		return _mm256_storeu_si256((__m256i*)(dest + e.value), values);
+	}
+	RELEASE_INLINE void store(partial_contiguous_tags<int32_t> e, int32_t* dest, int_vector values) {
+		int_vector_internal mask = _mm256_loadu_si256((__m256i const*)(load_masks + 8ui32 - e.subcount));
+		_mm256_maskstore_epi32(dest + e.value, mask, values);
+	}
+
 	template<typename T, int32_t i>
 	RELEASE_INLINE void store(contiguous_tags<typename ve_identity<T>::type, i> e, tagged_array_view<float, T> dest, fp_vector values) {
 		ve::store(contiguous_tags<int32_t, i>(e.value), dest.data(), values);
@@ -1336,6 +1406,18 @@ namespace ve {
 	RELEASE_INLINE void store(partial_contiguous_tags<typename ve_identity<T>::type> e, tagged_array_view<float, T> dest, fp_vector values) {
 		ve::store(partial_contiguous_tags<int32_t>(e.value, e.subcount), dest.data(), values);
 	}
+	template<typename T, int32_t i>
+	RELEASE_INLINE void store(contiguous_tags<typename ve_identity<T>::type, i> e, tagged_array_view<int32_t, T> dest, int_vector values) {
+		ve::store(contiguous_tags<int32_t, i>(e.value), dest.data(), values);
+	}
+	template<typename T, int32_t i>
+	RELEASE_INLINE void store(unaligned_contiguous_tags<typename ve_identity<T>::type, i> e, tagged_array_view<int32_t, T> dest, int_vector values) {
+		ve::store(unaligned_contiguous_tags<int32_t, i>(e.value), dest.data(), values);
+	}
+	template<typename T>
+	RELEASE_INLINE void store(partial_contiguous_tags<typename ve_identity<T>::type> e, tagged_array_view<int32_t, T> dest, int_vector values) {
+		ve::store(partial_contiguous_tags<int32_t>(e.value, e.subcount), dest.data(), values);
+	}
 
 	RELEASE_INLINE void store(int_vector indices, float* dest, fp_vector values) {
 		dest[indices[0]] = values[0];
@@ -1351,4 +1433,91 @@ namespace ve {
 	RELEASE_INLINE void store(tagged_vector<typename ve_identity<T>::type> indices, tagged_array_view<float, T> dest, fp_vector values) {
 		ve::store(indices.value, dest.data() - int32_t(T::zero_is_null_t::value), values);
 	}
+
+	// quantized storage: widened to / narrowed from fp_vector on load and store
+
+	template<typename U>
+	RELEASE_INLINE fp_vector widen_quantized(__m128i packed) {
+		if constexpr(std::is_same_v<std::remove_cv_t<U>, half_type>) {
+			return _mm256_cvtph_ps(packed);
+		} else if constexpr(std::is_same_v<std::remove_cv_t<U>, unorm16_type>) {
+			return _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(packed)), _mm256_set1_ps(1.0f / 65535.0f));
+		} else {
+			return _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(packed)), _mm256_set1_ps(std::remove_cv_t<U>::inverse_scale));
+		}
+	}
+	template<typename U>
+	RELEASE_INLINE __m128i narrow_quantized(fp_vector values) {
+		if constexpr(std::is_same_v<U, half_type>) {
+			return _mm256_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT);
+		} else if constexpr(std::is_same_v<U, unorm16_type>) {
+			auto const scaled = _mm256_cvtps_epi32(
+				_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(values, _mm256_set1_ps(65535.0f)), _mm256_setzero_ps()), _mm256_set1_ps(65535.0f)));
+			return _mm_packus_epi32(_mm256_castsi256_si128(scaled), _mm256_extracti128_si256(scaled, 1));
+		} else {
+			auto const scaled = _mm256_cvtps_epi32(
+				_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(values, _mm256_set1_ps(U::scale)), _mm256_set1_ps(-32768.0f)), _mm256_set1_ps(32767.0f)));
+			return _mm_packs_epi32(_mm256_castsi256_si128(scaled), _mm256_extracti128_si256(scaled, 1));
+		}
+	}
+
+	template<int32_t i, typename U>
+	RELEASE_INLINE auto load(contiguous_tags<int32_t, i> e, U const* source) -> std::enable_if_t<is_quantized_type<U>, fp_vector> {
+		return widen_quantized<U>(_mm_loadu_si128((__m128i const*)(source + e.value)));
+	}
+	template<int32_t i, typename U>
+	RELEASE_INLINE auto load(unaligned_contiguous_tags<int32_t, i> e, U const* source) -> std::enable_if_t<is_quantized_type<U>, fp_vector> {
+		return widen_quantized<U>(_mm_loadu_si128((__m128i const*)(source + e.value)));
+	}
+	template<typename U>
+	RELEASE_INLINE auto load(partial_contiguous_tags<int32_t> e, U const* source) -> std::enable_if_t<is_quantized_type<U>, fp_vector> {
+		alignas(16) std::remove_cv_t<U> partial[8];
+		std::copy_n(source + e.value, e.subcount, partial);
+		std::fill(partial + e.subcount, partial + 8, std::remove_cv_t<U>());
+		return widen_quantized<U>(_mm_load_si128((__m128i const*)partial));
+	}
+	template<typename U>
+	RELEASE_INLINE auto load(int_vector indices, U const* source) -> std::enable_if_t<is_quantized_type<U>, fp_vector> {
+		auto const gathered = _mm256_and_si256(_mm256_i32gather_epi32((int32_t const*)source, indices, 2), _mm256_set1_epi32(0xFFFF));
+		return widen_quantized<U>(_mm_packus_epi32(_mm256_castsi256_si128(gathered), _mm256_extracti128_si256(gathered, 1)));
+	}
+
+	template<int32_t i, typename U>
+	RELEASE_INLINE auto store(contiguous_tags<int32_t, i> e, U* dest, fp_vector values) -> std::enable_if_t<is_quantized_type<U>> {
+		_mm_storeu_si128((__m128i*)(dest + e.value), narrow_quantized<U>(values));
+	}
+	template<int32_t i, typename U>
+	RELEASE_INLINE auto store(unaligned_contiguous_tags<int32_t, i> e, U* dest, fp_vector values) -> std::enable_if_t<is_quantized_type<U>> {
+		_mm_storeu_si128((__m128i*)(dest + e.value), narrow_quantized<U>(values));
+	}
+	template<typename U>
+	RELEASE_INLINE auto store(partial_contiguous_tags<int32_t> e, U* dest, fp_vector values) -> std::enable_if_t<is_quantized_type<U>> {
+		alignas(16) U narrowed[8];
+		_mm_store_si128((__m128i*)narrowed, narrow_quantized<U>(values));
+		std::copy_n(narrowed, e.subcount, dest + e.value);
+	}
+	template<typename U>
+	RELEASE_INLINE auto store(int_vector indices, U* dest, fp_vector values) -> std::enable_if_t<is_quantized_type<U>> {
+		alignas(16) U narrowed[8];
+		_mm_store_si128((__m128i*)narrowed, narrow_quantized<U>(values));
+		for(uint32_t j = 0; j < 8ui32; ++j)
+			dest[indices[j]] = narrowed[j];
+	}
+
+	template<typename T, int32_t i, typename U>
+	RELEASE_INLINE auto store(contiguous_tags<typename ve_identity<T>::type, i> e, tagged_array_view<U, T> dest, fp_vector values) -> std::enable_if_t<is_quantized_type<U>> {
+		ve::store(contiguous_tags<int32_t, i>(e.value), dest.data(), values);
+	}
+	template<typename T, int32_t i, typename U>
+	RELEASE_INLINE auto store(unaligned_contiguous_tags<typename ve_identity<T>::type, i> e, tagged_array_view<U, T> dest, fp_vector values) -> std::enable_if_t<is_quantized_type<U>> {
+		ve::store(unaligned_contiguous_tags<int32_t, i>(e.value), dest.data(), values);
+	}
+	template<typename T, typename U>
+	RELEASE_INLINE auto store(partial_contiguous_tags<typename ve_identity<T>::type> e, tagged_array_view<U, T> dest, fp_vector values) -> std::enable_if_t<is_quantized_type<U>> {
+		ve::store(partial_contiguous_tags<int32_t>(e.value, e.subcount), dest.data(), values);
+	}
+	template<typename T, typename U>
+	RELEASE_INLINE auto store(tagged_vector<typename ve_identity<T>::type> indices, tagged_array_view<U, T> dest, fp_vector values) -> std::enable_if_t<is_quantized_type<U>> {
+		ve::store(int_vector(indices.value), dest.data() - int32_t(T::zero_is_null_t::value), values);
+	}
 }
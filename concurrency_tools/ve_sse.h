@@ -813,6 +813,52 @@ namespace ve {
 		0x00000000,
 	};
 
+	// lanes [0, count) set
+	RELEASE_INLINE mask_vector first_lanes(uint32_t count) {
+		return _mm_loadu_ps((float const*)(load_masks + 4ui32 - count));
+	}
+
+	// lane i holds v[0] + ... + v[i]
+	RELEASE_INLINE fp_vector inclusive_prefix_sum(fp_vector v) {
+		__m128 x = _mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 4)));
+		return _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 8)));
+	}
+	RELEASE_INLINE int_vector inclusive_prefix_sum(int_vector v) {
+		__m128i x = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+		return _mm_add_epi32(x, _mm_slli_si128(x, 8));
+	}
+
+	namespace ve_impl {
+		// entry b packs, one per nibble, the indices of the set bits of b in ascending order
+		struct compressed_lanes_table {
+			uint32_t values[16];
+
+			constexpr compressed_lanes_table() : values() {
+				for(uint32_t b = 0; b < 16; ++b) {
+					uint32_t count = 0;
+					for(uint32_t j = 0; j < 4; ++j) {
+						if((b & (1ui32 << j)) != 0)
+							values[b] |= j << (4ui32 * count++);
+					}
+				}
+			}
+		};
+		inline constexpr compressed_lanes_table compressed_lanes{};
+	}
+
+	// the indices of the lanes set in a compress_mask result, packed into the first lanes
+	RELEASE_INLINE int_vector compressed_lane_indices(int32_t mask_bits) {
+		auto const packed = int32_t(ve_impl::compressed_lanes.values[mask_bits & full_mask]);
+		return _mm_and_si128(_mm_setr_epi32(packed, packed >> 4, packed >> 8, packed >> 12), _mm_set1_epi32(0x0F));
+	}
+
+	// true if any two lanes hold the same value; rotations by 1 and 2 lanes compare every pair
+	RELEASE_INLINE bool has_conflicts(int_vector v) {
+		auto const r1 = _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 3, 2, 1));
+		auto const r2 = _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+		return _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi32(v, r1), _mm_cmpeq_epi32(v, r2))) != 0;
+	}
+
 	template<typename F>
 	class alignas(__m128i) true_accumulator : public F {
 	private:
@@ -1276,6 +1322,36 @@ namespace ve {
 		}
 	}
 
+	template<int32_t i>
+	RELEASE_INLINE void store(contiguous_tags<int32_t, i> e, int32_t* dest, int_vector values) {
+		assert((intptr_t(dest + e.value) & 15) == 0);
+		return _mm_store_si128((__m128i*)(dest + e.value), values);
+	}
+	template<int32_t i>
+	RELEASE_INLINE void store(unaligned_contiguous_tags<int32_t, i> e, int32_t* dest, int_vector values) {
+		return _mm_storeu_si128((__m128i*)(dest + e.value), values);
+	}
+	RELEASE_INLINE void store(partial_contiguous_tags<int32_t> e, int32_t* dest, int_vector values) {
+		switch(e.subcount) {
+			default:
+				// fallthrough
+			case 4:
+				dest[e.value + 3] = values[3];
+				// fallthrough
+			case 3:
+				dest[e.value + 2] = values[2];
+				// fallthrough
+			case 2:
+				dest[e.value + 1] = values[1];
+				// fallthrough
+			case 1:
+				dest[e.value + 0] = values[0];
+				// fallthrough
+			case 0:
+				break;
+		}
+	}
+
 	template<typename T, int32_t i>
 	RELEASE_INLINE void store(contiguous_tags<typename ve_identity<T>::type, i> e, tagged_array_view<float, T> dest, fp_vector values) {
 		ve::store(contiguous_tags<int32_t, i>(e.value), dest.data(), values);
@@ -1288,6 +1364,18 @@ namespace ve {
 	RELEASE_INLINE void store(partial_contiguous_tags<typename ve_identity<T>::type> e, tagged_array_view<float, T> dest, fp_vector values) {
 		ve::store(partial_contiguous_tags<int32_t>(e.value, e.subcount), dest.data(), values);
 	}
+	template<typename T, int32_t i>
+	RELEASE_INLINE void store(contiguous_tags<typename ve_identity<T>::type, i> e, tagged_array_view<int32_t, T> dest, int_vector values) {
+		ve::store(contiguous_tags<int32_t, i>(e.value), dest.data(), values);
+	}
+	template<typename T, int32_t i>
+	RELEASE_INLINE void store(unaligned_contiguous_tags<typename ve_identity<T>::type, i> e, tagged_array_view<int32_t, T> dest, int_vector values) {
+		ve::store(unaligned_contiguous_tags<int32_t, i>(e.value), dest.data(), values);
+	}
+	template<typename T>
+	RELEASE_INLINE void store(partial_contiguous_tags<typename ve_identity<T>::type> e, tagged_array_view<int32_t, T> dest, int_vector values) {
+		ve::store(partial_contiguous_tags<int32_t>(e.value, e.subcount), dest.data(), values);
+	}
 
 	RELEASE_INLINE void store(int_vector indices, float* dest, fp_vector values) {
 		dest[indices[0]] = values[0];
@@ -1300,4 +1388,117 @@ namespace ve {
 	RELEASE_INLINE void store(tagged_vector<typename ve_identity<T>::type> indices, tagged_array_view<float, T> dest, fp_vector values) {
 		ve::store(indices.value, dest.data() - int32_t(T::zero_is_null_t::value), values);
 	}
-}
\ No newline at end of file
+
+	// quantized storage: widened to / narrowed from fp_vector on load and store
+	// (half conversion is done in software, rounding to nearest even like vcvtps2ph)
+
+	RELEASE_INLINE __m128 half_bits_to_float(__m128i packed) {
+		auto const h = _mm_cvtepu16_epi32(packed);
+		auto const sign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+		auto const exp_mantissa = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7FFF)), 13);
+		auto const scaled = _mm_castps_si128(_mm_mul_ps(_mm_castsi128_ps(exp_mantissa), _mm_set1_ps(5.192296858534827628530496329220096e+33f)));
+		auto const inf_nan = _mm_and_si128(_mm_cmpgt_epi32(exp_mantissa, _mm_set1_epi32(0x0F7FFFFF)), _mm_set1_epi32(0x7F800000));
+		return _mm_castsi128_ps(_mm_or_si128(_mm_or_si128(scaled, inf_nan), sign));
+	}
+	RELEASE_INLINE __m128i float_to_half_bits(__m128 values) {
+		auto const bits = _mm_castps_si128(values);
+		auto const sign = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+		auto const abs_bits = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+
+		auto const subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(abs_bits), _mm_set1_ps(0.5f))), _mm_set1_epi32(0x3F000000));
+		auto const rebased = _mm_sub_epi32(abs_bits, _mm_set1_epi32(0x38000000));
+		auto const normal = _mm_min_epi32(_mm_set1_epi32(0x7C00),
+			_mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(rebased, _mm_set1_epi32(0x0FFF)), _mm_and_si128(_mm_srli_epi32(rebased, 13), _mm_set1_epi32(1))), 13));
+
+		auto const finite = _mm_blendv_epi8(normal, subnormal, _mm_cmplt_epi32(abs_bits, _mm_set1_epi32(0x38800000)));
+		auto const result = _mm_blendv_epi8(finite, _mm_set1_epi32(0x7E00), _mm_cmpgt_epi32(abs_bits, _mm_set1_epi32(0x7F800000)));
+		return _mm_or_si128(result, sign);
+	}
+
+	template<typename U>
+	RELEASE_INLINE fp_vector widen_quantized(__m128i packed) {
+		if constexpr(std::is_same_v<std::remove_cv_t<U>, half_type>) {
+			return half_bits_to_float(packed);
+		} else if constexpr(std::is_same_v<std::remove_cv_t<U>, unorm16_type>) {
+			return _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu16_epi32(packed)), _mm_set1_ps(1.0f / 65535.0f));
+		} else {
+			return _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(packed)), _mm_set1_ps(std::remove_cv_t<U>::inverse_scale));
+		}
+	}
+	template<typename U>
+	RELEASE_INLINE __m128i narrow_quantized(fp_vector values) {
+		if constexpr(std::is_same_v<U, half_type>) {
+			return _mm_packus_epi32(float_to_half_bits(values), _mm_setzero_si128());
+		} else if constexpr(std::is_same_v<U, unorm16_type>) {
+			auto const scaled = _mm_cvtps_epi32(
+				_mm_min_ps(_mm_max_ps(_mm_mul_ps(values, _mm_set1_ps(65535.0f)), _mm_setzero_ps()), _mm_set1_ps(65535.0f)));
+			return _mm_packus_epi32(scaled, _mm_setzero_si128());
+		} else {
+			auto const scaled = _mm_cvtps_epi32(
+				_mm_min_ps(_mm_max_ps(_mm_mul_ps(values, _mm_set1_ps(U::scale)), _mm_set1_ps(-32768.0f)), _mm_set1_ps(32767.0f)));
+			return _mm_packs_epi32(scaled, _mm_setzero_si128());
+		}
+	}
+
+	template<int32_t i, typename U>
+	RELEASE_INLINE auto load(contiguous_tags<int32_t, i> e, U const* source) -> std::enable_if_t<is_quantized_type<U>, fp_vector> {
+		return widen_quantized<U>(_mm_loadl_epi64((__m128i const*)(source + e.value)));
+	}
+	template<int32_t i, typename U>
+	RELEASE_INLINE auto load(unaligned_contiguous_tags<int32_t, i> e, U const* source) -> std::enable_if_t<is_quantized_type<U>, fp_vector> {
+		return widen_quantized<U>(_mm_loadl_epi64((__m128i const*)(source + e.value)));
+	}
+	template<typename U>
+	RELEASE_INLINE auto load(partial_contiguous_tags<int32_t> e, U const* source) -> std::enable_if_t<is_quantized_type<U>, fp_vector> {
+		alignas(16) std::remove_cv_t<U> partial[8];
+		std::copy_n(source + e.value, e.subcount, partial);
+		std::fill(partial + e.subcount, partial + 8, std::remove_cv_t<U>());
+		return widen_quantized<U>(_mm_load_si128((__m128i const*)partial));
+	}
+	template<typename U>
+	RELEASE_INLINE auto load(int_vector indices, U const* source) -> std::enable_if_t<is_quantized_type<U>, fp_vector> {
+		alignas(16) std::remove_cv_t<U> gathered[8] = {};
+		for(uint32_t j = 0; j < 4ui32; ++j)
+			gathered[j] = source[indices[j]];
+		return widen_quantized<U>(_mm_load_si128((__m128i const*)gathered));
+	}
+
+	template<int32_t i, typename U>
+	RELEASE_INLINE auto store(contiguous_tags<int32_t, i> e, U* dest, fp_vector values) -> std::enable_if_t<is_quantized_type<U>> {
+		_mm_storel_epi64((__m128i*)(dest + e.value), narrow_quantized<U>(values));
+	}
+	template<int32_t i, typename U>
+	RELEASE_INLINE auto store(unaligned_contiguous_tags<int32_t, i> e, U* dest, fp_vector values) -> std::enable_if_t<is_quantized_type<U>> {
+		_mm_storel_epi64((__m128i*)(dest + e.value), narrow_quantized<U>(values));
+	}
+	template<typename U>
+	RELEASE_INLINE auto store(partial_contiguous_tags<int32_t> e, U* dest, fp_vector values) -> std::enable_if_t<is_quantized_type<U>> {
+		alignas(16) U narrowed[8];
+		_mm_store_si128((__m128i*)narrowed, narrow_quantized<U>(values));
+		std::copy_n(narrowed, e.subcount, dest + e.value);
+	}
+	template<typename U>
+	RELEASE_INLINE auto store(int_vector indices, U* dest, fp_vector values) -> std::enable_if_t<is_quantized_type<U>> {
+		alignas(16) U narrowed[8];
+		_mm_store_si128((__m128i*)narrowed, narrow_quantized<U>(values));
+		for(uint32_t j = 0; j < 4ui32; ++j)
+			dest[indices[j]] = narrowed[j];
+	}
+
+	template<typename T, int32_t i, typename U>
+	RELEASE_INLINE auto store(contiguous_tags<typename ve_identity<T>::type, i> e, tagged_array_view<U, T> dest, fp_vector values) -> std::enable_if_t<is_quantized_type<U>> {
+		ve::store(contiguous_tags<int32_t, i>(e.value), dest.data(), values);
+	}
+	template<typename T, int32_t i, typename U>
+	RELEASE_INLINE auto store(unaligned_contiguous_tags<typename ve_identity<T>::type, i> e, tagged_array_view<U, T> dest, fp_vector values) -> std::enable_if_t<is_quantized_type<U>> {
+		ve::store(unaligned_contiguous_tags<int32_t, i>(e.value), dest.data(), values);
+	}
+	template<typename T, typename U>
+	RELEASE_INLINE auto store(partial_contiguous_tags<typename ve_identity<T>::type> e, tagged_array_view<U, T> dest, fp_vector values) -> std::enable_if_t<is_quantized_type<U>> {
+		ve::store(partial_contiguous_tags<int32_t>(e.value, e.subcount), dest.data(), values);
+	}
+	template<typename T, typename U>
+	RELEASE_INLINE auto store(tagged_vector<typename ve_identity<T>::type> indices, tagged_array_view<U, T> dest, fp_vector values) -> std::enable_if_t<is_quantized_type<U>> {
+		ve::store(int_vector(indices.value), dest.data() - int32_t(T::zero_is_null_t::value), values);
+	}
+}
@@ -4,6 +4,9 @@
 #include "concurrency_tools\\concurrency_tools.hpp"
 #include "concurrency_tools\\variable_layout.h"
 #include "concurrency_tools\\ve.h"
+#include "concurrency_tools\\staggered_scheduler.h"
+#include "concurrency_tools\\incremental_ranking.h"
+#include "concurrency_tools\\sorted_view.h"
 
 TEST(concurrency_tools, string_construction) {
 	concurrent_string a;
@@ -1798,6 +1801,34 @@ TEST(concurrency_tools, variable_layout_serialize) {
 	EXPECT_EQ(b, test_vec_b.get_new());
 }
 
+TEST(concurrency_tools, variable_layout_quantized) {
+	variable_layout_tagged_vector<provinces::province_tag, 64, labels::a, unorm16_type, labels::b, float, labels::c, half_type> test_vec;
+	auto va = test_vec.get_new();
+	auto vb = test_vec.get_new();
+
+	EXPECT_EQ(0.0f, test_vec.get<labels::a>(va));
+	EXPECT_EQ(0.0f, test_vec.get<labels::c>(va));
+
+	test_vec.set<labels::a>(va, 1.0f);
+	test_vec.set<labels::a>(vb, 0.25f);
+	test_vec.set<labels::b>(va, 2.5f);
+	test_vec.set<labels::c>(va, -3.5f);
+	test_vec.set<labels::c>(vb, 1024.0f);
+
+	EXPECT_EQ(1.0f, test_vec.get<labels::a>(va));
+	EXPECT_NEAR(0.25f, test_vec.get<labels::a>(vb), 1.0f / 65535.0f);
+	EXPECT_EQ(2.5f, test_vec.get<labels::b>(va));
+	EXPECT_EQ(-3.5f, test_vec.get<labels::c>(va));
+	EXPECT_EQ(1024.0f, test_vec.get<labels::c>(vb));
+
+	auto row = test_vec.get_row<labels::c>();
+	EXPECT_EQ(-3.5f, ve::load(va, row));
+
+	test_vec.release(va);
+	EXPECT_EQ(0.0f, test_vec.get<labels::a>(va));
+	EXPECT_EQ(0.0f, test_vec.get<labels::c>(va));
+}
+
 TEST(concurrency_tools, ve_simple_math) {
 	std::vector<float, aligned_allocator_64<float>> a(16, 0.0f);
 	std::vector<float, aligned_allocator_64<float>> b(16, 0.0f);
@@ -1962,6 +1993,161 @@ TEST(concurrency_tools, ve_partial_load_and_store) {
 	EXPECT_EQ(result[15], 0.0f);
 }
 
+TEST(concurrency_tools, ve_quantized_load_and_store) {
+	std::vector<half_type, aligned_allocator_64<half_type>> h(16);
+	std::vector<unorm16_type, aligned_allocator_64<unorm16_type>> u(16);
+	std::vector<fixed16_type<256>, aligned_allocator_64<fixed16_type<256>>> f(16);
+
+	for(int32_t i = 0; i < 16; ++i) {
+		h[i] = quantize<half_type>(float(i) * 1.5f - 3.0f);
+		u[i] = quantize<unorm16_type>(float(i) / 15.0f);
+		f[i] = quantize<fixed16_type<256>>(float(i) * 0.25f - 2.0f);
+	}
+
+	EXPECT_EQ(0x3C00ui16, quantize<half_type>(1.0f).v);
+	EXPECT_EQ(0xC000ui16, quantize<half_type>(-2.0f).v);
+	EXPECT_EQ(0x7C00ui16, quantize<half_type>(1.0e6f).v);
+	EXPECT_EQ(65504.0f, dequantize(half_type{ 0x7BFFui16 }));
+	EXPECT_EQ(0ui16, quantize<unorm16_type>(-0.5f).v);
+	EXPECT_EQ(65535ui16, quantize<unorm16_type>(1.5f).v);
+	EXPECT_EQ(int16_t(32767), quantize<fixed16_type<256>>(1000.0f).v);
+	EXPECT_EQ(int16_t(-32768), quantize<fixed16_type<256>>(-1000.0f).v);
+
+	auto h_func = [h_vec = h.data()](auto executor) {
+		ve::store(executor, h_vec, ve::load(executor, h_vec) + 1.0f);
+	};
+	auto f_func = [f_vec = f.data()](auto executor) {
+		ve::store(executor, f_vec, ve::load(executor, f_vec) * 2.0f);
+	};
+	auto u_func = [u_vec = u.data()](auto executor) {
+		ve::store(executor, u_vec, ve::load(executor, u_vec) * 0.5f);
+	};
+
+	ve::execute_serial<int32_t>(15, h_func);
+	ve::execute_serial<int32_t>(15, f_func);
+	ve::execute_serial<int32_t>(15, u_func);
+
+	for(int32_t i = 0; i < 15; ++i) {
+		EXPECT_EQ(float(i) * 1.5f - 2.0f, dequantize(h[i]));
+		EXPECT_EQ(float(i) * 0.5f - 4.0f, dequantize(f[i]));
+		EXPECT_NEAR(float(i) / 30.0f, dequantize(u[i]), 1.0f / 65535.0f);
+	}
+	EXPECT_EQ(15.0f * 1.5f - 3.0f, dequantize(h[15]));
+	EXPECT_EQ(15.0f * 0.25f - 2.0f, dequantize(f[15]));
+	EXPECT_EQ(1.0f, dequantize(u[15]));
+
+	auto reversed = ve::int_vector();
+	for(int32_t i = 0; i < int32_t(ve::vector_size); ++i)
+		reversed.set(uint32_t(i), int32_t(ve::vector_size) - 1 - i);
+
+	auto gathered = ve::load(reversed, f.data());
+	for(int32_t i = 0; i < int32_t(ve::vector_size); ++i)
+		EXPECT_EQ(dequantize(f[ve::vector_size - 1 - i]), gathered[uint32_t(i)]);
+
+	ve::store(reversed, h.data(), ve::fp_vector(0.5f));
+	for(int32_t i = 0; i < int32_t(ve::vector_size); ++i)
+		EXPECT_EQ(0.5f, dequantize(h[i]));
+}
+
+struct interleaved_test_block {
+	alignas(sizeof(float) * ve::vector_size) float a[ve::vector_size];
+	alignas(sizeof(int32_t) * ve::vector_size) int32_t b[ve::vector_size];
+	alignas(sizeof(uint16_t) * ve::vector_size) uint16_t c[ve::vector_size];
+};
+using itag = tag_type<uint16_t, std::true_type, struct itag_type>;
+
+TEST(concurrency_tools, ve_interleaved_view_load_and_store) {
+	constexpr int32_t block_count = 4;
+	std::vector<interleaved_test_block, aligned_allocator_64<interleaved_test_block>> blocks(block_count + 1);
+	using a_view = tagged_interleaved_view<float, itag, ve::vector_size, int32_t(sizeof(interleaved_test_block) / sizeof(float))>;
+	using b_view = tagged_interleaved_view<int32_t, itag, ve::vector_size, int32_t(sizeof(interleaved_test_block) / sizeof(int32_t))>;
+	using c_view = tagged_interleaved_view<uint16_t, itag, ve::vector_size, int32_t(sizeof(interleaved_test_block) / sizeof(uint16_t))>;
+
+	a_view a(blocks[1].a, block_count * ve::vector_size);
+	b_view b(blocks[1].b, block_count * ve::vector_size);
+	c_view c(blocks[1].c, block_count * ve::vector_size);
+
+	for(int32_t i = 0; i < block_count * ve::vector_size; ++i) {
+		a[itag(uint16_t(i))] = float(i);
+		b[itag(uint16_t(i))] = i * 2;
+		c[itag(uint16_t(i))] = uint16_t(i * 3);
+	}
+	EXPECT_EQ(float(ve::vector_size + 1), blocks[2].a[1]);
+	EXPECT_EQ((ve::vector_size + 1) * 2, blocks[2].b[1]);
+	EXPECT_EQ(0.0f, a[itag()]);
+	EXPECT_EQ(&blocks[0].a[ve::vector_size - 1], &a[itag()]);
+
+	auto func = [a, b, c](auto executor) {
+		ve::store(executor, a, ve::load(executor, a) + ve::to_float(ve::load(executor, b)) + ve::to_float(ve::load(executor, c)));
+	};
+	ve::execute_serial<itag>(uint32_t(block_count * ve::vector_size - 3), func);
+
+	for(int32_t i = 0; i < block_count * ve::vector_size - 3; ++i)
+		EXPECT_EQ(float(i * 6), a[itag(uint16_t(i))]);
+	for(int32_t i = block_count * ve::vector_size - 3; i < block_count * ve::vector_size; ++i)
+		EXPECT_EQ(float(i), a[itag(uint16_t(i))]);
+
+	ve::int_vector spread;
+	for(int32_t i = 0; i < int32_t(ve::vector_size); ++i)
+		spread.set(uint32_t(i), i * 3 + 1);
+
+	auto gathered = ve::load(ve::tagged_vector<itag>(spread), b);
+	for(int32_t i = 0; i < int32_t(ve::vector_size); ++i)
+		EXPECT_EQ(i * 3 * 2, gathered[uint32_t(i)]);
+
+	ve::store(ve::tagged_vector<itag>(spread), a, ve::fp_vector(-1.0f));
+	for(int32_t i = 0; i < int32_t(ve::vector_size); ++i)
+		EXPECT_EQ(-1.0f, a[itag(uint16_t(i * 3))]);
+	EXPECT_EQ(6.0f, a[itag(uint16_t(1))]);
+}
+
+TEST(concurrency_tools, ve_interleaved_view_misaligned_offsets) {
+	constexpr int32_t block_count = 4;
+	std::vector<interleaved_test_block, aligned_allocator_64<interleaved_test_block>> blocks(block_count + 1);
+	using a_view = tagged_interleaved_view<float, itag, ve::vector_size, int32_t(sizeof(interleaved_test_block) / sizeof(float))>;
+	using b_view = tagged_interleaved_view<int32_t, itag, ve::vector_size, int32_t(sizeof(interleaved_test_block) / sizeof(int32_t))>;
+
+	a_view a(blocks[1].a, block_count * ve::vector_size);
+	b_view b(blocks[1].b, block_count * ve::vector_size);
+
+	for(int32_t i = 0; i < block_count * ve::vector_size; ++i) {
+		a[itag(uint16_t(i))] = float(i);
+		b[itag(uint16_t(i))] = i * 2;
+	}
+
+	// starts inside the first block and runs into the second
+	auto const unaligned = ve::load(ve::unaligned_contiguous_tags<itag>(3ui32), a);
+	for(uint32_t j = 0; j < uint32_t(ve::vector_size); ++j)
+		EXPECT_EQ(float(3 + j), unaligned[j]);
+
+	auto const partial = ve::load(ve::partial_contiguous_tags<itag>(uint32_t(ve::vector_size + 1), 2ui32), b);
+	EXPECT_EQ((ve::vector_size + 1) * 2, partial[0]);
+	EXPECT_EQ((ve::vector_size + 2) * 2, partial[1]);
+	for(uint32_t j = 2; j < uint32_t(ve::vector_size); ++j)
+		EXPECT_EQ(0, partial[j]);
+
+	ve::store(ve::unaligned_contiguous_tags<itag>(1ui32), a, ve::fp_vector(-1.0f));
+	EXPECT_EQ(0.0f, a[itag(uint16_t(0))]);
+	for(int32_t i = 1; i <= ve::vector_size; ++i)
+		EXPECT_EQ(-1.0f, a[itag(uint16_t(i))]);
+	EXPECT_EQ(float(ve::vector_size + 1), a[itag(uint16_t(ve::vector_size + 1))]);
+
+	ve::store(ve::partial_contiguous_tags<itag>(uint32_t(2 * ve::vector_size - 1), 2ui32), b, ve::int_vector(-5));
+	EXPECT_EQ((2 * ve::vector_size - 2) * 2, b[itag(uint16_t(2 * ve::vector_size - 2))]);
+	EXPECT_EQ(-5, b[itag(uint16_t(2 * ve::vector_size - 1))]);
+	EXPECT_EQ(-5, b[itag(uint16_t(2 * ve::vector_size))]);
+	EXPECT_EQ((2 * ve::vector_size + 1) * 2, b[itag(uint16_t(2 * ve::vector_size + 1))]);
+
+	// an executor over a range that does not start on a block boundary
+	ve::execute_subsequence<itag>(5ui32, uint32_t(block_count * ve::vector_size - 1), [a, b](auto executor) {
+		ve::store(executor, a, ve::to_float(ve::load(executor, b)));
+	});
+	for(int32_t i = 5; i < block_count * ve::vector_size - 1; ++i)
+		EXPECT_EQ(float(b[itag(uint16_t(i))]), a[itag(uint16_t(i))]);
+	EXPECT_EQ(-1.0f, a[itag(uint16_t(4))]);
+	EXPECT_EQ(float(block_count * ve::vector_size - 1), a[itag(uint16_t(block_count * ve::vector_size - 1))]);
+}
+
 TEST(concurrency_tools, ve_complex_math) {
 	std::vector<float, aligned_allocator_64<float>> a(16, 0.0f);
 	std::vector<float, aligned_allocator_64<float>> b(16, 0.0f);
@@ -2188,6 +2374,178 @@ TEST(concurrency_tools, vector_reduce) {
 	EXPECT_FLOAT_EQ(reduce_result, std_reduce);
 }
 
+TEST(concurrency_tools, ve_segmented_reduce) {
+	std::vector<float, aligned_allocator_64<float>> values(48, 0.0f);
+	for(int32_t i = 0; i < 45; ++i)
+		values[i] = float(i + 1);
+	std::vector<int32_t, aligned_allocator_64<int32_t>> starts{ 0, 3, 3, 12, 13, 30, 45 };
+	std::vector<float, aligned_allocator_64<float>> out(8, -1.0f);
+
+	ve::segmented_reduce(6ui32, tagged_array_view<int32_t const, int32_t>(starts.data(), 7), tagged_array_view<float const, int32_t>(values.data(), 45),
+		tagged_array_view<float, int32_t>(out.data(), 6));
+	for(int32_t s = 0; s < 6; ++s)
+		EXPECT_EQ(out[s], std::reduce(values.data() + starts[s], values.data() + starts[s + 1], 0.0f, std::plus<>()));
+
+	std::fill(out.begin(), out.end(), -1.0f);
+	ve::segmented_reduce(6ui32, tagged_array_view<int32_t const, int32_t>(starts.data(), 7), tagged_array_view<float const, int32_t>(values.data(), 45),
+		tagged_array_view<float, int32_t>(out.data(), 6), ve::par());
+	EXPECT_EQ(out[0], 6.0f);
+	EXPECT_EQ(out[1], 0.0f);
+	EXPECT_EQ(out[3], 13.0f);
+	EXPECT_EQ(out[5], std::reduce(values.data() + 30, values.data() + 45, 0.0f, std::plus<>()));
+
+	std::vector<int32_t, aligned_allocator_64<int32_t>> indices(48, 0);
+	for(int32_t i = 0; i < 45; ++i)
+		indices[i] = (i * 7) % 45;
+	std::fill(out.begin(), out.end(), -1.0f);
+	ve::segmented_gather_reduce(6ui32, tagged_array_view<int32_t const, int32_t>(starts.data(), 7), tagged_array_view<int32_t const, int32_t>(indices.data(), 45),
+		tagged_array_view<float const, int32_t>(values.data(), 45), tagged_array_view<float, int32_t>(out.data(), 6));
+	for(int32_t s = 0; s < 6; ++s) {
+		float expected = 0.0f;
+		for(int32_t k = starts[s]; k < starts[s + 1]; ++k)
+			expected += values[indices[k]];
+		EXPECT_EQ(out[s], expected);
+	}
+}
+
+TEST(concurrency_tools, ve_inclusive_scan) {
+	std::vector<int32_t, aligned_allocator_64<int32_t>> values(2064, 0);
+	std::vector<int32_t, aligned_allocator_64<int32_t>> serial_out(2064, 0);
+	std::vector<int32_t, aligned_allocator_64<int32_t>> par_out(2064, 0);
+	for(int32_t i = 0; i < 2061; ++i)
+		values[i] = (i % 5) + 1;
+
+	ve::inclusive_scan(2061ui32, tagged_array_view<int32_t const, int32_t>(values.data(), 2061), tagged_array_view<int32_t, int32_t>(serial_out.data(), 2061));
+	ve::inclusive_scan(2061ui32, tagged_array_view<int32_t const, int32_t>(values.data(), 2061), tagged_array_view<int32_t, int32_t>(par_out.data(), 2061), ve::par());
+
+	int32_t running = 0;
+	for(int32_t i = 0; i < 2061; ++i) {
+		running += values[i];
+		EXPECT_EQ(serial_out[i], running);
+		EXPECT_EQ(par_out[i], running);
+	}
+
+	std::vector<float, aligned_allocator_64<float>> fvalues(24, 0.0f);
+	for(int32_t i = 0; i < 21; ++i)
+		fvalues[i] = float(i);
+	ve::inclusive_scan(21ui32, tagged_array_view<float const, int32_t>(fvalues.data(), 21), tagged_array_view<float, int32_t>(fvalues.data(), 21));
+	for(int32_t i = 0; i < 21; ++i)
+		EXPECT_EQ(fvalues[i], float(i * (i + 1) / 2));
+
+	std::vector<int32_t, aligned_allocator_64<int32_t>> starts{ 0, 5, 5, 19, 21 };
+	std::vector<int32_t, aligned_allocator_64<int32_t>> seg_out(24, 0);
+	ve::segmented_inclusive_scan(4ui32, tagged_array_view<int32_t const, int32_t>(starts.data(), 5), tagged_array_view<int32_t const, int32_t>(values.data(), 21),
+		tagged_array_view<int32_t, int32_t>(seg_out.data(), 21), ve::par());
+	for(int32_t s = 0; s < 4; ++s) {
+		int32_t segment_running = 0;
+		for(int32_t i = starts[s]; i < starts[s + 1]; ++i) {
+			segment_running += values[i];
+			EXPECT_EQ(seg_out[i], segment_running);
+		}
+	}
+}
+
+TEST(concurrency_tools, ve_compress_to_indices) {
+	std::vector<int32_t, aligned_allocator_64<int32_t>> values(1032, 0);
+	for(int32_t i = 0; i < 1029; ++i)
+		values[i] = (i * 37) % 11;
+
+	auto predicate = [v = values.data()](auto executor) {
+		return ve::load(executor, v) > ve::int_vector(6);
+	};
+
+	std::vector<int32_t> expected;
+	for(int32_t i = 0; i < 1029; ++i) {
+		if(values[i] > 6)
+			expected.push_back(i);
+	}
+
+	std::vector<int32_t, aligned_allocator_64<int32_t>> serial_out(1032, -1);
+	std::vector<int32_t, aligned_allocator_64<int32_t>> par_out(1032, -1);
+	auto const serial_count = ve::compress_to_indices(1029ui32, predicate, tagged_array_view<int32_t, int32_t>(serial_out.data(), 1032));
+	auto const par_count = ve::compress_to_indices(1029ui32, predicate, tagged_array_view<int32_t, int32_t>(par_out.data(), 1032), ve::par());
+
+	EXPECT_EQ(serial_count, uint32_t(expected.size()));
+	EXPECT_EQ(par_count, uint32_t(expected.size()));
+	for(uint32_t i = 0; i < expected.size(); ++i) {
+		EXPECT_EQ(serial_out[i], expected[i]);
+		EXPECT_EQ(par_out[i], expected[i]);
+	}
+}
+
+TEST(concurrency_tools, ve_gather_scatter_histogram) {
+	std::vector<float, aligned_allocator_64<float>> source(16, 0.0f);
+	for(int32_t i = 0; i < 16; ++i)
+		source[i] = float(i * 3);
+
+	std::vector<int32_t, aligned_allocator_64<int32_t>> indices(416, 0);
+	for(int32_t i = 0; i < 413; ++i)
+		indices[i] = (i * i) % 13; // many repeats within each vector
+	std::vector<float, aligned_allocator_64<float>> weights(416, 0.0f);
+	for(int32_t i = 0; i < 413; ++i)
+		weights[i] = float(i % 4);
+
+	std::vector<float, aligned_allocator_64<float>> gathered(416, 0.0f);
+	ve::gather(416ui32, tagged_array_view<int32_t const, int32_t>(indices.data(), 416), tagged_array_view<float const, int32_t>(source.data(), 16),
+		tagged_array_view<float, int32_t>(gathered.data(), 416));
+	for(int32_t i = 0; i < 416; ++i)
+		EXPECT_EQ(gathered[i], source[indices[i]]);
+
+	float expected_totals[13] = { 0.0f };
+	int32_t expected_counts[13] = { 0 };
+	for(int32_t i = 0; i < 413; ++i) {
+		expected_totals[indices[i]] += weights[i];
+		expected_counts[indices[i]] += 1;
+	}
+
+	std::vector<float, aligned_allocator_64<float>> serial_totals(16, 0.0f);
+	std::vector<float, aligned_allocator_64<float>> par_totals(16, 0.0f);
+	ve::scatter_add(413ui32, tagged_array_view<int32_t const, int32_t>(indices.data(), 413), tagged_array_view<float const, int32_t>(weights.data(), 413),
+		13ui32, tagged_array_view<float, int32_t>(serial_totals.data(), 13));
+	ve::weighted_histogram(413ui32, tagged_array_view<int32_t const, int32_t>(indices.data(), 413), tagged_array_view<float const, int32_t>(weights.data(), 413),
+		13ui32, tagged_array_view<float, int32_t>(par_totals.data(), 13), ve::par());
+
+	std::vector<int32_t, aligned_allocator_64<int32_t>> serial_counts(16, 0);
+	std::vector<int32_t, aligned_allocator_64<int32_t>> par_counts(16, 0);
+	ve::histogram(413ui32, tagged_array_view<int32_t const, int32_t>(indices.data(), 413), 13ui32, tagged_array_view<int32_t, int32_t>(serial_counts.data(), 13));
+	ve::histogram(413ui32, tagged_array_view<int32_t const, int32_t>(indices.data(), 413), 13ui32, tagged_array_view<int32_t, int32_t>(par_counts.data(), 13), ve::par());
+
+	for(int32_t i = 0; i < 13; ++i) {
+		EXPECT_EQ(serial_totals[i], expected_totals[i]);
+		EXPECT_EQ(par_totals[i], expected_totals[i]);
+		EXPECT_EQ(serial_counts[i], expected_counts[i]);
+		EXPECT_EQ(par_counts[i], expected_counts[i]);
+	}
+	EXPECT_EQ(serial_totals[13], 0.0f);
+	EXPECT_EQ(par_counts[13], 0);
+}
+
+TEST(concurrency_tools, ve_radix_sort_by_key) {
+	std::vector<uint64_t> serial_keys(1000);
+	std::vector<int32_t> serial_values(1000);
+	for(int32_t i = 0; i < 1000; ++i) {
+		serial_keys[i] = (uint64_t((i * 7919) % 61) << 33) | uint64_t((i * 104729) % 997); // equal keys appear repeatedly
+		serial_values[i] = i;
+	}
+	std::vector<uint64_t> par_keys(serial_keys);
+	std::vector<int32_t> par_values(serial_values);
+
+	std::vector<std::pair<uint64_t, int32_t>> expected;
+	for(int32_t i = 0; i < 1000; ++i)
+		expected.emplace_back(serial_keys[i], i);
+	std::stable_sort(expected.begin(), expected.end(), [](auto const& a, auto const& b) { return a.first < b.first; });
+
+	ve::radix_sort_by_key(1000ui32, serial_keys.data(), serial_values.data(), 39ui32);
+	ve::radix_sort_by_key(1000ui32, par_keys.data(), par_values.data(), 39ui32, ve::par());
+
+	for(int32_t i = 0; i < 1000; ++i) {
+		EXPECT_EQ(serial_keys[i], expected[i].first);
+		EXPECT_EQ(serial_values[i], expected[i].second);
+		EXPECT_EQ(par_keys[i], expected[i].first);
+		EXPECT_EQ(par_values[i], expected[i].second);
+	}
+}
+
 TEST(concurrency_tools, vector_integer_mask) {
 	std::vector<float, aligned_allocator_64<float>> a(16, 0.0f);
 	std::vector<float, aligned_allocator_64<float>> b(16, 0.0f);
@@ -2548,3 +2906,251 @@ TEST(concurrency_tools, chunking) {
 		EXPECT_EQ(19ui32, r.high);
 	}
 }
+
+TEST(concurrency_tools, staggered_scheduler_covers_set_once_per_period) {
+	staggered_scheduler sch(1);
+
+	uint32_t covered = 0;
+	for(int32_t day = 0; day < 8; ++day) {
+		sch.begin_tick();
+		auto const s = sch.next_slice(0, 8, 1, 100);
+		EXPECT_EQ(covered % 100ui32, s.first);
+		covered += s.last - s.first;
+		EXPECT_EQ(day == 7, s.completes_set);
+	}
+	EXPECT_EQ(100ui32, covered);
+}
+
+TEST(concurrency_tools, staggered_scheduler_granularity) {
+	staggered_scheduler sch(1);
+
+	for(int32_t day = 0; day < 8; ++day) {
+		sch.begin_tick();
+		auto const s = sch.next_slice(0, 8, 16, 200);
+		EXPECT_EQ(0ui32, s.first % 16ui32);
+		if(!s.completes_set)
+			EXPECT_EQ(0ui32, (s.last - s.first) % 16ui32);
+		else
+			EXPECT_EQ(200ui32, s.last);
+	}
+}
+
+TEST(concurrency_tools, staggered_scheduler_budget_does_not_change_slices) {
+	staggered_scheduler fast(1);
+	staggered_scheduler slow(1);
+	fast.set_budget(10'000.0f);
+	slow.set_budget(1.0f);
+
+	for(int32_t day = 0; day < 20; ++day) {
+		fast.begin_tick();
+		slow.begin_tick();
+		auto const a = fast.next_slice(0, 10, 1, 1000);
+		auto const b = slow.next_slice(0, 10, 1, 1000);
+		EXPECT_EQ(a.first, b.first);
+		EXPECT_EQ(a.last, b.last);
+		fast.record_time(100.0f);
+		slow.record_time(100.0f);
+		EXPECT_FALSE(fast.over_budget());
+		EXPECT_TRUE(slow.over_budget());
+	}
+}
+
+TEST(concurrency_tools, staggered_scheduler_catches_up) {
+	staggered_scheduler sch(1);
+
+	sch.begin_tick();
+	auto s = sch.next_slice(0, 8, 1, 100);
+	EXPECT_EQ(0ui32, s.first);
+	EXPECT_EQ(13ui32, s.last);
+	EXPECT_EQ(8ui32, s.ticks);
+
+	// not run for three ticks: the fifth tick of the pass covers everything up to 5/8 of the set
+	for(int32_t day = 0; day < 3; ++day)
+		sch.begin_tick();
+	sch.begin_tick();
+	s = sch.next_slice(0, 8, 1, 100);
+	EXPECT_EQ(13ui32, s.first);
+	EXPECT_EQ(63ui32, s.last);
+
+	// overdue: the pass is finished at once, and the next one reports how long it took
+	for(int32_t day = 0; day < 5; ++day)
+		sch.begin_tick();
+	s = sch.next_slice(0, 8, 1, 100);
+	EXPECT_EQ(63ui32, s.first);
+	EXPECT_EQ(100ui32, s.last);
+	EXPECT_TRUE(s.completes_set);
+
+	sch.begin_tick();
+	s = sch.next_slice(0, 8, 1, 100);
+	EXPECT_EQ(0ui32, s.first);
+	EXPECT_EQ(10ui32, s.ticks);
+}
+
+TEST(concurrency_tools, staggered_scheduler_small_set_waits_for_period) {
+	staggered_scheduler sch(1);
+
+	std::vector<int32_t> processed(3, 0);
+	for(int32_t day = 0; day < 16; ++day) {
+		sch.begin_tick();
+		auto const s = sch.next_slice(0, 8, 1, 3);
+		for(uint32_t i = s.first; i < s.last; ++i)
+			++processed[i];
+		if(day == 8) {
+			EXPECT_EQ(0ui32, s.first);
+			EXPECT_EQ(8ui32, s.ticks);
+		}
+	}
+	EXPECT_EQ(2, processed[0]);
+	EXPECT_EQ(2, processed[1]);
+	EXPECT_EQ(2, processed[2]);
+}
+
+TEST(concurrency_tools, staggered_scheduler_serialize) {
+	staggered_scheduler a(2);
+	for(int32_t day = 0; day < 5; ++day) {
+		a.begin_tick();
+		a.next_slice(0, 8, 1, 100);
+		a.next_slice(1, 32, 4, 50);
+	}
+
+	std::vector<std::byte> buffer(serialization::serialize_size(a));
+	std::byte* output = buffer.data();
+	serialization::serialize(output, a);
+
+	staggered_scheduler b(2);
+	std::byte const* input = buffer.data();
+	serialization::deserialize(input, b);
+
+	for(int32_t day = 0; day < 40; ++day) {
+		a.begin_tick();
+		b.begin_tick();
+		auto const sa = a.next_slice(0, 8, 1, 100);
+		auto const sb = b.next_slice(0, 8, 1, 100);
+		EXPECT_EQ(sa.first, sb.first);
+		EXPECT_EQ(sa.last, sb.last);
+		EXPECT_EQ(sa.ticks, sb.ticks);
+		auto const ta = a.next_slice(1, 32, 4, 50);
+		auto const tb = b.next_slice(1, 32, 4, 50);
+		EXPECT_EQ(ta.first, tb.first);
+		EXPECT_EQ(ta.last, tb.last);
+		EXPECT_EQ(ta.ticks, tb.ticks);
+	}
+}
+
+TEST(concurrency_tools, incremental_ranking_order) {
+	incremental_ranking r;
+	r.set(0, ranking_key{ 0, 5.0f });
+	r.set(1, ranking_key{ 0, 9.0f });
+	r.set(2, ranking_key{ 1, 20.0f }); // a later group ranks after any score
+	r.set(3, ranking_key{ 0, 5.0f }); // ties go to the lower id
+	EXPECT_TRUE(r.update());
+
+	EXPECT_EQ(4, r.size());
+	EXPECT_EQ(1, r.at(0));
+	EXPECT_EQ(0, r.at(1));
+	EXPECT_EQ(3, r.at(2));
+	EXPECT_EQ(2, r.at(3));
+	EXPECT_EQ(2, r.rank(3));
+	EXPECT_EQ(-1, r.rank(7));
+	EXPECT_EQ(4ui64, r.changed().size());
+	EXPECT_EQ(1ui32, r.generation());
+}
+
+TEST(concurrency_tools, incremental_ranking_changes) {
+	incremental_ranking r;
+	for(int32_t i = 0; i < 20; ++i)
+		r.set(i, ranking_key{ 0, float(100 - i) });
+	r.update();
+
+	// unchanged keys: nothing to report
+	for(int32_t i = 0; i < 20; ++i)
+		r.set(i, ranking_key{ 0, float(100 - i) });
+	EXPECT_FALSE(r.update());
+	EXPECT_EQ(1ui32, r.generation());
+
+	// item 12 climbs to second place, pushing 1 ... 11 down by one
+	for(int32_t i = 0; i < 20; ++i)
+		r.set(i, ranking_key{ 0, i == 12 ? 99.5f : float(100 - i) });
+	EXPECT_TRUE(r.update());
+	EXPECT_EQ(12ui64, r.changed().size());
+	EXPECT_EQ(1, r.rank(12));
+	EXPECT_EQ(12, r.rank(11));
+	EXPECT_EQ(13, r.rank(13));
+	EXPECT_TRUE(r.boundary_moved(8));
+	EXPECT_FALSE(r.boundary_moved(15));
+
+	// item 0 is not set again: it is dropped and the rest move up
+	for(int32_t i = 1; i < 20; ++i)
+		r.set(i, ranking_key{ 0, i == 12 ? 99.5f : float(100 - i) });
+	EXPECT_TRUE(r.update());
+	EXPECT_EQ(19, r.size());
+	EXPECT_EQ(-1, r.rank(0));
+	EXPECT_EQ(0, r.rank(12));
+	EXPECT_EQ(18, r.rank(19));
+	EXPECT_EQ(3ui32, r.generation());
+}
+
+TEST(concurrency_tools, sorted_view_prefix) {
+	std::vector<int32_t> items;
+	for(int32_t i = 0; i < 100; ++i)
+		items.push_back((i * 37) % 100);
+
+	sorted_view<int32_t> v;
+	v.assign(items.begin(), items.end());
+	EXPECT_EQ(100ui32, v.size());
+
+	auto less = [](int32_t a, int32_t b) { return a > b; };
+	v.sort_prefix(10, less);
+	EXPECT_EQ(10ui32, v.sorted_count());
+	for(int32_t i = 0; i < 10; ++i)
+		EXPECT_EQ(99 - i, v[uint32_t(i)]);
+
+	// the next page continues from the first one
+	v.sort_prefix(25, less);
+	EXPECT_EQ(25ui32, v.sorted_count());
+	for(int32_t i = 0; i < 25; ++i)
+		EXPECT_EQ(99 - i, v[uint32_t(i)]);
+
+	v.sort(less);
+	EXPECT_TRUE(std::is_sorted(v.begin(), v.end(), less));
+}
+
+TEST(concurrency_tools, sorted_view_refresh) {
+	std::vector<float> key(50);
+	for(int32_t i = 0; i < 50; ++i)
+		key[i] = float(i);
+	auto less = [&key](int32_t a, int32_t b) { return key[a] < key[b]; };
+
+	std::vector<int32_t> items;
+	for(int32_t i = 0; i < 40; ++i)
+		items.push_back(39 - i);
+
+	sorted_view<int32_t> v;
+	v.assign(items.begin(), items.end());
+	v.sort(less);
+	EXPECT_EQ(40ui32, v.sorted_count());
+
+	// 5 leaves, 45 and 46 join, 20 moves to the front and a repeated item is listed once
+	key[20] = -1.0f;
+	items.erase(std::find(items.begin(), items.end(), 5));
+	items.push_back(46);
+	items.push_back(45);
+	items.push_back(7);
+	v.assign(items.begin(), items.end());
+	EXPECT_EQ(0ui32, v.sorted_count());
+	EXPECT_EQ(41ui32, v.size());
+
+	v.sort(less);
+	EXPECT_EQ(41ui32, v.sorted_count());
+	EXPECT_EQ(20, v[0]);
+	EXPECT_EQ(0, v[1]);
+	EXPECT_EQ(6, v[6]);
+	EXPECT_EQ(46, v[40]);
+	EXPECT_TRUE(std::is_sorted(v.begin(), v.end(), less));
+	EXPECT_EQ(v.end(), std::find(v.begin(), v.end(), 5));
+
+	// no items: nothing left to sort
+	v.assign(items.end(), items.end());
+	v.sort(less);
+	EXPECT_EQ(0ui32, v.size());
+}
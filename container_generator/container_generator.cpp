@@ -2,6 +2,7 @@
 #include <Windows.h>
 #include <string>
 #include <vector>
+#include <algorithm>
 
 std::string extract_string(char const* & input, char const* end) {
 	while(input < end && (*input == ' ' || *input == ',' || *input == '\t' || *input == '\r' || *input == '\n'))
@@ -27,8 +28,18 @@ std::string extract_string(char const* & input, char const* end) {
 struct key_and_type {
 	std::string key;
 	std::string type;
+	int32_t group = -1;
 };
 
+bool is_quantized_type(std::string const& type) {
+	return type == "half_type" || type == "unorm16_type" || type.compare(0, 13, "fixed16_type<") == 0;
+}
+
+std::string group_row_type(std::string const& namespace_name, key_and_type const& kp, char const* qualifier, std::string const& index_type) {
+	return "tagged_interleaved_view<" + kp.type + qualifier + ", " + index_type + ", ve::vector_size, int32_t(sizeof(" + namespace_name + "::group_" + std::to_string(kp.group)
+		+ "_block) / sizeof(" + kp.type + "))>";
+}
+
 int wmain(int argc, wchar_t *argv[]) {
 
 	for(int32_t i = 1; i < argc; ++i) {
@@ -41,6 +52,8 @@ int wmain(int argc, wchar_t *argv[]) {
 		std::string index_type;
 		std::string container_size;
 		std::vector<key_and_type> keys_and_types;
+		int32_t group_count = 0;
+		std::vector<std::string> group_names; // by group, empty for unnamed groups
 
 		const auto handle = CreateFile(argv[i], GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
 		if(handle != INVALID_HANDLE_VALUE) {
@@ -60,9 +73,35 @@ int wmain(int argc, wchar_t *argv[]) {
 			index_type = extract_string(input, buffer + sz);
 			container_size = extract_string(input, buffer + sz);
 
+			// group { key, type, ... } declares columns stored interleaved in blocks of ve::vector_size
+			// group name { ... } does the same, and later blocks with the same name add to that group, so
+			// columns can be grouped without reordering the file (which would change the serialized order)
+			int32_t current_group = -1;
 			std::string next_key = extract_string(input, buffer + sz);
 			while(next_key.length() > 0) {
-				keys_and_types.push_back(key_and_type{ next_key, extract_string(input, buffer + sz) });
+				if(next_key == "group") {
+					std::string name = extract_string(input, buffer + sz);
+					if(name == "{") {
+						current_group = group_count++;
+					} else {
+						extract_string(input, buffer + sz); // {
+						auto const found = std::find(group_names.begin(), group_names.end(), name);
+						if(found != group_names.end()) {
+							current_group = int32_t(found - group_names.begin());
+						} else {
+							group_names.resize(group_count);
+							group_names.push_back(name);
+							current_group = group_count++;
+						}
+					}
+				} else if(next_key == "}") {
+					current_group = -1;
+				} else {
+					std::string type = extract_string(input, buffer + sz);
+					// bitfields are already packed and are never grouped
+					int32_t const group = (type == "bitfield" || type == "bitfield_type") ? -1 : current_group;
+					keys_and_types.push_back(key_and_type{ next_key, type, group });
+				}
 				next_key = extract_string(input, buffer + sz);
 			}
 
@@ -79,6 +118,7 @@ int wmain(int argc, wchar_t *argv[]) {
 		output += "#include \"common\\\\shared_tags.h\"\r\n";
 		output += "#include \"concurrency_tools\\\\ve.h\"\r\n";
 		output += "#include \"simple_serialize\\\\simple_serialize.hpp\"\r\n";
+		output += "#include \"concurrency_tools\\\\access_profiling.h\"\r\n";
 		output += "\r\n";
 
 		output += "#pragma warning( push )\r\n";
@@ -113,6 +153,18 @@ int wmain(int argc, wchar_t *argv[]) {
 		output += "\tconstexpr int32_t max_count = " + container_size + ";\r\n";
 		output += "\r\n";
 
+		// column group blocks; members should be listed largest type first to avoid padding
+		for(int32_t g = 0; g < group_count; ++g) {
+			output += "\tstruct group_" + std::to_string(g) + "_block {\r\n";
+			for(int32_t i = 0; i < int32_t(keys_and_types.size()); ++i) {
+				if(keys_and_types[i].group == g)
+					output += "\t\t alignas(sizeof(" + keys_and_types[i].type + ") * ve::vector_size) " + keys_and_types[i].type + " v" + std::to_string(i) + "[ve::vector_size];\r\n";
+			}
+			output += "\t};\r\n";
+		}
+		if(group_count != 0)
+			output += "\r\n";
+
 		output += "\tclass alignas(64) container {\r\n"; // BEGIN: container class
 
 		// commom members
@@ -136,7 +188,9 @@ int wmain(int argc, wchar_t *argv[]) {
 		output += "\r\n";
 
 		for(int32_t i = 0; i < int32_t(keys_and_types.size()); ++i) {
-			if(keys_and_types[i].type == "bitfield" || keys_and_types[i].type == "bitfield_type") {
+			if(keys_and_types[i].group != -1) {
+				continue;
+			} else if(keys_and_types[i].type == "bitfield" || keys_and_types[i].type == "bitfield_type") {
 				std::string bytes_size = std::string("((uint32_t(") + container_size + " + 7)) / 8ui32 + 63ui32) & ~63ui32";
 				output += "\t\t struct alignas(64) dtype_" + std::to_string(i) + " { \r\n"
 					"\t\t\t bitfield_type padding[64]; \r\n"
@@ -154,6 +208,31 @@ int wmain(int argc, wchar_t *argv[]) {
 					"\t\t } m_" + std::to_string(i) + ";\r\n";
 			}
 		}
+		for(int32_t g = 0; g < group_count; ++g) {
+			std::string block_count = "(uint32_t(" + container_size + ") + uint32_t(ve::vector_size - 1)) / uint32_t(ve::vector_size)";
+			output += "\t\t struct alignas(64) dtype_g" + std::to_string(g) + " { \r\n"
+				"\t\t\t group_" + std::to_string(g) + "_block padding; \r\n"
+				"\t\t\t group_" + std::to_string(g) + "_block values[" + block_count + "]; \r\n"
+				"\t\t\t dtype_g" + std::to_string(g) + "() { std::uninitialized_value_construct_n(values - 1, " + block_count + " + 1); }\r\n"
+				"\t\t } m_g" + std::to_string(g) + ";\r\n";
+		}
+
+		// access profile: column names, types and element sizes for the instrumentation build
+		output += "#ifdef CONTAINER_ACCESS_PROFILING\r\n";
+		output += "\t\t inline static access_profiling::container_profile profile{ \"" + namespace_name + "\", {";
+		for(int32_t i = 0; i < int32_t(keys_and_types.size()); ++i)
+			output += std::string(i != 0 ? ", " : " ") + "\"" + keys_and_types[i].key.substr(namespace_name.length() + 2) + "\"";
+		output += " }, {";
+		for(int32_t i = 0; i < int32_t(keys_and_types.size()); ++i)
+			output += std::string(i != 0 ? ", " : " ") + "\"" + keys_and_types[i].type + "\"";
+		output += " }, {";
+		for(int32_t i = 0; i < int32_t(keys_and_types.size()); ++i) {
+			bool const is_bitfield = keys_and_types[i].type == "bitfield" || keys_and_types[i].type == "bitfield_type";
+			output += std::string(i != 0 ? ", " : " ") + (is_bitfield ? std::string("0") : "sizeof(" + keys_and_types[i].type + ")");
+		}
+		output += " } };\r\n";
+		output += "#endif\r\n";
+
 		output += "\r\n";
 		output += "\t\t public:\r\n";
 		output += "\t\t friend class serialization::serializer<container>;\r\n";
@@ -172,55 +251,146 @@ int wmain(int argc, wchar_t *argv[]) {
 
 		// tagged member functions
 		for(int32_t i = 0; i < int32_t(keys_and_types.size()); ++i) {
-			if(keys_and_types[i].type == "bitfield" || keys_and_types[i].type == "bitfield_type") {
+			bool const is_bitfield = keys_and_types[i].type == "bitfield" || keys_and_types[i].type == "bitfield_type";
+			std::string const element_bytes = is_bitfield ? std::string("sizeof(bitfield_type)") : "sizeof(" + keys_and_types[i].type + ")";
+			std::string const row_bytes = is_bitfield ? std::string("uint32_t(size_used + 7) / 8ui32") : "uint64_t(size_used) * sizeof(" + keys_and_types[i].type + ")";
+			auto const record = [i](char const* kind, std::string const& bytes) {
+				return "\t\t\t CONTAINER_ACCESS_RECORD(profile, " + std::to_string(i) + ", " + kind + ", " + bytes + ");\r\n";
+			};
+
+			if(is_bitfield) {
 				// get
 				output += std::string("\t\t template<typename INDEX>\r\n") +
 					"\t\t std::enable_if_t<std::is_same_v<INDEX, " + keys_and_types[i].key + ">, bool> get(" + index_type + " i) const {\r\n"
+					+ record("get", element_bytes) +
 					"\t\t\t return bit_vector_test(m_" + std::to_string(i) + ".values, to_index(i));\r\n"
 					"\t\t }\r\n";
 				// set
 				output += std::string("\t\t template<typename INDEX>\r\n") +
 					"\t\t auto set(" + index_type + " i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, " + keys_and_types[i].key + ">> {\r\n"
+					+ record("set", element_bytes) +
 					"\t\t\t bit_vector_set(m_" + std::to_string(i) + ".values, to_index(i), v);\r\n"
 					"\t\t }\r\n";
 				// get row
 				output += std::string("\t\t template<typename INDEX>\r\n") +
 					"\t\t std::enable_if_t<std::is_same_v<INDEX, " + keys_and_types[i].key + ">, tagged_array_view<bitfield_type, " + index_type + ">> get_row() {\r\n"
+					+ record("get_row", row_bytes) +
 					"\t\t\t return tagged_array_view<bitfield_type, " + index_type + ">(m_" + std::to_string(i) + ".values, int32_t(uint32_t(size_used + 7) / 8ui32));\r\n"
 					"\t\t }\r\n";
 				// const get row
 				output += std::string("\t\t template<typename INDEX>\r\n") +
 					"\t\t std::enable_if_t<std::is_same_v<INDEX, " + keys_and_types[i].key + ">, tagged_array_view<bitfield_type const, " + index_type + ">> get_row() const {\r\n"
+					+ record("get_row", row_bytes) +
 					"\t\t\t return tagged_array_view<bitfield_type const, " + index_type + ">(m_" + std::to_string(i) + ".values, int32_t(uint32_t(size_used + 7) / 8ui32));\r\n"
 					"\t\t }\r\n";
+			} else if(keys_and_types[i].group != -1) {
+				std::string const row = group_row_type(namespace_name, keys_and_types[i], "", index_type);
+				std::string const const_row = group_row_type(namespace_name, keys_and_types[i], " const", index_type);
+				std::string const first = "m_g" + std::to_string(keys_and_types[i].group) + ".values[0].v" + std::to_string(i);
+				if(is_quantized_type(keys_and_types[i].type)) {
+					// get
+					output += std::string("\t\t template<typename INDEX>\r\n") +
+						"\t\t std::enable_if_t<std::is_same_v<INDEX, " + keys_and_types[i].key + ">, float> get(" + index_type + " i) const {\r\n"
+						+ record("get", element_bytes) +
+						"\t\t\t return dequantize(" + const_row + "(" + first + ", size_used)[i]);\r\n"
+						"\t\t }\r\n";
+					// set
+					output += std::string("\t\t template<typename INDEX>\r\n") +
+						"\t\t auto set(" + index_type + " i, float v) -> std::enable_if_t<std::is_same_v<INDEX, " + keys_and_types[i].key + ">> {\r\n"
+						+ record("set", element_bytes) +
+						"\t\t\t " + row + "(" + first + ", size_used)[i] = quantize<" + keys_and_types[i].type + ">(v);\r\n"
+						"\t\t }\r\n";
+				} else {
+					// get
+					output += std::string("\t\t template<typename INDEX>\r\n") +
+						"\t\t std::enable_if_t<std::is_same_v<INDEX, " + keys_and_types[i].key + ">, " + keys_and_types[i].type + "&> get(" + index_type + " i) {\r\n"
+						+ record("get", element_bytes) +
+						"\t\t\t return " + row + "(" + first + ", size_used)[i];\r\n"
+						"\t\t }\r\n";
+					// const get
+					output += std::string("\t\t template<typename INDEX>\r\n") +
+						"\t\t std::enable_if_t<std::is_same_v<INDEX, " + keys_and_types[i].key + ">, " + keys_and_types[i].type + " const&> get(" + index_type + " i) const {\r\n"
+						+ record("get", element_bytes) +
+						"\t\t\t return " + const_row + "(" + first + ", size_used)[i];\r\n"
+						"\t\t }\r\n";
+					// set
+					output += std::string("\t\t template<typename INDEX, typename value_type>\r\n") +
+						"\t\t auto set(" + index_type + " i, value_type const& v) -> std::enable_if_t<std::is_same_v<INDEX, " + keys_and_types[i].key + ">> {\r\n"
+						+ record("set", element_bytes) +
+						"\t\t\t " + row + "(" + first + ", size_used)[i] = v;\r\n"
+						"\t\t }\r\n";
+				}
+				// get row
+				output += std::string("\t\t template<typename INDEX>\r\n") +
+					"\t\t std::enable_if_t<std::is_same_v<INDEX, " + keys_and_types[i].key + ">, " + row + "> get_row() {\r\n"
+					+ record("get_row", row_bytes) +
+					"\t\t\t return " + row + "(" + first + ", ve::to_vector_size(uint32_t(size_used)));\r\n"
+					"\t\t }\r\n";
+				// const get row
+				output += std::string("\t\t template<typename INDEX>\r\n") +
+					"\t\t std::enable_if_t<std::is_same_v<INDEX, " + keys_and_types[i].key + ">, " + const_row + "> get_row() const {\r\n"
+					+ record("get_row", row_bytes) +
+					"\t\t\t return " + const_row + "(" + first + ", ve::to_vector_size(uint32_t(size_used)));\r\n"
+					"\t\t }\r\n";
+			} else if(is_quantized_type(keys_and_types[i].type)) {
+				// get
+				output += std::string("\t\t template<typename INDEX>\r\n") +
+					"\t\t std::enable_if_t<std::is_same_v<INDEX, " + keys_and_types[i].key + ">, float> get(" + index_type + " i) const {\r\n"
+					+ record("get", element_bytes) +
+					"\t\t\t return dequantize(m_" + std::to_string(i) + ".values[to_index(i)]);\r\n"
+					"\t\t }\r\n";
+				// set
+				output += std::string("\t\t template<typename INDEX>\r\n") +
+					"\t\t auto set(" + index_type + " i, float v) -> std::enable_if_t<std::is_same_v<INDEX, " + keys_and_types[i].key + ">> {\r\n"
+					+ record("set", element_bytes) +
+					"\t\t\t m_" + std::to_string(i) + ".values[to_index(i)] = quantize<" + keys_and_types[i].type + ">(v);\r\n"
+					"\t\t }\r\n";
+				// get row
+				output += std::string("\t\t template<typename INDEX>\r\n") +
+					"\t\t std::enable_if_t<std::is_same_v<INDEX, " + keys_and_types[i].key + ">, tagged_array_view<" + keys_and_types[i].type + ", " + index_type + ">> get_row() {\r\n"
+					+ record("get_row", row_bytes) +
+					"\t\t\t return tagged_array_view<" + keys_and_types[i].type + ", " + index_type + ">(m_" + std::to_string(i) + ".values, ve::to_vector_size(uint32_t(size_used)));\r\n"
+					"\t\t }\r\n";
+				// const get row
+				output += std::string("\t\t template<typename INDEX>\r\n") +
+					"\t\t std::enable_if_t<std::is_same_v<INDEX, " + keys_and_types[i].key + ">, tagged_array_view<" + keys_and_types[i].type + " const, " + index_type + ">> get_row() const {\r\n"
+					+ record("get_row", row_bytes) +
+					"\t\t\t return tagged_array_view<" + keys_and_types[i].type + " const, " + index_type + ">(m_" + std::to_string(i) + ".values, ve::to_vector_size(uint32_t(size_used)));\r\n"
+					"\t\t }\r\n";
 			} else {
 				// get
 				output += std::string("\t\t template<typename INDEX>\r\n") +
 					"\t\t std::enable_if_t<std::is_same_v<INDEX, " + keys_and_types[i].key + ">, " + keys_and_types[i].type + "&> get(" + index_type + " i) {\r\n"
+					+ record("get", element_bytes) +
 					"\t\t\t return m_" + std::to_string(i) + ".values[to_index(i)];\r\n"
 					"\t\t }\r\n";
 				// const get
 				output += std::string("\t\t template<typename INDEX>\r\n") +
 					"\t\t std::enable_if_t<std::is_same_v<INDEX, " + keys_and_types[i].key + ">, " + keys_and_types[i].type + " const&> get(" + index_type + " i) const {\r\n"
+					+ record("get", element_bytes) +
 					"\t\t\t return m_" + std::to_string(i) + ".values[to_index(i)];\r\n"
 					"\t\t }\r\n";
 				// set
 				output += std::string("\t\t template<typename INDEX, typename value_type>\r\n") +
 					"\t\t auto set(" + index_type + " i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, " + keys_and_types[i].key + ">> {\r\n"
+					+ record("set", element_bytes) +
 					"\t\t\t m_" + std::to_string(i) + ".values[to_index(i)] = v;\r\n"
 					"\t\t }\r\n";
 				output += std::string("\t\t template<typename INDEX, typename value_type>\r\n") +
 					"\t\t auto set(" + index_type + " i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, " + keys_and_types[i].key + ">> {\r\n"
+					+ record("set", element_bytes) +
 					"\t\t\t m_" + std::to_string(i) + ".values[to_index(i)] = v;\r\n"
 					"\t\t }\r\n";
 				// get row
 				output += std::string("\t\t template<typename INDEX>\r\n") +
 					"\t\t std::enable_if_t<std::is_same_v<INDEX, " + keys_and_types[i].key + ">, tagged_array_view<" + keys_and_types[i].type + ", " + index_type + ">> get_row() {\r\n"
+					+ record("get_row", row_bytes) +
 					"\t\t\t return tagged_array_view<" + keys_and_types[i].type + ", " + index_type + ">(m_" + std::to_string(i) + ".values, ve::to_vector_size(uint32_t(size_used)));\r\n"
 					"\t\t }\r\n";
 				// const get row
 				output += std::string("\t\t template<typename INDEX>\r\n") +
 					"\t\t std::enable_if_t<std::is_same_v<INDEX, " + keys_and_types[i].key + ">, tagged_array_view<" + keys_and_types[i].type + " const, " + index_type + ">> get_row() const {\r\n"
+					+ record("get_row", row_bytes) +
 					"\t\t\t return tagged_array_view<" + keys_and_types[i].type + " const, " + index_type + ">(m_" + std::to_string(i) + ".values, ve::to_vector_size(uint32_t(size_used)));\r\n"
 					"\t\t }\r\n";
 			}
@@ -253,6 +423,8 @@ int wmain(int argc, wchar_t *argv[]) {
 			for(int32_t i = 0; i < int32_t(keys_and_types.size()); ++i) {
 				if(keys_and_types[i].type == "bitfield" || keys_and_types[i].type == "bitfield_type") {
 					output += "\t\t\t set<" + keys_and_types[i].key + ">(i, false);\r\n";
+				} else if(is_quantized_type(keys_and_types[i].type)) {
+					output += "\t\t\t set<" + keys_and_types[i].key + ">(i, 0.0f);\r\n";
 				} else {
 					output += "\t\t\t set<" + keys_and_types[i].key + ">(i, " + keys_and_types[i].type + "());\r\n";
 				}
@@ -347,6 +519,16 @@ int wmain(int argc, wchar_t *argv[]) {
 				output += "\t using const_type = bool;\r\n";
 				output += "\t using row = tagged_array_view<bitfield_type, " + index_type + ">;\r\n";
 				output += "\t using const_row = tagged_array_view<bitfield_type const, " + index_type + ">;\r\n";
+			} else if(kp.group != -1) {
+				output += std::string("\t using type = ") + (is_quantized_type(kp.type) ? "float" : kp.type + "&") + ";\r\n";
+				output += std::string("\t using const_type = ") + (is_quantized_type(kp.type) ? "float" : kp.type + " const&") + ";\r\n";
+				output += "\t using row = " + group_row_type(namespace_name, kp, "", index_type) + ";\r\n";
+				output += "\t using const_row = " + group_row_type(namespace_name, kp, " const", index_type) + ";\r\n";
+			} else if(is_quantized_type(kp.type)) {
+				output += "\t using type = float;\r\n";
+				output += "\t using const_type = float;\r\n";
+				output += "\t using row = tagged_array_view<" + kp.type + ", " + index_type + ">;\r\n";
+				output += "\t using const_row = tagged_array_view<" + kp.type + " const, " + index_type + ">;\r\n";
 			} else {
 				output += "\t using type = " + kp.type + "&;\r\n";
 				output += "\t using const_type = " + kp.type + " const&;\r\n";
@@ -386,6 +568,12 @@ int wmain(int argc, wchar_t *argv[]) {
 		for(int32_t i = 0; i < int32_t(keys_and_types.size()); ++i) {
 			if(keys_and_types[i].type == "bitfield" || keys_and_types[i].type == "bitfield_type") {
 				output += std::string("\t\t serialization::serialize_array(output, obj.m_") + std::to_string(i) + ".values, uint32_t(obj.size_used + 7) / 8ui32);\r\n";
+			} else if(keys_and_types[i].group != -1) {
+				// grouped members are written element by element, matching the layout of an ungrouped column
+				output += "\t\tif constexpr(!serialization::tagged_serializer<" + keys_and_types[i].key + ", " + keys_and_types[i].type + ">::has_static_size || serialization::tagged_serializer<" + keys_and_types[i].key + ", " + keys_and_types[i].type + ">::size() != 0) {\r\n";
+				output += "\t\t\t for(int32_t i = 0; i < obj.size_used; ++i)\r\n";
+				output += "\t\t\t\t serialization::tagged_serializer<" + keys_and_types[i].key + ", " + keys_and_types[i].type + ">::serialize_object(output, obj.m_g" + std::to_string(keys_and_types[i].group) + ".values[i / ve::vector_size].v" + std::to_string(i) + "[i % ve::vector_size], std::forward<CONTEXT>(c)...);\r\n";
+				output += "\t\t}\r\n";
 			} else {
 				output += "\t\tif constexpr(serialization::tagged_serializer<" + keys_and_types[i].key + ", " + keys_and_types[i].type + ">::has_static_size) {\r\n";
 				output += "\t\t\t if constexpr(serialization::tagged_serializer<" + keys_and_types[i].key + ", " + keys_and_types[i].type + ">::size() == 0) {\r\n";
@@ -434,6 +622,12 @@ int wmain(int argc, wchar_t *argv[]) {
 		for(int32_t i = 0; i < int32_t(keys_and_types.size()); ++i) {
 			if(keys_and_types[i].type == "bitfield" || keys_and_types[i].type == "bitfield_type") {
 				output += std::string("\t\t serialization::deserialize_array(input, obj.m_") + std::to_string(i) + ".values, uint32_t(obj.size_used + 7) / 8ui32);\r\n";
+			} else if(keys_and_types[i].group != -1) {
+				// grouped members are written element by element, matching the layout of an ungrouped column
+				output += "\t\tif constexpr(!serialization::tagged_serializer<" + keys_and_types[i].key + ", " + keys_and_types[i].type + ">::has_static_size || serialization::tagged_serializer<" + keys_and_types[i].key + ", " + keys_and_types[i].type + ">::size() != 0) {\r\n";
+				output += "\t\t\t for(int32_t i = 0; i < obj.size_used; ++i)\r\n";
+				output += "\t\t\t\t serialization::tagged_serializer<" + keys_and_types[i].key + ", " + keys_and_types[i].type + ">::deserialize_object(input, obj.m_g" + std::to_string(keys_and_types[i].group) + ".values[i / ve::vector_size].v" + std::to_string(i) + "[i % ve::vector_size], std::forward<CONTEXT>(c)...);\r\n";
+				output += "\t\t}\r\n";
 			} else {
 				output += "\t\tif constexpr(serialization::tagged_serializer<" + keys_and_types[i].key + ", " + keys_and_types[i].type + ">::has_static_size) {\r\n";
 				output += "\t\t\t if constexpr(serialization::tagged_serializer<" + keys_and_types[i].key + ", " + keys_and_types[i].type + ">::size() == 0) {\r\n";
@@ -468,6 +662,18 @@ int wmain(int argc, wchar_t *argv[]) {
 		for(int32_t i = 0; i < int32_t(keys_and_types.size()); ++i) {
 			if(keys_and_types[i].type == "bitfield" || keys_and_types[i].type == "bitfield_type") {
 				output += "+ sizeof(bitfield_type) * (uint32_t(obj.size_used + 7) / 8ui32)";
+			} else if(keys_and_types[i].group != -1) {
+				std::string const element = "obj.m_g" + std::to_string(keys_and_types[i].group) + ".values[j / ve::vector_size].v" + std::to_string(i) + "[j % ve::vector_size]";
+				output += "+ [&, max = obj.size_used](){\r\n";
+				output += "\t\t\t if constexpr(serialization::tagged_serializer<" + keys_and_types[i].key + ", " + keys_and_types[i].type + ">::has_static_size) {\r\n";
+				output += "\t\t\t\t return size_t(max  * serialization::tagged_serializer<" + keys_and_types[i].key + ", " + keys_and_types[i].type + ">::size());\r\n";
+				output += "\t\t\t } else {\r\n";
+				output += "\t\t\t\t size_t total = 0;\r\n";
+				output += "\t\t\t\t for(int32_t j = 0; j < max; ++j)\r\n";
+				output += "\t\t\t\t\t total += serialization::tagged_serializer<" + keys_and_types[i].key + ", " + keys_and_types[i].type + ">::size(" + element + ", std::forward<CONTEXT>(c)...);\r\n";
+				output += "\t\t\t\t return total;\r\n";
+				output += "\t\t\t }\r\n";
+				output += "\t\t }()\r\n";
 			} else {
 				output += "+ [&, max = obj.size_used](){\r\n";
 				output += "\t\t\t if(max == 0)\r\n";
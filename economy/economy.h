@@ -141,10 +141,18 @@ namespace economy {
 		constexpr static uint8_t owner_is_upgrading = 0x02;
 	};
 
+	enum class price_solver : uint8_t {
+		dampened, // each good moves a fraction of the way towards its target price every other day
+		market_clearing // every good is iterated towards its clearing prices every day
+	};
+
 	class economic_state {
 	public:
 		stable_variable_vector_storage_mk_2<money_qnty_type, 64, 30'000'000, alignment_type::padded_cache_aligned> purchasing_arrays;
 		goods_tag coal;
+
+		price_solver price_mode = price_solver::dampened;
+		int32_t clearing_iteration_budget = 6; // price updates per good per day in market_clearing mode; at least one is made
 	};
 
 	class economic_scenario {
@@ -584,11 +584,10 @@ namespace economy {
 		std::vector<float, concurrent_aligned_allocator<float>> money;
 		std::vector<float, concurrent_aligned_allocator<float>> size;
 		std::vector<float, concurrent_aligned_allocator<float>> satisfaction;
-		std::vector<provinces::province_tag, concurrent_aligned_allocator<provinces::province_tag>> location;
 
-		std::vector<float, concurrent_aligned_allocator<float>> ln_spending;
-		std::vector<float, concurrent_aligned_allocator<float>> en_spending;
-		std::vector<float, concurrent_aligned_allocator<float>> lx_spending;
+		// pops are collected province by province: the pops of provinces[i] are [province_starts[i], province_starts[i + 1])
+		std::vector<provinces::province_tag> provinces;
+		std::vector<int32_t> province_starts;
 
 		std::vector<float, concurrent_aligned_allocator<float>> ln_money_div_qnty_by_type;
 		std::vector<float, concurrent_aligned_allocator<float>> en_money_div_qnty_by_type;
@@ -598,26 +597,31 @@ namespace economy {
 		std::vector<float, concurrent_aligned_allocator<float>> en_costs_by_type;
 		std::vector<float, concurrent_aligned_allocator<float>> lx_costs_by_type;
 
+		std::vector<float, concurrent_aligned_allocator<float>> pay_per_size_by_type;
 
 		state_pops_summary(world_state& ws, nations::state_tag si) {
 			pop_ids.reserve(64);
 			pop_types.reserve(64);
 			money.reserve(64);
 			size.reserve(64);
-			location.reserve(64);
-
-			nations::for_each_pop(ws, si, [&ws, _this = this](population::pop_tag id) {
-				_this->pop_ids.push_back(id);
-				_this->pop_types.emplace_back(ws.w.population_s.pops.get<pop::type>(id));
-				_this->money.push_back(ws.w.population_s.pops.get<pop::money>(id));
-				_this->location.emplace_back(ws.w.population_s.pops.get<pop::location>(id));
-				_this->size.push_back(ws.w.population_s.pops.get<pop::size>(id));
+
+			nations::for_each_province(ws, si, [&ws, _this = this](provinces::province_tag p) {
+				_this->provinces.push_back(p);
+				_this->province_starts.push_back(int32_t(_this->pop_ids.size()));
+
+				auto pop_range = ws.get_range(ws.get<province_state::pops>(p));
+				for(auto id : pop_range) {
+					if(is_valid_index(id)) {
+						_this->pop_ids.push_back(id);
+						_this->pop_types.emplace_back(ws.w.population_s.pops.get<pop::type>(id));
+						_this->money.push_back(ws.w.population_s.pops.get<pop::money>(id));
+						_this->size.push_back(ws.w.population_s.pops.get<pop::size>(id));
+					}
+				}
 			});
+			province_starts.push_back(int32_t(pop_ids.size()));
 
 			satisfaction.resize(pop_ids.size());
-			ln_spending.resize(pop_ids.size());
-			en_spending.resize(pop_ids.size());
-			lx_spending.resize(pop_ids.size());
 
 			auto ptype_size = int32_t(ws.s.population_m.pop_types.size()) + 1;
 
@@ -628,6 +632,8 @@ namespace economy {
 			ln_costs_by_type.resize(ptype_size);
 			en_costs_by_type.resize(ptype_size);
 			lx_costs_by_type.resize(ptype_size);
+
+			pay_per_size_by_type.resize(ptype_size);
 		}
 	};
 
@@ -1275,6 +1281,8 @@ namespace economy {
 
 	constexpr int32_t price_update_delay = 2;
 	constexpr money_qnty_type price_change_rate = money_qnty_type(0.025);
+	constexpr money_qnty_type clearing_damping = money_qnty_type(0.5);
+	constexpr float clearing_tolerance = 0.002f;
 	//constexpr money_qnty_type price_gravity_factor = money_qnty_type(0.01);
 	constexpr money_qnty_type purchasing_change_rate = money_qnty_type(1);
 #define FULL_PURCHASING_CHANGE
@@ -1543,7 +1551,13 @@ namespace economy {
 		*/
 	};
 
-	void economy_single_good_tick(world_state& ws, goods_tag tag, int32_t state_max, int32_t nations_max) {
+	// distributes the demand of every state for one good over the states that produce it, at the given prices;
+	// leaves each state's purchases in purchasing_arrays and the money received by each state in state_global_demand
+	void distribute_single_good_purchases(world_state& ws, goods_tag tag, int32_t state_max, int32_t nations_max,
+		concurrent_cache_aligned_buffer<float, nations::state_tag, true> const& state_prices_copy,
+		concurrent_cache_aligned_buffer<float, nations::country_tag, true>& nation_tarrif_income,
+		concurrent_cache_aligned_buffer<float, nations::country_tag, true>& player_imports) {
+
 		auto aligned_state_max = ((static_cast<uint32_t>(sizeof(economy::money_qnty_type)) * uint32_t(state_max + 1) + 63ui32) & ~63ui32) / static_cast<uint32_t>(sizeof(economy::money_qnty_type));
 		auto aligned_nations_max = ((static_cast<uint32_t>(sizeof(economy::money_qnty_type)) * uint32_t(nations_max + 1) + 63ui32) & ~63ui32) / static_cast<uint32_t>(sizeof(economy::money_qnty_type));
 
@@ -1559,13 +1573,8 @@ namespace economy {
 		auto global_demand_by_state = ws.w.nation_s.state_global_demand.get_row(tag, aligned_state_max);
 		auto state_production = ws.w.nation_s.state_production.get_row(tag, aligned_state_max);
 
-		concurrent_cache_aligned_buffer<float, nations::country_tag, true> nation_tarrif_income(nations_max);
-		concurrent_cache_aligned_buffer<float, nations::country_tag, true> player_imports(nations_max);
-		concurrent_cache_aligned_buffer<float, nations::state_tag, true> state_prices_copy(state_max, base_price);
-
-		ws.w.nation_s.states.parallel_for_each([&ws, &state_prices_copy, tag](nations::state_tag st) {
-			state_prices_copy[st] = state_current_prices(ws, st)[tag];
-		}, concurrency::static_partitioner());
+		std::fill_n(nation_tarrif_income.data(), aligned_nations_max, 0.0f);
+		std::fill_n(player_imports.data(), aligned_nations_max, 0.0f);
 
 		ws.w.nation_s.states.parallel_for_each([&ws, &workspace, state_production, &state_prices_copy, tag, base_price, aligned_state_max, state_max](nations::state_tag si) {
 			auto demand_in_state = std::max(state_current_demand(ws, si)[tag], 0.001f);
@@ -1651,6 +1660,41 @@ namespace economy {
 			ve::accumulate(aligned_nations_max, nation_tarrif_income.view(), o.nation_tarrif_income.view());
 			ve::accumulate(aligned_nations_max, player_imports.view(), o.player_imports.view());
 		});
+	}
+
+	// the price a state would pay for one good: the average cost of its purchases from each source state
+	float single_good_target_price(world_state const& ws, nations::state_tag si, goods_tag tag, int32_t state_max,
+		nations::country_tag state_owner, tagged_array_view<float const, nations::state_tag> global_demand_by_state,
+		tagged_array_view<float const, nations::state_tag> state_production) {
+
+		const auto base_price = ws.s.economy_m.goods[tag].base_price;
+		auto demand_in_state = std::max(state_current_demand(ws, si)[tag], 0.001f);
+
+		auto state_owner_tarrifs = ws.w.nation_s.nations.get<nation::f_tariffs>(state_owner);
+		auto state_owner_tarrif_mask = ws.w.nation_s.nations.get<nation::statewise_tariff_mask>(state_owner);
+		auto purchases_for_state = ws.w.nation_s.state_purchases.get(si, tag);
+
+		auto values = get_view(ws.w.economy_s.purchasing_arrays, purchases_for_state);
+		auto distance_vector = ws.w.province_s.state_distances.get_row(si);
+		auto tariff_mask = get_view(ws.w.economy_s.purchasing_arrays, state_owner_tarrif_mask);
+
+		/*workspace_local.apparent_price = (distance_vector.array() * distance_factor +
+			(tarrif_mask.array() * (state_owner_tarrifs) + 1.0f)
+			* global_demand_by_state.vector.array() / (state_production_copy.vector.array() + 0.0001f)).matrix();*/
+
+		new_price_accumulator acc_obj(distance_vector, tariff_mask, global_demand_by_state, state_production, values, state_owner_tarrifs);
+
+		ve::execute_serial<nations::state_tag>(uint32_t(state_max + 1), acc_obj);
+		const auto final_dot_product =
+			((acc_obj.price_times_purchases_accumulator[0] + acc_obj.price_times_purchases_accumulator[1])
+				+ (acc_obj.price_times_purchases_accumulator[2] + acc_obj.price_times_purchases_accumulator[3])).reduce();
+
+		return std::clamp(final_dot_product / demand_in_state, 0.01f, base_price * 10.0f);
+	}
+
+	void store_single_good_tariffs_and_imports(world_state& ws, goods_tag tag, int32_t nations_max,
+		concurrent_cache_aligned_buffer<float, nations::country_tag, true> const& nation_tarrif_income,
+		concurrent_cache_aligned_buffer<float, nations::country_tag, true> const& player_imports) {
 
 		ws.w.nation_s.nations.parallel_for_each([&ws, &nation_tarrif_income, tag](nations::country_tag nt) {
 			ws.w.nation_s.collected_tariffs.get(nt, tag) = nation_tarrif_income[nt];
@@ -1661,40 +1705,38 @@ namespace economy {
 
 		auto dest_player_imports = get_view(ws.w.economy_s.purchasing_arrays, ws.w.local_player_data.imports_by_country[tag]);
 		std::copy_n(player_imports.data(), nations_max, dest_player_imports.data());
+	}
 
-		// determine new prices
-		ws.w.nation_s.states.parallel_for_each([&ws, global_demand_by_state, state_production, state_max, aligned_state_max, tag, base_price](nations::state_tag si) {
-			auto state_owner = ws.w.nation_s.states.get<state::owner>(si);
-
-			auto demand_in_state = std::max(state_current_demand(ws, si)[tag], 0.001f);
-			if(!is_valid_index(state_owner)) // skip remainder for this state
-				return;
+	void economy_single_good_tick(world_state& ws, goods_tag tag, int32_t state_max, int32_t nations_max) {
+		auto aligned_state_max = ((static_cast<uint32_t>(sizeof(economy::money_qnty_type)) * uint32_t(state_max + 1) + 63ui32) & ~63ui32) / static_cast<uint32_t>(sizeof(economy::money_qnty_type));
 
-			auto state_owner_tarrifs = ws.w.nation_s.nations.get<nation::f_tariffs>(state_owner);
-			auto state_owner_tarrif_mask = ws.w.nation_s.nations.get<nation::statewise_tariff_mask>(state_owner);
-			auto purchases_for_state = ws.w.nation_s.state_purchases.get(si, tag);
+		const auto base_price = ws.s.economy_m.goods[tag].base_price;
 
-			auto values = get_view(ws.w.economy_s.purchasing_arrays, purchases_for_state);
-			auto distance_vector = ws.w.province_s.state_distances.get_row(si);
-			auto tariff_mask = get_view(ws.w.economy_s.purchasing_arrays, state_owner_tarrif_mask);
+		concurrent_cache_aligned_buffer<float, nations::country_tag, true> nation_tarrif_income(nations_max);
+		concurrent_cache_aligned_buffer<float, nations::country_tag, true> player_imports(nations_max);
+		concurrent_cache_aligned_buffer<float, nations::state_tag, true> state_prices_copy(state_max, base_price);
 
-			/*workspace_local.apparent_price = (distance_vector.array() * distance_factor +
-				(tarrif_mask.array() * (state_owner_tarrifs) + 1.0f)
-				* global_demand_by_state.vector.array() / (state_production_copy.vector.array() + 0.0001f)).matrix();*/
+		ws.w.nation_s.states.parallel_for_each([&ws, &state_prices_copy, tag](nations::state_tag st) {
+			state_prices_copy[st] = state_current_prices(ws, st)[tag];
+		}, concurrency::static_partitioner());
 
-			new_price_accumulator acc_obj(distance_vector, tariff_mask, global_demand_by_state, state_production, values, state_owner_tarrifs);
+		distribute_single_good_purchases(ws, tag, state_max, nations_max, state_prices_copy, nation_tarrif_income, player_imports);
+		store_single_good_tariffs_and_imports(ws, tag, nations_max, nation_tarrif_income, player_imports);
 
-			ve::execute_serial<nations::state_tag>(uint32_t(state_max + 1), acc_obj);
-			const auto final_dot_product =
-				((acc_obj.price_times_purchases_accumulator[0] + acc_obj.price_times_purchases_accumulator[1])
-					+ (acc_obj.price_times_purchases_accumulator[2] + acc_obj.price_times_purchases_accumulator[3])).reduce();
+		auto global_demand_by_state = ws.w.nation_s.state_global_demand.get_row(tag, aligned_state_max);
+		auto state_production = ws.w.nation_s.state_production.get_row(tag, aligned_state_max);
 
+		// determine new prices
+		ws.w.nation_s.states.parallel_for_each([&ws, global_demand_by_state, state_production, state_max, tag](nations::state_tag si) {
+			auto state_owner = ws.w.nation_s.states.get<state::owner>(si);
+			if(!is_valid_index(state_owner)) // skip remainder for this state
+				return;
 
 			auto current_price = state_current_prices(ws, si)[tag];
-			
+			auto target_price = single_good_target_price(ws, si, tag, state_max, state_owner, global_demand_by_state, state_production);
+
 			state_price_delta(ws, si)[tag] = (
-				(current_price * (1.0f - price_change_rate) +
-				std::clamp(final_dot_product / demand_in_state, 0.01f, base_price * 10.0f) * price_change_rate)
+				(current_price * (1.0f - price_change_rate) + target_price * price_change_rate)
 				- current_price
 				) / float(price_update_delay);
 
@@ -1709,6 +1751,83 @@ namespace economy {
 
 	}
 
+	struct clearing_price_step {
+		ve::fp_vector residual_accumulator[ve::block_repitition] = { ve::fp_vector{}, ve::fp_vector{}, ve::fp_vector{}, ve::fp_vector{} };
+		ve::fp_vector price_accumulator[ve::block_repitition] = { ve::fp_vector{}, ve::fp_vector{}, ve::fp_vector{}, ve::fp_vector{} };
+
+		tagged_array_view<float, nations::state_tag> prices;
+		tagged_array_view<float const, nations::state_tag> target_prices;
+
+		clearing_price_step(tagged_array_view<float, nations::state_tag> a, tagged_array_view<float const, nations::state_tag> b) :
+			prices(a), target_prices(b) {}
+
+		template<typename T>
+		RELEASE_INLINE void operator()(T executor) {
+			auto current = ve::load(executor, prices);
+			auto difference = ve::load(executor, target_prices) - current;
+
+			residual_accumulator[executor.block_index] = residual_accumulator[executor.block_index] +
+				ve::partial_mask(executor, ve::max(difference, 0.0f - difference));
+			price_accumulator[executor.block_index] = price_accumulator[executor.block_index] + ve::partial_mask(executor, current);
+
+			ve::store(executor, prices, ve::multiply_and_add(difference, clearing_damping, current));
+		}
+	};
+
+	// damped Jacobi iteration of every state's price for one good towards its target price, recomputing the
+	// purchases and the money received by each producer at every step, until the total price movement falls
+	// below clearing_tolerance of the total price level or the iteration budget (at least one step) runs out.
+	// The purchases and tariffs stored are those at the final prices, which are written directly (with no delta
+	// left over)
+	void clear_single_good_market(world_state& ws, goods_tag tag, int32_t state_max, int32_t nations_max, int32_t iteration_budget) {
+		auto aligned_state_max = ((static_cast<uint32_t>(sizeof(economy::money_qnty_type)) * uint32_t(state_max + 1) + 63ui32) & ~63ui32) / static_cast<uint32_t>(sizeof(economy::money_qnty_type));
+
+		const auto base_price = ws.s.economy_m.goods[tag].base_price;
+
+		concurrent_cache_aligned_buffer<float, nations::country_tag, true> nation_tarrif_income(nations_max);
+		concurrent_cache_aligned_buffer<float, nations::country_tag, true> player_imports(nations_max);
+		concurrent_cache_aligned_buffer<float, nations::state_tag, true> state_prices_copy(state_max, base_price);
+		concurrent_cache_aligned_buffer<float, nations::state_tag, true> target_prices(state_max, base_price);
+
+		ws.w.nation_s.states.parallel_for_each([&ws, &state_prices_copy, tag](nations::state_tag st) {
+			state_prices_copy[st] = state_current_prices(ws, st)[tag];
+		}, concurrency::static_partitioner());
+
+		auto global_demand_by_state = ws.w.nation_s.state_global_demand.get_row(tag, aligned_state_max);
+		auto state_production = ws.w.nation_s.state_production.get_row(tag, aligned_state_max);
+
+		int32_t const steps = std::max(iteration_budget, 1);
+		for(int32_t i = 0; i < steps; ++i) {
+			distribute_single_good_purchases(ws, tag, state_max, nations_max, state_prices_copy, nation_tarrif_income, player_imports);
+
+			ws.w.nation_s.states.parallel_for_each([&ws, &state_prices_copy, &target_prices, global_demand_by_state, state_production, state_max, tag](nations::state_tag si) {
+				auto state_owner = ws.w.nation_s.states.get<state::owner>(si);
+				target_prices[si] = is_valid_index(state_owner) ?
+					single_good_target_price(ws, si, tag, state_max, state_owner, global_demand_by_state, state_production) :
+					state_prices_copy[si];
+			}, concurrency::static_partitioner());
+
+			clearing_price_step step(state_prices_copy.view(), target_prices.view());
+			ve::execute_serial<nations::state_tag>(uint32_t(state_max + 1), step);
+
+			const auto residual = ((step.residual_accumulator[0] + step.residual_accumulator[1]) + (step.residual_accumulator[2] + step.residual_accumulator[3])).reduce();
+			const auto price_level = ((step.price_accumulator[0] + step.price_accumulator[1]) + (step.price_accumulator[2] + step.price_accumulator[3])).reduce();
+			if(price_level <= 0.0f || residual / price_level < clearing_tolerance)
+				break;
+		}
+		// keep the purchases consistent with the stored prices
+		distribute_single_good_purchases(ws, tag, state_max, nations_max, state_prices_copy, nation_tarrif_income, player_imports);
+
+		store_single_good_tariffs_and_imports(ws, tag, nations_max, nation_tarrif_income, player_imports);
+
+		ws.w.nation_s.states.parallel_for_each([&ws, &state_prices_copy, tag](nations::state_tag si) {
+			if(is_valid_index(ws.w.nation_s.states.get<state::owner>(si))) {
+				state_current_prices(ws, si)[tag] = state_prices_copy[si];
+				state_price_delta(ws, si)[tag] = 0.0f;
+			}
+		}, concurrency::static_partitioner());
+	}
+
 	constexpr goods_qnty_type global_rgo_production_multiplier = goods_qnty_type(7.0);
 	constexpr goods_qnty_type global_throughput_multiplier = goods_qnty_type(0.5);
 	constexpr float production_scaling_speed_factor = 0.5f;
@@ -2087,25 +2206,13 @@ namespace economy {
 
 		float* const satisfaction;
 
-		float* const ln_spending;
-		float* const en_spending;
-		float* const lx_spending;
-
-		tagged_array_view<float const, population::pop_type_tag> ln_money_div_qnty_by_type;
-		tagged_array_view<float const, population::pop_type_tag> en_money_div_qnty_by_type;
-		tagged_array_view<float const, population::pop_type_tag> lx_money_div_qnty_by_type;
-
 		tagged_array_view<float const, population::pop_type_tag> ln_costs_by_type;
 		tagged_array_view<float const, population::pop_type_tag> en_costs_by_type;
 		tagged_array_view<float const, population::pop_type_tag> lx_costs_by_type;
 
 		consumption_operation(state_pops_summary& state_pops) :
 			pop_sizes(state_pops.size.data()), pop_types(state_pops.pop_types.data()), pop_money(state_pops.money.data()),
-			satisfaction(state_pops.satisfaction.data()), ln_spending(state_pops.ln_spending.data()), en_spending(state_pops.en_spending.data()),
-			lx_spending(state_pops.lx_spending.data()),
-			ln_money_div_qnty_by_type(state_pops.ln_money_div_qnty_by_type.data() + 1, uint32_t(state_pops.ln_money_div_qnty_by_type.size())),
-			en_money_div_qnty_by_type(state_pops.en_money_div_qnty_by_type.data() + 1, uint32_t(state_pops.en_money_div_qnty_by_type.size())),
-			lx_money_div_qnty_by_type(state_pops.lx_money_div_qnty_by_type.data() + 1, uint32_t(state_pops.lx_money_div_qnty_by_type.size())),
+			satisfaction(state_pops.satisfaction.data()),
 			ln_costs_by_type(state_pops.ln_costs_by_type.data() + 1, uint32_t(state_pops.ln_costs_by_type.size())),
 			en_costs_by_type(state_pops.en_costs_by_type.data() + 1, uint32_t(state_pops.en_costs_by_type.size())),
 			lx_costs_by_type(state_pops.lx_costs_by_type.data() + 1, uint32_t(state_pops.lx_costs_by_type.size()))
@@ -2116,19 +2223,6 @@ namespace economy {
 			auto pop_size_multiplier = ve::load(executor, pop_sizes) * (1.0f / pop_needs_divisor);
 			auto type_indices = ve::load(executor, pop_types);
 
-			auto gathered_ln_mdt = ve::load(type_indices, ln_money_div_qnty_by_type);
-			auto gathered_en_mdt = ve::load(type_indices, en_money_div_qnty_by_type);
-			auto gathered_lx_mdt = ve::load(type_indices, lx_money_div_qnty_by_type);
-
-			/*
-			state_demand += (ln * ln_money / total_ln).matrix();
-			state_demand += (en * en_money / total_en).matrix();
-			state_demand += (xn * lx_money / total_xn).matrix();
-			*/
-			ve::store(executor, ln_spending, gathered_ln_mdt * pop_size_multiplier);
-			ve::store(executor, en_spending, gathered_en_mdt * pop_size_multiplier);
-			ve::store(executor, lx_spending, gathered_lx_mdt * pop_size_multiplier);
-
 			auto gathered_ln_cost = ve::load(type_indices, ln_costs_by_type);
 			auto gathered_en_cost = ve::load(type_indices, en_costs_by_type);
 			auto gathered_lx_cost = ve::load(type_indices, lx_costs_by_type);
@@ -2203,7 +2297,7 @@ namespace economy {
 		float const* const satisfaction;
 
 		tagged_array_view<float, population::pop_tag> money_dest;
-		tagged_array_view<float, population::pop_tag> satisfaction_dest;
+		row_type<pop::container, pop::needs_satisfaction> satisfaction_dest;
 
 		store_money_and_satisfaction_operation(world_state& ws, state_pops_summary const& state_pops) :
 			pop_ids(state_pops.pop_ids.data()),
@@ -2223,140 +2317,203 @@ namespace economy {
 		}
 	};
 
-	void apply_pop_demand(world_state& ws, nations::state_tag in_state, state_pops_summary const& state_pops) {
-		auto state_demand = state_current_demand(ws, in_state);
+	struct distribute_pay_operation {
+		float const* const pop_sizes;
+		population::pop_type_tag const* const pop_types;
+		float* const pop_money;
 
-		const auto goods_count = ws.s.economy_m.goods_count;
-		const int32_t total = int32_t(state_pops.pop_ids.size());
-
-		for(int32_t i = 0; i < total; ++i) {
-			population::pop_type_tag ptype = state_pops.pop_types[i];
-			if(state_pops.ln_spending[i] > 0)
-				ve::accumulate_scaled(goods_count,
-					state_demand,
-					ws.s.population_m.life_needs.get_row(ptype),
-					state_pops.ln_spending[i]);
-			if(state_pops.en_spending[i] > 0)
-				ve::accumulate_scaled(goods_count,
-					state_demand,
-					ws.s.population_m.everyday_needs.get_row(ptype),
-					state_pops.en_spending[i]);
-			if(state_pops.lx_spending[i] > 0)
-				ve::accumulate_scaled(goods_count,
-					state_demand,
-					ws.s.population_m.luxury_needs.get_row(ptype),
-					state_pops.lx_spending[i]);
-		}
+		tagged_array_view<float const, population::pop_type_tag> pay_per_size_by_type;
 
-		for(int32_t i = 0; i < int32_t(ws.s.economy_m.goods_count); ++i) {
-			assert(!std::isnan(*(state_demand.data() + i)));
+		distribute_pay_operation(state_pops_summary& state_pops) :
+			pop_sizes(state_pops.size.data()), pop_types(state_pops.pop_types.data()), pop_money(state_pops.money.data()),
+			pay_per_size_by_type(state_pops.pay_per_size_by_type.data() + 1, uint32_t(state_pops.pay_per_size_by_type.size()))
+		{}
+
+		template<typename T>
+		RELEASE_INLINE void operator()(T executor) {
+			auto type_indices = ve::load(executor, pop_types);
+			auto pay = ve::load(type_indices, pay_per_size_by_type);
+
+			ve::store(executor, pop_money, ve::multiply_and_add(pay, ve::load(executor, pop_sizes), ve::load(executor, pop_money)));
 		}
+	};
+
+	// pay[type] is split between the pops of that type in proportion to their size
+	void fill_pay_per_size(state_pops_summary& state_pops, economy::money_qnty_type const* pay_by_type, float const* population_by_type, int32_t type_count) {
+		for(int32_t i = 0; i < type_count; ++i)
+			state_pops.pay_per_size_by_type[i + 1] = population_by_type[i] > 0 ? pay_by_type[i] / population_by_type[i] : 0.0f;
 	}
-	
+
+	// demand, production and pay for the states [first_state, last_state)
+	// pop demand depends on a pop only through its type and size, so each state's pops are first summed into
+	// one bucket per pop type (which also fixes its strata) and demand for the whole block is then
+	// (states x types) spending matrices times the (types x goods) needs tables
 	template<bool adjust_money>
-	void update_demand_and_production(world_state& ws, nations::state_tag si) {
-		auto state_owner = ws.w.nation_s.states.get<state::owner>(si);
-		if(!is_valid_index(state_owner))
-			return;
+	void update_demand_and_production(world_state& ws, int32_t first_state, int32_t last_state) {
+		const int32_t type_count = int32_t(ws.s.population_m.count_poptypes);
+		const int32_t goods_count = int32_t(ws.s.economy_m.goods_count);
+
+		std::vector<nations::state_tag> block_states;
+		std::vector<state_pops_summary> summaries;
+		block_states.reserve(size_t(last_state - first_state));
+		summaries.reserve(size_t(last_state - first_state));
+
+		for(int32_t i = first_state; i < last_state; ++i) {
+			nations::state_tag si = nations::state_tag(nations::state_tag::value_base_t(i));
+			if(ws.w.nation_s.states.is_valid_index(si)
+				&& is_valid_index(ws.w.nation_s.states.get<state::owner>(si))
+				&& is_valid_index(nations::get_state_capital(ws, si))) {
+
+				block_states.push_back(si);
+				summaries.emplace_back(ws, si);
+			}
+		}
 
-		const auto state_capital_id = nations::get_state_capital(ws, si);
-		if(!is_valid_index(state_capital_id))
+		const int32_t rows = int32_t(block_states.size());
+		if(rows == 0 || type_count == 0 || goods_count == 0)
 			return;
-		
-		auto current_state_demand = state_current_demand(ws, si);
-		auto state_prices = state_current_prices(ws, si);
-
-		const float mobilization_effect = (ws.w.nation_s.nations.get<nation::is_mobilized>(state_owner) == false) ?
-			1.0f : std::max(0.0f, 1.0f - ws.w.nation_s.modifier_values.get<modifiers::national_offsets::mobilisation_size>(state_owner) * ws.w.nation_s.modifier_values.get<modifiers::national_offsets::mobilisation_economy_impact>(state_owner));
 
-		std::fill_n(current_state_demand.data(), ws.s.economy_m.goods_count, 0.0f);
+		using spending_matrix = Eigen::Matrix<float, -1, -1, Eigen::RowMajor>;
+		spending_matrix ln_spending(rows, type_count);
+		spending_matrix en_spending(rows, type_count);
+		spending_matrix lx_spending(rows, type_count);
 
 		tagged_array_view<float, goods_tag> masked_prices(
 			(economy::money_qnty_type*)ve_aligned_alloca(sizeof(economy::money_qnty_type) * ws.s.economy_m.aligned_32_goods_count),
 			ws.s.economy_m.aligned_32_goods_count);
-		create_masked_prices(masked_prices, ws, si);
+		float* bucket_size = (float*)ve_aligned_alloca(sizeof(float) * type_count);
 
-		state_pops_summary state_pops(ws, si);
-		fill_base_spending_values(ws, state_pops, state_owner);
+		for(int32_t r = 0; r < rows; ++r) {
+			auto const si = block_states[r];
+			auto& state_pops = summaries[r];
 
-		fill_needs_costs_arrays(ws, si, state_capital_id, masked_prices,
-			state_pops.ln_costs_by_type.data() + 1,
-			state_pops.en_costs_by_type.data() + 1,
-			state_pops.lx_costs_by_type.data() + 1);
+			create_masked_prices(masked_prices, ws, si);
+			fill_base_spending_values(ws, state_pops, ws.w.nation_s.states.get<state::owner>(si));
+			fill_needs_costs_arrays(ws, si, nations::get_state_capital(ws, si), masked_prices,
+				state_pops.ln_costs_by_type.data() + 1,
+				state_pops.en_costs_by_type.data() + 1,
+				state_pops.lx_costs_by_type.data() + 1);
 
-		ve::execute_serial<int32_t>(uint32_t(state_pops.pop_ids.size()), consumption_operation(state_pops));
+			ve::execute_serial<int32_t>(uint32_t(state_pops.pop_ids.size()), consumption_operation(state_pops));
 
-		apply_pop_demand(ws, si, state_pops);
+			std::fill_n(bucket_size, type_count, 0.0f);
+			const int32_t total = int32_t(state_pops.pop_ids.size());
+			for(int32_t i = 0; i < total; ++i)
+				bucket_size[to_index(state_pops.pop_types[i])] += state_pops.size[i];
+
+			for(int32_t t = 0; t < type_count; ++t) {
+				auto const multiplier = bucket_size[t] * (1.0f / pop_needs_divisor);
+				ln_spending(r, t) = state_pops.ln_money_div_qnty_by_type[t + 1] * multiplier;
+				en_spending(r, t) = state_pops.en_money_div_qnty_by_type[t + 1] * multiplier;
+				lx_spending(r, t) = state_pops.lx_money_div_qnty_by_type[t + 1] * multiplier;
+			}
+		}
 
-		nations::for_each_province(ws, si, [&ws, current_state_demand, &masked_prices, state_owner, state_prices, si,
-			&state_pops, mobilization_effect](provinces::province_tag ps) {
+		// the needs tables are blocked: consecutive pop type rows start on block boundaries
+		using needs_matrix = Eigen::Map<const Eigen::Matrix<float, -1, -1, Eigen::RowMajor>, Eigen::Aligned32, Eigen::OuterStride<>>;
+		constexpr int32_t needs_block = int32_t(decltype(ws.s.population_m.life_needs)::block_size);
+		Eigen::OuterStride<> const needs_stride((goods_count * int32_t(sizeof(float)) + needs_block - 1) / needs_block * (needs_block / int32_t(sizeof(float))));
 
-			economy::money_qnty_type* province_pay_by_type = (economy::money_qnty_type*)ve_aligned_alloca(sizeof(economy::money_qnty_type) * ws.s.population_m.count_poptypes);
-			std::fill_n(province_pay_by_type, ws.s.population_m.count_poptypes, economy::money_qnty_type(0));
-			auto province_population_by_type = &(ws.w.province_s.province_demographics.get_row(ps)[population::to_demo_tag(ws, population::pop_type_tag(0))]);
+		needs_matrix life_needs(ws.s.population_m.life_needs.get_row(population::pop_type_tag(0)).data(), type_count, goods_count, needs_stride);
+		needs_matrix everyday_needs(ws.s.population_m.everyday_needs.get_row(population::pop_type_tag(0)).data(), type_count, goods_count, needs_stride);
+		needs_matrix luxury_needs(ws.s.population_m.luxury_needs.get_row(population::pop_type_tag(0)).data(), type_count, goods_count, needs_stride);
 
-			auto rgo_production = ws.w.province_s.province_state_container.get<province_state::rgo_production>(ps);
-			auto& rgo_type = ((ws.s.economy_m.goods[rgo_production].flags & good_definition::mined) != 0) ? ws.s.economy_m.rgo_mine : ws.s.economy_m.rgo_farm;
+		spending_matrix demand = ln_spending * life_needs;
+		demand.noalias() += en_spending * everyday_needs;
+		demand.noalias() += lx_spending * luxury_needs;
 
-			update_rgo_production(ws,
-				state_owner,
-				si,
-				province_pay_by_type,
-				state_prices[rgo_production],
-				tagged_array_view<const float, population::pop_type_tag>(state_pops.ln_costs_by_type.data() + 1, ws.s.population_m.count_poptypes),
-				ps, rgo_type, mobilization_effect);
-			update_artisan_production(ws,
-				state_owner,
-				si,
-				province_pay_by_type,
-				current_state_demand,
-				state_prices,
-				tagged_array_view<const float, population::pop_type_tag>(state_pops.ln_costs_by_type.data() + 1, ws.s.population_m.count_poptypes),
-				ps, mobilization_effect);
-
-			update_rgo_employment(ws, ps);
+		economy::money_qnty_type* pay_by_type = (economy::money_qnty_type*)ve_aligned_alloca(sizeof(economy::money_qnty_type) * type_count);
 
-			const int32_t total = int32_t(state_pops.pop_ids.size());
-			for(int32_t i = 0; i < total; ++i) {
-				if(state_pops.location[i] == ps) {
-					auto ptype = state_pops.pop_types[i];
-					state_pops.money[i] += province_pay_by_type[to_index(ptype)] * state_pops.size[i] / float(province_population_by_type[to_index(ptype)]);
-				}
+		for(int32_t r = 0; r < rows; ++r) {
+			auto const si = block_states[r];
+			auto& state_pops = summaries[r];
+
+			auto state_owner = ws.w.nation_s.states.get<state::owner>(si);
+			const auto state_capital_id = nations::get_state_capital(ws, si);
+
+			auto current_state_demand = state_current_demand(ws, si);
+			auto state_prices = state_current_prices(ws, si);
+
+			const float mobilization_effect = (ws.w.nation_s.nations.get<nation::is_mobilized>(state_owner) == false) ?
+				1.0f : std::max(0.0f, 1.0f - ws.w.nation_s.modifier_values.get<modifiers::national_offsets::mobilisation_size>(state_owner) * ws.w.nation_s.modifier_values.get<modifiers::national_offsets::mobilisation_economy_impact>(state_owner));
+
+			std::copy_n(demand.row(r).data(), goods_count, current_state_demand.data());
+
+			for(int32_t i = 0; i < goods_count; ++i) {
+				assert(!std::isnan(*(current_state_demand.data() + i)));
 			}
-		});
 
-		
-		economy::money_qnty_type* state_pay_by_type = (economy::money_qnty_type*)ve_aligned_alloca(sizeof(economy::money_qnty_type) * ws.s.population_m.count_poptypes);
-		std::fill_n(state_pay_by_type, ws.s.population_m.count_poptypes, economy::money_qnty_type(0));
-		[[maybe_unused]] auto state_population_by_type = &(ws.w.nation_s.state_demographics.get_row(si)[population::to_demo_tag(ws, population::pop_type_tag(0))]);
+			tagged_array_view<const float, population::pop_type_tag> life_needs_costs(state_pops.ln_costs_by_type.data() + 1, ws.s.population_m.count_poptypes);
 
-		auto& factories = ws.w.nation_s.states.get<state::factories>(si);
-		for(auto& f : factories) {
-			if(factory_is_open(f)) {
-				update_factory_production(ws,
+			const int32_t province_count = int32_t(state_pops.provinces.size());
+			for(int32_t k = 0; k < province_count; ++k) {
+				auto const ps = state_pops.provinces[k];
+
+				std::fill_n(pay_by_type, type_count, economy::money_qnty_type(0));
+				auto province_population_by_type = &(ws.w.province_s.province_demographics.get_row(ps)[population::to_demo_tag(ws, population::pop_type_tag(0))]);
+
+				auto rgo_production = ws.w.province_s.province_state_container.get<province_state::rgo_production>(ps);
+				auto& rgo_type = ((ws.s.economy_m.goods[rgo_production].flags & good_definition::mined) != 0) ? ws.s.economy_m.rgo_mine : ws.s.economy_m.rgo_farm;
+
+				update_rgo_production(ws,
+					state_owner,
+					si,
+					pay_by_type,
+					state_prices[rgo_production],
+					life_needs_costs,
+					ps, rgo_type, mobilization_effect);
+				update_artisan_production(ws,
 					state_owner,
 					si,
-					state_pay_by_type,
+					pay_by_type,
 					current_state_demand,
 					state_prices,
-					tagged_array_view<const float, population::pop_type_tag>(state_pops.ln_costs_by_type.data() + 1, ws.s.population_m.count_poptypes),
-					f, state_capital_id, mobilization_effect);
+					life_needs_costs,
+					ps, mobilization_effect);
+
+				update_rgo_employment(ws, ps);
+
+				fill_pay_per_size(state_pops, pay_by_type, province_population_by_type, type_count);
+				ve::execute_subsequence<int32_t>(uint32_t(state_pops.province_starts[k]), uint32_t(state_pops.province_starts[k + 1]), distribute_pay_operation(state_pops));
 			}
-		}
 
-		update_factories_employment(ws, si);
-		
+			std::fill_n(pay_by_type, type_count, economy::money_qnty_type(0));
+			auto state_population_by_type = &(ws.w.nation_s.state_demographics.get_row(si)[population::to_demo_tag(ws, population::pop_type_tag(0))]);
+
+			auto& factories = ws.w.nation_s.states.get<state::factories>(si);
+			for(auto& f : factories) {
+				if(factory_is_open(f)) {
+					update_factory_production(ws,
+						state_owner,
+						si,
+						pay_by_type,
+						current_state_demand,
+						state_prices,
+						life_needs_costs,
+						f, state_capital_id, mobilization_effect);
+				}
+			}
+
+			update_factories_employment(ws, si);
+
+			const uint32_t total = uint32_t(state_pops.pop_ids.size());
+			fill_pay_per_size(state_pops, pay_by_type, state_population_by_type, type_count);
+			ve::execute_serial<int32_t>(total, distribute_pay_operation(state_pops));
 
-		const int32_t total = int32_t(state_pops.pop_ids.size());
-		for(int32_t i = 0; i < total; ++i) {
-			auto ptype = state_pops.pop_types[i];
-			auto const state_pop_type_sz = float(state_population_by_type[to_index(ptype)]);
-			auto const change = state_pay_by_type[to_index(ptype)] * state_pops.size[i] / state_pop_type_sz;
-			assert(std::isfinite(change));
-			state_pops.money[i] += change;
+			ve::execute_serial<int32_t>(total, store_money_and_satisfaction_operation(ws, state_pops));
 		}
+	}
+
+	constexpr int32_t demand_state_block_size = 32;
+
+	template<bool adjust_money>
+	void update_demand_and_production(world_state& ws) {
+		const int32_t state_count = int32_t(ws.w.nation_s.states.size());
+		const int32_t block_count = (state_count + demand_state_block_size - 1) / demand_state_block_size;
 
-		ve::execute_serial<int32_t>(uint32_t(total), store_money_and_satisfaction_operation(ws, state_pops));
+		concurrency::parallel_for(0, block_count, [&ws, state_count](int32_t block) {
+			update_demand_and_production<adjust_money>(ws, block * demand_state_block_size, std::min(state_count, (block + 1) * demand_state_block_size));
+		});
 	}
 
 	artisan_type_tag get_profitable_artisan(world_state const& ws, provinces::province_tag ps) {
@@ -2410,8 +2567,8 @@ namespace economy {
 			Eigen::Map<Eigen::Matrix<economy::money_qnty_type, 1, -1>, Eigen::Aligned32> prices(state_current_prices(ws, si).data(), ws.s.economy_m.aligned_32_goods_count);
 			Eigen::Map<Eigen::Matrix<economy::money_qnty_type, 1, -1>, Eigen::Aligned32> delta(state_price_delta(ws, si).data(), ws.s.economy_m.aligned_32_goods_count);
 			prices += delta;
-			update_demand_and_production<false>(ws, si);
 		});
+		update_demand_and_production<false>(ws);
 		concurrency::parallel_for(1ui32, ws.s.economy_m.goods_count, [&ws, state_count = ws.w.nation_s.states.size(), nations_count = ws.w.nation_s.nations.size()](uint32_t i) {
 			economy_single_good_tick(ws, goods_tag(goods_tag::value_base_t(i)), state_count, nations_count);
 		});*/
@@ -2426,18 +2583,25 @@ namespace economy {
 			Eigen::Map<Eigen::Matrix<economy::money_qnty_type, 1, -1>, Eigen::Aligned32> prices(state_current_prices(ws, si).data(), ws.s.economy_m.aligned_32_goods_count);
 			Eigen::Map<Eigen::Matrix<economy::money_qnty_type, 1, -1>, Eigen::Aligned32> delta(state_price_delta(ws, si).data(), ws.s.economy_m.aligned_32_goods_count);
 			prices += delta;
-			update_demand_and_production<true>(ws, si);
 		});
+		update_demand_and_production<true>(ws);
 		update_construction_and_projects(ws); // after demand update to added demand isnt clobbered
 
-		auto offset = (to_index(ws.w.current_date)) & (price_update_delay - 1);
-		concurrency::parallel_for(1 + offset, int32_t(ws.s.economy_m.goods_count), price_update_delay, [&ws, state_count = ws.w.nation_s.states.size(), nations_count = ws.w.nation_s.nations.size()](uint32_t i) {
-			economy_single_good_tick(ws, goods_tag(goods_tag::value_base_t(i)), state_count, nations_count);
-		});
+		if(ws.w.economy_s.price_mode == price_solver::market_clearing) {
+			concurrency::parallel_for(1, int32_t(ws.s.economy_m.goods_count), [&ws, state_count = ws.w.nation_s.states.size(), nations_count = ws.w.nation_s.nations.size()](int32_t i) {
+				clear_single_good_market(ws, goods_tag(goods_tag::value_base_t(i)), state_count, nations_count, ws.w.economy_s.clearing_iteration_budget);
+			});
+		} else {
+			auto offset = (to_index(ws.w.current_date)) & (price_update_delay - 1);
+			concurrency::parallel_for(1 + offset, int32_t(ws.s.economy_m.goods_count), price_update_delay, [&ws, state_count = ws.w.nation_s.states.size(), nations_count = ws.w.nation_s.nations.size()](uint32_t i) {
+				economy_single_good_tick(ws, goods_tag(goods_tag::value_base_t(i)), state_count, nations_count);
+			});
+		}
 		
 		collect_taxes(ws);
+		pay_unemployment_pensions_salaries(ws);
 
-		//collect tarrif income, pay pops, manage debt
+		//collect tarrif income, manage debt
 		ws.w.nation_s.nations.parallel_for_each([&ws](nations::country_tag n) {
 			auto tincome = ws.w.nation_s.collected_tariffs.get_row(n);
 
@@ -2447,8 +2611,6 @@ namespace economy {
 			assert(std::isfinite(tincome_sum));
 			treasury += tincome_sum;
 
-			pay_unemployment_pensions_salaries(ws, n);
-
 			auto amount = calculate_daily_debt_payment(ws, n);
 			auto paid = std::clamp(treasury, 0.0f, amount);
 			ws.w.nation_s.nations.get<nation::national_debt>(n) += (amount - paid) - amount / 2.0f;
@@ -2460,77 +2622,135 @@ namespace economy {
 			}
 
 		});
+
+		// every nation's markets, production and budget moved
+		ws.w.gui_m.publish_change_for_all(ui::world_data::nation_economy, uint32_t(ws.w.nation_s.nations.size()));
+	}
+
+	// tax and salary passes walk the pop columns in blocks rather than walking the pops of each nation, so that a
+	// few very large nations do not become single serial tasks. Each pass writes what it moved per pop together
+	// with the slot of the pop's owner (0 for pops outside of any nation, to_index(n) + 1 otherwise); the per
+	// nation totals are then formed with ve::scatter_add, whose fixed partitions keep them independent of scheduling
+
+	namespace {
+		std::vector<int32_t> strata_by_pop_type(world_state const& ws) {
+			std::vector<int32_t> result(ws.s.population_m.count_poptypes + 1, 2); // one leading slot for the null pop type
+			for(uint32_t i = 0; i < ws.s.population_m.count_poptypes; ++i) {
+				auto const strata = ws.s.population_m.pop_types[population::pop_type_tag(population::pop_type_tag::value_base_t(i))].flags & population::pop_type::strata_mask;
+				result[i + 1] = strata == population::pop_type::strata_poor ? 0 : (strata == population::pop_type::strata_middle ? 1 : 2);
+			}
+			return result;
+		}
 	}
 
+	struct collect_taxes_operation {
+		tagged_array_view<float, population::pop_tag> pop_money;
+		const_row_type<pop::container, pop::type> pop_types;
+		tagged_array_view<provinces::province_tag const, population::pop_tag> pop_locations;
+		tagged_array_view<nations::country_tag const, provinces::province_tag> province_owners;
+
+		tagged_array_view<float const, nations::country_tag> poor_rate;
+		tagged_array_view<float const, nations::country_tag> middle_rate;
+		tagged_array_view<float const, nations::country_tag> rich_rate;
+		tagged_array_view<float const, nations::country_tag> efficiency;
+		int32_t const* strata_by_type;
+
+		tagged_array_view<float, population::pop_tag> collected_out;
+		tagged_array_view<float, population::pop_tag> tax_base_out;
+		tagged_array_view<int32_t, population::pop_tag> nation_slot_out;
+		tagged_array_view<int32_t, population::pop_tag> strata_slot_out;
+
+		collect_taxes_operation(world_state& w,
+			tagged_array_view<float const, nations::country_tag> pr,
+			tagged_array_view<float const, nations::country_tag> mr,
+			tagged_array_view<float const, nations::country_tag> rr,
+			tagged_array_view<float const, nations::country_tag> eff,
+			int32_t const* st,
+			tagged_array_view<float, population::pop_tag> c,
+			tagged_array_view<float, population::pop_tag> b,
+			tagged_array_view<int32_t, population::pop_tag> ns,
+			tagged_array_view<int32_t, population::pop_tag> ss) :
+			pop_money(w.w.population_s.pops.get_row<pop::money>()),
+			pop_types(w.w.population_s.pops.get_row<pop::type>()),
+			pop_locations(w.w.population_s.pops.get_row<pop::location>()),
+			province_owners(w.w.province_s.province_state_container.get_row<province_state::owner>()),
+			poor_rate(pr), middle_rate(mr), rich_rate(rr), efficiency(eff), strata_by_type(st),
+			collected_out(c), tax_base_out(b), nation_slot_out(ns), strata_slot_out(ss) {}
+
+		template<typename T>
+		void operator()(T pop_v) {
+			auto const owners = ve::load(ve::load(pop_v, pop_locations), province_owners);
+			auto const strata = ve::load(ve::int_vector(ve::load(pop_v, pop_types).value), strata_by_type);
+
+			auto const rate = ve::select(strata == ve::int_vector(0), ve::load(owners, poor_rate),
+				ve::select(strata == ve::int_vector(1), ve::load(owners, middle_rate), ve::load(owners, rich_rate)));
+
+			auto const money = ve::load(pop_v, pop_money);
+			auto const collected = ve::min(money * rate, money);
+			ve::store(pop_v, pop_money, money - collected);
+
+			auto const slot = ve::int_vector(owners.value);
+			ve::store(pop_v, collected_out, collected);
+			ve::store(pop_v, tax_base_out, money * ve::load(owners, efficiency));
+			ve::store(pop_v, nation_slot_out, slot);
+			ve::store(pop_v, strata_slot_out, slot * ve::int_vector(3) + strata);
+		}
+	};
+
 	void collect_taxes(world_state& ws) {
 		ws.w.local_player_data.collected_poor_tax = 0;
 		ws.w.local_player_data.collected_middle_tax = 0;
 		ws.w.local_player_data.collected_rich_tax = 0;
 
-		ws.w.nation_s.nations.parallel_for_each([&ws](nations::country_tag n) {
-			auto& tax_base = ws.w.nation_s.nations.get<nation::tax_base>(n);
-			tax_base = 0.0f;
+		auto const nations_count = uint32_t(ws.w.nation_s.nations.size());
+		auto const pop_count = ws.w.population_s.pops.vector_size();
+
+		concurrent_cache_aligned_buffer<float, nations::country_tag, true> poor_rate(nations_count);
+		concurrent_cache_aligned_buffer<float, nations::country_tag, true> middle_rate(nations_count);
+		concurrent_cache_aligned_buffer<float, nations::country_tag, true> rich_rate(nations_count);
+		concurrent_cache_aligned_buffer<float, nations::country_tag, true> efficiency(nations_count);
+
+		ws.w.nation_s.nations.parallel_for_each([&ws, &poor_rate, &middle_rate, &rich_rate, &efficiency](nations::country_tag n) {
 			auto taxeff = std::max(ws.s.modifiers_m.global_defines.base_country_tax_efficiency + ws.w.nation_s.modifier_values.get<modifiers::national_offsets::tax_efficiency>(n), 0.05f);
-			auto pt = ws.w.nation_s.nations.get<nation::f_poor_tax>(n);
-			auto mt = ws.w.nation_s.nations.get<nation::f_middle_tax>(n);
-			auto rt = ws.w.nation_s.nations.get<nation::f_rich_tax>(n);
-			if(n != ws.w.local_player_nation) {
-				money_qnty_type total = 0;
-				nations::for_each_pop(ws, n, [&total, &ws, &tax_base, n, taxeff, pt, mt, rt](population::pop_tag p) {
-					auto p_type = ws.w.population_s.pops.get<pop::type>(p);
-					auto& p_money = ws.w.population_s.pops.get<pop::money>(p);
-					auto strata = ws.s.population_m.pop_types[p_type].flags & population::pop_type::strata_mask;
-					if(strata == population::pop_type::strata_poor) {
-						auto collected = std::min(p_money * pt * taxeff, p_money);
-						total += collected;
-						tax_base += p_money * taxeff;
-						p_money -= collected;
-					} else if(strata == population::pop_type::strata_middle) {
-						auto collected = std::min(p_money * mt * taxeff, p_money);
-						total += collected;
-						tax_base += p_money * taxeff;
-						p_money -= collected;
-					} else { // strata rich
-						auto collected = std::min(p_money * rt * taxeff, p_money);
-						total += collected;
-						tax_base += p_money * taxeff;
-						p_money -= collected;
-					}
-				});
-				ws.w.nation_s.nations.get<nation::treasury>(n) += total;
-			} else {
-				money_qnty_type total = 0;
-				nations::for_each_pop(ws, n, [&total, &ws, &tax_base, n, taxeff, pt, mt, rt](population::pop_tag p) {
-					auto p_type = ws.w.population_s.pops.get<pop::type>(p);
-					auto& p_money = ws.w.population_s.pops.get<pop::money>(p);
-
-					assert(std::isfinite(p_money));
-
-					auto strata = ws.s.population_m.pop_types[p_type].flags & population::pop_type::strata_mask;
-					if(strata == population::pop_type::strata_poor) {
-						auto collected = std::min(p_money * pt * taxeff, p_money);
-						total += collected;
-						ws.w.local_player_data.collected_poor_tax += p_money * taxeff;
-						tax_base += p_money * taxeff;
-						p_money -= collected;
-					} else if(strata == population::pop_type::strata_middle) {
-						auto collected = std::min(p_money * mt * taxeff, p_money);
-						total += collected;
-						ws.w.local_player_data.collected_middle_tax += p_money * taxeff;
-						tax_base += p_money * taxeff;
-						p_money -= collected;
-					} else { // strata rich
-						auto collected = std::min(p_money * rt * taxeff, p_money);
-						total += collected;
-						ws.w.local_player_data.collected_rich_tax += p_money * taxeff;
-						tax_base += p_money * taxeff;
-						p_money -= collected;
-					}
-				});
-				ws.w.nation_s.nations.get<nation::treasury>(n) += total;
-			}
+			poor_rate[n] = ws.w.nation_s.nations.get<nation::f_poor_tax>(n) * taxeff;
+			middle_rate[n] = ws.w.nation_s.nations.get<nation::f_middle_tax>(n) * taxeff;
+			rich_rate[n] = ws.w.nation_s.nations.get<nation::f_rich_tax>(n) * taxeff;
+			efficiency[n] = taxeff;
 		});
 
+		auto const strata_by_type = strata_by_pop_type(ws);
+
+		concurrent_cache_aligned_buffer<float, population::pop_tag, true> collected(pop_count);
+		concurrent_cache_aligned_buffer<float, population::pop_tag, true> tax_base(pop_count);
+		concurrent_cache_aligned_buffer<int32_t, population::pop_tag, true> nation_slot(pop_count);
+		concurrent_cache_aligned_buffer<int32_t, population::pop_tag, true> strata_slot(pop_count);
+
+		ve::execute_parallel<population::pop_tag>(pop_count, collect_taxes_operation(ws,
+			poor_rate.view(), middle_rate.view(), rich_rate.view(), efficiency.view(), strata_by_type.data(),
+			collected.view(), tax_base.view(), nation_slot.view(), strata_slot.view()));
+
+		// data() is the padding slot, which receives the pops outside of any nation
+		concurrent_cache_aligned_buffer<float, nations::country_tag, true> collected_by_nation(nations_count);
+		concurrent_cache_aligned_buffer<float, int32_t, false> tax_base_by_strata((nations_count + 1) * 3);
+
+		ve::scatter_add(pop_count, nation_slot.view(), collected.view(),
+			nations_count + 1, tagged_array_view<float, int32_t>(collected_by_nation.data(), int32_t(nations_count + 1)), ve::par());
+		ve::scatter_add(pop_count, strata_slot.view(), tax_base.view(),
+			(nations_count + 1) * 3, tax_base_by_strata.view(), ve::par());
+
+		ws.w.nation_s.nations.parallel_for_each([&ws, &collected_by_nation, &tax_base_by_strata](nations::country_tag n) {
+			auto const strata_row = (to_index(n) + 1) * 3;
+			ws.w.nation_s.nations.get<nation::tax_base>(n) = tax_base_by_strata[strata_row] + tax_base_by_strata[strata_row + 1] + tax_base_by_strata[strata_row + 2];
+			ws.w.nation_s.nations.get<nation::treasury>(n) += collected_by_nation[n];
+		});
+
+		if(auto const player = ws.w.local_player_nation; is_valid_index(player)) {
+			auto const strata_row = (to_index(player) + 1) * 3;
+			ws.w.local_player_data.collected_poor_tax = tax_base_by_strata[strata_row];
+			ws.w.local_player_data.collected_middle_tax = tax_base_by_strata[strata_row + 1];
+			ws.w.local_player_data.collected_rich_tax = tax_base_by_strata[strata_row + 2];
+		}
+
 		update_bankrupcy(ws);
 	}
 
@@ -2681,129 +2901,132 @@ namespace economy {
 		return cost_with_waste;
 	}
 
-	void pay_unemployment_pensions_salaries(world_state& ws, nations::country_tag n) {
-		auto ncap = ws.w.nation_s.nations.get<nation::current_capital>(n);
-		if(!is_valid_index(ncap))
-			return;
+	struct pay_pops_operation {
+		tagged_array_view<float, population::pop_tag> pop_money;
+		const_row_type<pop::container, pop::size> pop_size;
+		const_row_type<pop::container, pop::type> pop_types;
+		tagged_array_view<provinces::province_tag const, population::pop_tag> pop_locations;
+		tagged_array_view<nations::country_tag const, provinces::province_tag> province_owners;
+		tagged_array_view<nations::state_tag const, provinces::province_tag> province_states;
+
+		// indexed by nation slot * type_stride + pop type slot
+		float const* pension_by_type;
+		float const* unemployment_by_type;
+		float const* salary_by_type;
+		int32_t const type_stride;
+
+		tagged_array_view<float, population::pop_tag> paid_out;
+		tagged_array_view<int32_t, population::pop_tag> nation_slot_out;
+
+		world_state const& ws;
+
+		pay_pops_operation(world_state& w, float const* p, float const* u, float const* s, int32_t stride,
+			tagged_array_view<float, population::pop_tag> po, tagged_array_view<int32_t, population::pop_tag> ns) :
+			pop_money(w.w.population_s.pops.get_row<pop::money>()),
+			pop_size(w.w.population_s.pops.get_row<pop::size>()),
+			pop_types(w.w.population_s.pops.get_row<pop::type>()),
+			pop_locations(w.w.population_s.pops.get_row<pop::location>()),
+			province_owners(w.w.province_s.province_state_container.get_row<province_state::owner>()),
+			province_states(w.w.province_s.province_state_container.get_row<province_state::state_instance>()),
+			pension_by_type(p), unemployment_by_type(u), salary_by_type(s), type_stride(stride),
+			paid_out(po), nation_slot_out(ns), ws(w) {}
+
+		template<typename T>
+		void operator()(T pop_v) {
+			auto const province_indices = ve::load(pop_v, pop_locations);
+			auto const owners = ve::load(province_indices, province_owners);
+			auto const colonial = nations::is_colonial_or_protectorate(ws, ve::load(province_indices, province_states));
+
+			auto const slot = ve::int_vector(owners.value);
+			auto const table_index = slot * ve::int_vector(type_stride) + ve::int_vector(ve::load(pop_v, pop_types).value);
+
+			auto const size = ve::load(pop_v, pop_size);
+			auto const employed = ve::apply(pop_v, [_this = this](population::pop_tag p) {
+				if(_this->ws.w.population_s.pops.is_valid_index(p))
+					return _this->ws.w.population_s.pop_demographics.get(p, population::total_employment_tag);
+				else
+					return 0.0f;
+			});
+			auto const unemployment = 1.0f - employed / size;
 
-		auto capital_state_id = ws.w.province_s.province_state_container.get<province_state::state_instance>(ncap);
-		auto capital_of_capital = nations::get_state_capital(ws, capital_state_id);
+			auto const salary = ve::load(table_index, salary_by_type);
+			auto const core_amount = ve::multiply_and_add(ve::load(table_index, unemployment_by_type), unemployment, ve::load(table_index, pension_by_type)) + salary;
+			auto const colonial_amount = salary * 0.5f; // colonial reduction; no pensions or unemployment
 
-		tagged_array_view<float, goods_tag> masked_prices(
-			(economy::money_qnty_type*)ve_aligned_alloca(sizeof(economy::money_qnty_type) * ws.s.economy_m.aligned_32_goods_count),
-			ws.s.economy_m.aligned_32_goods_count);
-		create_masked_prices(masked_prices, ws, capital_state_id);
+			auto const amount = ve::select(size > 0.0f, (size / pop_needs_divisor) * ve::select(colonial, colonial_amount, core_amount), ve::fp_vector());
+			ve::store(pop_v, pop_money, ve::load(pop_v, pop_money) + amount);
+			ve::store(pop_v, paid_out, amount);
+			ve::store(pop_v, nation_slot_out, slot);
+		}
+	};
 
-		economy::money_qnty_type* life_needs_cost_by_type = (economy::money_qnty_type*)ve_aligned_alloca(sizeof(economy::money_qnty_type) * ws.s.population_m.count_poptypes);
-		economy::money_qnty_type* everyday_needs_cost_by_type = (economy::money_qnty_type*)ve_aligned_alloca(sizeof(economy::money_qnty_type) * ws.s.population_m.count_poptypes);
-		economy::money_qnty_type* luxury_needs_cost_by_type = (economy::money_qnty_type*)ve_aligned_alloca(sizeof(economy::money_qnty_type) * ws.s.population_m.count_poptypes);
+	void pay_unemployment_pensions_salaries(world_state& ws) {
+		auto const nations_count = uint32_t(ws.w.nation_s.nations.size());
+		auto const pop_count = ws.w.population_s.pops.vector_size();
+		auto const type_stride = int32_t(ws.s.population_m.count_poptypes) + 1;
 
-		fill_needs_costs_arrays(ws, capital_state_id, capital_of_capital, masked_prices, life_needs_cost_by_type, everyday_needs_cost_by_type, luxury_needs_cost_by_type);
+		concurrent_cache_aligned_buffer<float, int32_t, false> pension_by_type((nations_count + 1) * uint32_t(type_stride));
+		concurrent_cache_aligned_buffer<float, int32_t, false> unemployment_by_type((nations_count + 1) * uint32_t(type_stride));
+		concurrent_cache_aligned_buffer<float, int32_t, false> salary_by_type((nations_count + 1) * uint32_t(type_stride));
 
+		// rows of nations without a capital stay zero: they pay nothing
+		ws.w.nation_s.nations.parallel_for_each([&ws, &pension_by_type, &unemployment_by_type, &salary_by_type, type_stride](nations::country_tag n) {
+			auto ncap = ws.w.nation_s.nations.get<nation::current_capital>(n);
+			if(!is_valid_index(ncap))
+				return;
 
-		auto admin_spending = ws.w.nation_s.nations.get<nation::f_administrative_spending>(n);
-		auto education_spending = ws.w.nation_s.nations.get<nation::f_education_spending>(n);
-		auto military_spending = ws.w.nation_s.nations.get<nation::f_military_spending>(n);
-		auto social_spending = ws.w.nation_s.nations.get<nation::f_social_spending>(n);
-		auto pension_fraction = ws.w.nation_s.modifier_values.get<modifiers::national_offsets::pension_level>(n) * social_spending;
-		auto unemployment_fraction = ws.w.nation_s.modifier_values.get<modifiers::national_offsets::unemployment_benefit>(n) * social_spending;
+			auto capital_state_id = ws.w.province_s.province_state_container.get<province_state::state_instance>(ncap);
+			auto capital_of_capital = nations::get_state_capital(ws, capital_state_id);
 
-		economy::money_qnty_type est_costs = 0;
+			tagged_array_view<float, goods_tag> masked_prices(
+				(economy::money_qnty_type*)ve_aligned_alloca(sizeof(economy::money_qnty_type) * ws.s.economy_m.aligned_32_goods_count),
+				ws.s.economy_m.aligned_32_goods_count);
+			create_masked_prices(masked_prices, ws, capital_state_id);
 
-		nations::for_each_state(ws, n, [&ws, &est_costs, pension_fraction, unemployment_fraction, life_needs_cost_by_type, everyday_needs_cost_by_type, luxury_needs_cost_by_type, admin_spending, education_spending, military_spending](nations::state_tag si) {
-			if(!nations::is_colonial_or_protectorate(ws, si)) {
-				nations::for_each_pop(ws, si, [&ws, &est_costs, pension_fraction, unemployment_fraction, life_needs_cost_by_type, everyday_needs_cost_by_type, luxury_needs_cost_by_type, admin_spending, education_spending, military_spending](population::pop_tag p) {
-					auto pop_size = float(ws.w.population_s.pops.get<pop::size>(p));
-					if(pop_size == 0)
-						return;
+			economy::money_qnty_type* life_needs_cost_by_type = (economy::money_qnty_type*)ve_aligned_alloca(sizeof(economy::money_qnty_type) * ws.s.population_m.count_poptypes);
+			economy::money_qnty_type* everyday_needs_cost_by_type = (economy::money_qnty_type*)ve_aligned_alloca(sizeof(economy::money_qnty_type) * ws.s.population_m.count_poptypes);
+			economy::money_qnty_type* luxury_needs_cost_by_type = (economy::money_qnty_type*)ve_aligned_alloca(sizeof(economy::money_qnty_type) * ws.s.population_m.count_poptypes);
 
-					auto pop_size_multiplier = pop_size / pop_needs_divisor;
-					auto unemployment = 1.0f - float(ws.w.population_s.pop_demographics.get(p, population::total_employment_tag)) / pop_size;
-					auto ptype = ws.w.population_s.pops.get<pop::type>(p);
-					auto& p_money = ws.w.population_s.pops.get<pop::money>(p);
-
-					auto pamount = life_needs_cost_by_type[to_index(ptype)] * (pension_fraction + unemployment_fraction * unemployment) * pop_size_multiplier;
-					p_money += pamount;
-					est_costs += pamount;
-
-					if(ptype == ws.s.population_m.bureaucrat) {
-						auto amount = pop_size_multiplier *
-							admin_spending *
-							(life_needs_cost_by_type[to_index(ptype)] + everyday_needs_cost_by_type[to_index(ptype)] + luxury_pay_fraction * luxury_needs_cost_by_type[to_index(ptype)]);
-						p_money += amount;
-						est_costs += amount;
-					} else if(ptype == ws.s.population_m.clergy) {
-						auto amount =
-							pop_size_multiplier *
-							education_spending *
-							(life_needs_cost_by_type[to_index(ptype)] + everyday_needs_cost_by_type[to_index(ptype)] + luxury_pay_fraction * luxury_needs_cost_by_type[to_index(ptype)]);
-						p_money += amount;
-						est_costs += amount;
-					} else if(ptype == ws.s.population_m.soldier) {
-						auto amount =
-							pop_size_multiplier *
-							military_spending *
-							(life_needs_cost_by_type[to_index(ptype)] + everyday_needs_cost_by_type[to_index(ptype)] + luxury_pay_fraction * luxury_needs_cost_by_type[to_index(ptype)]);
-						p_money += amount;
-						est_costs += amount;
-					} else if(ptype == ws.s.population_m.officer) {
-						auto amount =
-							pop_size_multiplier *
-							military_spending *
-							(life_needs_cost_by_type[to_index(ptype)] + everyday_needs_cost_by_type[to_index(ptype)] + luxury_pay_fraction * luxury_needs_cost_by_type[to_index(ptype)]);
-						p_money += amount;
-						est_costs += amount;
-					}
-				});
-			} else {
-				nations::for_each_pop(ws, si, [&ws, &est_costs, life_needs_cost_by_type, everyday_needs_cost_by_type, luxury_needs_cost_by_type, admin_spending, education_spending, military_spending](population::pop_tag p) {
-					auto pop_size = float(ws.w.population_s.pops.get<pop::size>(p));
-					auto pop_size_multiplier = pop_size / pop_needs_divisor;
+			fill_needs_costs_arrays(ws, capital_state_id, capital_of_capital, masked_prices, life_needs_cost_by_type, everyday_needs_cost_by_type, luxury_needs_cost_by_type);
 
-					auto ptype = ws.w.population_s.pops.get<pop::type>(p);
-					auto& p_money = ws.w.population_s.pops.get<pop::money>(p);
-
-					if(ptype == ws.s.population_m.bureaucrat) {
-						auto amount =
-							0.5f * // colonial reduction
-							pop_size_multiplier *
-							admin_spending *
-							(life_needs_cost_by_type[to_index(ptype)] + everyday_needs_cost_by_type[to_index(ptype)] + luxury_pay_fraction * luxury_needs_cost_by_type[to_index(ptype)]);
-						p_money += amount;
-						est_costs += amount;
-					} else if(ptype == ws.s.population_m.clergy) {
-						auto amount =
-							0.5f * // colonial reduction
-							pop_size_multiplier *
-							education_spending *
-							(life_needs_cost_by_type[to_index(ptype)] + everyday_needs_cost_by_type[to_index(ptype)] + luxury_pay_fraction * luxury_needs_cost_by_type[to_index(ptype)]);
-						p_money += amount;
-						est_costs += amount;
-					} else if(ptype == ws.s.population_m.soldier) {
-						auto amount =
-							0.5f * // colonial reduction
-							pop_size_multiplier *
-							military_spending *
-							(life_needs_cost_by_type[to_index(ptype)] + everyday_needs_cost_by_type[to_index(ptype)] + luxury_pay_fraction * luxury_needs_cost_by_type[to_index(ptype)]);
-						p_money += amount;
-						est_costs += amount;
-					} else if(ptype == ws.s.population_m.officer) {
-						auto amount =
-							0.5f * // colonial reduction
-							pop_size_multiplier *
-							military_spending *
-							(life_needs_cost_by_type[to_index(ptype)] + everyday_needs_cost_by_type[to_index(ptype)] + luxury_pay_fraction * luxury_needs_cost_by_type[to_index(ptype)]);
-						p_money += amount;
-						est_costs += amount;
-					}
-				});
+			auto admin_spending = ws.w.nation_s.nations.get<nation::f_administrative_spending>(n);
+			auto education_spending = ws.w.nation_s.nations.get<nation::f_education_spending>(n);
+			auto military_spending = ws.w.nation_s.nations.get<nation::f_military_spending>(n);
+			auto social_spending = ws.w.nation_s.nations.get<nation::f_social_spending>(n);
+			auto pension_fraction = ws.w.nation_s.modifier_values.get<modifiers::national_offsets::pension_level>(n) * social_spending;
+			auto unemployment_fraction = ws.w.nation_s.modifier_values.get<modifiers::national_offsets::unemployment_benefit>(n) * social_spending;
+
+			auto const row = (to_index(n) + 1) * type_stride + 1;
+			for(uint32_t i = 0; i < ws.s.population_m.count_poptypes; ++i) {
+				population::pop_type_tag this_type(static_cast<population::pop_type_tag::value_base_t>(i));
+
+				pension_by_type[row + i] = life_needs_cost_by_type[i] * pension_fraction;
+				unemployment_by_type[row + i] = life_needs_cost_by_type[i] * unemployment_fraction;
+
+				auto const spending =
+					this_type == ws.s.population_m.bureaucrat ? admin_spending :
+					(this_type == ws.s.population_m.clergy ? education_spending :
+					((this_type == ws.s.population_m.soldier || this_type == ws.s.population_m.officer) ? military_spending : 0.0f));
+				salary_by_type[row + i] = spending * (life_needs_cost_by_type[i] + everyday_needs_cost_by_type[i] + luxury_pay_fraction * luxury_needs_cost_by_type[i]);
 			}
 		});
 
-		auto cost_with_waste = est_costs * (2.0f - ws.w.nation_s.nations.get<nation::national_administrative_efficiency>(n));
-		ws.w.nation_s.nations.get<nation::treasury>(n) -= cost_with_waste;
-	}
+		concurrent_cache_aligned_buffer<float, population::pop_tag, true> paid(pop_count);
+		concurrent_cache_aligned_buffer<int32_t, population::pop_tag, true> nation_slot(pop_count);
+
+		ve::execute_parallel<population::pop_tag>(pop_count, pay_pops_operation(ws,
+			pension_by_type.data(), unemployment_by_type.data(), salary_by_type.data(), type_stride,
+			paid.view(), nation_slot.view()));
 
+		concurrent_cache_aligned_buffer<float, nations::country_tag, true> paid_by_nation(nations_count);
+		ve::scatter_add(pop_count, nation_slot.view(), paid.view(),
+			nations_count + 1, tagged_array_view<float, int32_t>(paid_by_nation.data(), int32_t(nations_count + 1)), ve::par());
+
+		ws.w.nation_s.nations.parallel_for_each([&ws, &paid_by_nation](nations::country_tag n) {
+			auto cost_with_waste = paid_by_nation[n] * (2.0f - ws.w.nation_s.nations.get<nation::national_administrative_efficiency>(n));
+			ws.w.nation_s.nations.get<nation::treasury>(n) -= cost_with_waste;
+		});
+	}
 
 	bool factory_type_valid_in_state(world_state const& ws, nations::state_tag s, factory_type_tag f_type) {
 		auto& factories = ws.w.nation_s.states.get<state::factories>(s);
@@ -101,7 +101,7 @@ namespace economy {
 	void update_bankrupcy(world_state& ws);
 	bool is_bankrupt(world_state const& ws, nations::country_tag n);
 	void collect_taxes(world_state& ws);
-	void pay_unemployment_pensions_salaries(world_state& ws, nations::country_tag n);
+	void pay_unemployment_pensions_salaries(world_state& ws);
 	void economy_update_tick(world_state& ws);
 	void economy_demand_adjustment_tick(world_state& ws);
 	void update_construction_and_projects(world_state& ws);
@@ -6,6 +6,16 @@ namespace economy {
 	void close_button_s::button_function(ui::simple_button<close_button_s>&, world_state& ws) {
 		ws.w.production_w.hide(ws.w.gui_m);
 	}
+	void production_window_base::update(world_state& ws) {
+		// factories, projects and investments are those of the player's economy
+		if(auto player = ws.w.local_player_nation; player)
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_economy, uint16_t(to_index(player)) });
+	}
+	void build_factory_window_base::update(world_state& ws) {
+		// the costs and profits shown follow the player's markets
+		if(auto player = ws.w.local_player_nation; player)
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_economy, uint16_t(to_index(player)) });
+	}
 	production_window::production_window() : win(std::make_unique<production_window_t>()) {}
 	production_window::~production_window() {}
 	void production_window::hide(ui::gui_manager & gui_m) {
@@ -61,6 +61,7 @@ public:
 
 	 template<typename W>
 	 void on_create(W& w, world_state& ws);
+	 void update(world_state& ws);
 };
 class close_button_s {
 public:
@@ -2651,6 +2652,7 @@ public:
 
 	 template<typename W>
 	 void on_create(W& w, world_state& ws);
+	 void update(world_state& ws);
 };
 class bf_state_name {
 public:
@@ -26,6 +26,11 @@ namespace economy {
 		update(gui_m);
 		ui::make_visible_and_update(gui_m, *(win->associated_object));
 	}
+	void trade_window_base::update(world_state& ws) {
+		// prices, supply and demand are those of the player's markets
+		if(auto player = ws.w.local_player_nation; player)
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_economy, uint16_t(to_index(player)) });
+	}
 	void tw_close_button::button_function(ui::simple_button<tw_close_button>&, world_state & ws) {
 		ws.w.trade_w.hide(ws.w.gui_m);
 	}
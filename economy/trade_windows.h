@@ -16,6 +16,7 @@ public:
 
 	 template<typename W>
 	 void on_create(W& w, world_state& ws);
+	 void update(world_state& ws);
 };
 class tw_close_button {
 public:
@@ -88,71 +88,68 @@ namespace events {
 		}
 	}
 
-	void daily_update(world_state& ws) {
-		int32_t const date_offset = to_index(ws.w.current_date) & 31;
+	constexpr uint32_t event_update_frequency = 32;
 
+	void daily_update(world_state& ws) {
 		concurrency::concurrent_queue<int32_t> fired_once_list;
 		concurrency::concurrent_queue<std::pair<provinces::province_tag, events::event_tag>> player_province_events;
 
-		concurrency::parallel_for(date_offset, int32_t(ws.s.event_m.province_events.size()), 32, [&ws, &fired_once_list, &player_province_events](int32_t i) {
-			auto const e = ws.s.event_m.province_events[i];
-			auto const allow = ws.s.event_m.event_container[e].trigger;
-			auto const allow_data = ws.s.trigger_m.trigger_data.data() + to_index(allow);
-			auto const only_once_type = (ws.s.event_m.event_container[e].flags & event::fire_only_once) != 0;
-
-			if(only_once_type && ws.w.event_s.province_event_has_fired[i])
-				return;
-
-			for(int32_t j = 0; j < ws.s.province_m.first_sea_province; j += ve::vector_size) {
-				auto any_valid = triggers::test_contiguous_trigger(allow_data, ws, ve::contiguous_tags<union_tag>(j), ve::contiguous_tags<union_tag>(j), ve::contiguous_tags<union_tag>(0));
-				if(ve::compress_mask(any_valid) != 0) {
-					auto const chance_tag = ws.s.event_m.event_container[e].mean_time_to_happen;
-					auto const value = modifiers::test_contiguous_multiplicative_factor(chance_tag, ws, ve::contiguous_tags<union_tag>(j), ve::contiguous_tags<union_tag>(0));
-
-					auto chance = 2.0f / ve::max(value, 2.0f);
-					auto neg_chance = 1.0f - chance;
-					auto neg_chance_2 = neg_chance * neg_chance;
-					auto neg_chance_4 = neg_chance_2 * neg_chance_2;
-					auto neg_chance_8 = neg_chance_4 * neg_chance_4;
-					auto neg_chance_16 = neg_chance_8 * neg_chance_8;
-
-					auto full_chance = 1.0f - neg_chance_16;
-					auto& local_gen = get_local_generator();
-
-					bool any_fired = false;
-					ve::apply(any_valid, full_chance, ve::contiguous_tags<union_tag>(j), [&local_gen, &ws, &any_fired, only_once_type, e, &player_province_events](bool inner_valid, float inner_chance, union_tag p) {
-						provinces::province_tag const prov = p;
-						auto const prov_owner = ws.w.province_s.province_state_container.get<province_state::owner>(prov);
-
-						if(inner_valid && is_valid_index(prov_owner) && (!only_once_type || !any_fired)) {
-							std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-							auto const v = dist(local_gen);
-							if(v <= inner_chance) {
-								//fire event
-								if(prov_owner == ws.w.local_player_nation) {
-									player_province_events.push(std::pair<provinces::province_tag, events::event_tag>(prov, e));
-								} else {
-									auto const opt = make_ai_event_choice(ws, e, prov, triggers::const_parameter());
-									auto& gen = get_local_generator();
-									ws.w.pending_commands.add<commands::execute_event>(
-										gen,
-										prov,
-										triggers::parameter(),
-										e,
-										int8_t(opt));
-									gen.advance_n<8>();
+		ws.w.update_schedule.run(int32_t(current_state::amortized_phase::province_events), event_update_frequency, 1ui32, uint32_t(ws.s.event_m.province_events.size()), [&ws, &fired_once_list, &player_province_events](schedule_slice s) {
+			concurrency::parallel_for(int32_t(s.first), int32_t(s.last), [&ws, &fired_once_list, &player_province_events, s](int32_t i) {
+				auto const e = ws.s.event_m.province_events[i];
+				auto const allow = ws.s.event_m.event_container[e].trigger;
+				auto const allow_data = ws.s.trigger_m.trigger_data.data() + to_index(allow);
+				auto const only_once_type = (ws.s.event_m.event_container[e].flags & event::fire_only_once) != 0;
+
+				if(only_once_type && ws.w.event_s.province_event_has_fired[i])
+					return;
+
+				for(int32_t j = 0; j < ws.s.province_m.first_sea_province; j += ve::vector_size) {
+					auto any_valid = triggers::test_contiguous_trigger(allow_data, ws, ve::contiguous_tags<union_tag>(j), ve::contiguous_tags<union_tag>(j), ve::contiguous_tags<union_tag>(0));
+					if(ve::compress_mask(any_valid) != 0) {
+						auto const chance_tag = ws.s.event_m.event_container[e].mean_time_to_happen;
+						auto const value = modifiers::test_contiguous_multiplicative_factor(chance_tag, ws, ve::contiguous_tags<union_tag>(j), ve::contiguous_tags<union_tag>(0));
+
+						// chance per two days; the event had s.ticks days to fire since it was last tested
+						auto chance = 2.0f / ve::max(value, 2.0f);
+						auto neg_chance = 1.0f - chance;
+						auto& local_gen = get_local_generator();
+
+						bool any_fired = false;
+						ve::apply(any_valid, neg_chance, ve::contiguous_tags<union_tag>(j), [&local_gen, &ws, &any_fired, only_once_type, e, &player_province_events, s](bool inner_valid, float inner_neg_chance, union_tag p) {
+							provinces::province_tag const prov = p;
+							auto const prov_owner = ws.w.province_s.province_state_container.get<province_state::owner>(prov);
+
+							if(inner_valid && is_valid_index(prov_owner) && (!only_once_type || !any_fired)) {
+								std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+								auto const v = dist(local_gen);
+								if(v <= 1.0f - std::pow(inner_neg_chance, float(s.ticks) * 0.5f)) {
+									//fire event
+									if(prov_owner == ws.w.local_player_nation) {
+										player_province_events.push(std::pair<provinces::province_tag, events::event_tag>(prov, e));
+									} else {
+										auto const opt = make_ai_event_choice(ws, e, prov, triggers::const_parameter());
+										auto& gen = get_local_generator();
+										ws.w.pending_commands.add<commands::execute_event>(
+											gen,
+											prov,
+											triggers::parameter(),
+											e,
+											int8_t(opt));
+										gen.advance_n<8>();
+									}
+									any_fired = true;
 								}
-								any_fired = true;
 							}
-						}
-					});
+						});
 
-					if(only_once_type && any_fired) {
-						fired_once_list.push(i);
-						return;
+						if(only_once_type && any_fired) {
+							fired_once_list.push(i);
+							return;
+						}
 					}
 				}
-			}
+			});
 		});
 
 	
@@ -182,66 +179,62 @@ namespace events {
 
 		concurrency::concurrent_queue<events::event_tag> player_nation_events;
 
-		concurrency::parallel_for(date_offset, int32_t(ws.s.event_m.country_events.size()), 32, [&ws, &fired_once_list, &player_nation_events](int32_t i) {
-			auto const e = ws.s.event_m.country_events[i];
-			auto const allow = ws.s.event_m.event_container[e].trigger;
-			auto const allow_data = ws.s.trigger_m.trigger_data.data() + to_index(allow);
-			auto const only_once_type = (ws.s.event_m.event_container[e].flags & event::fire_only_once) != 0;
+		ws.w.update_schedule.run(int32_t(current_state::amortized_phase::national_events), event_update_frequency, 1ui32, uint32_t(ws.s.event_m.country_events.size()), [&ws, &fired_once_list, &player_nation_events](schedule_slice s) {
+			concurrency::parallel_for(int32_t(s.first), int32_t(s.last), [&ws, &fired_once_list, &player_nation_events, s](int32_t i) {
+				auto const e = ws.s.event_m.country_events[i];
+				auto const allow = ws.s.event_m.event_container[e].trigger;
+				auto const allow_data = ws.s.trigger_m.trigger_data.data() + to_index(allow);
+				auto const only_once_type = (ws.s.event_m.event_container[e].flags & event::fire_only_once) != 0;
 
-			if(only_once_type && ws.w.event_s.country_event_has_fired[i])
-				return;
+				if(only_once_type && ws.w.event_s.country_event_has_fired[i])
+					return;
 
-			auto const nation_count = ws.w.nation_s.nations.size();
-			for(int32_t j = 0; j < nation_count; j += ve::vector_size) {
-				auto any_valid = nations::nation_exists(ws, ve::contiguous_tags<nations::country_tag>(j)) & triggers::test_contiguous_trigger(allow_data, ws, ve::contiguous_tags<union_tag>(j), ve::contiguous_tags<union_tag>(j), ve::contiguous_tags<union_tag>(0));
+				auto const nation_count = ws.w.nation_s.nations.size();
+				for(int32_t j = 0; j < nation_count; j += ve::vector_size) {
+					auto any_valid = nations::nation_exists(ws, ve::contiguous_tags<nations::country_tag>(j)) & triggers::test_contiguous_trigger(allow_data, ws, ve::contiguous_tags<union_tag>(j), ve::contiguous_tags<union_tag>(j), ve::contiguous_tags<union_tag>(0));
 				
-				if(ve::compress_mask(any_valid) != 0) {
-					auto const chance_tag = ws.s.event_m.event_container[e].mean_time_to_happen;
-					auto const value = modifiers::test_contiguous_multiplicative_factor(chance_tag, ws, ve::contiguous_tags<union_tag>(j), ve::contiguous_tags<union_tag>(0));
-
-					auto chance = 1.0f / ve::max(value, 1.0f);
-					auto neg_chance = 1.0f - chance;
-					auto neg_chance_2 = neg_chance * neg_chance;
-					auto neg_chance_4 = neg_chance_2 * neg_chance_2;
-					auto neg_chance_8 = neg_chance_4 * neg_chance_4;
-					auto neg_chance_16 = neg_chance_8 * neg_chance_8;
-
-					auto full_chance = 1.0f - neg_chance_16;
-					auto& local_gen = get_local_generator();
-
-					bool any_fired = false;
-					ve::apply(any_valid, full_chance, ve::contiguous_tags<union_tag>(j), [&local_gen, &ws, &any_fired, only_once_type, e, &player_nation_events](bool inner_valid, float inner_chance, union_tag p) {
-						nations::country_tag const n = p;
-
-						if(inner_valid && (!only_once_type || !any_fired)) {
-							std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-							auto const v = dist(local_gen);
-							if(v <= inner_chance) {
-								//fire event
-								if(n == ws.w.local_player_nation) {
-									player_nation_events.push( e);
-								} else {
-									auto const opt = make_ai_event_choice(ws, e, n, triggers::const_parameter());
-									auto& gen = get_local_generator();
-									ws.w.pending_commands.add<commands::execute_event>(
-										gen,
-										n,
-										triggers::parameter(),
-										e,
-										int8_t(opt));
-									gen.advance_n<8>();
+					if(ve::compress_mask(any_valid) != 0) {
+						auto const chance_tag = ws.s.event_m.event_container[e].mean_time_to_happen;
+						auto const value = modifiers::test_contiguous_multiplicative_factor(chance_tag, ws, ve::contiguous_tags<union_tag>(j), ve::contiguous_tags<union_tag>(0));
+
+						auto chance = 1.0f / ve::max(value, 1.0f);
+						auto neg_chance = 1.0f - chance;
+						auto& local_gen = get_local_generator();
+
+						bool any_fired = false;
+						ve::apply(any_valid, neg_chance, ve::contiguous_tags<union_tag>(j), [&local_gen, &ws, &any_fired, only_once_type, e, &player_nation_events, s](bool inner_valid, float inner_neg_chance, union_tag p) {
+							nations::country_tag const n = p;
+
+							if(inner_valid && (!only_once_type || !any_fired)) {
+								std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+								auto const v = dist(local_gen);
+								if(v <= 1.0f - std::pow(inner_neg_chance, float(s.ticks) * 0.5f)) {
+									//fire event
+									if(n == ws.w.local_player_nation) {
+										player_nation_events.push( e);
+									} else {
+										auto const opt = make_ai_event_choice(ws, e, n, triggers::const_parameter());
+										auto& gen = get_local_generator();
+										ws.w.pending_commands.add<commands::execute_event>(
+											gen,
+											n,
+											triggers::parameter(),
+											e,
+											int8_t(opt));
+										gen.advance_n<8>();
+									}
+									any_fired = true;
 								}
-								any_fired = true;
 							}
-						}
-					});
+						});
 
-					if(only_once_type && any_fired) {
-						fired_once_list.push(i);
-						return;
+						if(only_once_type && any_fired) {
+							fired_once_list.push(i);
+							return;
+						}
 					}
 				}
-			}
+			});
 		});
 
 
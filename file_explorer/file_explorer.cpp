@@ -166,7 +166,7 @@ struct gui_window_handler {
 		}
 	}
 	void initialize_graphics(graphics::open_gl_wrapper& ogl) {
-		s.s.gui_m.fonts.load_fonts(ogl);
+		s.s.gui_m.fonts.load_fonts(ogl, u"D:\\VS2007Projects\\open_v2_test_data");
 	
 		//map.initialize(ogl, s.province_m.province_map_data.data(), s.province_m.province_map_width, s.province_m.province_map_height, 0.0f, -1.2f, 1.2f);
 		s.w.map.initialize(ogl, s, shadows_file, map_bg_file, s.s.province_m.province_map_data.data(), s.s.province_m.province_map_width, s.s.province_m.province_map_height, 0.0f, 1.57f, -1.57f);
@@ -182,6 +182,8 @@ struct gui_window_handler {
 
 		if (s.w.gui_m.check_and_clear_update()) {
 			ui::update(s);
+		} else if (s.w.gui_m.check_and_clear_data_update()) {
+			ui::update_changed(s);
 		} else if (s.w.gui_m.check_and_clear_minimal_update()) {
 			ui::minimal_update(s);
 		}
@@ -231,12 +233,11 @@ int main(int , char **) {
 		std::cout << "end scenario read" << std::endl << std::flush;
 
 		std::cout << "begin map read" << std::endl << std::flush;
-		provinces::load_province_map_data(s1.province_m, fs.get_root());
+		auto adj_map = provinces::load_province_map_and_adjacencies(s1.province_m, fs.get_root(), u"D:\\VS2007Projects\\open_v2_test_data");
 
 		std::cout << "end map read" << std::endl << std::flush;
 
 		std::cout << "begin map adjacency" << std::endl << std::flush;
-		auto adj_map = provinces::generate_map_adjacencies(s1.province_m.province_map_data.data(), s1.province_m.province_map_height, s1.province_m.province_map_width);
 		provinces::read_adjacnencies_file(adj_map, fs.get_root(), s1);
 		provinces::make_lakes(adj_map, s1.province_m);
 		provinces::make_adjacency(adj_map, s1.province_m);
@@ -265,6 +266,8 @@ int main(int , char **) {
 	std::cout << "end deserialize" << std::endl << std::flush;
 
 	scenario::ready_scenario(ws.s, fs.get_root()); // ready gui fonts and sound
+	ws.s.gui_m.textures.cache_directory = u"D:\\VS2007Projects\\open_v2_test_data";
+	ws.s.gui_m.textures.load_all_texture_files();
 	ready_world_state(ws);
 
 	if(DWORD dwAttrib = GetFileAttributes((const wchar_t*)(u"D:\\VS2007Projects\\open_v2_test_data\\test_save_cmp.bin")); dwAttrib == INVALID_FILE_ATTRIBUTES) {
@@ -23,6 +23,11 @@ namespace governments {
 	void bw_close_button::button_function(ui::simple_button<bw_close_button>&, world_state & ws) {
 		ws.w.budget_w.hide(ws.w.gui_m);
 	}
+	void budget_window_base::update(world_state& ws) {
+		// income, expenses and the treasury are those of the player's economy
+		if(auto player = ws.w.local_player_nation; player)
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_economy, uint16_t(to_index(player)) });
+	}
 	void hidden_button::on_create(ui::simple_button<hidden_button>& b, world_state & ws) {
 		b.set_visibility(ws.w.gui_m, false);
 	}
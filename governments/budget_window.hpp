@@ -321,6 +321,7 @@ namespace governments {
 
 		template<typename window_type>
 		void on_create(window_type& win, world_state& ws);
+		void update(world_state& ws);
 	};
 
 	class budget_window_t : public ui::gui_window<
@@ -150,68 +150,162 @@ namespace governments {
 		return date_tag();
 	}
 
-	void pop_voting_preferences(world_state const& ws, population::pop_tag p,
-		tagged_array_view<const party_tag, ideologies::ideology_tag> active_parties,
-		tagged_array_view<float, ideologies::ideology_tag> effective_voting, float multiplier) {
-
-		auto const icount = ws.s.ideologies_m.ideologies_count;
-		auto const party_issue_count = ws.s.issues_m.party_issues.size();
-		auto const ideology_vsize = ve::to_vector_size(icount);
+	namespace {
+		// the inputs to the pop vote of one nation, looked up once per election rather than once per pop:
+		// for each ideology, the position within a pop's demographics of the ideology itself (row 0) and of the option
+		// its active party takes on each party issue (rows 1 to issue_count); ideologies without an active party are masked out
+		class party_vote_table {
+		public:
+			int32_t* const offsets;
+			float* const active;
+			int32_t const issue_count;
+			uint32_t const ideology_vsize;
+
+			party_vote_table(int32_t* o, float* a, int32_t ic, uint32_t vs) : offsets(o), active(a), issue_count(ic), ideology_vsize(vs) {}
+
+			tagged_array_view<int32_t const, ideologies::ideology_tag> offset_row(int32_t k) const {
+				return tagged_array_view<int32_t const, ideologies::ideology_tag>(offsets + k * int32_t(ideology_vsize), ideology_vsize);
+			}
+			tagged_array_view<float const, ideologies::ideology_tag> active_row() const {
+				return tagged_array_view<float const, ideologies::ideology_tag>(active, ideology_vsize);
+			}
+		};
 
-		ve::set_zero(ideology_vsize, effective_voting, ve::serial{});
+		int32_t party_vote_table_size(int32_t issue_count, uint32_t ideology_vsize) {
+			return (issue_count + 1) * int32_t(ideology_vsize);
+		}
 
-		for(int32_t i = 0; i < int32_t(icount); ++i) {
-			auto const itag = ideologies::ideology_tag(ideologies::ideology_tag::value_base_t(i));
-			auto const ptag = active_parties[itag];
+		void fill_party_vote_table(world_state const& ws, tagged_array_view<const party_tag, ideologies::ideology_tag> active_parties, party_vote_table const& t) {
+			std::fill_n(t.offsets, party_vote_table_size(t.issue_count, t.ideology_vsize), 0);
+			std::fill_n(t.active, t.ideology_vsize, 0.0f);
 
-			if(ptag) {
-				const auto pcon = ws.w.population_s.pops.get<pop::consciousness>(p);
-				const auto pcon_complement = 1.0f - pcon;
+			for(int32_t i = 0; i < int32_t(ws.s.ideologies_m.ideologies_count); ++i) {
+				auto const itag = ideologies::ideology_tag(ideologies::ideology_tag::value_base_t(i));
+				auto const ptag = active_parties[itag];
 
-				auto const ideology_support = pcon_complement * ws.w.population_s.pop_demographics.get(p, population::to_demo_tag(ws, itag));
+				if(ptag) {
+					t.active[i] = 1.0f;
+					t.offsets[i] = int32_t(to_index(population::to_demo_tag(ws, itag)));
 
-				auto const pissues = ws.s.governments_m.party_issues.get_row(ptag);
-				float issue_support = std::transform_reduce(pissues.begin(), pissues.begin() + party_issue_count, 0.0f, std::plus{}, [pcon, p, &ws](issues::option_tag s) {
-					return pcon * ws.w.population_s.pop_demographics.get(p, population::to_demo_tag(ws, s));
-				});
+					auto const pissues = ws.s.governments_m.party_issues.get_row(ptag);
+					for(int32_t k = 0; k < t.issue_count; ++k)
+						t.offsets[(k + 1) * int32_t(t.ideology_vsize) + i] = int32_t(to_index(population::to_demo_tag(ws, pissues[uint32_t(k)])));
+				}
+			}
+		}
 
-				effective_voting[itag] = ideology_support + issue_support;
+		class pop_vote_operation {
+		public:
+			party_vote_table const& parties;
+			float const* const demographics;
+			tagged_array_view<float, ideologies::ideology_tag> const effective_voting;
+			float const pcon;
+
+			pop_vote_operation(party_vote_table const& t, float const* d, tagged_array_view<float, ideologies::ideology_tag> e, float c) :
+				parties(t), demographics(d), effective_voting(e), pcon(c) {}
+
+			template<typename T>
+			RELEASE_INLINE void operator()(T v) {
+				ve::fp_vector issue_support;
+				for(int32_t k = 1; k <= parties.issue_count; ++k)
+					issue_support = issue_support + ve::load(ve::load(v, parties.offset_row(k)), demographics);
+
+				auto const ideology_support = ve::load(ve::load(v, parties.offset_row(0)), demographics);
+				ve::store(v, effective_voting, ve::load(v, parties.active_row())
+					* ve::multiply_and_add(ve::fp_vector(pcon), issue_support, ve::fp_vector(1.0f - pcon) * ideology_support));
 			}
+		};
+
+		void pop_vote(world_state const& ws, population::pop_tag p, party_vote_table const& parties,
+			tagged_array_view<float, ideologies::ideology_tag> effective_voting, float multiplier) {
+
+			ve::execute_serial<ideologies::ideology_tag>(parties.ideology_vsize, pop_vote_operation(parties,
+				ws.w.population_s.pop_demographics.get_row(p).data(), effective_voting, ws.w.population_s.pops.get<pop::consciousness>(p)));
+
+			auto const total_support = ve::reduce(parties.ideology_vsize, effective_voting, ve::serial{});
+			if(total_support != 0.0f)
+				ve::rescale(parties.ideology_vsize, effective_voting, ws.w.population_s.pops.get<pop::size>(p) * multiplier / total_support);
+		}
+
+		struct election_inputs {
+			voting_type vtype = voting_type::unmodified;
+			cultures::culture_tag primary_culture;
+			float poor_vote = 0.0f;
+			float middle_vote = 0.0f;
+			float rich_vote = 0.0f;
+			float accepted_culture_vote = 0.0f;
+			float other_culture_vote = 0.0f;
+		};
+
+		election_inputs make_election_inputs(world_state const& ws, nations::country_tag this_nation, voting_type vtype) {
+			auto const national_rules = ws.w.nation_s.nations.get<nation::current_rules>(this_nation);
+
+			election_inputs result;
+			result.vtype = vtype;
+			result.primary_culture = ws.w.nation_s.nations.get<nation::primary_culture>(this_nation);
+			result.poor_vote = ws.w.nation_s.modifier_values.get<modifiers::national_offsets::poor_vote>(this_nation);
+			result.middle_vote = ws.w.nation_s.modifier_values.get<modifiers::national_offsets::middle_vote>(this_nation);
+			result.rich_vote = ws.w.nation_s.modifier_values.get<modifiers::national_offsets::rich_vote>(this_nation);
+			result.accepted_culture_vote =
+				(national_rules & issues::rules::citizens_rights_mask) == issues::rules::primary_culture_voting ? 0.5f : 1.0f;
+			result.other_culture_vote =
+				(national_rules & issues::rules::citizens_rights_mask) == issues::rules::primary_culture_voting ? 1.0f
+				: ((national_rules & issues::rules::citizens_rights_mask) == issues::rules::culture_voting ? 0.5f : 0.0f);
+			return result;
+		}
+
+		voting_type election_voting_type(world_state const& ws, nations::country_tag this_nation) {
+			auto const national_rules = ws.w.nation_s.nations.get<nation::current_rules>(this_nation);
+			return (national_rules & issues::rules::voting_system_mask) == issues::rules::largest_share ?
+				voting_type::majority : ((national_rules & issues::rules::voting_system_mask) == issues::rules::dhont ? voting_type::normalized : voting_type::additive);
 		}
-		auto const total_support = ve::reduce(ideology_vsize, effective_voting, ve::serial{});
-		if(total_support != 0.0f)
-			ve::rescale(ideology_vsize, effective_voting, ws.w.population_s.pops.get<pop::size>(p) * multiplier / total_support);
+	}
+
+	void pop_voting_preferences(world_state const& ws, population::pop_tag p,
+		tagged_array_view<const party_tag, ideologies::ideology_tag> active_parties,
+		tagged_array_view<float, ideologies::ideology_tag> effective_voting, float multiplier) {
+
+		auto const party_issue_count = int32_t(ws.s.issues_m.party_issues.size());
+		auto const ideology_vsize = ve::to_vector_size(ws.s.ideologies_m.ideologies_count);
+
+		party_vote_table const parties(
+			(int32_t*)ve_aligned_alloca(party_vote_table_size(party_issue_count, ideology_vsize) * sizeof(int32_t)),
+			(float*)ve_aligned_alloca(ideology_vsize * sizeof(float)),
+			party_issue_count, ideology_vsize);
+		fill_party_vote_table(ws, active_parties, parties);
+
+		pop_vote(ws, p, parties, effective_voting, multiplier);
 	}
 
 	void unmodified_province_vote(world_state const& ws, provinces::province_tag p, tagged_array_view<float, ideologies::ideology_tag> province_voting,
-		tagged_array_view<const party_tag, ideologies::ideology_tag> active_parties) {
+		party_vote_table const& parties) {
 
 		auto const icount = ws.s.ideologies_m.ideologies_count;
 		auto const ideology_vsize = ve::to_vector_size(icount);
-		float* const pop_vote = (float*)ve_aligned_alloca(ideology_vsize * sizeof(float));
+		float* const pop_vote_out = (float*)ve_aligned_alloca(ideology_vsize * sizeof(float));
 
 		ve::set_zero(ideology_vsize, province_voting, ve::serial{});
 
-		provinces::for_each_pop(ws, p, [&ws, province_voting, pop_vote, ideology_vsize, active_parties](population::pop_tag o) {
-			pop_voting_preferences(ws, o, active_parties, tagged_array_view<float, ideologies::ideology_tag>(pop_vote, ideology_vsize), 1.0f);
-			ve::accumulate(ideology_vsize, province_voting, tagged_array_view<float, ideologies::ideology_tag>(pop_vote, ideology_vsize), ve::serial{});
+		provinces::for_each_pop(ws, p, [&ws, province_voting, pop_vote_out, ideology_vsize, &parties](population::pop_tag o) {
+			pop_vote(ws, o, parties, tagged_array_view<float, ideologies::ideology_tag>(pop_vote_out, ideology_vsize), 1.0f);
+			ve::accumulate(ideology_vsize, province_voting, tagged_array_view<float, ideologies::ideology_tag>(pop_vote_out, ideology_vsize), ve::serial{});
 		});
 	}
 
 	void additive_province_vote(world_state const& ws, provinces::province_tag p, tagged_array_view<float, ideologies::ideology_tag> province_voting,
-		cultures::culture_tag prime_culture, tagged_array_view<const party_tag, ideologies::ideology_tag> active_parties,
+		cultures::culture_tag prime_culture, party_vote_table const& parties,
 		float national_poor_vote, float national_middle_vote, float national_rich_vote, float accepted_culture_vote, float other_culture_vote) {
 
 		const float province_vote_mod = 1.0f + ws.w.province_s.modifier_values.get<modifiers::provincial_offsets::number_of_voters>(p);
 
 		auto const icount = ws.s.ideologies_m.ideologies_count;
 		auto const ideology_vsize = ve::to_vector_size(icount);
-		float* const pop_vote = (float*)ve_aligned_alloca(ideology_vsize * sizeof(float));
+		float* const pop_vote_out = (float*)ve_aligned_alloca(ideology_vsize * sizeof(float));
 
 		ve::set_zero(ideology_vsize, province_voting, ve::serial{});
 
 		provinces::for_each_pop(ws, p, [&ws, province_voting, prime_culture, national_poor_vote, national_middle_vote, national_rich_vote,
-			accepted_culture_vote, other_culture_vote, pop_vote, ideology_vsize, active_parties](population::pop_tag o) {
+			accepted_culture_vote, other_culture_vote, pop_vote_out, ideology_vsize, &parties](population::pop_tag o) {
 
 			auto const type = ws.w.population_s.pops.get<pop::type>(o);
 			if(ws.s.population_m.slave != type) {
@@ -233,28 +327,28 @@ namespace governments {
 
 				const float vote_mod = type_mod * culture_mod;
 				if(vote_mod > 0.0f) {
-					pop_voting_preferences(ws, o, active_parties, tagged_array_view<float, ideologies::ideology_tag>(pop_vote, ideology_vsize), vote_mod);
-					ve::accumulate(ideology_vsize, province_voting, tagged_array_view<float, ideologies::ideology_tag>(pop_vote, ideology_vsize), ve::serial{});
+					pop_vote(ws, o, parties, tagged_array_view<float, ideologies::ideology_tag>(pop_vote_out, ideology_vsize), vote_mod);
+					ve::accumulate(ideology_vsize, province_voting, tagged_array_view<float, ideologies::ideology_tag>(pop_vote_out, ideology_vsize), ve::serial{});
 				}
 			}
 		});
-		
+
 
 		ve::rescale(ideology_vsize, province_voting, province_vote_mod);
 	}
 
 	void normalized_province_vote(world_state const& ws, provinces::province_tag p, tagged_array_view<float, ideologies::ideology_tag> province_voting,
-		cultures::culture_tag prime_culture, tagged_array_view<const party_tag, ideologies::ideology_tag> active_parties,
+		cultures::culture_tag prime_culture, party_vote_table const& parties,
 		float national_poor_vote, float national_middle_vote, float national_rich_vote, float accepted_culture_vote, float other_culture_vote) {
 
 		auto const icount = ws.s.ideologies_m.ideologies_count;
 		auto const ideology_vsize = ve::to_vector_size(icount);
-		float* const pop_vote = (float*)ve_aligned_alloca(ideology_vsize * sizeof(float));
+		float* const pop_vote_out = (float*)ve_aligned_alloca(ideology_vsize * sizeof(float));
 
 		ve::set_zero(ideology_vsize, province_voting, ve::serial{});
 
 		provinces::for_each_pop(ws, p, [&ws, province_voting, prime_culture, national_poor_vote, national_middle_vote, national_rich_vote,
-			accepted_culture_vote, other_culture_vote, pop_vote, ideology_vsize, active_parties](population::pop_tag o) {
+			accepted_culture_vote, other_culture_vote, pop_vote_out, ideology_vsize, &parties](population::pop_tag o) {
 
 			auto const type = ws.w.population_s.pops.get<pop::type>(o);
 			if(ws.s.population_m.slave != type) {
@@ -276,8 +370,8 @@ namespace governments {
 
 				const float vote_mod = type_mod * culture_mod;
 				if(vote_mod > 0.0f) {
-					pop_voting_preferences(ws, o, active_parties, tagged_array_view<float, ideologies::ideology_tag>(pop_vote, ideology_vsize), vote_mod);
-					ve::accumulate(ideology_vsize, province_voting, tagged_array_view<float, ideologies::ideology_tag>(pop_vote, ideology_vsize), ve::serial{});
+					pop_vote(ws, o, parties, tagged_array_view<float, ideologies::ideology_tag>(pop_vote_out, ideology_vsize), vote_mod);
+					ve::accumulate(ideology_vsize, province_voting, tagged_array_view<float, ideologies::ideology_tag>(pop_vote_out, ideology_vsize), ve::serial{});
 				}
 			}
 		});
@@ -288,7 +382,7 @@ namespace governments {
 	}
 
 	void majority_province_vote(world_state const& ws, provinces::province_tag p, tagged_array_view<float, ideologies::ideology_tag> province_voting,
-		cultures::culture_tag prime_culture, tagged_array_view<const party_tag, ideologies::ideology_tag> active_parties,
+		cultures::culture_tag prime_culture, party_vote_table const& parties,
 		float national_poor_vote, float national_middle_vote, float national_rich_vote, float accepted_culture_vote, float other_culture_vote) {
 
 		const float province_vote_mod = 1.0f + ws.w.province_s.modifier_values.get<modifiers::provincial_offsets::number_of_voters>(p);
@@ -296,14 +390,14 @@ namespace governments {
 		auto const icount = ws.s.ideologies_m.ideologies_count;
 		auto const ideology_vsize = ve::to_vector_size(icount);
 
-		float* const pop_vote = (float*)ve_aligned_alloca(ideology_vsize * sizeof(float));
+		float* const pop_vote_out = (float*)ve_aligned_alloca(ideology_vsize * sizeof(float));
 		float* const province_voting_temp = (float*)ve_aligned_alloca(ideology_vsize * sizeof(float));
 
 		ve::set_zero(ideology_vsize, tagged_array_view<float, ideologies::ideology_tag>(province_voting_temp, ideology_vsize), ve::serial{});
 		ve::set_zero(ideology_vsize, province_voting, ve::serial{});
 
 		provinces::for_each_pop(ws, p, [&ws, province_voting_temp, prime_culture, national_poor_vote, national_middle_vote, national_rich_vote,
-			accepted_culture_vote, other_culture_vote, pop_vote, ideology_vsize, active_parties](population::pop_tag o) {
+			accepted_culture_vote, other_culture_vote, pop_vote_out, ideology_vsize, &parties](population::pop_tag o) {
 
 			auto const type = ws.w.population_s.pops.get<pop::type>(o);
 			if(ws.s.population_m.slave != type) {
@@ -325,8 +419,8 @@ namespace governments {
 
 				const float vote_mod = type_mod * culture_mod;
 				if(vote_mod > 0.0f) {
-					pop_voting_preferences(ws, o, active_parties, tagged_array_view<float, ideologies::ideology_tag>(pop_vote, ideology_vsize), vote_mod);
-					ve::accumulate(ideology_vsize, tagged_array_view<float, ideologies::ideology_tag>(province_voting_temp, ideology_vsize), tagged_array_view<float, ideologies::ideology_tag>(pop_vote, ideology_vsize), ve::serial{});
+					pop_vote(ws, o, parties, tagged_array_view<float, ideologies::ideology_tag>(pop_vote_out, ideology_vsize), vote_mod);
+					ve::accumulate(ideology_vsize, tagged_array_view<float, ideologies::ideology_tag>(province_voting_temp, ideology_vsize), tagged_array_view<float, ideologies::ideology_tag>(pop_vote_out, ideology_vsize), ve::serial{});
 				}
 			}
 		});
@@ -335,148 +429,172 @@ namespace governments {
 		province_voting[ideologies::ideology_tag(ideologies::ideology_tag::value_base_t(max_index))] = province_vote_mod * province_voting_temp[max_index];
 	}
 
-	void populate_voting_info(world_state const& ws, nations::country_tag this_nation,
-		tagged_array_view<float, ideologies::ideology_tag> effective_voting,
-		voting_type vtype) {
+	namespace {
+		void province_vote(world_state const& ws, provinces::province_tag p, tagged_array_view<float, ideologies::ideology_tag> province_voting,
+			election_inputs const& e, party_vote_table const& parties) {
+
+			switch(e.vtype) {
+				case voting_type::unmodified:
+					unmodified_province_vote(ws, p, province_voting, parties);
+					break;
+				case voting_type::additive:
+					additive_province_vote(ws, p, province_voting, e.primary_culture, parties,
+						e.poor_vote, e.middle_vote, e.rich_vote, e.accepted_culture_vote, e.other_culture_vote);
+					break;
+				case voting_type::normalized:
+					normalized_province_vote(ws, p, province_voting, e.primary_culture, parties,
+						e.poor_vote, e.middle_vote, e.rich_vote, e.accepted_culture_vote, e.other_culture_vote);
+					break;
+				case voting_type::majority:
+					majority_province_vote(ws, p, province_voting, e.primary_culture, parties,
+						e.poor_vote, e.middle_vote, e.rich_vote, e.accepted_culture_vote, e.other_culture_vote);
+					break;
+			}
+		}
 
-		auto const ideology_vsize = ve::to_vector_size(ws.s.ideologies_m.ideologies_count);
+		election_result decide_election(world_state const& ws, nations::country_tag this_nation, float* const vote, uint32_t ideology_vsize) {
+			const auto gov_type = ws.w.nation_s.nations.get<nation::current_government>(this_nation);
+			ws.s.ideologies_m.for_each_ideology([&ws, this_nation, vote, gov_type](ideologies::ideology_tag t) {
+				if(ws.s.governments_m.permitted_ideologies.get(gov_type, t) == 0)
+					vote[to_index(t)] = 0.0f;
+			});
+			auto const total_vote = ve::reduce(ws.s.ideologies_m.ideologies_count, tagged_array_view<float, ideologies::ideology_tag>(vote, ideology_vsize), ve::serial_exact{});
 
-		float* const prov_vote = (float*)ve_aligned_alloca(ideology_vsize * sizeof(float));
+			auto total_pop = ws.w.nation_s.nation_demographics.get(this_nation, population::total_population_tag);
+			auto militancy = ws.w.nation_s.nation_demographics.get(this_nation, population::militancy_demo_tag(ws));
 
-		ve::set_zero(ideology_vsize, effective_voting, ve::serial{});
+			const float n_militancy = total_pop != 0 ?  float(militancy) / float(total_pop) : 0.0f;
 
-		const float national_poor_vote = ws.w.nation_s.modifier_values.get<modifiers::national_offsets::poor_vote>(this_nation);
-		const float national_middle_vote = ws.w.nation_s.modifier_values.get<modifiers::national_offsets::middle_vote>(this_nation);
-		const float national_rich_vote = ws.w.nation_s.modifier_values.get<modifiers::national_offsets::rich_vote>(this_nation);
+			if(n_militancy < 0.5f) {
+				float* const group_vote = (float*)_alloca(ws.s.ideologies_m.ideology_groups.size() * sizeof(float));
+				std::fill_n(group_vote, ws.s.ideologies_m.ideology_groups.size(), 0.0f);
+				for(int32_t i = 0; i < int32_t(ws.s.ideologies_m.ideologies_count); ++i) {
+					auto const itag = ideologies::ideology_tag(ideologies::ideology_tag::value_base_t(i));
+					auto const group_tag = ws.s.ideologies_m.ideology_container[itag].group;
 
-		auto const national_rules = ws.w.nation_s.nations.get<nation::current_rules>(this_nation);
+					group_vote[to_index(group_tag)] += vote[i];
+				}
+				ideologies::ideology_group_tag ig(0);
+				for(int32_t i = 1; i < int32_t(ws.s.ideologies_m.ideology_groups.size()); ++i) {
+					if(group_vote[i] > group_vote[to_index(ig)])
+						ig = ideologies::ideology_group_tag(ideologies::ideology_group_tag::value_base_t(i));
+				}
 
-		const float accepted_culture_vote = 
-			(national_rules & issues::rules::citizens_rights_mask) == issues::rules::primary_culture_voting ? 0.5f : 1.0f;
-		const float other_culture_vote = 
-			(national_rules & issues::rules::citizens_rights_mask) == issues::rules::primary_culture_voting ? 1.0f 
-			: ((national_rules & issues::rules::citizens_rights_mask) == issues::rules::culture_voting ? 0.5f : 0.0f);
+				float max = 0;
+				ideologies::ideology_tag mi;
 
-		const auto pculture = ws.w.nation_s.nations.get<nation::primary_culture>(this_nation);
-		const auto active_parties = ws.w.nation_s.active_parties.get_row(this_nation);
+				for(int32_t i = 0; i < int32_t(ws.s.ideologies_m.ideologies_count); ++i) {
+					auto const itag = ideologies::ideology_tag(ideologies::ideology_tag::value_base_t(i));
+					if(ig == ws.s.ideologies_m.ideology_container[itag].group) {
+						if(vote[i] >= max) {
+							max = vote[i];
+							mi = ideologies::ideology_tag(ideologies::ideology_tag::value_base_t(i));
+						}
+					}
+				}
 
-		switch(vtype) {
-			case voting_type::unmodified:
-				nations::for_each_province(ws, this_nation, [effective_voting, accepted_culture_vote, other_culture_vote,
-					national_poor_vote, national_middle_vote, national_rich_vote, pculture, prov_vote, ideology_vsize, active_parties,
-					&ws](provinces::province_tag p) {
+				return election_result{
+					ws.w.nation_s.active_parties.get(this_nation, mi),
+					vote[to_index(mi)] / (total_vote > 0.0f ? total_vote : 1.0f)
+				};
+			} else {
+				auto const max_index = maximum_index(vote, ideology_vsize);
+				return election_result{
+					ws.w.nation_s.active_parties.get(this_nation,ideologies::ideology_tag(ideologies::ideology_tag::value_base_t(max_index))),
+					vote[max_index] / (total_vote > 0.0f ? total_vote : 1.0f)
+				};
+			}
+		}
+	}
 
-					if(ws.w.province_s.province_state_container.get<province_state::is_non_state>(p) == false) {
-						unmodified_province_vote(ws, p, tagged_array_view<float, ideologies::ideology_tag>(prov_vote, ideology_vsize), active_parties);
-						ve::accumulate(ideology_vsize, effective_voting, tagged_array_view<float, ideologies::ideology_tag>(prov_vote, ideology_vsize), ve::serial{});
-					}
-				});
-				break;
-			case voting_type::additive:
-				nations::for_each_province(ws, this_nation, [effective_voting, national_rules, accepted_culture_vote, other_culture_vote,
-					national_poor_vote, national_middle_vote, national_rich_vote, pculture, prov_vote, ideology_vsize, active_parties,
-					&ws](provinces::province_tag p) {
+	void populate_voting_info(world_state const& ws, nations::country_tag this_nation,
+		tagged_array_view<float, ideologies::ideology_tag> effective_voting,
+		voting_type vtype) {
 
-					if(ws.w.province_s.province_state_container.get<province_state::is_non_state>(p) == false) {
-						additive_province_vote(ws, p, tagged_array_view<float, ideologies::ideology_tag>(prov_vote, ideology_vsize),
-							pculture, active_parties, national_poor_vote, national_middle_vote, national_rich_vote, accepted_culture_vote, other_culture_vote);
-						ve::accumulate(ideology_vsize, effective_voting, tagged_array_view<float, ideologies::ideology_tag>(prov_vote, ideology_vsize), ve::serial{});
-					}
-				});
-				break;
-			case voting_type::normalized:
-				nations::for_each_province(ws, this_nation, [effective_voting, national_rules, accepted_culture_vote, other_culture_vote,
-					national_poor_vote, national_middle_vote, national_rich_vote, pculture, prov_vote, ideology_vsize, active_parties,
-					&ws](provinces::province_tag p) {
+		auto const party_issue_count = int32_t(ws.s.issues_m.party_issues.size());
+		auto const ideology_vsize = ve::to_vector_size(ws.s.ideologies_m.ideologies_count);
 
-					if(ws.w.province_s.province_state_container.get<province_state::is_non_state>(p) == false) {
-						normalized_province_vote(ws, p, tagged_array_view<float, ideologies::ideology_tag>(prov_vote, ideology_vsize),
-							pculture, active_parties, national_poor_vote, national_middle_vote, national_rich_vote, accepted_culture_vote, other_culture_vote);
-						ve::accumulate(ideology_vsize, effective_voting, tagged_array_view<float, ideologies::ideology_tag>(prov_vote, ideology_vsize), ve::serial{});
-					}
-				});
-				break;
-			case voting_type::majority:
-				nations::for_each_province(ws, this_nation, [effective_voting, national_rules, accepted_culture_vote, other_culture_vote,
-					national_poor_vote, national_middle_vote, national_rich_vote, pculture, prov_vote, ideology_vsize, active_parties,
-					&ws](provinces::province_tag p) {
+		float* const prov_vote = (float*)ve_aligned_alloca(ideology_vsize * sizeof(float));
 
-					if(ws.w.province_s.province_state_container.get<province_state::is_non_state>(p) == false) {
-						majority_province_vote(ws, p, tagged_array_view<float, ideologies::ideology_tag>(prov_vote, ideology_vsize),
-							pculture, active_parties, national_poor_vote, national_middle_vote, national_rich_vote, accepted_culture_vote, other_culture_vote);
-						ve::accumulate(ideology_vsize, effective_voting, tagged_array_view<float, ideologies::ideology_tag>(prov_vote, ideology_vsize), ve::serial{});
-					}
-				});
-				break;
-		}
-	}
+		ve::set_zero(ideology_vsize, effective_voting, ve::serial{});
 
-	
+		party_vote_table const parties(
+			(int32_t*)ve_aligned_alloca(party_vote_table_size(party_issue_count, ideology_vsize) * sizeof(int32_t)),
+			(float*)ve_aligned_alloca(ideology_vsize * sizeof(float)),
+			party_issue_count, ideology_vsize);
+		fill_party_vote_table(ws, ws.w.nation_s.active_parties.get_row(this_nation), parties);
 
-	election_result perform_election(world_state const& ws, nations::country_tag this_nation) {
-		auto const national_rules = ws.w.nation_s.nations.get<nation::current_rules>(this_nation);
-		voting_type vtype =
-			(national_rules & issues::rules::voting_system_mask) == issues::rules::largest_share ?
-			voting_type::majority : ((national_rules & issues::rules::voting_system_mask) == issues::rules::dhont ? voting_type::normalized : voting_type::additive);
+		auto const inputs = make_election_inputs(ws, this_nation, vtype);
+
+		nations::for_each_province(ws, this_nation, [effective_voting, prov_vote, ideology_vsize, &inputs, &parties, &ws](provinces::province_tag p) {
+			if(ws.w.province_s.province_state_container.get<province_state::is_non_state>(p) == false) {
+				province_vote(ws, p, tagged_array_view<float, ideologies::ideology_tag>(prov_vote, ideology_vsize), inputs, parties);
+				ve::accumulate(ideology_vsize, effective_voting, tagged_array_view<float, ideologies::ideology_tag>(prov_vote, ideology_vsize), ve::serial{});
+			}
+		});
+	}
 
+	void perform_elections(world_state const& ws, nations::country_tag const* electing, election_result* results, int32_t count) {
+		if(count == 0)
+			return;
+
+		auto const party_issue_count = int32_t(ws.s.issues_m.party_issues.size());
 		auto const ideology_vsize = ve::to_vector_size(ws.s.ideologies_m.ideologies_count);
-		float* const vote = (float*)ve_aligned_alloca(ideology_vsize * sizeof(float));
+		auto const table_size = party_vote_table_size(party_issue_count, ideology_vsize);
 
-		populate_voting_info(ws, this_nation, tagged_array_view<float, ideologies::ideology_tag>(vote, ideology_vsize), vtype);
-		
-		const auto gov_type = ws.w.nation_s.nations.get<nation::current_government>(this_nation);
-		ws.s.ideologies_m.for_each_ideology([&ws, this_nation, vote, gov_type](ideologies::ideology_tag t) {
-			if(ws.s.governments_m.permitted_ideologies.get(gov_type, t) == 0)
-				vote[to_index(t)] = 0.0f;
+		std::vector<int32_t, aligned_allocator_32<int32_t>> table_offsets(size_t(table_size * count));
+		std::vector<float, aligned_allocator_32<float>> table_active(size_t(ideology_vsize * count));
+		std::vector<election_inputs> inputs(static_cast<size_t>(count));
+
+		concurrency::parallel_for(0, count, [&](int32_t i) {
+			fill_party_vote_table(ws, ws.w.nation_s.active_parties.get_row(electing[i]),
+				party_vote_table(table_offsets.data() + table_size * i, table_active.data() + ideology_vsize * i, party_issue_count, ideology_vsize));
+			inputs[size_t(i)] = make_election_inputs(ws, electing[i], election_voting_type(ws, electing[i]));
 		});
-		auto const total_vote = ve::reduce(ws.s.ideologies_m.ideologies_count, tagged_array_view<float, ideologies::ideology_tag>(vote, ideology_vsize), ve::serial_exact{});
 
-		auto total_pop = ws.w.nation_s.nation_demographics.get(this_nation, population::total_population_tag);
-		auto militancy = ws.w.nation_s.nation_demographics.get(this_nation, population::militancy_demo_tag(ws));
+		// the provinces of each nation are listed contiguously, in the order in which they are summed
+		std::vector<provinces::province_tag> voting_provinces;
+		std::vector<int32_t> province_nation;
+		std::vector<int32_t> first_province(size_t(count + 1), 0);
+
+		for(int32_t i = 0; i < count; ++i) {
+			first_province[size_t(i)] = int32_t(voting_provinces.size());
+			nations::for_each_province(ws, electing[i], [&ws, &voting_provinces, &province_nation, i](provinces::province_tag p) {
+				if(ws.w.province_s.province_state_container.get<province_state::is_non_state>(p) == false) {
+					voting_provinces.push_back(p);
+					province_nation.push_back(i);
+				}
+			});
+		}
+		first_province[size_t(count)] = int32_t(voting_provinces.size());
 
-		const float n_militancy = total_pop != 0 ?  float(militancy) / float(total_pop) : 0.0f;
+		std::vector<float, aligned_allocator_32<float>> province_votes(voting_provinces.size() * ideology_vsize);
 
-		if(n_militancy < 0.5f) {
-			float* const group_vote = (float*)_alloca(ws.s.ideologies_m.ideology_groups.size() * sizeof(float));
-			std::fill_n(group_vote, ws.s.ideologies_m.ideology_groups.size(), 0.0f);
-			for(int32_t i = 0; i < int32_t(ws.s.ideologies_m.ideologies_count); ++i) {
-				auto const itag = ideologies::ideology_tag(ideologies::ideology_tag::value_base_t(i));
-				auto const group_tag = ws.s.ideologies_m.ideology_container[itag].group;
+		concurrency::parallel_for(0, int32_t(voting_provinces.size()), [&](int32_t j) {
+			auto const n = province_nation[size_t(j)];
+			province_vote(ws, voting_provinces[size_t(j)], tagged_array_view<float, ideologies::ideology_tag>(province_votes.data() + ideology_vsize * j, ideology_vsize),
+				inputs[size_t(n)], party_vote_table(table_offsets.data() + table_size * n, table_active.data() + ideology_vsize * n, party_issue_count, ideology_vsize));
+		});
 
-				group_vote[to_index(group_tag)] += vote[i];
-			}
-			ideologies::ideology_group_tag ig(0);
-			for(int32_t i = 1; i < int32_t(ws.s.ideologies_m.ideology_groups.size()); ++i) {
-				if(group_vote[i] > group_vote[to_index(ig)])
-					ig = ideologies::ideology_group_tag(ideologies::ideology_group_tag::value_base_t(i));
-			}
-			
-			float max = 0;
-			ideologies::ideology_tag mi;
+		concurrency::parallel_for(0, count, [&](int32_t i) {
+			float* const vote = (float*)ve_aligned_alloca(ideology_vsize * sizeof(float));
+			tagged_array_view<float, ideologies::ideology_tag> const vote_view(vote, ideology_vsize);
 
-			for(int32_t i = 0; i < int32_t(ws.s.ideologies_m.ideologies_count); ++i) {
-				auto const itag = ideologies::ideology_tag(ideologies::ideology_tag::value_base_t(i));
-				if(ig == ws.s.ideologies_m.ideology_container[itag].group) {
-					if(vote[i] >= max) {
-						max = vote[i];
-						mi = ideologies::ideology_tag(ideologies::ideology_tag::value_base_t(i));
-					}
-				}
+			ve::set_zero(ideology_vsize, vote_view, ve::serial{});
+			for(int32_t j = first_province[size_t(i)]; j < first_province[size_t(i + 1)]; ++j) {
+				ve::accumulate(ideology_vsize, vote_view,
+					tagged_array_view<float, ideologies::ideology_tag>(province_votes.data() + ideology_vsize * j, ideology_vsize), ve::serial{});
 			}
 
-			return election_result{
-				ws.w.nation_s.active_parties.get(this_nation, mi),
-				vote[to_index(mi)] / (total_vote > 0.0f ? total_vote : 1.0f)
-			};
-		} else {
-			auto const max_index = maximum_index(vote, ideology_vsize);
-			return election_result{
-				ws.w.nation_s.active_parties.get(this_nation,ideologies::ideology_tag(ideologies::ideology_tag::value_base_t(max_index))),
-				vote[max_index] / (total_vote > 0.0f ? total_vote : 1.0f)
-			};
-		}
+			results[i] = decide_election(ws, electing[i], vote, ideology_vsize);
+		});
 	}
 
+	election_result perform_election(world_state const& ws, nations::country_tag this_nation) {
+		election_result result;
+		perform_elections(ws, &this_nation, &result, 1);
+		return result;
+	}
 
 	void unmodified_upper_house_province_vote(world_state const& ws, provinces::province_tag p, tagged_array_view<float, ideologies::ideology_tag> province_voting,
 		cultures::culture_tag prime_culture, float national_poor_vote, float national_middle_vote, float national_rich_vote, float accepted_culture_vote, float other_culture_vote) {
@@ -681,7 +799,13 @@ namespace governments {
 				if(nations::nation_exists(ws, n)) {
 					update_upper_house(ws, n);
 					messages::new_upper_house(ws, n);
+				}
+			});
 
+			std::vector<nations::country_tag> electing;
+			for(int32_t nth = int32_t(to_index(ws.w.current_date) & 15); nth < int32_t(ws.w.nation_s.nations.size()); nth += 16) {
+				auto n = nations::country_tag(nations::country_tag::value_base_t(nth));
+				if(nations::nation_exists(ws, n)) {
 					auto gov = ws.w.nation_s.nations.get<nation::current_government>(n);
 					if(ws.s.governments_m.governments_container[gov].election) {
 
@@ -689,16 +813,28 @@ namespace governments {
 						if(tag_to_date(next_election).year() >= tag_to_date(ws.w.current_date).year()) {
 							ws.w.nation_s.nations.set<nation::last_election>(n, ws.w.current_date);
 
-							if((n != ws.w.local_player_nation || ws.s.governments_m.governments_container[gov].appoint_ruling_party == false)) {
-								if(auto election_res = perform_election(ws, n); election_res.p) {
-									silent_set_ruling_party(ws, n, election_res.p);
-									messages::election_result(ws, n, election_res.p, election_res.vote);
-								}
-							}
+							if((n != ws.w.local_player_nation || ws.s.governments_m.governments_container[gov].appoint_ruling_party == false))
+								electing.push_back(n);
 						}
 					}
 				}
-			});
+			}
+
+			std::vector<election_result> results(electing.size());
+			perform_elections(ws, electing.data(), results.data(), int32_t(electing.size()));
+
+			for(size_t i = 0; i < electing.size(); ++i) {
+				if(results[i].p) {
+					silent_set_ruling_party(ws, electing[i], results[i].p);
+					messages::election_result(ws, electing[i], results[i].p, results[i].vote);
+				}
+			}
+
+			// today's share of the nations has a new upper house, and some of them a new ruling party
+			std::vector<ui::data_key> changed;
+			for(int32_t nth = int32_t(to_index(ws.w.current_date) & 15); nth < int32_t(ws.w.nation_s.nations.size()); nth += 16)
+				changed.push_back(ui::data_key{ ui::world_data::nation_demographics, uint16_t(nth) });
+			ws.w.gui_m.publish_changes(changed);
 		}
 	}
 }
@@ -34,6 +34,7 @@ namespace governments {
 		tagged_array_view<float, ideologies::ideology_tag> effective_voting, float multiplier);
 	void populate_voting_info(world_state const& ws, nations::country_tag this_nation, tagged_array_view<float, ideologies::ideology_tag> effective_voting, voting_type vtype);
 	election_result perform_election(world_state const& ws, nations::country_tag this_nation);
+	void perform_elections(world_state const& ws, nations::country_tag const* electing, election_result* results, int32_t count); // results[i] is the result for electing[i]
 	void update_upper_house(world_state const& ws, nations::country_tag this_nation);
 	void government_composition_update(world_state& ws);
 }
@@ -11,6 +11,11 @@ namespace governments {
 		ui::hide(*(ws.w.government_w.win->choose_window.associated_object));
 		ws.w.government_w.hide_government_window(ws.w.gui_m);
 	}
+	void government_window_base::update(world_state& ws) {
+		// party support, movements, the upper house and the ruling party all follow the player's population
+		if(auto player = ws.w.local_player_nation; player)
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_demographics, uint16_t(to_index(player)) });
+	}
 	void government_type_text_box::update(ui::tagged_gui_object box, ui::text_box_line_manager & lm, ui::text_format & fmt, world_state & ws) {
 		if(auto player = ws.w.local_player_nation; player) {
 			if(auto gov = ws.w.nation_s.nations.get<nation::current_government>(player); is_valid_index(gov)) {
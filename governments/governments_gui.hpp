@@ -130,6 +130,7 @@ namespace governments {
 
 		template<typename W>
 		void on_create(W& w, world_state&);
+		void update(world_state& ws);
 	};
 
 	class close_button {
@@ -0,0 +1,74 @@
+#include "draw_list.h"
+#include <algorithm>
+
+namespace graphics {
+	bool batch_key::operator==(batch_key const& o) const {
+		return texture == o.texture && secondary_texture == o.secondary_texture
+			&& color_function == o.color_function && font_function == o.font_function
+			&& scissor[0] == o.scissor[0] && scissor[1] == o.scissor[1] && scissor[2] == o.scissor[2] && scissor[3] == o.scissor[3];
+	}
+
+	void draw_list::add(batch_key const& k, quad_instance const& q) {
+		const float x0 = q.rect[0];
+		const float y0 = q.rect[1];
+		const float x1 = q.rect[0] + q.rect[2];
+		const float y1 = q.rect[1] + q.rect[3];
+
+		const uint32_t last = uint32_t(batches.size());
+		const uint32_t stop = last > merge_window ? last - merge_window : 0ui32;
+
+		for(uint32_t i = last; i-- > stop; ) {
+			auto& b = batches[i];
+			if(b.key == k) {
+				b.bounds[0] = std::min(b.bounds[0], x0);
+				b.bounds[1] = std::min(b.bounds[1], y0);
+				b.bounds[2] = std::max(b.bounds[2], x1);
+				b.bounds[3] = std::max(b.bounds[3], y1);
+				++b.count;
+
+				recorded.push_back(q);
+				recorded_batch.push_back(i);
+				if(i + 1 != last)
+					++reordered;
+				return;
+			}
+			if(x0 < b.bounds[2] && b.bounds[0] < x1 && y0 < b.bounds[3] && b.bounds[1] < y1)
+				break;
+		}
+
+		draw_batch nb;
+		nb.key = k;
+		nb.bounds[0] = x0;
+		nb.bounds[1] = y0;
+		nb.bounds[2] = x1;
+		nb.bounds[3] = y1;
+		nb.count = 1;
+		batches.push_back(nb);
+
+		recorded.push_back(q);
+		recorded_batch.push_back(last);
+	}
+
+	void draw_list::finish() {
+		uint32_t offset = 0;
+		for(auto& b : batches) {
+			b.first = offset;
+			offset += b.count;
+		}
+
+		sorted.resize(recorded.size());
+		std::vector<uint32_t> cursor(batches.size());
+		for(size_t i = 0; i < batches.size(); ++i)
+			cursor[i] = batches[i].first;
+		for(size_t i = 0; i < recorded.size(); ++i)
+			sorted[cursor[recorded_batch[i]]++] = recorded[i];
+	}
+
+	void draw_list::clear() {
+		recorded.clear();
+		recorded_batch.clear();
+		batches.clear();
+		sorted.clear();
+		reordered = 0;
+	}
+}
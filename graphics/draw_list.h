@@ -0,0 +1,59 @@
+#pragma once
+#include <stdint.h>
+#include <vector>
+
+namespace graphics {
+	// per quad data of a batched draw, uploaded as is as the instance attributes of the batched shader
+	struct quad_instance {
+		float rect[4] = { 0.0f, 0.0f, 0.0f, 0.0f }; // x, y, width, height in screen pixels
+		float tex_rect[4] = { 0.0f, 0.0f, 1.0f, 1.0f }; // offset and extent of the sampled region of the texture
+		float params[4] = { 0.0f, 0.0f, 0.0f, 0.0f }; // inner color and border size, as read by the fragment functions
+		int32_t rotation = 0; // graphics::rotation
+	};
+
+	// the state shared by all the quads of a batch
+	struct batch_key {
+		uint32_t texture = 0;
+		uint32_t secondary_texture = 0;
+		uint32_t color_function = 0;
+		uint32_t font_function = 0;
+		int32_t scissor[4] = { 0, 0, 0, 0 };
+
+		bool operator==(batch_key const& o) const;
+		bool operator!=(batch_key const& o) const { return !(*this == o); }
+	};
+
+	struct draw_batch {
+		batch_key key;
+		float bounds[4] = { 0.0f, 0.0f, 0.0f, 0.0f }; // x0, y0, x1, y1 of all the quads in the batch
+		uint32_t first = 0; // into sorted_instances, once the list is finished
+		uint32_t count = 0;
+	};
+
+	// Records quads in painter's order, grouped into batches of quads with equal keys. A quad joins the most recent
+	// of the last merge_window batches that has its key, provided that none of the batches recorded after that one
+	// overlaps it, so drawing the batches in order produces the same image as drawing the quads in order.
+	// finish lays the instances out contiguously by batch. Nothing here touches OpenGL.
+	class draw_list {
+	private:
+		std::vector<quad_instance> recorded;
+		std::vector<uint32_t> recorded_batch;
+		std::vector<draw_batch> batches;
+		std::vector<quad_instance> sorted;
+		uint32_t reordered = 0;
+	public:
+		static constexpr uint32_t merge_window = 16;
+
+		void add(batch_key const& k, quad_instance const& q);
+		void finish();
+		void clear();
+
+		bool empty() const { return recorded.size() == 0; }
+		uint32_t quad_count() const { return uint32_t(recorded.size()); }
+		uint32_t batch_count() const { return uint32_t(batches.size()); }
+		uint32_t reordered_count() const { return reordered; } // quads that joined a batch other than the last one
+
+		std::vector<draw_batch> const& get_batches() const { return batches; }
+		std::vector<quad_instance> const& sorted_instances() const { return sorted; }
+	};
+}
@@ -43,7 +43,7 @@ namespace map_mode {
 				if(g) {
 					auto price_range = economy::global_price_range(ws, g);
 
-					for(int32_t i = 0; i < ws.w.province_s.province_state_container.size(); ++i) {
+					concurrency::parallel_for(0, int32_t(ws.w.province_s.province_state_container.size()), [&](int32_t i) {
 						if(auto sid = provinces::province_state(ws, provinces::province_tag(provinces::province_tag::value_base_t(i)));
 							bool(sid) && bool(ws.w.nation_s.states.get<::state::owner>(sid))) {
 
@@ -62,14 +62,14 @@ namespace map_mode {
 							default_color_province(ws, provinces::province_tag(provinces::province_tag::value_base_t(i)),
 								pcolors + i * 3, scolors + i * 3);
 						}
-					}
+					});
 				}
 			} else if(ws.w.map_view.mode == type::production) {
 				auto g = ws.w.map_view.legends->current_good;
 				if(g) {
 					auto prod_range = economy::global_production_range(ws, g);
 
-					for(int32_t i = 0; i < ws.w.province_s.province_state_container.size(); ++i) {
+					concurrency::parallel_for(0, int32_t(ws.w.province_s.province_state_container.size()), [&](int32_t i) {
 						if(auto sid = provinces::province_state(ws, provinces::province_tag(provinces::province_tag::value_base_t(i)));
 							bool(sid) && bool(ws.w.nation_s.states.get<::state::owner>(sid))) {
 
@@ -88,7 +88,7 @@ namespace map_mode {
 							default_color_province(ws, provinces::province_tag(provinces::province_tag::value_base_t(i)),
 								pcolors + i * 3, scolors + i * 3);
 						}
-					}
+					});
 				}
 			} else if(ws.w.map_view.mode == type::purchasing) {
 				auto g = ws.w.map_view.legends->current_good;
@@ -100,7 +100,7 @@ namespace map_mode {
 						auto max_purchases = *std::max_element(std::begin(purchases_data_range) + 1, std::end(purchases_data_range));
 
 
-						for(int32_t i = 0; i < ws.w.province_s.province_state_container.size(); ++i) {
+						concurrency::parallel_for(0, int32_t(ws.w.province_s.province_state_container.size()), [&](int32_t i) {
 							if(auto sid = provinces::province_state(ws, provinces::province_tag(provinces::province_tag::value_base_t(i)));
 								bool(sid) && bool(ws.w.nation_s.states.get<::state::owner>(sid)) && purchases_data_range.first + to_index(sid) + 1 < purchases_data_range.second) {
 
@@ -116,12 +116,12 @@ namespace map_mode {
 								scolors[i * 3 + 1] = uint8_t(fraction * 205.0f + 50.0f);
 								scolors[i * 3 + 2] = uint8_t(fraction * 205.0f + 50.0f);
 
-								continue;
+								return;
 							}
 
 							default_color_province(ws, provinces::province_tag(provinces::province_tag::value_base_t(i)),
 								pcolors + i * 3, scolors + i * 3);
-						}
+						});
 
 					}
 				}
@@ -129,7 +129,7 @@ namespace map_mode {
 				is_valid_index(lprov) && ws.w.map_view.mode == type::distance) {
 
 				auto pcount = ws.s.province_m.province_container.size();
-				for(int32_t i = 0; i < pcount; ++i) {
+				concurrency::parallel_for(0, pcount, [&](int32_t i) {
 					auto distance = ws.w.province_s.province_distance_to[to_index(lprov) * pcount + i];
 					pcolors[i * 3 + 0] = uint8_t(std::clamp((distance / 8'000.0f - 1.0f), 0.0f, 1.0f) * 255.0f);
 					pcolors[i * 3 + 1] = uint8_t(std::clamp((1.0f - distance / 8'000.0f), 0.0f, 1.0f) * 255.0f);
@@ -137,13 +137,13 @@ namespace map_mode {
 					scolors[i * 3 + 0] = uint8_t(std::clamp((distance / 8'000.0f - 1.0f), 0.0f, 1.0f) * 255.0f);
 					scolors[i * 3 + 1] = uint8_t(std::clamp((1.0f - distance / 8'000.0f), 0.0f, 1.0f) * 255.0f);
 					scolors[i * 3 + 2] = uint8_t(100);
-				}
+				});
 			} else if(ws.w.map_view.mode == type::culture) {
 				auto pcount = ws.s.province_m.province_container.size();
 				auto const c = ws.w.map_view.legends->current_culture;
 				auto const col = c ? ws.s.culture_m.culture_container[c].color : graphics::color_rgb{ 0,0,0 };
 
-				for(int32_t i = 0; i < pcount; ++i) {
+				concurrency::parallel_for(0, pcount, [&](int32_t i) {
 					auto const p = provinces::province_tag(provinces::province_tag::value_base_t(i));
 					if(is_valid_index(p) && p != provinces::province_tag(0) && to_index(p) < ws.s.province_m.first_sea_province) {
 						if(c) {
@@ -181,13 +181,13 @@ namespace map_mode {
 						default_color_province(ws, provinces::province_tag(provinces::province_tag::value_base_t(i)),
 							pcolors + i * 3, scolors + i * 3);
 					}
-				}
+				});
 			} else if(ws.w.map_view.mode == type::region) {
 				auto pcount = ws.s.province_m.province_container.size();
 				int32_t const total_number_of_colors = 100;
 				int32_t const rel_prime = find_best_relative_prime(total_number_of_colors);
 
-				for(int32_t i = 0; i < pcount; ++i) {
+				concurrency::parallel_for(0, pcount, [&](int32_t i) {
 					auto const p = provinces::province_tag(provinces::province_tag::value_base_t(i));
 
 					if(is_valid_index(p) && p != provinces::province_tag(0) && to_index(p) < ws.s.province_m.first_sea_province) {
@@ -205,9 +205,9 @@ namespace map_mode {
 						default_color_province(ws, provinces::province_tag(provinces::province_tag::value_base_t(i)),
 							pcolors + i * 3, scolors + i * 3);
 					}
-				}
+				});
 			} else if(ws.w.map_view.mode == type::sphere) {
-				for(size_t i = 0; i < ws.s.province_m.province_container.size(); ++i) {
+				concurrency::parallel_for(0, int32_t(ws.s.province_m.province_container.size()), [&](int32_t i) {
 					const provinces::province_tag p(static_cast<provinces::province_tag::value_base_t>(i));
 					if(is_valid_index(p) && p != provinces::province_tag(0) && to_index(p) < ws.s.province_m.first_sea_province) {
 
@@ -240,12 +240,12 @@ namespace map_mode {
 						default_color_province(ws, provinces::province_tag(provinces::province_tag::value_base_t(i)),
 							pcolors + i * 3, scolors + i * 3);
 					}
-				}
+				});
 			} else if(ws.w.map_view.mode == type::population) {
 				auto const range = ws.w.map_view.legends->showing_density == false ? 
 					population::population_amount_range(ws) : population::population_density_range(ws);
 
-				for(size_t i = 0; i < ws.s.province_m.province_container.size(); ++i) {
+				concurrency::parallel_for(0, int32_t(ws.s.province_m.province_container.size()), [&](int32_t i) {
 					const provinces::province_tag p(static_cast<provinces::province_tag::value_base_t>(i));
 					if(is_valid_index(p) && p != provinces::province_tag(0) && to_index(p) < ws.s.province_m.first_sea_province) {
 						auto total_pop = ws.w.province_s.province_state_container.get<province_state::total_population>(p);
@@ -271,10 +271,10 @@ namespace map_mode {
 					} else {
 						default_color_province(ws, p, pcolors + i * 3, scolors + i * 3);
 					}
-				}
+				});
 			} else if(ws.w.map_view.mode == type::relations) {
 				auto const rel_with = ws.w.map_view.legends->current_nation;
-				for(size_t i = 0; i < ws.s.province_m.province_container.size(); ++i) {
+				concurrency::parallel_for(0, int32_t(ws.s.province_m.province_container.size()), [&](int32_t i) {
 					const provinces::province_tag p(static_cast<provinces::province_tag::value_base_t>(i));
 					if(is_valid_index(p) && p != provinces::province_tag(0) && to_index(p) < ws.s.province_m.first_sea_province) {
 						if(auto owner = provinces::province_owner(ws, p)) {
@@ -292,7 +292,7 @@ namespace map_mode {
 					} else {
 						default_color_province(ws, p, pcolors + i * 3, scolors + i * 3);
 					}
-				}
+				});
 			} else if(ws.w.map_view.mode == type::migration) {
 				if(ws.w.map_view.legends->showing_internal_migration) {
 					tagged_vector<population::population_range, nations::country_tag, concurrent_allocator<population::population_range>> nation_ranges;
@@ -310,7 +310,7 @@ namespace map_mode {
 						}
 					}
 
-					for(size_t i = 0; i < ws.s.province_m.province_container.size(); ++i) {
+					concurrency::parallel_for(0, int32_t(ws.s.province_m.province_container.size()), [&](int32_t i) {
 						const provinces::province_tag p(static_cast<provinces::province_tag::value_base_t>(i));
 						if(is_valid_index(p) && p != provinces::province_tag(0) && to_index(p) < ws.s.province_m.first_sea_province) {
 							auto const owner = provinces::province_owner(ws, p);
@@ -343,7 +343,7 @@ namespace map_mode {
 						} else {
 							default_color_province(ws, p, pcolors + i * 3, scolors + i * 3);
 						}
-					}
+					});
 				} else {
 					tagged_vector<float, nations::country_tag, concurrent_allocator<float>> nation_totals;
 					auto const size = ws.w.nation_s.nations.size();
@@ -362,7 +362,7 @@ namespace map_mode {
 						range.max = std::max(range.max, nation_totals[n]);
 					}
 
-					for(size_t i = 0; i < ws.s.province_m.province_container.size(); ++i) {
+					concurrency::parallel_for(0, int32_t(ws.s.province_m.province_container.size()), [&](int32_t i) {
 						const provinces::province_tag p(static_cast<provinces::province_tag::value_base_t>(i));
 						if(is_valid_index(p) && p != provinces::province_tag(0) && to_index(p) < ws.s.province_m.first_sea_province) {
 							auto const owner = provinces::province_owner(ws, p);
@@ -395,11 +395,11 @@ namespace map_mode {
 						} else {
 							default_color_province(ws, p, pcolors + i * 3, scolors + i * 3);
 						}
-					}
+					});
 
 				}
 			} else if(ws.w.map_view.mode == type::infrastructure) {
-				for(size_t i = 0; i < ws.s.province_m.province_container.size(); ++i) {
+				concurrency::parallel_for(0, int32_t(ws.s.province_m.province_container.size()), [&](int32_t i) {
 					const provinces::province_tag p(static_cast<provinces::province_tag::value_base_t>(i));
 
 					if(auto owner = provinces::province_owner(ws, p); owner) {
@@ -467,7 +467,7 @@ namespace map_mode {
 						default_color_province(ws, provinces::province_tag(provinces::province_tag::value_base_t(i)),
 							pcolors + i * 3, scolors + i * 3);
 					}
-				}
+				});
 			} else if(ws.w.map_view.mode == type::rgo) {
 				int32_t max_size = 1;
 				auto const cg = ws.w.map_view.legends->current_good;
@@ -475,7 +475,7 @@ namespace map_mode {
 					if(!is_valid_index(cg) || cg == ws.w.province_s.province_state_container.get<province_state::rgo_production>(o))
 						max_size = std::max(max_size, int32_t(ws.w.province_s.province_state_container.get<province_state::rgo_size>(o)));
 				});
-				for(size_t i = 1; i < ws.s.province_m.province_container.size(); ++i) {
+				concurrency::parallel_for(1, int32_t(ws.s.province_m.province_container.size()), [&](int32_t i) {
 					const provinces::province_tag p(static_cast<provinces::province_tag::value_base_t>(i));
 					if(i < ws.s.province_m.first_sea_province) {
 						auto prgo = ws.w.province_s.province_state_container.get<province_state::rgo_production>(p);
@@ -502,10 +502,10 @@ namespace map_mode {
 					} else {
 						default_color_province(ws, p, pcolors + i * 3, scolors + i * 3);
 					}
-				}
+				});
 			} else if(ws.w.map_view.mode == type::voting) {
 				auto const ide = ws.w.map_view.legends->current_ideology;
-				for(size_t i = 1; i < ws.s.province_m.province_container.size(); ++i) {
+				concurrency::parallel_for(1, int32_t(ws.s.province_m.province_container.size()), [&](int32_t i) {
 					const provinces::province_tag p(static_cast<provinces::province_tag::value_base_t>(i));
 					if(i < ws.s.province_m.first_sea_province) {
 						if(ide) {
@@ -541,9 +541,9 @@ namespace map_mode {
 					} else {
 						default_color_province(ws, p, pcolors + i * 3, scolors + i * 3);
 					}
-				}
+				});
 			} else if(ws.w.map_view.mode == type::admin) {
-				for(size_t i = 1; i < ws.s.province_m.province_container.size(); ++i) {
+				concurrency::parallel_for(1, int32_t(ws.s.province_m.province_container.size()), [&](int32_t i) {
 					const provinces::province_tag p(static_cast<provinces::province_tag::value_base_t>(i));
 					if(i < ws.s.province_m.first_sea_province) {
 						if(auto si = provinces::province_state(ws, p); si) {
@@ -566,9 +566,9 @@ namespace map_mode {
 					} else {
 						default_color_province(ws, p, pcolors + i * 3, scolors + i * 3);
 					}
-				}
+				});
 			} else if(ws.w.map_view.mode == type::military) {
-				for(size_t i = 1; i < ws.s.province_m.province_container.size(); ++i) {
+				concurrency::parallel_for(1, int32_t(ws.s.province_m.province_container.size()), [&](int32_t i) {
 					const provinces::province_tag p(static_cast<provinces::province_tag::value_base_t>(i));
 					if(i < ws.s.province_m.first_sea_province) {
 						auto owner = ws.get<province_state::owner>(p);
@@ -613,9 +613,9 @@ namespace map_mode {
 					} else {
 						default_color_province(ws, p, pcolors + i * 3, scolors + i * 3);
 					}
-				}
+				});
 			} else { // default case: color by ownership
-				for(size_t i = 0; i < ws.s.province_m.province_container.size(); ++i) {
+				concurrency::parallel_for(0, int32_t(ws.s.province_m.province_container.size()), [&](int32_t i) {
 					const provinces::province_tag this_province(static_cast<provinces::province_tag::value_base_t>(i));
 
 					if(auto owner = provinces::province_owner(ws, this_province); owner) {
@@ -630,7 +630,7 @@ namespace map_mode {
 						default_color_province(ws, provinces::province_tag(provinces::province_tag::value_base_t(i)),
 							pcolors + i * 3, scolors + i * 3);
 					}
-				}
+				});
 			}
 
 			ws.w.map.colors.update_ready();
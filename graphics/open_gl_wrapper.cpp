@@ -10,6 +10,7 @@
 #include <thread>
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include "v2_window.hpp"
 
 #undef max
@@ -150,7 +151,43 @@ namespace graphics {
 		"}\n";
 
 
-	static char tquad_fragment_shader[] =
+	// the quad parameters of the instanced shader are per instance attributes instead of uniforms
+	static char batched_vertex_shader[] =
+		"#version 430 core\n"
+		"layout (location = 0) in vec2 vertex_position;\n"
+		"layout (location = 2) in vec4 instance_rect;\n"
+		"layout (location = 3) in vec4 instance_tex_rect;\n"
+		"layout (location = 4) in vec4 instance_params;\n"
+		"layout (location = 5) in int instance_rotation;\n"
+		"\n"
+		"out vec2 tex_coord;\n"
+		"flat out vec4 d_rect;\n"
+		"flat out vec4 params;\n"
+		"\n"
+		"layout (location = 0) uniform float screen_width;\n"
+		"layout (location = 1) uniform float screen_height;\n"
+		"\n"
+		"vec2 rotated(vec2 p, int r) {\n"
+		"	switch(r) {\n"
+		"		case 1: return vec2(1.0 - p.y, p.x);\n" // left
+		"		case 2: return vec2(p.y, 1.0 - p.x);\n" // right
+		"		case 3: return vec2(p.x, 1.0 - p.y);\n" // upright_vertical_flipped
+		"		case 4: return vec2(1.0 - p.y, 1.0 - p.x);\n" // left_vertical_flipped
+		"		case 5: return vec2(p.y, p.x);\n" // right_vertical_flipped
+		"		default: return p;\n"
+		"	}\n"
+		"}\n"
+		"\n"
+		"void main() {\n"
+		"	gl_Position = vec4(-1.0 + (2.0 * ((vertex_position.x * instance_rect.z)  + instance_rect.x) / screen_width), "
+		"1.0 - (2.0 * ((vertex_position.y * instance_rect.w)  + instance_rect.y) / screen_height), "
+		"0.0, 1.0);\n"
+		"	tex_coord = instance_tex_rect.xy + rotated(vertex_position, instance_rotation) * instance_tex_rect.zw;\n"
+		"	d_rect = instance_rect;\n"
+		"	params = instance_params;\n"
+		"}\n";
+
+	static char tquad_fragment_header[] =
 		"#version 430 core\n"
 		"\n"
 		"#define M_PI 3.1415926535897932384626433832795\n"
@@ -168,7 +205,30 @@ namespace graphics {
 		"layout (location = 2) uniform vec4 d_rect;\n"
 		"layout (location = 6) uniform float border_size;\n"
 		"layout (location = 7) uniform vec3 inner_color;\n"
+		"\n";
+
+	static char batched_fragment_header[] =
+		"#version 430 core\n"
+		"\n"
+		"#define M_PI 3.1415926535897932384626433832795\n"
+		"subroutine vec4 color_function_class(vec4 color_in);\n"
+		"layout(location = 0) subroutine uniform color_function_class coloring_function;\n"
+		"\n"
+		"subroutine vec4 font_function_class(vec2 tc);\n"
+		"layout(location = 1) subroutine uniform font_function_class font_function;\n"
+		"\n"
+		"in vec2 tex_coord;\n"
+		"flat in vec4 d_rect;\n"
+		"flat in vec4 params;\n"
+		"layout (location = 0) out vec4 frag_color;\n"
 		"\n"
+		"layout (binding = 0) uniform sampler2D texture_sampler;\n"
+		"layout (binding = 1) uniform sampler2D secondary_texture_sampler;\n"
+		"#define border_size params.w\n"
+		"#define inner_color params.rgb\n"
+		"\n";
+
+	static char tquad_fragment_shader[] =
 		"layout(index = 0) subroutine(font_function_class)\n"
 		"vec4 border_filter(vec2 tc) {\n"
 		"	vec4 color_in = texture(texture_sampler, tc);\n"
@@ -283,6 +343,7 @@ namespace graphics {
 		"}\n";
 
 	static GLuint general_shader = 0;
+	static GLuint batched_shader = 0;
 
 	static GLuint global_square_vao = 0;
 	static GLuint global_sqaure_buffer = 0;
@@ -337,6 +398,9 @@ namespace graphics {
 
 	static GLuint sub_sqaure_buffers[64] = { 0 };
 
+	static GLuint batched_quad_vao = 0;
+	static GLuint batched_instance_buffer = 0;
+
 	void create_global_square() {
 		glGenBuffers(1, &global_sqaure_buffer);
 
@@ -395,9 +459,37 @@ namespace graphics {
 
 			glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * 16, global_sub_square_data, GL_STATIC_DRAW);
 		}
+
+		glGenBuffers(1, &batched_instance_buffer);
+		glBindBuffer(GL_ARRAY_BUFFER, batched_instance_buffer);
+
+		glGenVertexArrays(1, &batched_quad_vao);
+		glBindVertexArray(batched_quad_vao);
+		glEnableVertexAttribArray(0); //position
+		glEnableVertexAttribArray(2); //instance rectangle
+		glEnableVertexAttribArray(3); //instance texture rectangle
+		glEnableVertexAttribArray(4); //instance parameters
+		glEnableVertexAttribArray(5); //instance rotation
+
+		glBindVertexBuffer(0, global_sqaure_buffer, 0, sizeof(GLfloat) * 4);
+		glBindVertexBuffer(1, batched_instance_buffer, 0, sizeof(quad_instance));
+		glVertexBindingDivisor(1, 1);
+
+		glVertexAttribFormat(0, 2, GL_FLOAT, GL_FALSE, 0);
+		glVertexAttribFormat(2, 4, GL_FLOAT, GL_FALSE, offsetof(quad_instance, rect));
+		glVertexAttribFormat(3, 4, GL_FLOAT, GL_FALSE, offsetof(quad_instance, tex_rect));
+		glVertexAttribFormat(4, 4, GL_FLOAT, GL_FALSE, offsetof(quad_instance, params));
+		glVertexAttribIFormat(5, 1, GL_INT, offsetof(quad_instance, rotation));
+		glVertexAttribBinding(0, 0);
+		glVertexAttribBinding(2, 1);
+		glVertexAttribBinding(3, 1);
+		glVertexAttribBinding(4, 1);
+		glVertexAttribBinding(5, 1);
+
+		glBindVertexArray(global_square_vao);
 	}
 
-	void create_shaders() {
+	GLuint create_program(const GLchar* const* vertex_sources, GLsizei vertex_count, const GLchar* const* fragment_sources, GLsizei fragment_count) {
 		GLuint general_vertex_shader = glCreateShader(GL_VERTEX_SHADER);
 		GLuint general_fragment_shader = glCreateShader(GL_FRAGMENT_SHADER);
 
@@ -407,9 +499,7 @@ namespace graphics {
 			std::abort();
 		}
 #endif
-		const GLchar* array_a[] = { tquad_vertex_shader };
-
-		glShaderSource(general_vertex_shader, 1, array_a, nullptr);
+		glShaderSource(general_vertex_shader, vertex_count, vertex_sources, nullptr);
 		glCompileShader(general_vertex_shader);
 
 #ifdef _DEBUG
@@ -433,9 +523,7 @@ namespace graphics {
 #endif
 
 
-		const GLchar* array_b[] = { tquad_fragment_shader };
-
-		glShaderSource(general_fragment_shader, 1, array_b, nullptr);
+		glShaderSource(general_fragment_shader, fragment_count, fragment_sources, nullptr);
 		glCompileShader(general_fragment_shader);
 
 #ifdef _DEBUG
@@ -457,30 +545,30 @@ namespace graphics {
 		}
 #endif
 
-		general_shader = glCreateProgram();
+		const GLuint program = glCreateProgram();
 
 #ifdef _DEBUG
-		if (general_shader == 0) {
+		if (program == 0) {
 			MessageBox(nullptr, L"shader program creation failed", L"OpenGL error", MB_OK);
 			std::abort();
 		}
 #endif
 
-		glAttachShader(general_shader, general_vertex_shader);
-		glAttachShader(general_shader, general_fragment_shader);
-		glLinkProgram(general_shader);
+		glAttachShader(program, general_vertex_shader);
+		glAttachShader(program, general_fragment_shader);
+		glLinkProgram(program);
 
 #ifdef _DEBUG
-		glGetProgramiv(general_shader, GL_LINK_STATUS, &result);
+		glGetProgramiv(program, GL_LINK_STATUS, &result);
 		if (result == GL_FALSE) {
 			MessageBox(nullptr, L"shader program linking failed", L"OpenGL error", MB_OK);
 
 			GLint logLen;
-			glGetProgramiv(general_shader, GL_INFO_LOG_LENGTH, &logLen);
+			glGetProgramiv(program, GL_INFO_LOG_LENGTH, &logLen);
 
 			char * log = new char[static_cast<size_t>(logLen)];
 			GLsizei written;
-			glGetProgramInfoLog(general_shader, logLen, &written, log);
+			glGetProgramInfoLog(program, logLen, &written, log);
 			MessageBoxA(nullptr, log, "OpenGL error", MB_OK);
 
 			delete[] log;
@@ -490,6 +578,18 @@ namespace graphics {
 		glDeleteShader(general_vertex_shader);
 		glDeleteShader(general_fragment_shader);
 
+		return program;
+	}
+
+	void create_shaders() {
+		const GLchar* general_vertex[] = { tquad_vertex_shader };
+		const GLchar* general_fragment[] = { tquad_fragment_header, tquad_fragment_shader };
+		general_shader = create_program(general_vertex, 1, general_fragment, 2);
+
+		const GLchar* batched_vertex[] = { batched_vertex_shader };
+		const GLchar* batched_fragment[] = { batched_fragment_header, tquad_fragment_shader };
+		batched_shader = create_program(batched_vertex, 1, batched_fragment, 2);
+
 		glUseProgram(general_shader);
 
 		glEnable(GL_BLEND);
@@ -728,7 +828,103 @@ namespace graphics {
 		}
 	}
 
+	inline void set_glyph_cell(quad_instance& q, uint32_t buffer) { // the region of the glyph texture sampled by sub_sqaure_buffers[buffer]
+		q.tex_rect[0] = static_cast<float>(buffer & 7) / 8.0f;
+		q.tex_rect[1] = static_cast<float>((buffer >> 3) & 7) / 8.0f;
+		q.tex_rect[2] = 1.0f / 8.0f;
+		q.tex_rect[3] = 1.0f / 8.0f;
+	}
+
+	void open_gl_wrapper::add_to_batch(uint32_t texture, uint32_t secondary_texture, uint32_t color_function, uint32_t font_function, const quad_instance& q) {
+		batch_key k;
+		k.texture = texture;
+		k.secondary_texture = secondary_texture;
+		k.color_function = color_function;
+		k.font_function = font_function;
+		memcpy(k.scissor, current_scissor_rect, sizeof(k.scissor));
+
+		batched_quads.add(k, q);
+	}
+
+	void open_gl_wrapper::add_text_to_batch(const char16_t* codepoints, uint32_t count, color_modification enabled, uint32_t font_function, float x, float baseline_y, float size, const color& c, font& f, float extra) {
+		quad_instance q;
+		q.params[0] = c.r;
+		q.params[1] = c.g;
+		q.params[2] = c.b;
+		q.params[3] = 0.08f * 16.0f / size;
+
+		const auto color_function = map_color_modification_to_index(enabled);
+		const auto& run = f.get_render_run(codepoints, count);
+		for(uint32_t i = 0; i < count; ++i) {
+			const auto& g = run.glyphs[i];
+			const float glyph_x = x + run.positions[i] * size / 64.0f + extra * static_cast<float>(i);
+
+			q.rect[0] = glyph_x + g.x_offset * size / 64.0f;
+			q.rect[1] = baseline_y + g.y_offset * size / 64.0f;
+			q.rect[2] = size;
+			q.rect[3] = size;
+			set_glyph_cell(q, g.buffer);
+			add_to_batch(g.texture, 0, color_function, font_function, q);
+		}
+	}
+
+	void open_gl_wrapper::flush_batch() {
+		if(batched_quads.empty())
+			return;
+
+		batched_quads.finish();
+		const auto& instances = batched_quads.sorted_instances();
+
+		glUseProgram(batched_shader);
+		glUniform1f(parameters::screen_width, static_cast<float>(impl->viewport_x));
+		glUniform1f(parameters::screen_height, static_cast<float>(impl->viewport_y));
+
+		glBindVertexArray(batched_quad_vao);
+		glBindBuffer(GL_ARRAY_BUFFER, batched_instance_buffer);
+		glBufferData(GL_ARRAY_BUFFER, sizeof(quad_instance) * instances.size(), instances.data(), GL_STREAM_DRAW);
+
+		for(const auto& b : batched_quads.get_batches()) {
+			glScissor(b.key.scissor[0], b.key.scissor[1], b.key.scissor[2], b.key.scissor[3]);
+
+			glActiveTexture(GL_TEXTURE0);
+			glBindTexture(GL_TEXTURE_2D, b.key.texture);
+			if(b.key.secondary_texture != 0) {
+				glActiveTexture(GL_TEXTURE1);
+				glBindTexture(GL_TEXTURE_2D, b.key.secondary_texture);
+			}
+
+			GLuint subroutines[2] = { b.key.color_function, b.key.font_function };
+			glUniformSubroutinesuiv(GL_FRAGMENT_SHADER, 2, subroutines); // must set all subroutines in one call
+
+			glDrawArraysInstancedBaseInstance(GL_TRIANGLE_FAN, 0, 4, static_cast<GLsizei>(b.count), b.first);
+		}
+
+		batched_quads.clear();
+
+		glScissor(current_scissor_rect[0], current_scissor_rect[1], current_scissor_rect[2], current_scissor_rect[3]);
+		glBindVertexArray(global_square_vao);
+		glUseProgram(general_shader);
+	}
+
+	void open_gl_wrapper::begin_batch() {
+		batched_quads.clear();
+		batching = true;
+	}
+
+	void open_gl_wrapper::end_batch() {
+		flush_batch();
+		batching = false;
+	}
+
 	void open_gl_wrapper::render_textured_rect(color_modification enabled, float x, float y, float width, float height, texture& t, rotation r) {
+		if(batching) {
+			quad_instance q;
+			q.rect[0] = x; q.rect[1] = y; q.rect[2] = width; q.rect[3] = height;
+			q.rotation = int32_t(r);
+			add_to_batch(t.handle(), 0, map_color_modification_to_index(enabled), parameters::no_filter, q);
+			return;
+		}
+
 		glBindVertexArray(global_square_vao);
 
 		switch (r) {
@@ -759,6 +955,13 @@ namespace graphics {
 	}
 
 	void open_gl_wrapper::render_textured_rect_direct(float x, float y, float width, float height, uint32_t handle) {
+		if(batching) {
+			quad_instance q;
+			q.rect[0] = x; q.rect[1] = y; q.rect[2] = width; q.rect[3] = height;
+			add_to_batch(handle, 0, parameters::enabled, parameters::no_filter, q);
+			return;
+		}
+
 		glBindVertexArray(global_square_vao);
 
 		glBindVertexBuffer(0, global_sqaure_buffer, 0, sizeof(GLfloat) * 4); 
@@ -775,6 +978,8 @@ namespace graphics {
 	}
 
 	void open_gl_wrapper::render_linegraph(color_modification enabled, float x, float y, float width, float height, lines& l) {
+		flush_batch(); // line strips are not batched: draw what was recorded before them first
+
 		glBindVertexArray(global_square_vao);
 
 		l.bind_buffer();
@@ -789,6 +994,14 @@ namespace graphics {
 	}
 
 	void open_gl_wrapper::render_barchart(color_modification enabled, float x, float y, float width, float height, data_texture& t, rotation r) {
+		if(batching) {
+			quad_instance q;
+			q.rect[0] = x; q.rect[1] = y; q.rect[2] = width; q.rect[3] = height;
+			q.rotation = int32_t(r);
+			add_to_batch(t.handle(), 0, map_color_modification_to_index(enabled), parameters::barchart, q);
+			return;
+		}
+
 		glBindVertexArray(global_square_vao);
 
 		switch(r) {
@@ -819,6 +1032,13 @@ namespace graphics {
 	}
 
 	void open_gl_wrapper::render_piechart(color_modification enabled, float x, float y, float size, data_texture& t) {
+		if(batching) {
+			quad_instance q;
+			q.rect[0] = x; q.rect[1] = y; q.rect[2] = size; q.rect[3] = size;
+			add_to_batch(t.handle(), 0, map_color_modification_to_index(enabled), parameters::piechart, q);
+			return;
+		}
+
 		glBindVertexArray(global_square_vao);
 
 		glBindVertexBuffer(0, global_sqaure_buffer, 0, sizeof(GLfloat) * 4);
@@ -835,6 +1055,15 @@ namespace graphics {
 	}
 
 	void open_gl_wrapper::render_bordered_rect(color_modification enabled, float border_size, float x, float y, float width, float height, texture& t, rotation r) {
+		if(batching) {
+			quad_instance q;
+			q.rect[0] = x; q.rect[1] = y; q.rect[2] = width; q.rect[3] = height;
+			q.params[3] = border_size;
+			q.rotation = int32_t(r);
+			add_to_batch(t.handle(), 0, map_color_modification_to_index(enabled), parameters::frame_stretch, q);
+			return;
+		}
+
 		glBindVertexArray(global_square_vao);
 
 		switch(r) {
@@ -866,6 +1095,14 @@ namespace graphics {
 	}
 
 	void open_gl_wrapper::render_masked_rect(color_modification enabled, float x, float y, float width, float height, texture& t, texture& mask, rotation r) {
+		if(batching) {
+			quad_instance q;
+			q.rect[0] = x; q.rect[1] = y; q.rect[2] = width; q.rect[3] = height;
+			q.rotation = int32_t(r);
+			add_to_batch(t.handle(), mask.handle(), map_color_modification_to_index(enabled), parameters::use_mask, q);
+			return;
+		}
+
 		glBindVertexArray(global_square_vao);
 
 		switch(r) {
@@ -898,6 +1135,15 @@ namespace graphics {
 	}
 
 	void open_gl_wrapper::render_progress_bar(color_modification enabled, float progress, float x, float y, float width, float height, texture& left, texture& right, rotation r) {
+		if(batching) {
+			quad_instance q;
+			q.rect[0] = x; q.rect[1] = y; q.rect[2] = width; q.rect[3] = height;
+			q.params[3] = progress;
+			q.rotation = int32_t(r);
+			add_to_batch(left.handle(), right.handle(), map_color_modification_to_index(enabled), parameters::progress_bar, q);
+			return;
+		}
+
 		glBindVertexArray(global_square_vao);
 
 		switch(r) {
@@ -931,6 +1177,15 @@ namespace graphics {
 	}
 
 	void open_gl_wrapper::render_tinted_textured_rect(float x, float y, float width, float height, float r, float g, float b, texture& t, rotation rot) {
+		if(batching) {
+			quad_instance q;
+			q.rect[0] = x; q.rect[1] = y; q.rect[2] = width; q.rect[3] = height;
+			q.params[0] = r; q.params[1] = g; q.params[2] = b;
+			q.rotation = int32_t(rot);
+			add_to_batch(t.handle(), 0, parameters::tint, parameters::no_filter, q);
+			return;
+		}
+
 		glBindVertexArray(global_square_vao);
 
 		switch(rot) {
@@ -961,6 +1216,16 @@ namespace graphics {
 	}
 
 	void open_gl_wrapper::render_subsprite(color_modification enabled, int frame, int total_frames, float x, float y, float width, float height, texture& t, rotation r) {
+		if(batching) {
+			const auto scale = 1.0f / static_cast<float>(total_frames);
+			quad_instance q;
+			q.rect[0] = x; q.rect[1] = y; q.rect[2] = width; q.rect[3] = height;
+			q.params[0] = static_cast<float>(frame) * scale; q.params[1] = scale;
+			q.rotation = int32_t(r);
+			add_to_batch(t.handle(), 0, map_color_modification_to_index(enabled), parameters::sub_sprite, q);
+			return;
+		}
+
 		glBindVertexArray(global_square_vao);
 
 		switch(r) {
@@ -994,6 +1259,15 @@ namespace graphics {
 	void open_gl_wrapper::render_character(char16_t codepoint, color_modification enabled, float x, float y, float size, font& f) {
 		const auto g = f.get_render_glyph(codepoint);
 
+		if(batching) {
+			quad_instance q;
+			q.rect[0] = x; q.rect[1] = y; q.rect[2] = size; q.rect[3] = size;
+			set_glyph_cell(q, g.buffer);
+			q.params[3] = 0.08f * 16.0f / size;
+			add_to_batch(g.texture, 0, map_color_modification_to_index(enabled), parameters::border_filter, q);
+			return;
+		}
+
 		glBindVertexBuffer(0, sub_sqaure_buffers[g.buffer], 0, sizeof(GLfloat) * 4);
 		glActiveTexture(GL_TEXTURE0);
 		glBindTexture(GL_TEXTURE_2D, g.texture);
@@ -1013,21 +1287,27 @@ namespace graphics {
 	}
 
 	void internal_text_render(const char16_t* codepoints, uint32_t count, float x, float baseline_y, float size, font& f, float extra) {
+		const auto& run = f.get_render_run(codepoints, count);
 		for (uint32_t i = 0; i < count; ++i) {
-			const auto g = f.get_render_glyph(codepoints[i]);
+			const auto& g = run.glyphs[i];
+			const float glyph_x = x + run.positions[i] * size / 64.0f + extra * static_cast<float>(i);
 
 			glBindVertexBuffer(0, sub_sqaure_buffers[g.buffer], 0, sizeof(GLfloat) * 4);
 			glActiveTexture(GL_TEXTURE0);
 			glBindTexture(GL_TEXTURE_2D, g.texture);
 
-			glUniform4f(parameters::drawing_rectangle, x + g.x_offset * size / 64.0f, baseline_y + g.y_offset * size / 64.0f, size, size);
+			glUniform4f(parameters::drawing_rectangle, glyph_x + g.x_offset * size / 64.0f, baseline_y + g.y_offset * size / 64.0f, size, size);
 
 			glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
-			x += g.advance * size / 64.0f + extra + ((i != count - 1) ? f.render_kerning(codepoints[i], codepoints[i + 1]) * size / 64.0f : 0.0f);
 		}
 	}
 
 	void open_gl_wrapper::render_outlined_text(const char16_t* codepoints, uint32_t count, color_modification enabled, float x, float y, float size, const color& c, font& f) {
+		if(batching) {
+			add_text_to_batch(codepoints, count, enabled, parameters::border_filter, x, y + size, size, c, f, 0.6f);
+			return;
+		}
+
 		GLuint subroutines[2] = { map_color_modification_to_index(enabled), parameters::border_filter };
 		glUniformSubroutinesuiv(GL_FRAGMENT_SHADER, 2, subroutines);
 
@@ -1039,6 +1319,11 @@ namespace graphics {
 	}
 
 	void open_gl_wrapper::render_text(const char16_t* codepoints, uint32_t count, color_modification enabled, float x, float y, float size, const color& c, font& f) {
+		if(batching) {
+			add_text_to_batch(codepoints, count, enabled, parameters::filter, x, y + size, size, c, f, 0.0f);
+			return;
+		}
+
 		GLuint subroutines[2] = { map_color_modification_to_index(enabled), parameters::filter };
 		glUniformSubroutinesuiv(GL_FRAGMENT_SHADER, 2, subroutines);
 
@@ -5,6 +5,7 @@
 #include "texture.h"
 #include "text.h"
 #include "lines.h"
+#include "draw_list.h"
 
 namespace graphics {
 	class _open_gl_wrapper;
@@ -38,10 +39,15 @@ namespace graphics {
 	class open_gl_wrapper {
 	private:
 		int32_t current_scissor_rect[4] = { 0,0,0,0 };
+		draw_list batched_quads;
+		bool batching = false;
 
 		void set_render_thread(const std::function<void()>&);
 		bool is_running();
 		void setup_context(void* hwnd);
+		void add_to_batch(uint32_t texture, uint32_t secondary_texture, uint32_t color_function, uint32_t font_function, const quad_instance& q);
+		void add_text_to_batch(const char16_t* codepoints, uint32_t count, color_modification enabled, uint32_t font_function, float x, float baseline_y, float size, const color& c, font& f, float extra);
+		void flush_batch();
 	public:
 		std::unique_ptr<_open_gl_wrapper> impl;
 
@@ -58,6 +64,13 @@ namespace graphics {
 		void display();
 		void use_default_program();
 		void set_viewport(uint32_t width, uint32_t height);
+
+		// between begin_batch and end_batch the render functions record quads into a draw list instead of drawing them,
+		// and end_batch draws the list with one instanced draw per batch
+		void begin_batch();
+		void end_batch();
+		const draw_list& current_batch() const { return batched_quads; }
+
 		void render_piechart(color_modification enabled, float x, float y, float size, data_texture& t);
 		void render_textured_rect(color_modification enabled, float x, float y, float width, float height, texture& t, rotation r = rotation::upright);
 		void render_barchart(color_modification enabled, float x, float y, float width, float height, data_texture& t, rotation r = rotation::upright);
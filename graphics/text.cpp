@@ -18,7 +18,10 @@
 
 #include "concurrency_tools\\concurrency_tools.hpp"
 #include "open_gl_wrapper.h"
+#include "texture.h"
 #include "Parsers\\parsers.hpp"
+#include <unordered_map>
+#include <mutex>
 
 #undef min
 #undef max
@@ -168,14 +171,115 @@ namespace graphics {
 		}
 	}
 
+	namespace {
+		constexpr uint32_t glyph_cache_kind = 0x46445347ui32;
+		constexpr uint32_t glyph_cache_version = 2ui32;
+
+		// the distance field of a glyph, already reduced to the 64 x 64 cell it occupies in a glyph texture, and its metrics
+		struct baked_glyph {
+			uint32_t codepoint = 0;
+			float advance = 0.0f;
+			float x_offset = 0.0f;
+			float y_offset = 0.0f;
+			uint8_t pixels[64 * 64];
+		};
+
+		// a glyph as rendered by FreeType, copied out of the face so that its distance field can be computed on any thread
+		struct rendered_glyph {
+			std::vector<uint8_t> bitmap;
+			uint32_t width = 0;
+			uint32_t rows = 0;
+			uint32_t pitch = 0;
+			float hb_x = 0.0f;
+			float hb_y = 0.0f;
+			float advance = 0.0f;
+		};
+
+		void bake_glyph(baked_glyph& out, uint8_t* bmp_data, uint32_t width, uint32_t rows, uint32_t pitch, float hb_x, float hb_y) {
+			const int btmap_x_off = 32 * magnification_factor - int32_t(width / 2);
+			const int btmap_y_off = 32 * magnification_factor - int32_t(rows / 2);
+
+			out.x_offset = (hb_x - static_cast<float>(btmap_x_off)) * 1.0f / static_cast<float>(magnification_factor);
+			out.y_offset = (-hb_y - static_cast<float>(btmap_y_off)) * 1.0f / static_cast<float>(magnification_factor);
+
+			// on the heap, as dead_reckoning already takes most of a worker thread's stack
+			std::unique_ptr<bool[]> in_map(new bool[dr_size * dr_size]());
+			std::unique_ptr<float[]> distance_map(new float[dr_size * dr_size]);
+
+			init_in_map(in_map.get(), bmp_data, btmap_x_off, btmap_y_off, width, rows, pitch);
+			dead_reckoning(distance_map.get(), in_map.get());
+
+			for (int y = 0; y < 64; ++y) {
+				for (int x = 0; x < 64; ++x) {
+
+					const size_t index = static_cast<size_t>(x + y * 64);
+					const float distance_value = distance_map[
+						(x * magnification_factor + magnification_factor / 2) +
+							(y * magnification_factor + magnification_factor / 2)* dr_size]
+						/ static_cast<float>(magnification_factor * 64);
+						const int int_value = static_cast<int>(distance_value * -255.0f + 128.0f);
+						const uint8_t small_value = static_cast<uint8_t>(std::min(255, std::max(0, int_value)));
+
+						out.pixels[index] = small_value;
+				}
+			}
+		}
+
+		// keyed by the font file and the range of codepoints that was baked; the payload is the baked glyphs
+		serialization::blob_cache_key glyph_cache_key(uint64_t font_hash, uint64_t font_size, uint32_t first, uint32_t last) {
+			serialization::blob_cache_key key;
+			key.kind = glyph_cache_kind;
+			key.version = glyph_cache_version;
+			key.source_hash = font_hash;
+			key.source_size = font_size;
+			key.detail = (uint64_t(first) << 32) | uint64_t(last);
+			return key;
+		}
+
+		bool read_cached_glyphs(const std::u16string& cache_name, serialization::blob_cache_key const& key, std::vector<baked_glyph>& result) {
+			return serialization::read_cached_blob(cache_name, key, [&result](std::byte const* payload, uint64_t payload_size) {
+				if(payload_size % sizeof(baked_glyph) != 0)
+					return false; // a truncated or foreign payload, so the glyphs are baked again
+				result.resize(size_t(payload_size / sizeof(baked_glyph)));
+				memcpy(result.data(), payload, result.size() * sizeof(baked_glyph));
+				return true;
+			});
+		}
+
+		void write_cached_glyphs(const std::u16string& cache_name, serialization::blob_cache_key const& key, std::vector<baked_glyph> const& glyphs) {
+			serialization::write_cached_blob(cache_name, key, { serialization::blob_part{ glyphs.data(), glyphs.size() * sizeof(baked_glyph) } });
+		}
+
+		uint64_t run_key(const char16_t* codepoints, uint32_t count) {
+			return serialization::blob_hash(codepoints, size_t(count) * sizeof(char16_t));
+		}
+
+		bool same_text(std::vector<char16_t> const& text, const char16_t* codepoints, uint32_t count) {
+			return text.size() == count && std::equal(text.begin(), text.end(), codepoints);
+		}
+	}
+
 	class _font {
 	public:
+		// the number of runs kept by each of the run caches before they are emptied
+		static constexpr size_t max_cached_runs = 4096;
+
+		struct metrics_run {
+			std::vector<char16_t> text;
+			float width = 0.0f;
+		};
 
 		_font* const parent;
 		boost::container::flat_map<char16_t, glyph> glyph_mappings;
 		boost::container::flat_map<char16_t, metrics_glyph> metrics_glyph_mappings;
 		std::vector<uint32_t> textures;
 
+		// laid out runs, keyed by a hash of their text; the render runs belong to the rendering thread, while
+		// the metrics runs are used by whichever thread creates the gui, and so are guarded
+		std::unordered_map<uint64_t, shaped_run> render_runs;
+		std::unordered_map<uint64_t, metrics_run> metrics_runs;
+		std::mutex metrics_runs_guard;
+
 		const std::string font_file;
 
 		FT_Face font_face;
@@ -281,90 +385,162 @@ namespace graphics {
 			}
 		}
 
-		glyph make_glyph(char16_t codepoint) {
-			const auto index_in_this_font = FT_Get_Char_Index(font_face, codepoint);
-			if (index_in_this_font) {
-				FT_Load_Glyph(font_face, index_in_this_font, FT_LOAD_TARGET_NORMAL | FT_LOAD_RENDER);
-
-				FT_Glyph g_result;
-				FT_Get_Glyph(font_face->glyph, &g_result);
+		glyph upload_glyph(baked_glyph const& baked) {
+			glyph created;
 
-				glyph created;
+			if ((last_in_texture & 63) == 0) {
+				glGenTextures(1, &created.texture);
+				glBindTexture(GL_TEXTURE_2D, created.texture);
+				glTexStorage2D(GL_TEXTURE_2D, 1, GL_R8, 64 * 8, 64 * 8);
 
-				if ((last_in_texture & 63) == 0) {
-					glGenTextures(1, &created.texture);
-					glBindTexture(GL_TEXTURE_2D, created.texture);
-					glTexStorage2D(GL_TEXTURE_2D, 1, GL_R8, 64 * 8, 64 * 8);
+				//glClearTexImage(created.texture, 0, GL_RED, GL_FLOAT, nullptr);
 
-					//glClearTexImage(created.texture, 0, GL_RED, GL_FLOAT, nullptr);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 
-					glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-					glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+				textures.push_back(created.texture);
+			} else {
+				created.texture = textures.back();
+				glBindTexture(GL_TEXTURE_2D, created.texture);
+			}
 
-					textures.push_back(created.texture);
-				} else {
-					created.texture = textures.back();
-					glBindTexture(GL_TEXTURE_2D, created.texture);
-				}
+			created.advance = baked.advance;
+			created.buffer = (last_in_texture & 63);
+			created.x_offset = baked.x_offset;
+			created.y_offset = baked.y_offset;
 
-				FT_Bitmap& bitmap = ((FT_BitmapGlyphRec*)g_result)->bitmap;
+			glTexSubImage2D(GL_TEXTURE_2D, 0,
+				(last_in_texture & 7) * 64,
+				((last_in_texture >> 3) & 7) * 64,
+				64,
+				64,
+				GL_RED, GL_UNSIGNED_BYTE, baked.pixels);
 
-				const float hb_x = static_cast<float>(font_face->glyph->metrics.horiBearingX) / static_cast<float>(1 << 6);
-				const float hb_y = static_cast<float>(font_face->glyph->metrics.horiBearingY) / static_cast<float>(1 << 6);
+			++last_in_texture;
+			glyph_mappings[char16_t(baked.codepoint)] = created;
 
-				created.advance = static_cast<float>(font_face->glyph->metrics.horiAdvance) / static_cast<float>((1 << 6) * magnification_factor);
+			return created;
+		}
 
-				created.buffer = (last_in_texture & 63);
+		void render_glyph(rendered_glyph& out, uint32_t index_in_this_font) {
+			FT_Load_Glyph(font_face, index_in_this_font, FT_LOAD_TARGET_NORMAL | FT_LOAD_RENDER);
 
-				uint8_t pixel_buffer[64 * 64];
+			FT_Bitmap const& bitmap = font_face->glyph->bitmap;
 
-				const int btmap_x_off = 32 * magnification_factor - bitmap.width / 2;
-				const int btmap_y_off = 32 * magnification_factor - bitmap.rows / 2;
+			out.width = bitmap.width;
+			out.rows = bitmap.rows;
+			out.pitch = (uint32_t)bitmap.pitch;
+			out.bitmap.assign(bitmap.buffer, bitmap.buffer + size_t(out.rows) * size_t(out.pitch));
 
-				created.x_offset = (hb_x - static_cast<float>(btmap_x_off)) * 1.0f / static_cast<float>(magnification_factor);
-				created.y_offset = (-hb_y - static_cast<float>(btmap_y_off)) * 1.0f / static_cast<float>(magnification_factor);
+			out.hb_x = static_cast<float>(font_face->glyph->metrics.horiBearingX) / static_cast<float>(1 << 6);
+			out.hb_y = static_cast<float>(font_face->glyph->metrics.horiBearingY) / static_cast<float>(1 << 6);
+			out.advance = static_cast<float>(font_face->glyph->metrics.horiAdvance) / static_cast<float>((1 << 6) * magnification_factor);
+		}
 
-				bool in_map[dr_size * dr_size] = { false };
-				float distance_map[dr_size * dr_size];
+		glyph make_glyph(char16_t codepoint) {
+			const auto index_in_this_font = FT_Get_Char_Index(font_face, codepoint);
+			if (index_in_this_font) {
+				rendered_glyph rendered;
+				render_glyph(rendered, index_in_this_font);
 
-				init_in_map(in_map, bitmap.buffer, btmap_x_off, btmap_y_off, bitmap.width, bitmap.rows, (uint32_t)bitmap.pitch);
-				dead_reckoning(distance_map, in_map);
+				baked_glyph baked;
+				baked.codepoint = codepoint;
+				baked.advance = rendered.advance;
+				bake_glyph(baked, rendered.bitmap.data(), rendered.width, rendered.rows, rendered.pitch, rendered.hb_x, rendered.hb_y);
 
+				return upload_glyph(baked);
+			} else if (parent) {
+				return parent->make_glyph(codepoint);
+			} else {
+				// impossible to display this codepoint
+				return glyph();
+			}
+		}
 
-				for (int y = 0; y < 64; ++y) {
-					for (int x = 0; x < 64; ++x) {
+		void prebake(char16_t first, char16_t last, const std::u16string& cache_directory) {
+			std::vector<baked_glyph> baked;
 
-						const size_t index = static_cast<size_t>(x + y * 64);
-						const float distance_value = distance_map[
-							(x * magnification_factor + magnification_factor / 2) +
-								(y * magnification_factor + magnification_factor / 2)* dr_size]
-							/ static_cast<float>(magnification_factor * 64);
-							const int int_value = static_cast<int>(distance_value * -255.0f + 128.0f);
-							const uint8_t small_value = static_cast<uint8_t>(std::min(255, std::max(0, int_value)));
+			serialization::blob_cache_key key;
+			std::u16string cache_name;
+			if(cache_directory.length() != 0) {
+				serialization::serialize_file_wrapper source(std::u16string(font_file.begin(), font_file.end()));
+				if(source.file_valid()) {
+					key = glyph_cache_key(serialization::blob_hash(source.get_bytes(), size_t(source.get_size())), source.get_size(), first, last);
+					cache_name = serialization::blob_cache_file_name(cache_directory, key, u".sdf");
+				}
+			}
 
-							pixel_buffer[index] = small_value;
+			if(cache_name.length() == 0 || !read_cached_glyphs(cache_name, key, baked)) {
+				// FreeType faces may only be used by one thread at a time, so only the distance fields are made in parallel
+				std::vector<rendered_glyph> rendered;
+				for(uint32_t c = first; c <= last; ++c) {
+					if(const auto index_in_this_font = FT_Get_Char_Index(font_face, c); index_in_this_font) {
+						render_glyph(rendered.emplace_back(), index_in_this_font);
+						baked.emplace_back().codepoint = c;
 					}
 				}
 
-				glTexSubImage2D(GL_TEXTURE_2D, 0,
-					(last_in_texture & 7) * 64,
-					((last_in_texture >> 3) & 7) * 64,
-					64,
-					64,
-					GL_RED, GL_UNSIGNED_BYTE, pixel_buffer);
+				concurrency::parallel_for(0, int32_t(rendered.size()), [&rendered, &baked](int32_t i) {
+					baked[size_t(i)].advance = rendered[size_t(i)].advance;
+					bake_glyph(baked[size_t(i)], rendered[size_t(i)].bitmap.data(), rendered[size_t(i)].width, rendered[size_t(i)].rows,
+						rendered[size_t(i)].pitch, rendered[size_t(i)].hb_x, rendered[size_t(i)].hb_y);
+				});
 
-				++last_in_texture;
-				glyph_mappings[codepoint] = created;
+				if(cache_name.length() != 0)
+					write_cached_glyphs(cache_name, key, baked);
+			}
 
-				FT_Done_Glyph(g_result);
+			for(auto const& b : baked) {
+				if(glyph_mappings.find(char16_t(b.codepoint)) == glyph_mappings.end())
+					upload_glyph(b);
+			}
+		}
 
-				return created;
-			} else if (parent) {
-				return parent->make_glyph(codepoint);
-			} else {
-				// impossible to display this codepoint
-				return glyph();
+		shaped_run const& get_render_run(const char16_t* codepoints, uint32_t count) {
+			const auto key = run_key(codepoints, count);
+			if(auto it = render_runs.find(key); it != render_runs.end() && same_text(it->second.text, codepoints, count))
+				return it->second;
+
+			if(render_runs.size() >= max_cached_runs)
+				render_runs.clear();
+
+			auto& run = render_runs[key];
+			run.text.assign(codepoints, codepoints + count);
+			run.glyphs.resize(count);
+			run.positions.resize(count);
+
+			float x = 0.0f;
+			for(uint32_t i = 0; i < count; ++i) {
+				run.glyphs[i] = get_glyph(codepoints[i]);
+				run.positions[i] = x;
+				x += run.glyphs[i].advance + ((i != count - 1) ? kerning(codepoints[i], codepoints[i + 1]) : 0.0f);
+			}
+			run.width = x;
+
+			return run;
+		}
+
+		float metrics_width(const char16_t* codepoints, uint32_t count) {
+			const auto key = run_key(codepoints, count);
+
+			std::lock_guard<std::mutex> lock(metrics_runs_guard);
+			if(auto it = metrics_runs.find(key); it != metrics_runs.end() && same_text(it->second.text, codepoints, count))
+				return it->second.width;
+
+			if(metrics_runs.size() >= max_cached_runs)
+				metrics_runs.clear();
+
+			float total = 0.0f;
+			for(uint32_t i = 0; i < count; ++i) {
+				total += get_metrics_glyph(codepoints[i]).advance
+					+ ((i != count - 1) ? metrics_kerning(codepoints[i], codepoints[i + 1]) : 0.0f);
 			}
+
+			auto& run = metrics_runs[key];
+			run.text.assign(codepoints, codepoints + count);
+			run.width = total;
+
+			return total;
 		}
 
 		metrics_glyph make_metrics_glyph(char16_t codepoint) {
@@ -413,6 +589,14 @@ namespace graphics {
 		return impl->get_metrics_glyph(codepoint);
 	}
 
+	shaped_run const& font::get_render_run(const char16_t* codepoints, uint32_t count) {
+		return impl->get_render_run(codepoints, count);
+	}
+
+	void font::prebake_glyphs(char16_t first, char16_t last, const std::u16string& cache_directory) {
+		impl->prebake(first, last, cache_directory);
+	}
+
 	float font::render_kerning(char16_t codepoint_first, char16_t codepoint_second) const {
 		return impl->kerning(codepoint_first, codepoint_second);
 	}
@@ -430,14 +614,7 @@ namespace graphics {
 	}
 
 	float font::metrics_text_extent(const char16_t* codepoints, uint32_t count, float size, bool outlined) const {
-		float total = 0.0f;
-		for (int32_t i = static_cast<int32_t>(count) - 1; i >= 0; --i) {
-			total +=
-				impl->get_metrics_glyph(codepoints[i]).advance * size / 64.0f +
-				(outlined ? 0.6f : 0.0f) +
-				((i != 0) ? metrics_kerning(codepoints[i - 1], codepoints[i]) * size / 64.0f : 0.0f);
-		}
-		return total;
+		return impl->metrics_width(codepoints, count) * size / 64.0f + (outlined ? 0.6f * static_cast<float>(count) : 0.0f);
 	}
 
 	float font::line_height(float size) const {
@@ -580,9 +757,10 @@ namespace graphics {
 		}
 	}
 
-	void font_manager::load_fonts(open_gl_wrapper& ogl) {
+	void font_manager::load_fonts(open_gl_wrapper& ogl, const std::u16string& cache_directory) {
 		for (auto& f : fonts) {
 			f.load_font(ogl);
+			f.prebake_glyphs(font::prebaked_first, font::prebaked_last, cache_directory);
 		}
 	}
 	void font_manager::load_metrics_fonts() {
@@ -23,6 +23,15 @@ namespace graphics {
 		float advance = 0.0;
 	};
 
+	// a run of text laid out at size 64: the glyph for each codepoint and the x position of its origin, kerning included
+	class shaped_run {
+	public:
+		std::vector<char16_t> text;
+		std::vector<glyph> glyphs;
+		std::vector<float> positions;
+		float width = 0.0f; // the position following the last glyph
+	};
+
 	class open_gl_wrapper;
 
 	class font {
@@ -36,10 +45,19 @@ namespace graphics {
 		font(font&& other) noexcept;
 		~font();
 
+		static constexpr char16_t prebaked_first = u' ';
+		static constexpr char16_t prebaked_last = char16_t(0x017F); // through latin extended-a
+
 		void load_font(open_gl_wrapper&);
 		void load_metrics_font();
+		// creates the glyphs of this font for the codepoints in [first, last] at once, computing their distance fields in
+		// parallel; when cache_directory is not empty the baked glyphs are stored there, keyed by a hash of the font file,
+		// and are read back from there instead of being rendered again
+		void prebake_glyphs(char16_t first, char16_t last, const std::u16string& cache_directory);
 		glyph get_render_glyph(char16_t codepoint);
 		metrics_glyph get_metrics_glyph(char16_t codepoint);
+		// the cached layout of a run of text; only valid until the next call, and only to be used by the rendering thread
+		shaped_run const& get_render_run(const char16_t* codepoints, uint32_t count);
 		float line_height(float size) const;
 		float render_kerning(char16_t codepoint_first, char16_t codepoint_second) const;
 		float metrics_kerning(char16_t codepoint_first, char16_t codepoint_second) const;
@@ -66,7 +84,7 @@ namespace graphics {
 		void load_standard_fonts(const directory& root);
 		font const& at(font_tag t) const;
 		font& at(font_tag t);
-		void load_fonts(open_gl_wrapper&);
+		void load_fonts(open_gl_wrapper&, const std::u16string& cache_directory = std::u16string());
 		void load_metrics_fonts();
 	};
 }
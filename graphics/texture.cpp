@@ -6,6 +6,7 @@
 #include <Windows.h>
 #include <wingdi.h>
 #include <thread>
+#include <ppl.h>
 
 #include "soil\\SOIL.h"
 
@@ -82,14 +83,15 @@ namespace graphics {
 		SOIL_free_image_data(expected);
 	}
 
-	void texture::load_filedata() {
+	void texture::load_filedata(const std::u16string& cache_directory) {
 		if (filedata.load(std::memory_order_acquire) == nullptr) {
-			int channels = 4;
-			auto data = SOIL_load_image(filename.c_str(), &width, &height, &channels, 4);
+			auto decoded = decode_texture_file(filename, cache_directory);
+			width = decoded.width;
+			height = decoded.height;
 
 			unsigned char* expected = nullptr;
-			if (!filedata.compare_exchange_strong(expected, data, std::memory_order_release, std::memory_order_acquire)) {
-				SOIL_free_image_data(data);
+			if (!filedata.compare_exchange_strong(expected, decoded.data, std::memory_order_release, std::memory_order_acquire)) {
+				free_decoded_texture(decoded);
 			}
 		}
 	}
@@ -179,10 +181,10 @@ namespace graphics {
 	}
 
 	void texture_manager::load_all_texture_files() {
-		std::thread loading_thread([_this = this]() {
-			for (auto& t : _this->textures) {
-				t.load_filedata();
-			}
+		std::thread loading_thread([_this = this, cache_directory = cache_directory]() {
+			concurrency::parallel_for(0, int32_t(_this->textures.size()), [_this, &cache_directory](int32_t i) {
+				_this->textures[texture_tag(static_cast<texture_tag::value_base_t>(i))].load_filedata(cache_directory);
+			});
 		});
 		loading_thread.detach();
 	}
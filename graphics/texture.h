@@ -9,6 +9,19 @@
 #include "simple_serialize\\simple_serialize.hpp"
 
 namespace graphics {
+	// an image decoded to RGBA8; data is released with free_decoded_texture (or SOIL_free_image_data)
+	struct decoded_texture {
+		unsigned char* data = nullptr;
+		int32_t width = 0;
+		int32_t height = 0;
+		bool from_cache = false;
+	};
+
+	// Decoding does not touch OpenGL. When cache_directory is not empty decoded images are stored there, keyed by the
+	// hash and size of the source file, and a later decode of the same file reads them back instead of decoding again.
+	decoded_texture decode_texture_file(const std::string& filename, const std::u16string& cache_directory);
+	void free_decoded_texture(decoded_texture& t);
+
 	class texture {
 	private:
 		std::atomic<uint32_t> texture_handle = 0;
@@ -46,7 +59,7 @@ namespace graphics {
 		int32_t get_height() const { return height; }
 		uint32_t handle();
 		void load();
-		void load_filedata();
+		void load_filedata(const std::u16string& cache_directory = std::u16string());
 		void free();
 	};
 
@@ -88,6 +101,8 @@ namespace graphics {
 		texture_tag standard_small_tiles_dialog;
 		texture_tag edit_cursor;
 
+		std::u16string cache_directory; // where decoded images are kept between runs; empty for none
+
 		texture_manager() : fname_map(vector_backed_string_less_ci(file_names)) {}
 		auto count() { return textures.size(); }
 		texture_tag load_texture(const directory& root, const char* start, const char* end);
@@ -95,7 +110,7 @@ namespace graphics {
 		texture_tag retrieve_by_name(const directory& root, const char* start, const char* end);
 		const texture& retrieve_by_key(texture_tag key) const;
 		texture& retrieve_by_key(texture_tag key);
-		void load_all_texture_files();
+		void load_all_texture_files(); // decodes in the background, in parallel, through cache_directory
 	};
 }
 
@@ -0,0 +1,76 @@
+#include "texture.h"
+#include <stdlib.h>
+
+#include "soil\\SOIL.h"
+
+namespace graphics {
+	namespace {
+		constexpr uint32_t texture_cache_kind = 0x58455456ui32;
+		constexpr uint32_t texture_cache_version = 2ui32;
+
+		// the payload is the size of the image followed by its pixels
+		bool read_cached(const std::u16string& cache_name, serialization::blob_cache_key const& key, decoded_texture& result) {
+			return serialization::read_cached_blob(cache_name, key, [&result](std::byte const* payload, uint64_t payload_size) {
+				int32_t size[2] = { 0, 0 };
+				if(payload_size < sizeof(size))
+					return false;
+				memcpy(size, payload, sizeof(size));
+
+				const auto pixels_size = uint64_t(size[0]) * uint64_t(size[1]) * 4ui64;
+				if(size[0] <= 0 || size[1] <= 0 || payload_size < sizeof(size) + pixels_size)
+					return false;
+
+				result.data = (unsigned char*)malloc(size_t(pixels_size)); // released with free, as SOIL's images are
+				memcpy(result.data, payload + sizeof(size), size_t(pixels_size));
+				result.width = size[0];
+				result.height = size[1];
+				result.from_cache = true;
+				return true;
+			});
+		}
+
+		void write_cached(const std::u16string& cache_name, serialization::blob_cache_key const& key, const decoded_texture& t) {
+			const int32_t size[2] = { t.width, t.height };
+			serialization::write_cached_blob(cache_name, key, {
+				serialization::blob_part{ size, sizeof(size) },
+				serialization::blob_part{ t.data, size_t(t.width) * size_t(t.height) * 4 } });
+		}
+	}
+
+	decoded_texture decode_texture_file(const std::string& filename, const std::u16string& cache_directory) {
+		decoded_texture result;
+
+		serialization::serialize_file_wrapper source(std::u16string(filename.begin(), filename.end()));
+		if(!source.file_valid())
+			return result;
+
+		const auto source_bytes = (const unsigned char*)source.get_bytes();
+		const auto source_size = source.get_size();
+
+		serialization::blob_cache_key key;
+		std::u16string cache_name;
+		if(cache_directory.length() != 0) {
+			key.kind = texture_cache_kind;
+			key.version = texture_cache_version;
+			key.source_hash = serialization::blob_hash(source_bytes, size_t(source_size));
+			key.source_size = source_size;
+			cache_name = serialization::blob_cache_file_name(cache_directory, key, u".tex");
+			if(read_cached(cache_name, key, result))
+				return result;
+		}
+
+		int channels = 4;
+		result.data = SOIL_load_image_from_memory(source_bytes, int(source_size), &result.width, &result.height, &channels, 4);
+
+		if(result.data && result.width > 0 && result.height > 0 && cache_name.length() != 0)
+			write_cached(cache_name, key, result);
+
+		return result;
+	}
+
+	void free_decoded_texture(decoded_texture& t) {
+		if(t.data)
+			SOIL_free_image_data(t.data);
+		t.data = nullptr;
+	}
+}
@@ -626,10 +626,56 @@ namespace graphics {
 		return  projected_to_unrotated(in.first, in.second, scale, _aspect, _projection);
 	}
 
+	void centroid_grid::build(tagged_array_view<Eigen::Vector2f, provinces::province_tag> centroids, int32_t count, int32_t map_width, int32_t map_height) {
+		width_cells = std::max((map_width + block_size - 1) / block_size, 1);
+		height_cells = std::max((map_height + block_size - 1) / block_size, 1);
+
+		auto const cell_of = [this](Eigen::Vector2f const& c) {
+			int32_t const i = std::clamp(int32_t(c[0] / float(block_size)), 0, width_cells - 1);
+			int32_t const j = std::clamp(int32_t(c[1] / float(block_size)), 0, height_cells - 1);
+			return i + j * width_cells;
+		};
+
+		cell_start.assign(size_t(width_cells * height_cells + 1), 0);
+		for(int32_t i = 1; i < count; ++i)
+			++cell_start[size_t(cell_of(centroids[provinces::province_tag(provinces::province_tag::value_base_t(i))]) + 1)];
+		for(size_t k = 1; k < cell_start.size(); ++k)
+			cell_start[k] += cell_start[k - 1];
+
+		std::vector<int32_t> cursor(cell_start.begin(), cell_start.end() - 1);
+		cell_provinces.resize(size_t(cell_start.back()));
+		for(int32_t i = 1; i < count; ++i) {
+			auto const p = provinces::province_tag(provinces::province_tag::value_base_t(i));
+			cell_provinces[size_t(cursor[size_t(cell_of(centroids[p]))]++)] = p;
+		}
+	}
+
+	void centroid_grid::gather(float x0, float y0, float x1, float y1, std::vector<provinces::province_tag>& out) const {
+		if(cell_start.size() == 0)
+			return;
+
+		int32_t const row_a = std::clamp(int32_t(std::floor(y0 / float(block_size))), 0, height_cells - 1);
+		int32_t const row_b = std::clamp(int32_t(std::floor(y1 / float(block_size))), 0, height_cells - 1);
+		int32_t col_a = int32_t(std::floor(x0 / float(block_size)));
+		int32_t col_b = int32_t(std::floor(x1 / float(block_size)));
+		if(col_b - col_a + 1 >= width_cells) {
+			col_a = 0;
+			col_b = width_cells - 1;
+		}
+
+		for(int32_t r = row_a; r <= row_b; ++r) {
+			for(int32_t c = col_a; c <= col_b; ++c) {
+				int32_t const cell = ((c % width_cells) + width_cells) % width_cells + r * width_cells;
+				out.insert(out.end(), cell_provinces.begin() + cell_start[size_t(cell)], cell_provinces.begin() + cell_start[size_t(cell + 1)]);
+			}
+		}
+	}
+
 	void map_display::init_province_ui(tagged_array_view<Eigen::Vector2f, provinces::province_tag> c, int32_t count, std::function<void()> sig_f) {
 		new (&province_centroids) tagged_array_view<Eigen::Vector2f, provinces::province_tag>(c);
 		province_count = count;
 		signal_ui_update = sig_f;
+		province_grid.build(c, count, map_width, map_height);
 	}
 
 	void map_display::associate_map_icon_set(ui::gui_object_tag(*f)(world_state&, ui::gui_object_tag, provinces::province_tag), int32_t x_size, int32_t y_size) {
@@ -639,21 +685,71 @@ namespace graphics {
 		update_object_fun_out_of_date.store(true, std::memory_order_release);
 	}
 
+	void map_display::gather_map_ui_candidates(int32_t x_border, int32_t y_border) {
+		map_ui_candidates.clear();
+
+		// bounds the part of the map under the screen, plus the icon borders, by projecting points along the edges of the screen
+		// back onto the map; the x coordinates are unwrapped around the center of the screen so that the bounds may cross the seam
+
+		constexpr int32_t samples_per_edge = 8;
+		float const edge_x = 1.0f + float(x_border * 2) / float(std::max(screen_x, 1));
+		float const edge_y = 1.0f + float(y_border * 2) / float(std::max(screen_y, 1));
+		float const half_width = float(map_width) * 0.5f;
+
+		auto const center = map_coordinate_from_globe(get_vector_for(std::pair<float, float>(0.0f, 0.0f)));
+		float min_x = center.first;
+		float max_x = center.first;
+		float min_y = center.second;
+		float max_y = center.second;
+
+		auto const add_sample = [&](float x, float y) {
+			auto const m = map_coordinate_from_globe(get_vector_for(std::pair<float, float>(x, y)));
+			float const mx = m.first - center.first > half_width ? m.first - float(map_width) :
+				(center.first - m.first > half_width ? m.first + float(map_width) : m.first);
+			min_x = std::min(min_x, mx);
+			max_x = std::max(max_x, mx);
+			min_y = std::min(min_y, m.second);
+			max_y = std::max(max_y, m.second);
+		};
+		for(int32_t k = 0; k <= samples_per_edge; ++k) {
+			float const t = -1.0f + 2.0f * float(k) / float(samples_per_edge);
+			add_sample(t * edge_x, edge_y);
+			add_sample(t * edge_x, -edge_y);
+			add_sample(edge_x, t * edge_y);
+			add_sample(-edge_x, t * edge_y);
+		}
+
+		// near a pole the unwrapped x bounds are unreliable, so every column is searched
+		if(max_x - min_x > half_width * 0.5f) {
+			min_x = 0.0f;
+			max_x = float(map_width);
+		}
+
+		// the screen edges curve between the samples, so the bounds are padded by a block
+		province_grid.gather(min_x - float(block_size), min_y - float(block_size), max_x + float(block_size), max_y + float(block_size), map_ui_candidates);
+	}
+
+	void map_display::release_map_icon(world_state& ws, ui::gui_object_tag& t) {
+		ui::tagged_gui_object obj{ ws.w.gui_m.gui_objects.at(t) , t };
+		if(auto const ab = obj.object.associated_behavior; ab) {
+			ab->associated_object = nullptr;
+		}
+		ws.w.gui_m.destroy(obj);
+		t = ui::gui_object_tag();
+	}
+
 	void map_display::update_province_ui_positions(world_state& ws) {
 		auto const update_fn = update_object_fun.load(std::memory_order_acquire);
 		if(update_fn && get_scale() >= scale_max * 0.6f) {
 			bool fn_update_expected = true;
 			if(update_object_fun_out_of_date.compare_exchange_strong(fn_update_expected, false, std::memory_order_acq_rel)) {
 				for(auto& t : map_ui_objects) {
-					if(t) {
-						ui::tagged_gui_object obj{ ws.w.gui_m.gui_objects.at(t) , t };
-						if(auto const ab = obj.object.associated_behavior; ab) {
-							ab->associated_object = nullptr;
-						}
-						ws.w.gui_m.destroy(obj);
-						t = ui::gui_object_tag();
-					}
+					if(t)
+						release_map_icon(ws, t);
 				}
+				map_ui_shown.clear();
+				map_ui_retained.clear();
+				std::fill(map_ui_is_retained.begin(), map_ui_is_retained.end(), 0ui8);
 			}
 
 			bool update_expected = true;
@@ -661,48 +757,60 @@ namespace graphics {
 				auto x_border = int32_t(map_ui_half_x_size.load(std::memory_order_acquire) * ws.w.gui_m.scale());
 				auto y_border = int32_t(map_ui_half_y_size.load(std::memory_order_acquire) * ws.w.gui_m.scale());
 
-				auto const max_province = ws.s.province_m.province_container.size();
-				for(int32_t i = 1; i < max_province; ++i) {
-					auto const p = provinces::province_tag(provinces::province_tag::value_base_t(i));
+				++map_ui_pass;
+
+				gather_map_ui_candidates(x_border, y_border);
+
+				map_ui_next_shown.clear();
+				for(auto const p : map_ui_candidates) {
+					auto const i = to_index(p);
 					auto centroid = province_centroids[p];
 					auto screen_coords = fast_screen_coordinates_from_map(centroid[0], centroid[1]);
 
-					if(screen_coords.visible) {
-						if(screen_coords.x + x_border >= 0 && screen_coords.x - x_border < screen_x
-							&& screen_coords.y + y_border >= 0 && screen_coords.y - y_border < screen_y) {
-
-							if(auto t = map_ui_objects[i]; t) {
-								ui::tagged_gui_object obj{ ws.w.gui_m.gui_objects.at(t) , t };
-								obj.object.position = ui::xy_pair{ int16_t(screen_coords.x - x_border), int16_t(screen_coords.y - y_border) };
-								obj.object.flags.fetch_or(ui::gui_object::visible_after_update, std::memory_order_acq_rel);
-							} else {
-								if(auto u = update_fn(ws, map_ui_container, p); u) {
-									map_ui_objects[i] = u;
-									ui::tagged_gui_object obj{ ws.w.gui_m.gui_objects.at(u) , u };
-									obj.object.position = ui::xy_pair{ int16_t(screen_coords.x - x_border), int16_t(screen_coords.y - y_border) };
-									obj.object.flags.fetch_or(ui::gui_object::visible_after_update, std::memory_order_acq_rel);
-								}
-							}
-						} else if(auto t = map_ui_objects[i]; t) {
+					if(screen_coords.visible
+						&& screen_coords.x + x_border >= 0 && screen_coords.x - x_border < screen_x
+						&& screen_coords.y + y_border >= 0 && screen_coords.y - y_border < screen_y) {
+
+						if(!map_ui_objects[i])
+							map_ui_objects[i] = update_fn(ws, map_ui_container, p);
+						if(auto t = map_ui_objects[i]; t) {
 							ui::tagged_gui_object obj{ ws.w.gui_m.gui_objects.at(t) , t };
-							if(auto const ab = obj.object.associated_behavior; ab) {
-								ab->associated_object = nullptr;
-								//obj.object.associated_behavior = nullptr;
+							obj.object.position = ui::xy_pair{ int16_t(screen_coords.x - x_border), int16_t(screen_coords.y - y_border) };
+							obj.object.flags.fetch_or(ui::gui_object::visible_after_update, std::memory_order_acq_rel);
+
+							map_ui_shown_pass[i] = map_ui_pass;
+							map_ui_next_shown.push_back(p);
+
+							if(map_ui_is_retained[i]) { // shown again: it no longer takes a retained slot
+								map_ui_is_retained[i] = 0ui8;
+								map_ui_retained.erase(std::find(map_ui_retained.begin(), map_ui_retained.end(), p));
 							}
-							ws.w.gui_m.destroy(obj);
-							map_ui_objects[i] = ui::gui_object_tag();
 						}
-					} else if(auto t = map_ui_objects[i]; t) {
-						ui::tagged_gui_object obj{ ws.w.gui_m.gui_objects.at(t) , t };
-						if(auto const ab = obj.object.associated_behavior; ab) {
-							ab->associated_object = nullptr;
-							//obj.object.associated_behavior = nullptr;
-						}
-						ws.w.gui_m.destroy(obj);
-						map_ui_objects[i] = ui::gui_object_tag();
 					}
 				}
 
+				// icons that left the screen are hidden rather than destroyed, so that they can be shown again without
+				// being recreated; only the oldest ones past max_retained_map_icons are destroyed
+
+				for(auto const p : map_ui_shown) {
+					auto const i = to_index(p);
+					if(map_ui_shown_pass[i] != map_ui_pass && map_ui_objects[i]) {
+						ui::hide(ws.w.gui_m.gui_objects.at(map_ui_objects[i]));
+						if(!map_ui_is_retained[i]) {
+							map_ui_is_retained[i] = 1ui8;
+							map_ui_retained.push_back(p);
+						}
+					}
+				}
+				std::swap(map_ui_shown, map_ui_next_shown);
+
+				while(map_ui_retained.size() > max_retained_map_icons) {
+					auto const i = to_index(map_ui_retained.front());
+					map_ui_retained.pop_front();
+					map_ui_is_retained[i] = 0ui8;
+					if(map_ui_shown_pass[i] != map_ui_pass && map_ui_objects[i])
+						release_map_icon(ws, map_ui_objects[i]);
+				}
 				
 				if(map_ui_container) {
 					auto& container_obj = ws.w.gui_m.gui_objects.at(map_ui_container);
@@ -1101,16 +1209,42 @@ namespace graphics {
 			glDrawElements(GL_LINE_STRIP, block.coastal_borders_size - 1, GL_UNSIGNED_INT, (void*)(sizeof(int32_t)));
 		}
 	}
-	void render_national_borders(float scale, provinces::borders_manager::border_block const& block, world_state const& ws) {
-		glLineWidth(1.0f + ((scale - scale_min) / (scale_max - scale_min)) * 3.0f);
-		glUniform4f(border_parameters::border_color, 0.0f, 0.0f, 0.0f, 1.0f);
-		for(auto const& b : block.province_borders) {
-			if(ws.w.province_s.province_state_container.get<province_state::owner>(b.a) 
-				!= ws.w.province_s.province_state_container.get<province_state::owner>(b.b)) {
-				glDrawElements(GL_LINE_STRIP, b.size, GL_UNSIGNED_INT, (void*)(b.offset * sizeof(int32_t)));
+	void update_national_borders(national_border_list& list, provinces::borders_manager::border_block const& block, world_state const& ws) {
+		auto const& container = ws.w.province_s.province_state_container;
+
+		bool changed = list.owners.size() != block.province_borders.size() * 2;
+		for(size_t k = 0; !changed && k < block.province_borders.size(); ++k) {
+			changed = list.owners[k * 2] != container.get<province_state::owner>(block.province_borders[k].a)
+				|| list.owners[k * 2 + 1] != container.get<province_state::owner>(block.province_borders[k].b);
+		}
+
+		if(changed) {
+			list.owners.resize(block.province_borders.size() * 2);
+			list.counts.clear();
+			list.offsets.clear();
+
+			for(size_t k = 0; k < block.province_borders.size(); ++k) {
+				auto const& b = block.province_borders[k];
+				auto const owner_a = container.get<province_state::owner>(b.a);
+				auto const owner_b = container.get<province_state::owner>(b.b);
+				list.owners[k * 2] = owner_a;
+				list.owners[k * 2 + 1] = owner_b;
+
+				if(owner_a != owner_b) {
+					list.counts.push_back(b.size);
+					list.offsets.push_back((void const*)(b.offset * sizeof(int32_t)));
+				}
 			}
 		}
 	}
+	void render_national_borders(float scale, national_border_list const& list) {
+		if(list.counts.size() != 0) {
+			glLineWidth(1.0f + ((scale - scale_min) / (scale_max - scale_min)) * 3.0f);
+			glUniform4f(border_parameters::border_color, 0.0f, 0.0f, 0.0f, 1.0f);
+
+			glMultiDrawElements(GL_LINE_STRIP, list.counts.data(), GL_UNSIGNED_INT, list.offsets.data(), GLsizei(list.counts.size()));
+		}
+	}
 	void render_state_borders(float scale, provinces::borders_manager::border_block const& block) {
 		if(block.state_borders_size > 0 && scale > scale_max * 0.3f) {
 			glLineWidth(1.0f + ((scale - scale_min) / (scale_max - scale_min)) * 2.0f);
@@ -1137,15 +1271,17 @@ namespace graphics {
 
 		const auto wblocks = (map_width + block_size - 1) / block_size;
 
-		get_globe().for_each_visible_block(map_width, map_height, [scale = this->get_scale(), wblocks, &borders, &ws](int32_t x, int32_t y, float const* x_matrix, float const* y_matrix) {
+		get_globe().for_each_visible_block(map_width, map_height, [scale = this->get_scale(), wblocks, &borders, &national = this->national_borders, &ws](int32_t x, int32_t y, float const* x_matrix, float const* y_matrix) {
 			auto& block = borders.borders[x + y * wblocks];
+			auto& national_list = national[x + y * wblocks];
 			
 			ready_border_render(borders.border_vbo, block.vertices_handle, block.indices_handle, x_matrix, y_matrix);
+			update_national_borders(national_list, block, ws);
 			
 			render_coastal_borders(scale, block);
 			render_state_borders(scale, block);
 			render_province_borders(scale, block);
-			render_national_borders(scale, block, ws);
+			render_national_borders(scale, national_list);
 		});
 		glDisable(GL_PRIMITIVE_RESTART);
 	}
@@ -1191,6 +1327,26 @@ namespace graphics {
 	//.....................
 
 
+	void fill_corner_data(int8_t* corners, uint16_t const* map_data, int32_t width, int32_t first_row, int32_t last_row) {
+		for (int32_t j = first_row; j < last_row; ++j) {
+			for (int32_t i = 0; i < width - 1; ++i) {
+				const auto ul = map_data[i + j * width];
+				const auto ur = map_data[i+1 + j * width];
+				const auto bl = map_data[i + (j+1) * width];
+				const auto br = map_data[i+1 + (j+1) * width];
+
+				if (ul == ur && bl == ul)
+					corners[(i + 1) * 2 + (j + 1) * 2 * width * 2] = -1i8;
+				if (ul == ur && br == ur)
+					corners[(i) * 2 + 1 + (j + 1) * 2 * width * 2] = 1i8;
+				if (br == bl && bl == ul)
+					corners[(i + 1) * 2 + ((j) * 2 + 1) * width * 2] = -1i8;
+				if (br == bl && br == ur)
+					corners[(i) * 2 + 1 + ((j) * 2 + 1) * width * 2] = 1i8;
+			}
+		}
+	}
+
 	void create_data_textures(map_data_textures& result, uint16_t const* map_data, int32_t width, int32_t height) {
 		result.width = width;
 		result.height = height;
@@ -1211,23 +1367,11 @@ namespace graphics {
 		int8_t* corners = new int8_t[static_cast<size_t>(width * height * 4)];
 		memset(corners, 0, static_cast<size_t>(width * height * 4));
 
-		for (int32_t j = 0; j < height - 1; ++j) {
-			for (int32_t i = 0; i < width - 1; ++i) {
-				const auto ul = result.primary_data[i + j * width];
-				const auto ur = result.primary_data[i+1 + j * width];
-				const auto bl = result.primary_data[i + (j+1) * width];
-				const auto br = result.primary_data[i+1 + (j+1) * width];
-
-				if (ul == ur && bl == ul)
-					corners[(i + 1) * 2 + (j + 1) * 2 * width * 2] = -1i8;
-				if (ul == ur && br == ur)
-					corners[(i) * 2 + 1 + (j + 1) * 2 * width * 2] = 1i8;
-				if (br == bl && bl == ul)
-					corners[(i + 1) * 2 + ((j) * 2 + 1) * width * 2] = -1i8;
-				if (br == bl && br == ur)
-					corners[(i) * 2 + 1 + ((j) * 2 + 1) * width * 2] = 1i8;
-			}
-		}
+		// each row of pixels only writes the two rows of corners below its top edge, so bands of rows are independent
+		const auto hblocks = (height + block_size - 1) / block_size;
+		concurrency::parallel_for(0, hblocks, [corners, map_data, width, height](int32_t band) {
+			fill_corner_data(corners, map_data, width, band * block_size, std::min((band + 1) * block_size, height - 1));
+		});
 
 		glGenTextures(1, &result.corner_handle);
 		glBindTexture(GL_TEXTURE_2D, result.corner_handle);
@@ -1245,12 +1389,13 @@ namespace graphics {
 	}
 
 	void color_maps::bind_colors() {
-		bool expected = true;
-		if (update_pending.compare_exchange_strong(expected, false, std::memory_order_release, std::memory_order_acquire)) {
+		if((ready_slot.load(std::memory_order_acquire) & fresh_bit) != 0) {
+			read_slot = ready_slot.exchange(read_slot, std::memory_order_acq_rel) & slot_mask;
+
 			glBindTexture(GL_TEXTURE_1D, primary_handle);
-			glTexSubImage1D(GL_TEXTURE_1D, 0, 0, size, GL_RGB, GL_UNSIGNED_BYTE, primary_colors);
+			glTexSubImage1D(GL_TEXTURE_1D, 0, 0, size, GL_RGB, GL_UNSIGNED_BYTE, primary_colors[read_slot]);
 			glBindTexture(GL_TEXTURE_1D, secondary_handle);
-			glTexSubImage1D(GL_TEXTURE_1D, 0, 0, size, GL_RGB, GL_UNSIGNED_BYTE, secondary_colors);
+			glTexSubImage1D(GL_TEXTURE_1D, 0, 0, size, GL_RGB, GL_UNSIGNED_BYTE, secondary_colors[read_slot]);
 		}
 
 		glActiveTexture(GL_TEXTURE1);
@@ -1530,8 +1675,11 @@ namespace graphics {
 
 		border_shader_handle = compile_borders_program();
 		init_border_graphics(ws.s.province_m.borders);
+		national_borders.resize(ws.s.province_m.borders.borders.size());
 
 		map_ui_objects.resize(ws.s.province_m.province_container.size());
+		map_ui_shown_pass.resize(ws.s.province_m.province_container.size(), 0ui32);
+		map_ui_is_retained.resize(ws.s.province_m.province_container.size(), 0ui8);
 
 		auto i_con = ws.w.gui_m.gui_objects.emplace();
 		i_con.object.flags.store(ui::gui_object::enabled, std::memory_order_release);
@@ -4,50 +4,69 @@
 #include "simple_fs\\simple_fs.h"
 #include "scenario\scenario.h"
 #include "provinces\\provinces.h"
+#include <deque>
 
 class world_state;
 
 namespace graphics {
+	// Three sets of province color buffers: one written by map_mode::update_map_colors, one holding the most recently
+	// finished colors, and one uploaded by bind_colors. update_ready and bind_colors each trade their set for the one in
+	// ready_slot, so neither side ever sees a set that the other is still working on.
 	class color_maps {
 	private:
-		uint8_t* primary_colors = nullptr;
-		uint8_t* secondary_colors = nullptr;
+		static constexpr uint32_t slot_mask = 0x03;
+		static constexpr uint32_t fresh_bit = 0x04; // set in ready_slot when the set there has not yet been uploaded
+
+		uint8_t* primary_colors[3] = { nullptr, nullptr, nullptr };
+		uint8_t* secondary_colors[3] = { nullptr, nullptr, nullptr };
 
 		uint32_t primary_handle = 0;
 		uint32_t secondary_handle = 0;
 
-		std::atomic<bool> update_pending = false;
+		uint32_t write_slot = 0;
+		uint32_t read_slot = 2;
+		std::atomic<uint32_t> ready_slot = 1;
 
 		int32_t size = 0;
 	public:
 		color_maps() {}
-		color_maps(uint32_t count) : size(static_cast<int32_t>(count)) {
-			primary_colors = new uint8_t[count * 3];
-			secondary_colors = new uint8_t[count * 3];
+		color_maps(uint32_t count) {
+			init_color_data(count);
 		}
 		void bind_colors();
 		void create_color_textures();
 		void init_color_data(uint32_t count) {
 			size = static_cast<int32_t>(count);
-			primary_colors = new uint8_t[count * 3];
-			secondary_colors = new uint8_t[count * 3];
+			for(uint32_t i = 0; i < 3; ++i) {
+				primary_colors[i] = new uint8_t[count * 3];
+				secondary_colors[i] = new uint8_t[count * 3];
+				std::fill_n(primary_colors[i], count * 3, uint8_t(0));
+				std::fill_n(secondary_colors[i], count * 3, uint8_t(0));
+			}
 		}
 		uint8_t* primary_color_data() const {
-			return primary_colors;
+			return primary_colors[write_slot];
 		}
 		uint8_t* secondary_color_data() const {
-			return secondary_colors;
+			return secondary_colors[write_slot];
 		}
 		void update_ready() {
-			update_pending.store(true, std::memory_order_release);
+			auto const finished = write_slot;
+			write_slot = ready_slot.exchange(finished | fresh_bit, std::memory_order_acq_rel) & slot_mask;
+
+			// colors that the next update leaves alone must stay as they are now
+			std::copy_n(primary_colors[finished], size * 3, primary_colors[write_slot]);
+			std::copy_n(secondary_colors[finished], size * 3, secondary_colors[write_slot]);
 		}
 		~color_maps() {
-			if (primary_colors)
-				delete[] primary_colors;
-			if(secondary_colors)
-				delete[] secondary_colors;
-			primary_colors = nullptr;
-			secondary_colors = nullptr;
+			for(uint32_t i = 0; i < 3; ++i) {
+				if(primary_colors[i])
+					delete[] primary_colors[i];
+				if(secondary_colors[i])
+					delete[] secondary_colors[i];
+				primary_colors[i] = nullptr;
+				secondary_colors[i] = nullptr;
+			}
 		}
 	};
 
@@ -89,6 +108,32 @@ namespace graphics {
 	constexpr float scale_max = 18.0f;
 
 	constexpr float map_ui_scale_threshold = 17.0f;
+	constexpr uint32_t max_retained_map_icons = 256; // hidden province icons kept around to be shown again
+
+	// province centroids bucketed by map block, so that finding the provinces near some part of the map
+	// doesn't require looking at all of them
+	class centroid_grid {
+	private:
+		std::vector<int32_t> cell_start; // into cell_provinces, one past the end is the start of the next cell
+		std::vector<provinces::province_tag> cell_provinces;
+		int32_t width_cells = 0;
+		int32_t height_cells = 0;
+	public:
+		void build(tagged_array_view<Eigen::Vector2f, provinces::province_tag> centroids, int32_t count, int32_t map_width, int32_t map_height);
+		bool empty() const { return cell_start.size() == 0; }
+
+		// appends the provinces in the cells overlapping [x0, x1] x [y0, y1], in map pixels; the x range may
+		// extend past either side of the map, where it wraps around
+		void gather(float x0, float y0, float x1, float y1, std::vector<provinces::province_tag>& out) const;
+	};
+
+	// the national borders of one border block, as the counts and offsets of a glMultiDrawElements call, along with the
+	// owners of the provinces on either side of each of the block's province borders when the lists were made
+	struct national_border_list {
+		std::vector<nations::country_tag> owners;
+		std::vector<int32_t> counts;
+		std::vector<void const*> offsets;
+	};
 
 	class map_display {
 	private:
@@ -129,12 +174,25 @@ namespace graphics {
 		std::vector<ui::gui_object_tag> map_ui_objects;
 		ui::gui_object_tag map_ui_container;
 
+		centroid_grid province_grid;
+		std::vector<provinces::province_tag> map_ui_candidates;
+		std::vector<provinces::province_tag> map_ui_shown; // provinces with a visible icon
+		std::vector<provinces::province_tag> map_ui_next_shown;
+		std::vector<uint32_t> map_ui_shown_pass; // by province, the last update pass that showed its icon
+		std::deque<provinces::province_tag> map_ui_retained; // provinces with hidden icons, oldest first, each at most once
+		std::vector<uint8_t> map_ui_is_retained; // by province, 1 while it is in map_ui_retained
+		uint32_t map_ui_pass = 0;
+
 		std::atomic<ui::gui_object_tag (*)(world_state&, ui::gui_object_tag, provinces::province_tag)> update_object_fun = nullptr;
 		std::atomic<bool> update_object_fun_out_of_date = true;
 		std::atomic<int32_t> map_ui_half_x_size = 0;
 		std::atomic<int32_t> map_ui_half_y_size = 0;
 
+		std::vector<national_border_list> national_borders; // by border block, rebuilt when the owners along the block change
+
 		void render_borders(provinces::borders_manager const& borders, world_state const& ws);
+		void gather_map_ui_candidates(int32_t x_border, int32_t y_border);
+		void release_map_icon(world_state& ws, ui::gui_object_tag& t);
 	public:
 		struct fast_screen_coordinate : public ui::xy_pair {
 			bool visible;
@@ -2,6 +2,9 @@
 #include "fake_fs\\fake_fs.h"
 #include "gtest\\gtest.h"
 #include <mutex>
+#include <Windows.h>
+#undef max
+#undef min
 
 using namespace graphics;
 
@@ -248,6 +251,27 @@ TEST(graphics_tests, font_manager_test) {
 	EXPECT_EQ(14ui32, fm.find_font_size(RANGE(v3)));
 }
 
+TEST(graphics_tests, metrics_text_extent) {
+	font test_font("D:\\VS2007Projects\\open_v2_test_data\\CreteRound-Regular.otf");
+	test_font.load_metrics_font();
+
+	const char16_t text[] = u"AVAToday";
+	const uint32_t count = 8;
+
+	float expected = 0.0f;
+	for(uint32_t i = 0; i < count; ++i) {
+		expected += test_font.get_metrics_glyph(text[i]).advance * 16.0f / 64.0f
+			+ ((i != count - 1) ? test_font.metrics_kerning(text[i], text[i + 1]) * 16.0f / 64.0f : 0.0f);
+	}
+
+	EXPECT_NEAR(expected, test_font.metrics_text_extent(text, count, 16.0f), 0.001f);
+	EXPECT_NEAR(expected, test_font.metrics_text_extent(text, count, 16.0f), 0.001f);
+	EXPECT_NEAR(expected + 0.6f * float(count), test_font.metrics_text_extent(text, count, 16.0f, true), 0.001f);
+	EXPECT_NEAR(expected * 2.0f, test_font.metrics_text_extent(text, count, 32.0f), 0.001f);
+	EXPECT_GT(expected, test_font.metrics_text_extent(text, count - 1, 16.0f));
+	EXPECT_EQ(0.0f, test_font.metrics_text_extent(text, 0, 16.0f));
+}
+
 TEST(graphics_tests, clipping) {
 	std::lock_guard l(force_sequential);
 
@@ -270,3 +294,160 @@ TEST(graphics_tests, clipping) {
 		ogl.render_textured_rect(graphics::color_modification::disabled, 0.0f, 40.0f, 80.0f, 40.0f, test_tex);
 	}));
 }
+
+TEST(graphics_tests, batched_rendering) {
+	std::lock_guard l(force_sequential);
+
+	EXPECT_TRUE(test_rendering("D:\\VS2007Projects\\open_v2_test_data\\texture", 0, 0, 80, 80, [](open_gl_wrapper& ogl) {
+		texture test_tex("D:\\VS2007Projects\\open_v2_test_data\\test_tx.bmp");
+
+		ogl.begin_batch();
+		ogl.render_textured_rect(graphics::color_modification::none, 0.0f, 0.0f, 80.0f, 40.0f, test_tex);
+		ogl.render_textured_rect(graphics::color_modification::disabled, 0.0f, 40.0f, 80.0f, 40.0f, test_tex);
+		EXPECT_EQ(2ui32, ogl.current_batch().quad_count());
+		EXPECT_EQ(2ui32, ogl.current_batch().batch_count());
+		ogl.end_batch();
+	}));
+
+	EXPECT_TRUE(test_rendering("D:\\VS2007Projects\\open_v2_test_data\\clipping_b", 0, 0, 80, 80, [](open_gl_wrapper& ogl) {
+		texture test_tex("D:\\VS2007Projects\\open_v2_test_data\\test_tx.bmp");
+
+		ogl.begin_batch();
+		scissor_rect r1(ogl, 10, 10, 60, 60);
+		{
+			scissor_rect r2(ogl, 0, 00, 40, 80);
+			ogl.render_textured_rect(graphics::color_modification::none, 0.0f, 0.0f, 80.0f, 40.0f, test_tex);
+		}
+		ogl.render_textured_rect(graphics::color_modification::disabled, 0.0f, 40.0f, 80.0f, 40.0f, test_tex);
+		ogl.end_batch();
+	}));
+}
+
+namespace {
+	quad_instance test_quad(float x, float y, float w, float h) {
+		quad_instance q;
+		q.rect[0] = x;
+		q.rect[1] = y;
+		q.rect[2] = w;
+		q.rect[3] = h;
+		return q;
+	}
+	batch_key test_key(uint32_t texture) {
+		batch_key k;
+		k.texture = texture;
+		k.scissor[2] = 100;
+		k.scissor[3] = 100;
+		return k;
+	}
+}
+
+TEST(graphics_tests, draw_list_merging) {
+	draw_list dl;
+
+	for(int32_t i = 0; i < 10; ++i)
+		dl.add(test_key(1), test_quad(float(i) * 8.0f, 0.0f, 8.0f, 8.0f));
+
+	EXPECT_EQ(10ui32, dl.quad_count());
+	EXPECT_EQ(1ui32, dl.batch_count());
+	EXPECT_EQ(0ui32, dl.reordered_count());
+
+	dl.add(test_key(2), test_quad(0.0f, 20.0f, 8.0f, 8.0f));
+	dl.add(test_key(1), test_quad(0.0f, 40.0f, 8.0f, 8.0f)); // does not overlap the quad of the second batch
+
+	EXPECT_EQ(2ui32, dl.batch_count());
+	EXPECT_EQ(1ui32, dl.reordered_count());
+	EXPECT_EQ(11ui32, dl.get_batches()[0].count);
+
+	dl.add(test_key(2), test_quad(0.0f, 36.0f, 8.0f, 8.0f)); // overlaps the first batch, so must be drawn after it
+	EXPECT_EQ(2ui32, dl.batch_count());
+	EXPECT_EQ(2ui32, dl.get_batches()[1].count);
+
+	dl.add(test_key(1), test_quad(4.0f, 20.0f, 8.0f, 8.0f)); // overlaps the second batch, so starts a new one
+	EXPECT_EQ(3ui32, dl.batch_count());
+
+	batch_key clipped = test_key(1);
+	clipped.scissor[2] = 50;
+	dl.add(clipped, test_quad(60.0f, 60.0f, 8.0f, 8.0f));
+	EXPECT_EQ(4ui32, dl.batch_count());
+	EXPECT_EQ(15ui32, dl.quad_count());
+
+	dl.clear();
+	EXPECT_TRUE(dl.empty());
+	EXPECT_EQ(0ui32, dl.batch_count());
+	EXPECT_EQ(0ui32, dl.reordered_count());
+}
+
+TEST(graphics_tests, draw_list_layout) {
+	draw_list dl;
+
+	dl.add(test_key(1), test_quad(0.0f, 0.0f, 8.0f, 8.0f));
+	dl.add(test_key(2), test_quad(10.0f, 0.0f, 8.0f, 8.0f));
+	dl.add(test_key(1), test_quad(20.0f, 0.0f, 8.0f, 8.0f));
+	dl.add(test_key(2), test_quad(30.0f, 0.0f, 8.0f, 8.0f));
+	dl.add(test_key(3), test_quad(0.0f, 0.0f, 40.0f, 8.0f));
+	dl.add(test_key(1), test_quad(40.0f, 0.0f, 8.0f, 8.0f));
+
+	dl.finish();
+
+	auto const& batches = dl.get_batches();
+	auto const& instances = dl.sorted_instances();
+	ASSERT_EQ(3ui32, dl.batch_count());
+	ASSERT_EQ(6ui32, uint32_t(instances.size()));
+
+	EXPECT_EQ(0ui32, batches[0].first);
+	EXPECT_EQ(3ui32, batches[0].count);
+	EXPECT_EQ(3ui32, batches[1].first);
+	EXPECT_EQ(2ui32, batches[1].count);
+	EXPECT_EQ(5ui32, batches[2].first);
+	EXPECT_EQ(1ui32, batches[2].count);
+
+	EXPECT_EQ(0.0f, instances[0].rect[0]);
+	EXPECT_EQ(20.0f, instances[1].rect[0]);
+	EXPECT_EQ(40.0f, instances[2].rect[0]);
+	EXPECT_EQ(10.0f, instances[3].rect[0]);
+	EXPECT_EQ(30.0f, instances[4].rect[0]);
+	EXPECT_EQ(40.0f, instances[5].rect[2]);
+}
+
+// creates dir if needed and deletes the files in it, so that a cache test starts with nothing cached
+static void empty_test_directory(std::u16string const& dir) {
+	CreateDirectoryW((wchar_t const*)(dir.c_str()), nullptr);
+
+	WIN32_FIND_DATAW fd;
+	const auto pattern = dir + u"\\*";
+	if(auto h = FindFirstFileW((wchar_t const*)(pattern.c_str()), &fd); h != INVALID_HANDLE_VALUE) {
+		do {
+			if((fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0)
+				DeleteFileW((wchar_t const*)((dir + u"\\" + (char16_t const*)(fd.cFileName)).c_str()));
+		} while(FindNextFileW(h, &fd));
+		FindClose(h);
+	}
+}
+
+TEST(graphics_tests, texture_decoding_cache) {
+	const std::u16string cache_dir = u"D:\\VS2007Projects\\open_v2_test_data\\texture_cache_test";
+	empty_test_directory(cache_dir);
+
+	auto uncached = decode_texture_file("D:\\VS2007Projects\\open_v2_test_data\\test_tx.bmp", std::u16string());
+	ASSERT_NE(nullptr, uncached.data);
+	EXPECT_FALSE(uncached.from_cache);
+
+	auto first = decode_texture_file("D:\\VS2007Projects\\open_v2_test_data\\test_tx.bmp", cache_dir);
+	auto second = decode_texture_file("D:\\VS2007Projects\\open_v2_test_data\\test_tx.bmp", cache_dir);
+	ASSERT_NE(nullptr, first.data);
+	ASSERT_NE(nullptr, second.data);
+	EXPECT_FALSE(first.from_cache);
+	EXPECT_TRUE(second.from_cache);
+
+	EXPECT_EQ(uncached.width, second.width);
+	EXPECT_EQ(uncached.height, second.height);
+	EXPECT_EQ(0, memcmp(uncached.data, first.data, size_t(uncached.width * uncached.height * 4)));
+	EXPECT_EQ(0, memcmp(uncached.data, second.data, size_t(uncached.width * uncached.height * 4)));
+
+	free_decoded_texture(uncached);
+	free_decoded_texture(first);
+	free_decoded_texture(second);
+	EXPECT_EQ(nullptr, second.data);
+
+	empty_test_directory(cache_dir);
+}
@@ -21,6 +21,7 @@ void ui::gui_manager::destroy(tagged_gui_object g) {
 	}
 	if (focus == g.id)
 		focus = gui_object_tag();
+	clear_subscriptions(g);
 
 	if (g.object.associated_behavior) {
 		if ((g.object.flags.load(std::memory_order_relaxed) & gui_object::dynamic_behavior) != 0) {
@@ -493,9 +494,21 @@ namespace ui {
 
 	void line_manager::add_object(gui_object * o) {
 		current_line.push_back(o);
+		if(recording) {
+			line_recording::entry e;
+			e.position = o->position;
+			e.size = o->size;
+			recording->entries.push_back(e);
+			recording->added.push_back(o);
+		}
 	}
 
 	void line_manager::finish_current_line() {
+		if(recording) {
+			line_recording::entry e;
+			e.type = line_recording::op::finish_line;
+			recording->entries.push_back(e);
+		}
 		if(align == text_data::alignment::left) {
 			for(auto p : current_line)
 				p->position.x += int16_t(indent);
@@ -525,9 +538,50 @@ namespace ui {
 
 	void line_manager::increase_indent(int32_t n) {
 		indent += indent_size * n;
+		if(recording) {
+			line_recording::entry e;
+			e.type = line_recording::op::indent;
+			e.indent = int16_t(n);
+			recording->entries.push_back(e);
+		}
 	}
 	void line_manager::decrease_indent(int32_t n) {
-		indent -= indent_size * n;
+		increase_indent(-n);
+	}
+
+	bool line_recording::complete(gui_manager& m) {
+		size_t next = 0;
+		for(auto& e : entries) {
+			if(e.type != op::add_object)
+				continue;
+
+			const auto o = added[next++];
+			if((o->flags.load(std::memory_order_acquire) & gui_object::type_mask) != gui_object::type_text_instance)
+				return false;
+			e.text = m.text_instances.at(text_instance_tag(o->type_dependant_handle.load(std::memory_order_acquire)));
+		}
+		added.clear();
+		return true;
+	}
+
+	void line_recording::replay(gui_manager& m, tagged_gui_object container, line_manager& lm) const {
+		for(auto const& e : entries) {
+			if(e.type == op::add_object) {
+				const auto new_gobj = m.gui_objects.emplace();
+				const auto new_text_instance = ui::create_text_instance(m, new_gobj, text_format{ e.text.color, e.text.font_handle, uint32_t(e.text.size) * 2 });
+				new_text_instance.object = e.text;
+
+				new_gobj.object.size = e.size;
+				new_gobj.object.position = e.position;
+
+				add_to_back(m, container, new_gobj);
+				lm.add_object(&(new_gobj.object));
+			} else if(e.type == op::finish_line) {
+				lm.finish_current_line();
+			} else {
+				lm.increase_indent(e.indent);
+			}
+		}
 	}
 
 	bool draggable_region::on_drag(gui_object_tag t, world_state& ws, const mouse_drag &m) {
@@ -704,11 +758,11 @@ namespace {
 		auto main_texture_ptr = &(static_manager.textures.retrieve_by_key(main_texture)); //overlay
 		auto mask_texture_ptr = &(static_manager.textures.retrieve_by_key(mask_texture));
 
-		main_texture_ptr->load_filedata();
+		main_texture_ptr->load_filedata(static_manager.textures.cache_directory);
 		auto main_height = main_texture_ptr->get_height();
 		auto main_width = main_texture_ptr->get_width();
 
-		mask_texture_ptr->load_filedata();
+		mask_texture_ptr->load_filedata(static_manager.textures.cache_directory);
 		auto mask_height = mask_texture_ptr->get_height();
 		auto mask_width = mask_texture_ptr->get_width();
 
@@ -763,7 +817,7 @@ void ui::detail::instantiate_graphical_object(gui_static& static_manager, ui::gu
 			icon_graphic.object.t = &(static_manager.textures.retrieve_by_key(graphic_object_def.primary_texture_handle));
 
 			if(((int32_t)container.object.size.y | (int32_t)container.object.size.x) == 0) {
-				icon_graphic.object.t->load_filedata();
+				icon_graphic.object.t->load_filedata(static_manager.textures.cache_directory);
 				container.object.size.y = static_cast<int16_t>(icon_graphic.object.t->get_height());
 				container.object.size.x = static_cast<int16_t>(icon_graphic.object.t->get_width() / ((graphic_object_def.number_of_frames != 0) ? graphic_object_def.number_of_frames : 1));
 			}
@@ -789,7 +843,7 @@ void ui::detail::instantiate_graphical_object(gui_static& static_manager, ui::gu
 				icon_graphic.object.t = &(static_manager.textures.retrieve_by_key(graphic_object_def.primary_texture_handle));
 
 				if (((int32_t)container.object.size.y | (int32_t)container.object.size.x) == 0) {
-					icon_graphic.object.t->load_filedata();
+					icon_graphic.object.t->load_filedata(static_manager.textures.cache_directory);
 					container.object.size.y = static_cast<int16_t>(icon_graphic.object.t->get_height());
 					container.object.size.x = static_cast<int16_t>(icon_graphic.object.t->get_width() / ((graphic_object_def.number_of_frames != 0) ? graphic_object_def.number_of_frames : 1));
 				}
@@ -1679,7 +1733,7 @@ void ui::detail::update(tagged_gui_object obj, world_state& w) {
 	}
 
 	if (obj.object.associated_behavior)
-		obj.object.associated_behavior->update_data(obj.id, w);
+		w.w.gui_m.refresh_object(obj, w);
 
 	ui::for_each_child(w.w.gui_m, obj, [&w](ui::tagged_gui_object child) {
 		update(child, w);
@@ -1699,7 +1753,7 @@ void ui::detail::minimal_update(tagged_gui_object obj, world_state& w) {
 		}
 
 		if (obj.object.associated_behavior)
-			obj.object.associated_behavior->update_data(obj.id, w);
+			w.w.gui_m.refresh_object(obj, w);
 
 		ui::for_each_child(w.w.gui_m, obj, [&w](ui::tagged_gui_object child) {
 			update(child, w);
@@ -1711,6 +1765,20 @@ void ui::detail::minimal_update(tagged_gui_object obj, world_state& w) {
 	}
 }
 
+void ui::detail::update_subscribed(tagged_gui_object obj, world_state& w) {
+	if (obj.object.associated_behavior)
+		w.w.gui_m.refresh_object(obj, w);
+
+	// descendants with subscriptions of their own are only refreshed when those change
+	ui::for_each_child(w.w.gui_m, obj, [&w](ui::tagged_gui_object child) {
+		const auto child_flags = child.object.flags.load(std::memory_order_acquire);
+		if ((child_flags & ui::gui_object::visible_after_update) != 0)
+			update(child, w);
+		else if ((child_flags & (ui::gui_object::visible | ui::gui_object::subscribed)) == ui::gui_object::visible)
+			update_subscribed(child, w);
+	});
+}
+
 void ui::minimal_update(world_state& w) {
 	detail::minimal_update(tagged_gui_object{ w.w.gui_m.root, gui_object_tag(0) }, w);
 	detail::minimal_update(tagged_gui_object{ w.w.gui_m.background, gui_object_tag(1) }, w);
@@ -1719,6 +1787,9 @@ void ui::minimal_update(world_state& w) {
 
 void ui::update(world_state& w) {
 	w.w.gui_m.check_and_clear_minimal_update();
+	w.w.gui_m.check_and_clear_data_update();
+	w.w.gui_m.take_published_changes();
+
 	detail::update(tagged_gui_object{ w.w.gui_m.root, gui_object_tag(0) }, w);
 	detail::update(tagged_gui_object{ w.w.gui_m.background, gui_object_tag(1) }, w);
 	detail::update(tagged_gui_object{ w.w.gui_m.foreground, gui_object_tag(2) }, w);
@@ -1727,6 +1798,151 @@ void ui::update(world_state& w) {
 	w.w.gui_m.on_mouse_move(w, ui::mouse_move{ w.w.gui_m.last_mouse_move.x, w.w.gui_m.last_mouse_move.y, key_modifiers::modifiers_none });
 }
 
+void ui::update_changed(world_state& w) {
+	w.w.gui_m.take_published_changes();
+
+	// an earlier refresh may have destroyed or hidden a later object, so each is checked again just before it is refreshed
+	for (auto g : w.w.gui_m.collect_changed_subscribers()) {
+		if (w.w.gui_m.subscription_changed(g) && w.w.gui_m.is_shown(g))
+			detail::update_subscribed(tagged_gui_object{ w.w.gui_m.gui_objects.at(g), g }, w);
+	}
+	// data updates can arrive every frame, so objects made visible since the last pass are handled here as well
+	if (w.w.gui_m.check_and_clear_minimal_update())
+		minimal_update(w);
+
+	w.w.gui_m.tooltip = gui_object_tag();
+	w.w.gui_m.on_mouse_move(w, ui::mouse_move{ w.w.gui_m.last_mouse_move.x, w.w.gui_m.last_mouse_move.y, key_modifiers::modifiers_none });
+}
+
+void ui::subscribe(world_state& ws, data_key k) {
+	ws.w.gui_m.subscribe(k);
+}
+
+void ui::gui_manager::publish_change(data_key k) {
+	std::lock_guard<std::mutex> lock(published_guard);
+	published_changes.push_back(k);
+}
+
+void ui::gui_manager::publish_changes(std::vector<data_key> const& keys) {
+	std::lock_guard<std::mutex> lock(published_guard);
+	published_changes.insert(published_changes.end(), keys.begin(), keys.end());
+}
+
+void ui::gui_manager::publish_change_for_all(world_data kind, uint32_t count) {
+	std::lock_guard<std::mutex> lock(published_guard);
+	for(uint32_t i = 0; i < count; ++i)
+		published_changes.push_back(data_key{ kind, uint16_t(i) });
+}
+
+void ui::gui_manager::take_published_changes() {
+	changed_data.clear();
+	{
+		std::lock_guard<std::mutex> lock(published_guard);
+		changed_data.swap(published_changes);
+	}
+	std::sort(changed_data.begin(), changed_data.end());
+	changed_data.erase(std::unique(changed_data.begin(), changed_data.end()), changed_data.end());
+}
+
+namespace {
+	bool subscriber_less(std::pair<ui::data_key, ui::gui_object_tag> const& a, std::pair<ui::data_key, ui::gui_object_tag> const& b) {
+		return a.first != b.first ? a.first < b.first : to_index(a.second) < to_index(b.second);
+	}
+}
+
+std::vector<ui::gui_object_tag> const& ui::gui_manager::collect_changed_subscribers() {
+	changed_subscribers.clear();
+	for(auto k : changed_data) {
+		auto it = std::lower_bound(subscribers.begin(), subscribers.end(), std::pair<data_key, gui_object_tag>(k, gui_object_tag()),
+			[](std::pair<data_key, gui_object_tag> const& a, std::pair<data_key, gui_object_tag> const& b) { return a.first < b.first; });
+		for(; it != subscribers.end() && it->first == k; ++it)
+			changed_subscribers.push_back(it->second);
+	}
+	std::sort(changed_subscribers.begin(), changed_subscribers.end(), [](gui_object_tag a, gui_object_tag b) { return to_index(a) < to_index(b); });
+	changed_subscribers.erase(std::unique(changed_subscribers.begin(), changed_subscribers.end()), changed_subscribers.end());
+	return changed_subscribers;
+}
+
+void ui::gui_manager::subscribe(data_key k) {
+	if(!is_valid_index(updating_object))
+		return;
+
+	const auto index = size_t(to_index(updating_object));
+	if(subscriptions.size() <= index)
+		subscriptions.resize(index + 1);
+	subscriptions[index].push_back(k);
+	gui_objects.at(updating_object).flags.fetch_or(gui_object::subscribed, std::memory_order_acq_rel);
+}
+
+void ui::gui_manager::index_subscriptions(gui_object_tag g, std::vector<data_key> const& previous) {
+	auto const& current = subscriptions[size_t(to_index(g))];
+	if(current == previous)
+		return;
+
+	for(auto k : previous) {
+		auto it = std::lower_bound(subscribers.begin(), subscribers.end(), std::pair<data_key, gui_object_tag>(k, g), subscriber_less);
+		if(it != subscribers.end() && it->first == k && it->second == g)
+			subscribers.erase(it);
+	}
+	for(auto k : current) {
+		const std::pair<data_key, gui_object_tag> entry(k, g);
+		subscribers.insert(std::upper_bound(subscribers.begin(), subscribers.end(), entry, subscriber_less), entry);
+	}
+}
+
+void ui::gui_manager::clear_subscriptions(tagged_gui_object g) {
+	if((g.object.flags.load(std::memory_order_acquire) & gui_object::subscribed) != 0) {
+		g.object.flags.fetch_and((uint16_t)~gui_object::subscribed, std::memory_order_acq_rel);
+
+		std::vector<data_key> previous;
+		previous.swap(subscriptions[size_t(to_index(g.id))]);
+		index_subscriptions(g.id, previous);
+	}
+}
+
+bool ui::gui_manager::subscription_changed(gui_object_tag g) const {
+	const auto index = size_t(to_index(g));
+	if(subscriptions.size() <= index)
+		return false;
+	return std::any_of(subscriptions[index].begin(), subscriptions[index].end(), [this](data_key k) {
+		return std::binary_search(changed_data.begin(), changed_data.end(), k);
+	});
+}
+
+bool ui::gui_manager::is_shown(gui_object_tag g) const {
+	auto t = g;
+	while(true) {
+		auto const& obj = gui_objects.at(t);
+		if((obj.flags.load(std::memory_order_acquire) & gui_object::visible) == 0)
+			return false;
+		const gui_object_tag p = obj.parent;
+		if(!is_valid_index(p))
+			return to_index(t) < 3; // root, background or foreground
+		t = p;
+	}
+}
+
+void ui::gui_manager::refresh_object(tagged_gui_object g, world_state& ws) {
+	const auto index = size_t(to_index(g.id));
+	if(subscriptions.size() <= index)
+		subscriptions.resize(index + 1);
+
+	std::vector<data_key> previous;
+	previous.swap(subscriptions[index]);
+	g.object.flags.fetch_and((uint16_t)~gui_object::subscribed, std::memory_order_acq_rel);
+
+	const auto previous_object = updating_object;
+	updating_object = g.id;
+	g.object.associated_behavior->update_data(g.id, ws);
+	updating_object = previous_object;
+
+	auto& current = subscriptions[index];
+	std::sort(current.begin(), current.end());
+	current.erase(std::unique(current.begin(), current.end()), current.end());
+
+	index_subscriptions(g.id, previous);
+}
+
 ui::gui_manager::gui_manager() : gui_manager(1080, 640) {}
 
 ui::gui_manager::gui_manager(int32_t width, int32_t height) :
@@ -1771,9 +1987,11 @@ void ui::render(gui_static& static_manager, const gui_manager& manager, graphics
 	auto const ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::time_point_cast<std::chrono::milliseconds>(time).time_since_epoch());
 	cursor_graphic.frame = std::clamp(int32_t((sin(float(ms.count() % 1000) * 3.14159f * 2.0f / 1000.0f) + 1.0f) * 24.0f),0,47);
 	
+	ogl.begin_batch();
 	detail::render(static_manager, manager, ogl, manager.background, ui::xy_pair{ 0, 0 }, manager.background.size, graphics::color_modification::none);
 	detail::render(static_manager, manager, ogl, manager.root, ui::xy_pair{ 0, 0 }, manager.root.size, graphics::color_modification::none);
 	detail::render(static_manager, manager, ogl, manager.foreground, ui::xy_pair{ 0, 0 }, manager.foreground.size, graphics::color_modification::none);
+	ogl.end_batch();
 }
 
 graphics::rotation ui::gui_object::get_rotation() const {
@@ -1,6 +1,7 @@
 #pragma once
 #include "common\\common.h"
 #include <atomic>
+#include <mutex>
 #include "concurrency_tools\\concurrency_tools.h"
 #include "gui_definitions\\gui_definitions.h"
 #include "graphics\\texture.h"
@@ -677,6 +678,7 @@ namespace ui {
 		window_tag element_def_tag;
 
 		void set_element_definition(gui_static& manager);
+		void repopulate_after_move(gui_manager& m);
 	public:
 		discrete_listbox(discrete_listbox&& o) noexcept : 
 			visible_region(std::move(o)),
@@ -700,6 +702,7 @@ namespace ui {
 		void update_list(iterator first, iterator last);
 		void goto_element(value_type const& v, ui::gui_manager& m);
 		uint32_t get_position() const;
+		uint32_t get_visible_count() const;
 		void set_position(uint32_t p, ui::gui_manager& m);
 	};
 
@@ -803,8 +806,33 @@ namespace ui {
 	alignment alignment_from_definition(const scrollbar_def&);
 	alignment alignment_from_definition(const window_def&);
 
+	// world state data that gui objects can subscribe to while they are updated (see ui::subscribe);
+	// the update thread publishes which keys changed during a tick with gui_manager::publish_change
+	enum class world_data : uint8_t {
+		date, // the current date itself; only views that display it should subscribe
+		nation_rank, // index = the nation whose industrial, military, prestige or overall rank changed
+		province_pops, // index = the province whose pops changed in size, type, culture, religion, attitudes or opinions
+		nation_economy, // index = the nation whose treasury, debt, markets, production, construction or pop incomes were updated
+		nation_research, // index = the nation whose research points, technologies or inventions were updated
+		nation_demographics, // index = the nation whose population totals, movements, upper house or ruling party were updated
+		nation_scores, // index = the nation whose military or industrial score or administrative efficiency changed
+		nation_relations, // index = the nation whose influence, sphere or cb construction changed
+		province_crime, // index = the province whose crime changed
+		message_log, // a line was added to the message log
+	};
+
+	struct data_key {
+		world_data kind = world_data::date;
+		uint16_t index = 0;
+
+		bool operator==(data_key o) const { return kind == o.kind && index == o.index; }
+		bool operator!=(data_key o) const { return !(*this == o); }
+		bool operator<(data_key o) const { return kind != o.kind ? kind < o.kind : index < o.index; }
+	};
+
 	class gui_object {
 	public:
+		static constexpr uint16_t subscribed = 0x0080; // refreshed by update_changed, with its unsubscribed descendants, only when subscribed data changed
 		static constexpr uint16_t dynamic_behavior = 0x0100;
 		static constexpr uint16_t visible = 0x0200;
 		static constexpr uint16_t enabled = 0x0400;
@@ -884,6 +912,7 @@ namespace ui {
 
 		void update(tagged_gui_object obj, world_state&);
 		void minimal_update(tagged_gui_object obj, world_state&);
+		void update_subscribed(tagged_gui_object obj, world_state&);
 
 		template<typename MESSAGE_FUNCTION, typename MESSAGE_TYPE>
 		bool dispatch_message(const gui_manager& manager, const MESSAGE_FUNCTION &member_f, tagged_gui_object obj, ui::xy_pair container_size, const MESSAGE_TYPE& message);
@@ -969,6 +998,29 @@ namespace ui {
 	ui::text_color text_color_to_ui_text_color(text_data::text_color c);
 
 
+	// The text objects given to a line manager and the line breaks and indentation applied to it while the recording
+	// was attached, from which the same lines can be placed again without generating their text again
+	class line_recording {
+	public:
+		enum class op : uint8_t { add_object, finish_line, indent };
+		struct entry {
+			op type = op::add_object;
+			int16_t indent = 0; // the change of indentation in steps, for indent
+			xy_pair position; // the position and size of the object when it was added, for add_object
+			xy_pair size;
+			text_instance text;
+		};
+
+		std::vector<entry> entries;
+		std::vector<gui_object*> added; // one per add_object entry, until complete is called
+
+		// copies the text of the added objects into the entries; false if any of them was not a text instance
+		bool complete(gui_manager& m);
+		// creates the recorded objects in container again, passing them through lm as they were when recorded
+		void replay(gui_manager& m, tagged_gui_object container, line_manager& lm) const;
+		void clear() { entries.clear(); added.clear(); }
+	};
+
 	class line_manager {
 	private:
 		constexpr static int32_t indent_size = 15;
@@ -981,6 +1033,7 @@ namespace ui {
 		int32_t indent = 0;
 
 		bool no_auto_newline = false;
+		line_recording* recording = nullptr;
 	public:
 		struct textbox {};
 
@@ -999,6 +1052,11 @@ namespace ui {
 		void increase_indent(int32_t n);
 		void decrease_indent(int32_t n);
 
+		void start_recording(line_recording& r) { recording = &r; }
+		void stop_recording() { recording = nullptr; }
+		bool is_recording() const { return recording != nullptr; }
+		bool wraps_lines() const { return !no_auto_newline; }
+
 		~line_manager() { finish_current_line(); }
 	};
 
@@ -1195,6 +1253,8 @@ namespace ui {
 	void render(gui_static& static_manager, const gui_manager& manager, graphics::open_gl_wrapper&);
 	void update(world_state&);
 	void minimal_update(world_state&);
+	void update_changed(world_state&); // refreshes the visible objects subscribed to published changes
+	void subscribe(world_state& ws, data_key k); // called from update_data: refresh only when k is published as changed
 
 	template<typename T>
 	void for_each_child(gui_manager& manager, tagged_gui_object parent, const T& f);
@@ -1217,6 +1277,17 @@ namespace ui {
 		int32_t _height;
 		std::atomic<bool> pending_update = false;
 		std::atomic<bool> pending_minimal_update = false;
+		std::atomic<bool> pending_data_update = false;
+
+		std::mutex published_guard;
+		std::vector<data_key> published_changes; // written by the update thread, guarded by published_guard
+		std::vector<data_key> changed_data; // the changes being handled by update_changed, sorted
+		std::vector<std::vector<data_key>> subscriptions; // by gui_object_tag, sorted; empty unless the object is subscribed
+		std::vector<std::pair<data_key, gui_object_tag>> subscribers; // every subscription, sorted by key
+		std::vector<gui_object_tag> changed_subscribers; // the objects update_changed refreshes
+		gui_object_tag updating_object;
+
+		void index_subscriptions(gui_object_tag g, std::vector<data_key> const& previous);
 	public:
 		fixed_sz_deque<gui_object, 2048, 16, gui_object_tag> gui_objects;
 		fixed_sz_deque<text_instance, 2048, 16, text_instance_tag> text_instances;
@@ -1262,6 +1333,24 @@ namespace ui {
 		void flag_minimal_update();
 		bool check_and_clear_minimal_update() { bool expected = true; return pending_minimal_update.compare_exchange_strong(expected, false, std::memory_order_release, std::memory_order_acquire); }
 
+		// data driven refresh: publish_change may be called from any thread, and flag_data_update requests
+		// an update_changed pass that refreshes the objects subscribed to the published keys. An object that
+		// subscribes to nothing is refreshed with its nearest subscribed ancestor, or only by full updates if
+		// it has none
+		void publish_change(data_key k);
+		void publish_changes(std::vector<data_key> const& keys);
+		void publish_change_for_all(world_data kind, uint32_t count); // kind changed for every index below count
+		void flag_data_update() { pending_data_update.store(true, std::memory_order_release); }
+		bool check_and_clear_data_update() { bool expected = true; return pending_data_update.compare_exchange_strong(expected, false, std::memory_order_release, std::memory_order_acquire); }
+
+		void subscribe(data_key k); // for the object whose update_data is running
+		void clear_subscriptions(tagged_gui_object g);
+		bool subscription_changed(gui_object_tag g) const;
+		bool is_shown(gui_object_tag g) const; // it and all of its ancestors are visible
+		void take_published_changes();
+		std::vector<gui_object_tag> const& collect_changed_subscribers(); // after take_published_changes
+		void refresh_object(tagged_gui_object g, world_state& ws); // calls update_data, recording the object's subscriptions
+
 		void destroy(tagged_gui_object g);
 		~gui_manager();
 	};
@@ -451,7 +451,7 @@ void ui::discrete_listbox<BASE, ELEMENT, value_type, left_expand>::goto_element(
 		} else {
 			ui::hide(*(display_list[i].associated_object));
 		}
-	}
+	}	repopulate_after_move(m);
 }
 
 template<typename BASE, typename ELEMENT, typename value_type, int32_t left_expand>
@@ -459,6 +459,11 @@ uint32_t ui::discrete_listbox<BASE, ELEMENT, value_type, left_expand>::get_posit
 	return offset;
 }
 
+template<typename BASE, typename ELEMENT, typename value_type, int32_t left_expand>
+uint32_t ui::discrete_listbox<BASE, ELEMENT, value_type, left_expand>::get_visible_count() const {
+	return uint32_t(display_list.size());
+}
+
 template<typename BASE, typename ELEMENT, typename value_type, int32_t left_expand>
 void ui::discrete_listbox<BASE, ELEMENT, value_type, left_expand>::set_position(uint32_t p, ui::gui_manager& m) {
 	const int32_t num_displayed = associated_object->size.y / element_def->size.y;
@@ -477,6 +482,14 @@ void ui::discrete_listbox<BASE, ELEMENT, value_type, left_expand>::set_position(
 	}
 }
 
+template<typename BASE, typename ELEMENT, typename value_type, int32_t left_expand>
+void ui::discrete_listbox<BASE, ELEMENT, value_type, left_expand>::repopulate_after_move(ui::gui_manager& m) {
+	// a list that builds its own values may only have put the rows up to the old position in order (see population_lb),
+	// so it is built again for the new one, as it is when the scrollbar moves
+	if constexpr(ui::detail::has_populate_list<BASE, discrete_listbox<BASE, ELEMENT, value_type, left_expand>&, world_state&>)
+		ui::make_visible_and_update(m, *associated_object);
+}
+
 template<typename B, typename ELEMENT, int32_t left_expand>
 ui::tagged_gui_object ui::create_static_element(world_state& ws, listbox_tag handle, tagged_gui_object parent, ui::display_listbox<B, ELEMENT, left_expand>& b) {
 	const ui::listbox_def& definition = ws.s.gui_m.ui_definitions.listboxes[handle];
@@ -2,6 +2,7 @@
 #include "common\\shared_tags.h"
 #include "concurrency_tools\\ve.h"
 #include "simple_serialize\\simple_serialize.hpp"
+#include "concurrency_tools\\access_profiling.h"
 
 #pragma warning( push )
 #pragma warning( disable : 4324 )
@@ -95,6 +96,9 @@ namespace army {
 			 date_tag values[(sizeof(date_tag) <= 64 ? (uint32_t(army::container_size) + (64ui32 / uint32_t(sizeof(date_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(date_tag)) - 1ui32) : uint32_t(army::container_size))]; 
 			 dtype_11() { std::uninitialized_value_construct_n(values - 1, (sizeof(date_tag) <= 64 ? (uint32_t(army::container_size) + (64ui32 / uint32_t(sizeof(date_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(date_tag)) - 1ui32) : uint32_t(army::container_size)) + 1); }
 		 } m_11;
+#ifdef CONTAINER_ACCESS_PROFILING
+		 inline static access_profiling::container_profile profile{ "army", { "leader", "hq", "order", "location", "owner", "current_soldiers", "target_soldiers", "readiness", "supply", "priority", "composition", "arrival_time" }, { "military::leader_tag", "military::strategic_hq_tag", "military::army_orders_tag", "provinces::province_tag", "nations::country_tag", "float", "float", "float", "float", "int8_t", "military::army_composition_tag", "date_tag" }, { sizeof(military::leader_tag), sizeof(military::strategic_hq_tag), sizeof(military::army_orders_tag), sizeof(provinces::province_tag), sizeof(nations::country_tag), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(int8_t), sizeof(military::army_composition_tag), sizeof(date_tag) } };
+#endif
 
 		 public:
 		 friend class serialization::serializer<container>;
@@ -107,290 +111,362 @@ namespace army {
 
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::leader>, military::leader_tag&> get(military::army_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(military::leader_tag));
 			 return m_0.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::leader>, military::leader_tag const&> get(military::army_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(military::leader_tag));
 			 return m_0.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::leader>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(military::leader_tag));
 			 m_0.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::leader>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(military::leader_tag));
 			 m_0.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::leader>, tagged_array_view<military::leader_tag, military::army_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint64_t(size_used) * sizeof(military::leader_tag));
 			 return tagged_array_view<military::leader_tag, military::army_tag>(m_0.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::leader>, tagged_array_view<military::leader_tag const, military::army_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint64_t(size_used) * sizeof(military::leader_tag));
 			 return tagged_array_view<military::leader_tag const, military::army_tag>(m_0.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::hq>, military::strategic_hq_tag&> get(military::army_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(military::strategic_hq_tag));
 			 return m_1.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::hq>, military::strategic_hq_tag const&> get(military::army_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(military::strategic_hq_tag));
 			 return m_1.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::hq>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(military::strategic_hq_tag));
 			 m_1.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::hq>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(military::strategic_hq_tag));
 			 m_1.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::hq>, tagged_array_view<military::strategic_hq_tag, military::army_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint64_t(size_used) * sizeof(military::strategic_hq_tag));
 			 return tagged_array_view<military::strategic_hq_tag, military::army_tag>(m_1.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::hq>, tagged_array_view<military::strategic_hq_tag const, military::army_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint64_t(size_used) * sizeof(military::strategic_hq_tag));
 			 return tagged_array_view<military::strategic_hq_tag const, military::army_tag>(m_1.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::order>, military::army_orders_tag&> get(military::army_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(military::army_orders_tag));
 			 return m_2.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::order>, military::army_orders_tag const&> get(military::army_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(military::army_orders_tag));
 			 return m_2.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::order>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(military::army_orders_tag));
 			 m_2.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::order>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(military::army_orders_tag));
 			 m_2.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::order>, tagged_array_view<military::army_orders_tag, military::army_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint64_t(size_used) * sizeof(military::army_orders_tag));
 			 return tagged_array_view<military::army_orders_tag, military::army_tag>(m_2.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::order>, tagged_array_view<military::army_orders_tag const, military::army_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint64_t(size_used) * sizeof(military::army_orders_tag));
 			 return tagged_array_view<military::army_orders_tag const, military::army_tag>(m_2.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::location>, provinces::province_tag&> get(military::army_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(provinces::province_tag));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::location>, provinces::province_tag const&> get(military::army_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(provinces::province_tag));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::location>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(provinces::province_tag));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::location>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(provinces::province_tag));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::location>, tagged_array_view<provinces::province_tag, military::army_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(provinces::province_tag));
 			 return tagged_array_view<provinces::province_tag, military::army_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::location>, tagged_array_view<provinces::province_tag const, military::army_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(provinces::province_tag));
 			 return tagged_array_view<provinces::province_tag const, military::army_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::owner>, nations::country_tag&> get(military::army_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(nations::country_tag));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::owner>, nations::country_tag const&> get(military::army_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(nations::country_tag));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::owner>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(nations::country_tag));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::owner>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(nations::country_tag));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::owner>, tagged_array_view<nations::country_tag, military::army_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag, military::army_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::owner>, tagged_array_view<nations::country_tag const, military::army_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag const, military::army_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::current_soldiers>, float&> get(military::army_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(float));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::current_soldiers>, float const&> get(military::army_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(float));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::current_soldiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(float));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::current_soldiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(float));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::current_soldiers>, tagged_array_view<float, military::army_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::army_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::current_soldiers>, tagged_array_view<float const, military::army_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::army_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::target_soldiers>, float&> get(military::army_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get, sizeof(float));
 			 return m_6.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::target_soldiers>, float const&> get(military::army_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get, sizeof(float));
 			 return m_6.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::target_soldiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 6, set, sizeof(float));
 			 m_6.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::target_soldiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 6, set, sizeof(float));
 			 m_6.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::target_soldiers>, tagged_array_view<float, military::army_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::army_tag>(m_6.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::target_soldiers>, tagged_array_view<float const, military::army_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::army_tag>(m_6.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::readiness>, float&> get(military::army_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get, sizeof(float));
 			 return m_7.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::readiness>, float const&> get(military::army_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get, sizeof(float));
 			 return m_7.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::readiness>> {
+			 CONTAINER_ACCESS_RECORD(profile, 7, set, sizeof(float));
 			 m_7.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::readiness>> {
+			 CONTAINER_ACCESS_RECORD(profile, 7, set, sizeof(float));
 			 m_7.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::readiness>, tagged_array_view<float, military::army_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::army_tag>(m_7.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::readiness>, tagged_array_view<float const, military::army_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::army_tag>(m_7.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::supply>, float&> get(military::army_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get, sizeof(float));
 			 return m_8.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::supply>, float const&> get(military::army_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get, sizeof(float));
 			 return m_8.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::supply>> {
+			 CONTAINER_ACCESS_RECORD(profile, 8, set, sizeof(float));
 			 m_8.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::supply>> {
+			 CONTAINER_ACCESS_RECORD(profile, 8, set, sizeof(float));
 			 m_8.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::supply>, tagged_array_view<float, military::army_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::army_tag>(m_8.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::supply>, tagged_array_view<float const, military::army_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::army_tag>(m_8.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::priority>, int8_t&> get(military::army_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get, sizeof(int8_t));
 			 return m_9.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::priority>, int8_t const&> get(military::army_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get, sizeof(int8_t));
 			 return m_9.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::priority>> {
+			 CONTAINER_ACCESS_RECORD(profile, 9, set, sizeof(int8_t));
 			 m_9.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::priority>> {
+			 CONTAINER_ACCESS_RECORD(profile, 9, set, sizeof(int8_t));
 			 m_9.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::priority>, tagged_array_view<int8_t, military::army_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get_row, uint64_t(size_used) * sizeof(int8_t));
 			 return tagged_array_view<int8_t, military::army_tag>(m_9.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::priority>, tagged_array_view<int8_t const, military::army_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get_row, uint64_t(size_used) * sizeof(int8_t));
 			 return tagged_array_view<int8_t const, military::army_tag>(m_9.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::composition>, military::army_composition_tag&> get(military::army_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get, sizeof(military::army_composition_tag));
 			 return m_10.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::composition>, military::army_composition_tag const&> get(military::army_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get, sizeof(military::army_composition_tag));
 			 return m_10.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::composition>> {
+			 CONTAINER_ACCESS_RECORD(profile, 10, set, sizeof(military::army_composition_tag));
 			 m_10.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::composition>> {
+			 CONTAINER_ACCESS_RECORD(profile, 10, set, sizeof(military::army_composition_tag));
 			 m_10.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::composition>, tagged_array_view<military::army_composition_tag, military::army_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get_row, uint64_t(size_used) * sizeof(military::army_composition_tag));
 			 return tagged_array_view<military::army_composition_tag, military::army_tag>(m_10.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::composition>, tagged_array_view<military::army_composition_tag const, military::army_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get_row, uint64_t(size_used) * sizeof(military::army_composition_tag));
 			 return tagged_array_view<military::army_composition_tag const, military::army_tag>(m_10.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::arrival_time>, date_tag&> get(military::army_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get, sizeof(date_tag));
 			 return m_11.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::arrival_time>, date_tag const&> get(military::army_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get, sizeof(date_tag));
 			 return m_11.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::arrival_time>> {
+			 CONTAINER_ACCESS_RECORD(profile, 11, set, sizeof(date_tag));
 			 m_11.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army::arrival_time>> {
+			 CONTAINER_ACCESS_RECORD(profile, 11, set, sizeof(date_tag));
 			 m_11.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::arrival_time>, tagged_array_view<date_tag, military::army_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag, military::army_tag>(m_11.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army::arrival_time>, tagged_array_view<date_tag const, military::army_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag const, military::army_tag>(m_11.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 
@@ -2,6 +2,7 @@
 #include "common\\shared_tags.h"
 #include "concurrency_tools\\ve.h"
 #include "simple_serialize\\simple_serialize.hpp"
+#include "concurrency_tools\\access_profiling.h"
 
 #pragma warning( push )
 #pragma warning( disable : 4324 )
@@ -53,6 +54,9 @@ namespace army_order {
 			 military::leader_tag values[(sizeof(military::leader_tag) <= 64 ? (uint32_t(army_order::container_size) + (64ui32 / uint32_t(sizeof(military::leader_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(military::leader_tag)) - 1ui32) : uint32_t(army_order::container_size))]; 
 			 dtype_4() { std::uninitialized_value_construct_n(values - 1, (sizeof(military::leader_tag) <= 64 ? (uint32_t(army_order::container_size) + (64ui32 / uint32_t(sizeof(military::leader_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(military::leader_tag)) - 1ui32) : uint32_t(army_order::container_size)) + 1); }
 		 } m_4;
+#ifdef CONTAINER_ACCESS_PROFILING
+		 inline static access_profiling::container_profile profile{ "army_order", { "type", "province_set", "army_set", "target", "leader" }, { "military::army_orders_type", "set_tag<provinces::province_tag>", "set_tag<military::army_tag>", "provinces::province_tag", "military::leader_tag" }, { sizeof(military::army_orders_type), sizeof(set_tag<provinces::province_tag>), sizeof(set_tag<military::army_tag>), sizeof(provinces::province_tag), sizeof(military::leader_tag) } };
+#endif
 
 		 public:
 		 friend class serialization::serializer<container>;
@@ -65,122 +69,152 @@ namespace army_order {
 
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::type>, military::army_orders_type&> get(military::army_orders_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(military::army_orders_type));
 			 return m_0.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::type>, military::army_orders_type const&> get(military::army_orders_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(military::army_orders_type));
 			 return m_0.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_orders_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army_order::type>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(military::army_orders_type));
 			 m_0.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_orders_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army_order::type>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(military::army_orders_type));
 			 m_0.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::type>, tagged_array_view<military::army_orders_type, military::army_orders_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint64_t(size_used) * sizeof(military::army_orders_type));
 			 return tagged_array_view<military::army_orders_type, military::army_orders_tag>(m_0.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::type>, tagged_array_view<military::army_orders_type const, military::army_orders_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint64_t(size_used) * sizeof(military::army_orders_type));
 			 return tagged_array_view<military::army_orders_type const, military::army_orders_tag>(m_0.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::province_set>, set_tag<provinces::province_tag>&> get(military::army_orders_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(set_tag<provinces::province_tag>));
 			 return m_1.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::province_set>, set_tag<provinces::province_tag> const&> get(military::army_orders_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(set_tag<provinces::province_tag>));
 			 return m_1.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_orders_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army_order::province_set>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(set_tag<provinces::province_tag>));
 			 m_1.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_orders_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army_order::province_set>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(set_tag<provinces::province_tag>));
 			 m_1.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::province_set>, tagged_array_view<set_tag<provinces::province_tag>, military::army_orders_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint64_t(size_used) * sizeof(set_tag<provinces::province_tag>));
 			 return tagged_array_view<set_tag<provinces::province_tag>, military::army_orders_tag>(m_1.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::province_set>, tagged_array_view<set_tag<provinces::province_tag> const, military::army_orders_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint64_t(size_used) * sizeof(set_tag<provinces::province_tag>));
 			 return tagged_array_view<set_tag<provinces::province_tag> const, military::army_orders_tag>(m_1.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::army_set>, set_tag<military::army_tag>&> get(military::army_orders_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(set_tag<military::army_tag>));
 			 return m_2.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::army_set>, set_tag<military::army_tag> const&> get(military::army_orders_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(set_tag<military::army_tag>));
 			 return m_2.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_orders_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army_order::army_set>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(set_tag<military::army_tag>));
 			 m_2.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_orders_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army_order::army_set>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(set_tag<military::army_tag>));
 			 m_2.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::army_set>, tagged_array_view<set_tag<military::army_tag>, military::army_orders_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint64_t(size_used) * sizeof(set_tag<military::army_tag>));
 			 return tagged_array_view<set_tag<military::army_tag>, military::army_orders_tag>(m_2.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::army_set>, tagged_array_view<set_tag<military::army_tag> const, military::army_orders_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint64_t(size_used) * sizeof(set_tag<military::army_tag>));
 			 return tagged_array_view<set_tag<military::army_tag> const, military::army_orders_tag>(m_2.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::target>, provinces::province_tag&> get(military::army_orders_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(provinces::province_tag));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::target>, provinces::province_tag const&> get(military::army_orders_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(provinces::province_tag));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_orders_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army_order::target>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(provinces::province_tag));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_orders_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army_order::target>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(provinces::province_tag));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::target>, tagged_array_view<provinces::province_tag, military::army_orders_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(provinces::province_tag));
 			 return tagged_array_view<provinces::province_tag, military::army_orders_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::target>, tagged_array_view<provinces::province_tag const, military::army_orders_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(provinces::province_tag));
 			 return tagged_array_view<provinces::province_tag const, military::army_orders_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::leader>, military::leader_tag&> get(military::army_orders_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(military::leader_tag));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::leader>, military::leader_tag const&> get(military::army_orders_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(military::leader_tag));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_orders_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army_order::leader>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(military::leader_tag));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::army_orders_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, army_order::leader>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(military::leader_tag));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::leader>, tagged_array_view<military::leader_tag, military::army_orders_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(military::leader_tag));
 			 return tagged_array_view<military::leader_tag, military::army_orders_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, army_order::leader>, tagged_array_view<military::leader_tag const, military::army_orders_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(military::leader_tag));
 			 return tagged_array_view<military::leader_tag const, military::army_orders_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 
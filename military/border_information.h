@@ -2,6 +2,7 @@
 #include "common\\shared_tags.h"
 #include "concurrency_tools\\ve.h"
 #include "simple_serialize\\simple_serialize.hpp"
+#include "concurrency_tools\\access_profiling.h"
 
 #pragma warning( push )
 #pragma warning( disable : 4324 )
@@ -61,6 +62,9 @@ constexpr int32_t max_count = province::container_size;
 			 nations::country_tag values[(sizeof(nations::country_tag) <= 64 ? (uint32_t(province::container_size) + (64ui32 / uint32_t(sizeof(nations::country_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(nations::country_tag)) - 1ui32) : uint32_t(province::container_size))]; 
 			 dtype_5() { std::uninitialized_value_construct_n(values - 1, (sizeof(nations::country_tag) <= 64 ? (uint32_t(province::container_size) + (64ui32 / uint32_t(sizeof(nations::country_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(nations::country_tag)) - 1ui32) : uint32_t(province::container_size)) + 1); }
 		 } m_5;
+#ifdef CONTAINER_ACCESS_PROFILING
+		 inline static access_profiling::container_profile profile{ "border_information", { "readiness", "supply", "hqs", "stance", "owner", "against" }, { "float", "float", "array_tag<military::hq_commitment_information, int32_t, false>", "int8_t", "nations::country_tag", "nations::country_tag" }, { sizeof(float), sizeof(float), sizeof(array_tag<military::hq_commitment_information, int32_t, false>), sizeof(int8_t), sizeof(nations::country_tag), sizeof(nations::country_tag) } };
+#endif
 
 		 public:
 		 friend class serialization::serializer<container>;
@@ -73,146 +77,182 @@ constexpr int32_t max_count = province::container_size;
 
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::readiness>, float&> get(military::border_information_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(float));
 			 return m_0.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::readiness>, float const&> get(military::border_information_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(float));
 			 return m_0.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::border_information_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, border_information::readiness>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(float));
 			 m_0.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::border_information_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, border_information::readiness>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(float));
 			 m_0.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::readiness>, tagged_array_view<float, military::border_information_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::border_information_tag>(m_0.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::readiness>, tagged_array_view<float const, military::border_information_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::border_information_tag>(m_0.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::supply>, float&> get(military::border_information_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(float));
 			 return m_1.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::supply>, float const&> get(military::border_information_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(float));
 			 return m_1.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::border_information_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, border_information::supply>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(float));
 			 m_1.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::border_information_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, border_information::supply>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(float));
 			 m_1.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::supply>, tagged_array_view<float, military::border_information_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::border_information_tag>(m_1.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::supply>, tagged_array_view<float const, military::border_information_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::border_information_tag>(m_1.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::hqs>, array_tag<military::hq_commitment_information, int32_t, false>&> get(military::border_information_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(array_tag<military::hq_commitment_information, int32_t, false>));
 			 return m_2.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::hqs>, array_tag<military::hq_commitment_information, int32_t, false> const&> get(military::border_information_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(array_tag<military::hq_commitment_information, int32_t, false>));
 			 return m_2.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::border_information_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, border_information::hqs>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(array_tag<military::hq_commitment_information, int32_t, false>));
 			 m_2.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::border_information_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, border_information::hqs>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(array_tag<military::hq_commitment_information, int32_t, false>));
 			 m_2.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::hqs>, tagged_array_view<array_tag<military::hq_commitment_information, int32_t, false>, military::border_information_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint64_t(size_used) * sizeof(array_tag<military::hq_commitment_information, int32_t, false>));
 			 return tagged_array_view<array_tag<military::hq_commitment_information, int32_t, false>, military::border_information_tag>(m_2.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::hqs>, tagged_array_view<array_tag<military::hq_commitment_information, int32_t, false> const, military::border_information_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint64_t(size_used) * sizeof(array_tag<military::hq_commitment_information, int32_t, false>));
 			 return tagged_array_view<array_tag<military::hq_commitment_information, int32_t, false> const, military::border_information_tag>(m_2.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::stance>, int8_t&> get(military::border_information_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(int8_t));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::stance>, int8_t const&> get(military::border_information_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(int8_t));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::border_information_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, border_information::stance>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(int8_t));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::border_information_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, border_information::stance>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(int8_t));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::stance>, tagged_array_view<int8_t, military::border_information_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(int8_t));
 			 return tagged_array_view<int8_t, military::border_information_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::stance>, tagged_array_view<int8_t const, military::border_information_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(int8_t));
 			 return tagged_array_view<int8_t const, military::border_information_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::owner>, nations::country_tag&> get(military::border_information_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(nations::country_tag));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::owner>, nations::country_tag const&> get(military::border_information_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(nations::country_tag));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::border_information_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, border_information::owner>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(nations::country_tag));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::border_information_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, border_information::owner>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(nations::country_tag));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::owner>, tagged_array_view<nations::country_tag, military::border_information_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag, military::border_information_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::owner>, tagged_array_view<nations::country_tag const, military::border_information_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag const, military::border_information_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::against>, nations::country_tag&> get(military::border_information_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(nations::country_tag));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::against>, nations::country_tag const&> get(military::border_information_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(nations::country_tag));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::border_information_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, border_information::against>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(nations::country_tag));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::border_information_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, border_information::against>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(nations::country_tag));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::against>, tagged_array_view<nations::country_tag, military::border_information_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag, military::border_information_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, border_information::against>, tagged_array_view<nations::country_tag const, military::border_information_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag const, military::border_information_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 
@@ -2,6 +2,7 @@
 #include "common\\shared_tags.h"
 #include "concurrency_tools\\ve.h"
 #include "simple_serialize\\simple_serialize.hpp"
+#include "concurrency_tools\\access_profiling.h"
 
 #pragma warning( push )
 #pragma warning( disable : 4324 )
@@ -59,6 +60,9 @@ namespace fleet {
 			 date_tag values[(sizeof(date_tag) <= 64 ? (uint32_t(fleet::container_size) + (64ui32 / uint32_t(sizeof(date_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(date_tag)) - 1ui32) : uint32_t(fleet::container_size))]; 
 			 dtype_5() { std::uninitialized_value_construct_n(values - 1, (sizeof(date_tag) <= 64 ? (uint32_t(fleet::container_size) + (64ui32 / uint32_t(sizeof(date_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(date_tag)) - 1ui32) : uint32_t(fleet::container_size)) + 1); }
 		 } m_5;
+#ifdef CONTAINER_ACCESS_PROFILING
+		 inline static access_profiling::container_profile profile{ "fleet", { "leader", "location", "supply", "readiness", "size", "arrival_time" }, { "military::leader_tag", "provinces::province_tag", "float", "float", "float", "date_tag" }, { sizeof(military::leader_tag), sizeof(provinces::province_tag), sizeof(float), sizeof(float), sizeof(float), sizeof(date_tag) } };
+#endif
 
 		 public:
 		 friend class serialization::serializer<container>;
@@ -71,146 +75,182 @@ namespace fleet {
 
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::leader>, military::leader_tag&> get(military::fleet_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(military::leader_tag));
 			 return m_0.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::leader>, military::leader_tag const&> get(military::fleet_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(military::leader_tag));
 			 return m_0.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::fleet_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, fleet::leader>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(military::leader_tag));
 			 m_0.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::fleet_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, fleet::leader>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(military::leader_tag));
 			 m_0.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::leader>, tagged_array_view<military::leader_tag, military::fleet_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint64_t(size_used) * sizeof(military::leader_tag));
 			 return tagged_array_view<military::leader_tag, military::fleet_tag>(m_0.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::leader>, tagged_array_view<military::leader_tag const, military::fleet_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint64_t(size_used) * sizeof(military::leader_tag));
 			 return tagged_array_view<military::leader_tag const, military::fleet_tag>(m_0.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::location>, provinces::province_tag&> get(military::fleet_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(provinces::province_tag));
 			 return m_1.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::location>, provinces::province_tag const&> get(military::fleet_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(provinces::province_tag));
 			 return m_1.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::fleet_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, fleet::location>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(provinces::province_tag));
 			 m_1.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::fleet_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, fleet::location>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(provinces::province_tag));
 			 m_1.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::location>, tagged_array_view<provinces::province_tag, military::fleet_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint64_t(size_used) * sizeof(provinces::province_tag));
 			 return tagged_array_view<provinces::province_tag, military::fleet_tag>(m_1.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::location>, tagged_array_view<provinces::province_tag const, military::fleet_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint64_t(size_used) * sizeof(provinces::province_tag));
 			 return tagged_array_view<provinces::province_tag const, military::fleet_tag>(m_1.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::supply>, float&> get(military::fleet_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(float));
 			 return m_2.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::supply>, float const&> get(military::fleet_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(float));
 			 return m_2.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::fleet_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, fleet::supply>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(float));
 			 m_2.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::fleet_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, fleet::supply>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(float));
 			 m_2.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::supply>, tagged_array_view<float, military::fleet_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::fleet_tag>(m_2.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::supply>, tagged_array_view<float const, military::fleet_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::fleet_tag>(m_2.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::readiness>, float&> get(military::fleet_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(float));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::readiness>, float const&> get(military::fleet_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(float));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::fleet_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, fleet::readiness>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(float));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::fleet_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, fleet::readiness>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(float));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::readiness>, tagged_array_view<float, military::fleet_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::fleet_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::readiness>, tagged_array_view<float const, military::fleet_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::fleet_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::size>, float&> get(military::fleet_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(float));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::size>, float const&> get(military::fleet_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(float));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::fleet_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, fleet::size>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(float));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::fleet_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, fleet::size>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(float));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::size>, tagged_array_view<float, military::fleet_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::fleet_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::size>, tagged_array_view<float const, military::fleet_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::fleet_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::arrival_time>, date_tag&> get(military::fleet_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(date_tag));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::arrival_time>, date_tag const&> get(military::fleet_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(date_tag));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::fleet_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, fleet::arrival_time>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(date_tag));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::fleet_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, fleet::arrival_time>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(date_tag));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::arrival_time>, tagged_array_view<date_tag, military::fleet_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag, military::fleet_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, fleet::arrival_time>, tagged_array_view<date_tag const, military::fleet_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag const, military::fleet_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 
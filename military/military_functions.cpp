@@ -304,6 +304,17 @@ namespace military {
 	}
 
 	void update_cb_construction(world_state& ws) {
+		// the progress of every cb under construction moves, whether it is then acquired, dropped or continues
+		std::vector<ui::data_key> changed;
+		ws.w.nation_s.nations.for_each([&ws, &changed](nations::country_tag n) {
+			if(is_valid_index(ws.get<nation::cb_construction_type>(n))) {
+				changed.push_back(ui::data_key{ ui::world_data::nation_relations, uint16_t(to_index(n)) });
+				if(auto const target = ws.get<nation::cb_construction_target>(n); is_valid_index(target))
+					changed.push_back(ui::data_key{ ui::world_data::nation_relations, uint16_t(to_index(target)) });
+			}
+		});
+		ws.w.gui_m.publish_changes(changed);
+
 		internal_update_cb_construction<
 			world_state,
 			setting_struct,
@@ -2,6 +2,7 @@
 #include "common\\shared_tags.h"
 #include "concurrency_tools\\ve.h"
 #include "simple_serialize\\simple_serialize.hpp"
+#include "concurrency_tools\\access_profiling.h"
 
 #pragma warning( push )
 #pragma warning( disable : 4324 )
@@ -119,6 +120,9 @@ namespace military_leader {
 			 bitfield_type values[((uint32_t(military_leader::container_size + 7)) / 8ui32 + 63ui32) & ~63ui32]; 
 			 dtype_15() { std::fill_n(values - 1, 1 + ((uint32_t(military_leader::container_size + 7)) / 8ui32 + 63ui32) & ~63ui32, bitfield_type{ 0ui8 }); }
 		 } m_15;
+#ifdef CONTAINER_ACCESS_PROFILING
+		 inline static access_profiling::container_profile profile{ "military_leader", { "first_name", "last_name", "creation_date", "portrait", "personality", "background", "organisation", "morale", "attack", "defence", "reconnaissance", "speed", "experience", "reliability", "is_attached", "is_general" }, { "vector_backed_string<char16_t>", "vector_backed_string<char16_t>", "date_tag", "graphics::texture_tag", "military::leader_trait_tag", "military::leader_trait_tag", "float", "float", "float", "float", "float", "float", "float", "float", "bitfield_type", "bitfield_type" }, { sizeof(vector_backed_string<char16_t>), sizeof(vector_backed_string<char16_t>), sizeof(date_tag), sizeof(graphics::texture_tag), sizeof(military::leader_trait_tag), sizeof(military::leader_trait_tag), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), 0, 0 } };
+#endif
 
 		 public:
 		 friend class serialization::serializer<container>;
@@ -131,370 +135,462 @@ namespace military_leader {
 
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::first_name>, vector_backed_string<char16_t>&> get(military::leader_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(vector_backed_string<char16_t>));
 			 return m_0.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::first_name>, vector_backed_string<char16_t> const&> get(military::leader_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(vector_backed_string<char16_t>));
 			 return m_0.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::first_name>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(vector_backed_string<char16_t>));
 			 m_0.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::first_name>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(vector_backed_string<char16_t>));
 			 m_0.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::first_name>, tagged_array_view<vector_backed_string<char16_t>, military::leader_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint64_t(size_used) * sizeof(vector_backed_string<char16_t>));
 			 return tagged_array_view<vector_backed_string<char16_t>, military::leader_tag>(m_0.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::first_name>, tagged_array_view<vector_backed_string<char16_t> const, military::leader_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint64_t(size_used) * sizeof(vector_backed_string<char16_t>));
 			 return tagged_array_view<vector_backed_string<char16_t> const, military::leader_tag>(m_0.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::last_name>, vector_backed_string<char16_t>&> get(military::leader_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(vector_backed_string<char16_t>));
 			 return m_1.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::last_name>, vector_backed_string<char16_t> const&> get(military::leader_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(vector_backed_string<char16_t>));
 			 return m_1.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::last_name>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(vector_backed_string<char16_t>));
 			 m_1.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::last_name>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(vector_backed_string<char16_t>));
 			 m_1.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::last_name>, tagged_array_view<vector_backed_string<char16_t>, military::leader_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint64_t(size_used) * sizeof(vector_backed_string<char16_t>));
 			 return tagged_array_view<vector_backed_string<char16_t>, military::leader_tag>(m_1.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::last_name>, tagged_array_view<vector_backed_string<char16_t> const, military::leader_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint64_t(size_used) * sizeof(vector_backed_string<char16_t>));
 			 return tagged_array_view<vector_backed_string<char16_t> const, military::leader_tag>(m_1.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::creation_date>, date_tag&> get(military::leader_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(date_tag));
 			 return m_2.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::creation_date>, date_tag const&> get(military::leader_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(date_tag));
 			 return m_2.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::creation_date>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(date_tag));
 			 m_2.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::creation_date>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(date_tag));
 			 m_2.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::creation_date>, tagged_array_view<date_tag, military::leader_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag, military::leader_tag>(m_2.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::creation_date>, tagged_array_view<date_tag const, military::leader_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag const, military::leader_tag>(m_2.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::portrait>, graphics::texture_tag&> get(military::leader_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(graphics::texture_tag));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::portrait>, graphics::texture_tag const&> get(military::leader_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(graphics::texture_tag));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::portrait>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(graphics::texture_tag));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::portrait>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(graphics::texture_tag));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::portrait>, tagged_array_view<graphics::texture_tag, military::leader_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(graphics::texture_tag));
 			 return tagged_array_view<graphics::texture_tag, military::leader_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::portrait>, tagged_array_view<graphics::texture_tag const, military::leader_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(graphics::texture_tag));
 			 return tagged_array_view<graphics::texture_tag const, military::leader_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::personality>, military::leader_trait_tag&> get(military::leader_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(military::leader_trait_tag));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::personality>, military::leader_trait_tag const&> get(military::leader_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(military::leader_trait_tag));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::personality>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(military::leader_trait_tag));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::personality>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(military::leader_trait_tag));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::personality>, tagged_array_view<military::leader_trait_tag, military::leader_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(military::leader_trait_tag));
 			 return tagged_array_view<military::leader_trait_tag, military::leader_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::personality>, tagged_array_view<military::leader_trait_tag const, military::leader_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(military::leader_trait_tag));
 			 return tagged_array_view<military::leader_trait_tag const, military::leader_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::background>, military::leader_trait_tag&> get(military::leader_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(military::leader_trait_tag));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::background>, military::leader_trait_tag const&> get(military::leader_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(military::leader_trait_tag));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::background>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(military::leader_trait_tag));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::background>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(military::leader_trait_tag));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::background>, tagged_array_view<military::leader_trait_tag, military::leader_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(military::leader_trait_tag));
 			 return tagged_array_view<military::leader_trait_tag, military::leader_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::background>, tagged_array_view<military::leader_trait_tag const, military::leader_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(military::leader_trait_tag));
 			 return tagged_array_view<military::leader_trait_tag const, military::leader_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::organisation>, float&> get(military::leader_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get, sizeof(float));
 			 return m_6.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::organisation>, float const&> get(military::leader_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get, sizeof(float));
 			 return m_6.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::organisation>> {
+			 CONTAINER_ACCESS_RECORD(profile, 6, set, sizeof(float));
 			 m_6.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::organisation>> {
+			 CONTAINER_ACCESS_RECORD(profile, 6, set, sizeof(float));
 			 m_6.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::organisation>, tagged_array_view<float, military::leader_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::leader_tag>(m_6.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::organisation>, tagged_array_view<float const, military::leader_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::leader_tag>(m_6.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::morale>, float&> get(military::leader_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get, sizeof(float));
 			 return m_7.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::morale>, float const&> get(military::leader_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get, sizeof(float));
 			 return m_7.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::morale>> {
+			 CONTAINER_ACCESS_RECORD(profile, 7, set, sizeof(float));
 			 m_7.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::morale>> {
+			 CONTAINER_ACCESS_RECORD(profile, 7, set, sizeof(float));
 			 m_7.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::morale>, tagged_array_view<float, military::leader_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::leader_tag>(m_7.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::morale>, tagged_array_view<float const, military::leader_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::leader_tag>(m_7.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::attack>, float&> get(military::leader_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get, sizeof(float));
 			 return m_8.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::attack>, float const&> get(military::leader_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get, sizeof(float));
 			 return m_8.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::attack>> {
+			 CONTAINER_ACCESS_RECORD(profile, 8, set, sizeof(float));
 			 m_8.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::attack>> {
+			 CONTAINER_ACCESS_RECORD(profile, 8, set, sizeof(float));
 			 m_8.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::attack>, tagged_array_view<float, military::leader_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::leader_tag>(m_8.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::attack>, tagged_array_view<float const, military::leader_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::leader_tag>(m_8.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::defence>, float&> get(military::leader_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get, sizeof(float));
 			 return m_9.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::defence>, float const&> get(military::leader_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get, sizeof(float));
 			 return m_9.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::defence>> {
+			 CONTAINER_ACCESS_RECORD(profile, 9, set, sizeof(float));
 			 m_9.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::defence>> {
+			 CONTAINER_ACCESS_RECORD(profile, 9, set, sizeof(float));
 			 m_9.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::defence>, tagged_array_view<float, military::leader_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::leader_tag>(m_9.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::defence>, tagged_array_view<float const, military::leader_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::leader_tag>(m_9.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::reconnaissance>, float&> get(military::leader_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get, sizeof(float));
 			 return m_10.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::reconnaissance>, float const&> get(military::leader_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get, sizeof(float));
 			 return m_10.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::reconnaissance>> {
+			 CONTAINER_ACCESS_RECORD(profile, 10, set, sizeof(float));
 			 m_10.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::reconnaissance>> {
+			 CONTAINER_ACCESS_RECORD(profile, 10, set, sizeof(float));
 			 m_10.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::reconnaissance>, tagged_array_view<float, military::leader_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::leader_tag>(m_10.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::reconnaissance>, tagged_array_view<float const, military::leader_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::leader_tag>(m_10.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::speed>, float&> get(military::leader_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get, sizeof(float));
 			 return m_11.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::speed>, float const&> get(military::leader_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get, sizeof(float));
 			 return m_11.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::speed>> {
+			 CONTAINER_ACCESS_RECORD(profile, 11, set, sizeof(float));
 			 m_11.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::speed>> {
+			 CONTAINER_ACCESS_RECORD(profile, 11, set, sizeof(float));
 			 m_11.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::speed>, tagged_array_view<float, military::leader_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::leader_tag>(m_11.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::speed>, tagged_array_view<float const, military::leader_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::leader_tag>(m_11.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::experience>, float&> get(military::leader_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get, sizeof(float));
 			 return m_12.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::experience>, float const&> get(military::leader_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get, sizeof(float));
 			 return m_12.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::experience>> {
+			 CONTAINER_ACCESS_RECORD(profile, 12, set, sizeof(float));
 			 m_12.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::experience>> {
+			 CONTAINER_ACCESS_RECORD(profile, 12, set, sizeof(float));
 			 m_12.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::experience>, tagged_array_view<float, military::leader_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::leader_tag>(m_12.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::experience>, tagged_array_view<float const, military::leader_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::leader_tag>(m_12.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::reliability>, float&> get(military::leader_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get, sizeof(float));
 			 return m_13.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::reliability>, float const&> get(military::leader_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get, sizeof(float));
 			 return m_13.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::reliability>> {
+			 CONTAINER_ACCESS_RECORD(profile, 13, set, sizeof(float));
 			 m_13.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::leader_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, military_leader::reliability>> {
+			 CONTAINER_ACCESS_RECORD(profile, 13, set, sizeof(float));
 			 m_13.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::reliability>, tagged_array_view<float, military::leader_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::leader_tag>(m_13.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::reliability>, tagged_array_view<float const, military::leader_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::leader_tag>(m_13.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::is_attached>, bool> get(military::leader_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 14, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_14.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(military::leader_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, military_leader::is_attached>> {
+			 CONTAINER_ACCESS_RECORD(profile, 14, set, sizeof(bitfield_type));
 			 bit_vector_set(m_14.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::is_attached>, tagged_array_view<bitfield_type, military::leader_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 14, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, military::leader_tag>(m_14.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::is_attached>, tagged_array_view<bitfield_type const, military::leader_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 14, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, military::leader_tag>(m_14.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::is_general>, bool> get(military::leader_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 15, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_15.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(military::leader_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, military_leader::is_general>> {
+			 CONTAINER_ACCESS_RECORD(profile, 15, set, sizeof(bitfield_type));
 			 bit_vector_set(m_15.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::is_general>, tagged_array_view<bitfield_type, military::leader_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 15, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, military::leader_tag>(m_15.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, military_leader::is_general>, tagged_array_view<bitfield_type const, military::leader_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 15, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, military::leader_tag>(m_15.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 
@@ -2,6 +2,7 @@
 #include "common\\shared_tags.h"
 #include "concurrency_tools\\ve.h"
 #include "simple_serialize\\simple_serialize.hpp"
+#include "concurrency_tools\\access_profiling.h"
 
 #pragma warning( push )
 #pragma warning( disable : 4324 )
@@ -89,6 +90,9 @@ namespace strategic_hq {
 			 int8_t values[(sizeof(int8_t) <= 64 ? (uint32_t(strategic_hq::container_size) + (64ui32 / uint32_t(sizeof(int8_t))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(int8_t)) - 1ui32) : uint32_t(strategic_hq::container_size))]; 
 			 dtype_10() { std::uninitialized_value_construct_n(values - 1, (sizeof(int8_t) <= 64 ? (uint32_t(strategic_hq::container_size) + (64ui32 / uint32_t(sizeof(int8_t))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(int8_t)) - 1ui32) : uint32_t(strategic_hq::container_size)) + 1); }
 		 } m_10;
+#ifdef CONTAINER_ACCESS_PROFILING
+		 inline static access_profiling::container_profile profile{ "strategic_hq", { "leader", "location", "province_set", "army_set", "injured_soldiers", "pow_soldiers", "reserve_soldiers", "allocated_soldiers", "total_soldier_pops", "total_non_soldier_pops", "mobilization_level" }, { "military::leader_tag", "provinces::province_tag", "set_tag<provinces::province_tag>", "set_tag<military::army_tag>", "float", "float", "float", "float", "float", "float", "int8_t" }, { sizeof(military::leader_tag), sizeof(provinces::province_tag), sizeof(set_tag<provinces::province_tag>), sizeof(set_tag<military::army_tag>), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(int8_t) } };
+#endif
 
 		 public:
 		 friend class serialization::serializer<container>;
@@ -101,266 +105,332 @@ namespace strategic_hq {
 
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::leader>, military::leader_tag&> get(military::strategic_hq_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(military::leader_tag));
 			 return m_0.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::leader>, military::leader_tag const&> get(military::strategic_hq_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(military::leader_tag));
 			 return m_0.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::leader>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(military::leader_tag));
 			 m_0.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::leader>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(military::leader_tag));
 			 m_0.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::leader>, tagged_array_view<military::leader_tag, military::strategic_hq_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint64_t(size_used) * sizeof(military::leader_tag));
 			 return tagged_array_view<military::leader_tag, military::strategic_hq_tag>(m_0.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::leader>, tagged_array_view<military::leader_tag const, military::strategic_hq_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint64_t(size_used) * sizeof(military::leader_tag));
 			 return tagged_array_view<military::leader_tag const, military::strategic_hq_tag>(m_0.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::location>, provinces::province_tag&> get(military::strategic_hq_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(provinces::province_tag));
 			 return m_1.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::location>, provinces::province_tag const&> get(military::strategic_hq_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(provinces::province_tag));
 			 return m_1.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::location>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(provinces::province_tag));
 			 m_1.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::location>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(provinces::province_tag));
 			 m_1.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::location>, tagged_array_view<provinces::province_tag, military::strategic_hq_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint64_t(size_used) * sizeof(provinces::province_tag));
 			 return tagged_array_view<provinces::province_tag, military::strategic_hq_tag>(m_1.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::location>, tagged_array_view<provinces::province_tag const, military::strategic_hq_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint64_t(size_used) * sizeof(provinces::province_tag));
 			 return tagged_array_view<provinces::province_tag const, military::strategic_hq_tag>(m_1.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::province_set>, set_tag<provinces::province_tag>&> get(military::strategic_hq_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(set_tag<provinces::province_tag>));
 			 return m_2.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::province_set>, set_tag<provinces::province_tag> const&> get(military::strategic_hq_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(set_tag<provinces::province_tag>));
 			 return m_2.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::province_set>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(set_tag<provinces::province_tag>));
 			 m_2.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::province_set>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(set_tag<provinces::province_tag>));
 			 m_2.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::province_set>, tagged_array_view<set_tag<provinces::province_tag>, military::strategic_hq_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint64_t(size_used) * sizeof(set_tag<provinces::province_tag>));
 			 return tagged_array_view<set_tag<provinces::province_tag>, military::strategic_hq_tag>(m_2.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::province_set>, tagged_array_view<set_tag<provinces::province_tag> const, military::strategic_hq_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint64_t(size_used) * sizeof(set_tag<provinces::province_tag>));
 			 return tagged_array_view<set_tag<provinces::province_tag> const, military::strategic_hq_tag>(m_2.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::army_set>, set_tag<military::army_tag>&> get(military::strategic_hq_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(set_tag<military::army_tag>));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::army_set>, set_tag<military::army_tag> const&> get(military::strategic_hq_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(set_tag<military::army_tag>));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::army_set>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(set_tag<military::army_tag>));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::army_set>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(set_tag<military::army_tag>));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::army_set>, tagged_array_view<set_tag<military::army_tag>, military::strategic_hq_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(set_tag<military::army_tag>));
 			 return tagged_array_view<set_tag<military::army_tag>, military::strategic_hq_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::army_set>, tagged_array_view<set_tag<military::army_tag> const, military::strategic_hq_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(set_tag<military::army_tag>));
 			 return tagged_array_view<set_tag<military::army_tag> const, military::strategic_hq_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::injured_soldiers>, float&> get(military::strategic_hq_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(float));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::injured_soldiers>, float const&> get(military::strategic_hq_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(float));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::injured_soldiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(float));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::injured_soldiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(float));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::injured_soldiers>, tagged_array_view<float, military::strategic_hq_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::strategic_hq_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::injured_soldiers>, tagged_array_view<float const, military::strategic_hq_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::strategic_hq_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::pow_soldiers>, float&> get(military::strategic_hq_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(float));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::pow_soldiers>, float const&> get(military::strategic_hq_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(float));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::pow_soldiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(float));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::pow_soldiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(float));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::pow_soldiers>, tagged_array_view<float, military::strategic_hq_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::strategic_hq_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::pow_soldiers>, tagged_array_view<float const, military::strategic_hq_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::strategic_hq_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::reserve_soldiers>, float&> get(military::strategic_hq_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get, sizeof(float));
 			 return m_6.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::reserve_soldiers>, float const&> get(military::strategic_hq_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get, sizeof(float));
 			 return m_6.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::reserve_soldiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 6, set, sizeof(float));
 			 m_6.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::reserve_soldiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 6, set, sizeof(float));
 			 m_6.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::reserve_soldiers>, tagged_array_view<float, military::strategic_hq_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::strategic_hq_tag>(m_6.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::reserve_soldiers>, tagged_array_view<float const, military::strategic_hq_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::strategic_hq_tag>(m_6.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::allocated_soldiers>, float&> get(military::strategic_hq_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get, sizeof(float));
 			 return m_7.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::allocated_soldiers>, float const&> get(military::strategic_hq_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get, sizeof(float));
 			 return m_7.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::allocated_soldiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 7, set, sizeof(float));
 			 m_7.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::allocated_soldiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 7, set, sizeof(float));
 			 m_7.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::allocated_soldiers>, tagged_array_view<float, military::strategic_hq_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::strategic_hq_tag>(m_7.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::allocated_soldiers>, tagged_array_view<float const, military::strategic_hq_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::strategic_hq_tag>(m_7.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::total_soldier_pops>, float&> get(military::strategic_hq_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get, sizeof(float));
 			 return m_8.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::total_soldier_pops>, float const&> get(military::strategic_hq_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get, sizeof(float));
 			 return m_8.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::total_soldier_pops>> {
+			 CONTAINER_ACCESS_RECORD(profile, 8, set, sizeof(float));
 			 m_8.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::total_soldier_pops>> {
+			 CONTAINER_ACCESS_RECORD(profile, 8, set, sizeof(float));
 			 m_8.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::total_soldier_pops>, tagged_array_view<float, military::strategic_hq_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::strategic_hq_tag>(m_8.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::total_soldier_pops>, tagged_array_view<float const, military::strategic_hq_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::strategic_hq_tag>(m_8.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::total_non_soldier_pops>, float&> get(military::strategic_hq_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get, sizeof(float));
 			 return m_9.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::total_non_soldier_pops>, float const&> get(military::strategic_hq_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get, sizeof(float));
 			 return m_9.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::total_non_soldier_pops>> {
+			 CONTAINER_ACCESS_RECORD(profile, 9, set, sizeof(float));
 			 m_9.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::total_non_soldier_pops>> {
+			 CONTAINER_ACCESS_RECORD(profile, 9, set, sizeof(float));
 			 m_9.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::total_non_soldier_pops>, tagged_array_view<float, military::strategic_hq_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::strategic_hq_tag>(m_9.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::total_non_soldier_pops>, tagged_array_view<float const, military::strategic_hq_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::strategic_hq_tag>(m_9.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::mobilization_level>, int8_t&> get(military::strategic_hq_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get, sizeof(int8_t));
 			 return m_10.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::mobilization_level>, int8_t const&> get(military::strategic_hq_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get, sizeof(int8_t));
 			 return m_10.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::mobilization_level>> {
+			 CONTAINER_ACCESS_RECORD(profile, 10, set, sizeof(int8_t));
 			 m_10.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::strategic_hq_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, strategic_hq::mobilization_level>> {
+			 CONTAINER_ACCESS_RECORD(profile, 10, set, sizeof(int8_t));
 			 m_10.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::mobilization_level>, tagged_array_view<int8_t, military::strategic_hq_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get_row, uint64_t(size_used) * sizeof(int8_t));
 			 return tagged_array_view<int8_t, military::strategic_hq_tag>(m_10.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, strategic_hq::mobilization_level>, tagged_array_view<int8_t const, military::strategic_hq_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get_row, uint64_t(size_used) * sizeof(int8_t));
 			 return tagged_array_view<int8_t const, military::strategic_hq_tag>(m_10.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 
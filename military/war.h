@@ -2,6 +2,7 @@
 #include "common\\shared_tags.h"
 #include "concurrency_tools\\ve.h"
 #include "simple_serialize\\simple_serialize.hpp"
+#include "concurrency_tools\\access_profiling.h"
 
 #pragma warning( push )
 #pragma warning( disable : 4324 )
@@ -107,6 +108,9 @@ namespace war {
 			 bitfield_type values[((uint32_t(war::container_size + 7)) / 8ui32 + 63ui32) & ~63ui32]; 
 			 dtype_13() { std::fill_n(values - 1, 1 + ((uint32_t(war::container_size + 7)) / 8ui32 + 63ui32) & ~63ui32, bitfield_type{ 0ui8 }); }
 		 } m_13;
+#ifdef CONTAINER_ACCESS_PROFILING
+		 inline static access_profiling::container_profile profile{ "war", { "attackers", "defenders", "naval_control_set", "start_date", "current_war_score", "name", "first_adj", "second", "state_name", "primary_attacker", "primary_defender", "war_goals", "is_great_war", "is_world_war" }, { "set_tag<nations::country_tag>", "set_tag<nations::country_tag>", "set_tag<military::naval_control>", "date_tag", "float", "text_data::text_tag", "text_data::text_tag", "text_data::text_tag", "text_data::text_tag", "nations::country_tag", "nations::country_tag", "array_tag<military::war_goal, int32_t, false>", "bitfield_type", "bitfield_type" }, { sizeof(set_tag<nations::country_tag>), sizeof(set_tag<nations::country_tag>), sizeof(set_tag<military::naval_control>), sizeof(date_tag), sizeof(float), sizeof(text_data::text_tag), sizeof(text_data::text_tag), sizeof(text_data::text_tag), sizeof(text_data::text_tag), sizeof(nations::country_tag), sizeof(nations::country_tag), sizeof(array_tag<military::war_goal, int32_t, false>), 0, 0 } };
+#endif
 
 		 public:
 		 friend class serialization::serializer<container>;
@@ -119,322 +123,402 @@ namespace war {
 
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::attackers>, set_tag<nations::country_tag>&> get(military::war_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(set_tag<nations::country_tag>));
 			 return m_0.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::attackers>, set_tag<nations::country_tag> const&> get(military::war_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(set_tag<nations::country_tag>));
 			 return m_0.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::attackers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(set_tag<nations::country_tag>));
 			 m_0.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::attackers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(set_tag<nations::country_tag>));
 			 m_0.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::attackers>, tagged_array_view<set_tag<nations::country_tag>, military::war_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag>, military::war_tag>(m_0.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::attackers>, tagged_array_view<set_tag<nations::country_tag> const, military::war_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag> const, military::war_tag>(m_0.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::defenders>, set_tag<nations::country_tag>&> get(military::war_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(set_tag<nations::country_tag>));
 			 return m_1.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::defenders>, set_tag<nations::country_tag> const&> get(military::war_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(set_tag<nations::country_tag>));
 			 return m_1.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::defenders>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(set_tag<nations::country_tag>));
 			 m_1.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::defenders>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(set_tag<nations::country_tag>));
 			 m_1.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::defenders>, tagged_array_view<set_tag<nations::country_tag>, military::war_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag>, military::war_tag>(m_1.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::defenders>, tagged_array_view<set_tag<nations::country_tag> const, military::war_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag> const, military::war_tag>(m_1.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::naval_control_set>, set_tag<military::naval_control>&> get(military::war_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(set_tag<military::naval_control>));
 			 return m_2.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::naval_control_set>, set_tag<military::naval_control> const&> get(military::war_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(set_tag<military::naval_control>));
 			 return m_2.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::naval_control_set>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(set_tag<military::naval_control>));
 			 m_2.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::naval_control_set>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(set_tag<military::naval_control>));
 			 m_2.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::naval_control_set>, tagged_array_view<set_tag<military::naval_control>, military::war_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint64_t(size_used) * sizeof(set_tag<military::naval_control>));
 			 return tagged_array_view<set_tag<military::naval_control>, military::war_tag>(m_2.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::naval_control_set>, tagged_array_view<set_tag<military::naval_control> const, military::war_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint64_t(size_used) * sizeof(set_tag<military::naval_control>));
 			 return tagged_array_view<set_tag<military::naval_control> const, military::war_tag>(m_2.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::start_date>, date_tag&> get(military::war_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(date_tag));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::start_date>, date_tag const&> get(military::war_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(date_tag));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::start_date>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(date_tag));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::start_date>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(date_tag));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::start_date>, tagged_array_view<date_tag, military::war_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag, military::war_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::start_date>, tagged_array_view<date_tag const, military::war_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag const, military::war_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::current_war_score>, float&> get(military::war_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(float));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::current_war_score>, float const&> get(military::war_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(float));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::current_war_score>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(float));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::current_war_score>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(float));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::current_war_score>, tagged_array_view<float, military::war_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, military::war_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::current_war_score>, tagged_array_view<float const, military::war_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, military::war_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::name>, text_data::text_tag&> get(military::war_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(text_data::text_tag));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::name>, text_data::text_tag const&> get(military::war_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(text_data::text_tag));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::name>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(text_data::text_tag));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::name>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(text_data::text_tag));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::name>, tagged_array_view<text_data::text_tag, military::war_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(text_data::text_tag));
 			 return tagged_array_view<text_data::text_tag, military::war_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::name>, tagged_array_view<text_data::text_tag const, military::war_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(text_data::text_tag));
 			 return tagged_array_view<text_data::text_tag const, military::war_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::first_adj>, text_data::text_tag&> get(military::war_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get, sizeof(text_data::text_tag));
 			 return m_6.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::first_adj>, text_data::text_tag const&> get(military::war_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get, sizeof(text_data::text_tag));
 			 return m_6.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::first_adj>> {
+			 CONTAINER_ACCESS_RECORD(profile, 6, set, sizeof(text_data::text_tag));
 			 m_6.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::first_adj>> {
+			 CONTAINER_ACCESS_RECORD(profile, 6, set, sizeof(text_data::text_tag));
 			 m_6.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::first_adj>, tagged_array_view<text_data::text_tag, military::war_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get_row, uint64_t(size_used) * sizeof(text_data::text_tag));
 			 return tagged_array_view<text_data::text_tag, military::war_tag>(m_6.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::first_adj>, tagged_array_view<text_data::text_tag const, military::war_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get_row, uint64_t(size_used) * sizeof(text_data::text_tag));
 			 return tagged_array_view<text_data::text_tag const, military::war_tag>(m_6.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::second>, text_data::text_tag&> get(military::war_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get, sizeof(text_data::text_tag));
 			 return m_7.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::second>, text_data::text_tag const&> get(military::war_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get, sizeof(text_data::text_tag));
 			 return m_7.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::second>> {
+			 CONTAINER_ACCESS_RECORD(profile, 7, set, sizeof(text_data::text_tag));
 			 m_7.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::second>> {
+			 CONTAINER_ACCESS_RECORD(profile, 7, set, sizeof(text_data::text_tag));
 			 m_7.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::second>, tagged_array_view<text_data::text_tag, military::war_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get_row, uint64_t(size_used) * sizeof(text_data::text_tag));
 			 return tagged_array_view<text_data::text_tag, military::war_tag>(m_7.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::second>, tagged_array_view<text_data::text_tag const, military::war_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get_row, uint64_t(size_used) * sizeof(text_data::text_tag));
 			 return tagged_array_view<text_data::text_tag const, military::war_tag>(m_7.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::state_name>, text_data::text_tag&> get(military::war_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get, sizeof(text_data::text_tag));
 			 return m_8.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::state_name>, text_data::text_tag const&> get(military::war_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get, sizeof(text_data::text_tag));
 			 return m_8.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::state_name>> {
+			 CONTAINER_ACCESS_RECORD(profile, 8, set, sizeof(text_data::text_tag));
 			 m_8.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::state_name>> {
+			 CONTAINER_ACCESS_RECORD(profile, 8, set, sizeof(text_data::text_tag));
 			 m_8.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::state_name>, tagged_array_view<text_data::text_tag, military::war_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get_row, uint64_t(size_used) * sizeof(text_data::text_tag));
 			 return tagged_array_view<text_data::text_tag, military::war_tag>(m_8.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::state_name>, tagged_array_view<text_data::text_tag const, military::war_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get_row, uint64_t(size_used) * sizeof(text_data::text_tag));
 			 return tagged_array_view<text_data::text_tag const, military::war_tag>(m_8.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::primary_attacker>, nations::country_tag&> get(military::war_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get, sizeof(nations::country_tag));
 			 return m_9.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::primary_attacker>, nations::country_tag const&> get(military::war_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get, sizeof(nations::country_tag));
 			 return m_9.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::primary_attacker>> {
+			 CONTAINER_ACCESS_RECORD(profile, 9, set, sizeof(nations::country_tag));
 			 m_9.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::primary_attacker>> {
+			 CONTAINER_ACCESS_RECORD(profile, 9, set, sizeof(nations::country_tag));
 			 m_9.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::primary_attacker>, tagged_array_view<nations::country_tag, military::war_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag, military::war_tag>(m_9.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::primary_attacker>, tagged_array_view<nations::country_tag const, military::war_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag const, military::war_tag>(m_9.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::primary_defender>, nations::country_tag&> get(military::war_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get, sizeof(nations::country_tag));
 			 return m_10.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::primary_defender>, nations::country_tag const&> get(military::war_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get, sizeof(nations::country_tag));
 			 return m_10.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::primary_defender>> {
+			 CONTAINER_ACCESS_RECORD(profile, 10, set, sizeof(nations::country_tag));
 			 m_10.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::primary_defender>> {
+			 CONTAINER_ACCESS_RECORD(profile, 10, set, sizeof(nations::country_tag));
 			 m_10.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::primary_defender>, tagged_array_view<nations::country_tag, military::war_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag, military::war_tag>(m_10.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::primary_defender>, tagged_array_view<nations::country_tag const, military::war_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag const, military::war_tag>(m_10.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::war_goals>, array_tag<military::war_goal, int32_t, false>&> get(military::war_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get, sizeof(array_tag<military::war_goal, int32_t, false>));
 			 return m_11.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::war_goals>, array_tag<military::war_goal, int32_t, false> const&> get(military::war_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get, sizeof(array_tag<military::war_goal, int32_t, false>));
 			 return m_11.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::war_goals>> {
+			 CONTAINER_ACCESS_RECORD(profile, 11, set, sizeof(array_tag<military::war_goal, int32_t, false>));
 			 m_11.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(military::war_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, war::war_goals>> {
+			 CONTAINER_ACCESS_RECORD(profile, 11, set, sizeof(array_tag<military::war_goal, int32_t, false>));
 			 m_11.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::war_goals>, tagged_array_view<array_tag<military::war_goal, int32_t, false>, military::war_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get_row, uint64_t(size_used) * sizeof(array_tag<military::war_goal, int32_t, false>));
 			 return tagged_array_view<array_tag<military::war_goal, int32_t, false>, military::war_tag>(m_11.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::war_goals>, tagged_array_view<array_tag<military::war_goal, int32_t, false> const, military::war_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get_row, uint64_t(size_used) * sizeof(array_tag<military::war_goal, int32_t, false>));
 			 return tagged_array_view<array_tag<military::war_goal, int32_t, false> const, military::war_tag>(m_11.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::is_great_war>, bool> get(military::war_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_12.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(military::war_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, war::is_great_war>> {
+			 CONTAINER_ACCESS_RECORD(profile, 12, set, sizeof(bitfield_type));
 			 bit_vector_set(m_12.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::is_great_war>, tagged_array_view<bitfield_type, military::war_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, military::war_tag>(m_12.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::is_great_war>, tagged_array_view<bitfield_type const, military::war_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, military::war_tag>(m_12.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::is_world_war>, bool> get(military::war_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_13.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(military::war_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, war::is_world_war>> {
+			 CONTAINER_ACCESS_RECORD(profile, 13, set, sizeof(bitfield_type));
 			 bit_vector_set(m_13.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::is_world_war>, tagged_array_view<bitfield_type, military::war_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, military::war_tag>(m_13.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, war::is_world_war>, tagged_array_view<bitfield_type const, military::war_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, military::war_tag>(m_13.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 
@@ -2,6 +2,7 @@
 #include "common\\shared_tags.h"
 #include "concurrency_tools\\ve.h"
 #include "simple_serialize\\simple_serialize.hpp"
+#include "concurrency_tools\\access_profiling.h"
 
 #pragma warning( push )
 #pragma warning( disable : 4324 )
@@ -703,6 +704,9 @@ constexpr int32_t max_count = 700;
 			 bitfield_type values[((uint32_t(700 + 7)) / 8ui32 + 63ui32) & ~63ui32]; 
 			 dtype_112() { std::fill_n(values - 1, 1 + ((uint32_t(700 + 7)) / 8ui32 + 63ui32) & ~63ui32, bitfield_type{ 0ui8 }); }
 		 } m_112;
+#ifdef CONTAINER_ACCESS_PROFILING
+		 inline static access_profiling::container_profile profile{ "nation", { "sphere_leader", "overlord", "enabled_crimes", "current_rules", "total_core_population", "last_election", "last_reform_date", "last_manual_ruling_party_change", "last_lost_war", "disarmed_until", "total_foreign_investment", "treasury", "plurality", "revanchism", "base_prestige", "infamy", "war_exhaustion", "suppression_points", "diplomacy_points", "research_points", "national_debt", "tax_base", "political_interest_fraction", "social_interest_fraction", "national_administrative_efficiency", "social_movement_support", "political_movement_support", "owned_provinces", "controlled_provinces", "naval_patrols", "sphere_members", "vassals", "allies", "neighboring_nations", "accepted_cultures", "member_states", "gp_influence", "influencers", "relations", "truces", "national_focus_locations", "national_flags", "static_modifiers", "timed_modifiers", "statewise_tariff_mask", "generals", "admirals", "armies", "fleets", "active_orders", "strategic_hqs", "active_cbs", "wars_involved_in", "opponents_in_war", "allies_in_war", "name", "adjective", "national_value", "tech_school", "flag", "current_color", "current_research", "military_score", "industrial_score", "overall_rank", "prestige_rank", "military_rank", "industrial_rank", "province_count", "central_province_count", "rebel_controlled_provinces", "blockaded_count", "crime_count", "leadership_points", "base_colonial_points", "num_connected_ports", "num_ports", "player_importance", "cb_construction_progress", "cb_construction_target", "cb_construction_type", "ruling_party", "current_capital", "tag", "primary_culture", "dominant_culture", "dominant_issue", "dominant_ideology", "dominant_religion", "national_religion", "current_government", "ruling_ideology", "f_rich_tax", "f_middle_tax", "f_poor_tax", "f_social_spending", "f_administrative_spending", "f_education_spending", "f_military_spending", "f_tariffs", "f_army_stockpile_spending", "f_navy_stockpile_spending", "f_projects_stockpile_spending", "is_civilized", "is_substate", "is_mobilized", "is_at_war", "is_not_ai_controlled", "is_holding_election", "is_colonial_nation", "cb_construction_discovered", "has_gas_attack", "has_gas_defence" }, { "nations::country_tag", "nations::country_tag", "uint64_t", "int32_t", "float", "date_tag", "date_tag", "date_tag", "date_tag", "date_tag", "float", "float", "float", "float", "float", "float", "float", "float", "float", "float", "float", "float", "float", "float", "float", "float", "float", "set_tag<provinces::province_tag>", "set_tag<provinces::province_tag>", "set_tag<provinces::province_tag>", "set_tag<nations::country_tag>", "set_tag<nations::country_tag>", "set_tag<nations::country_tag>", "set_tag<nations::country_tag>", "set_tag<cultures::culture_tag>", "set_tag<nations::region_state_pair>", "set_tag<nations::influence>", "set_tag<nations::country_tag>", "set_tag<nations::relationship>", "set_tag<nations::truce>", "set_tag<nations::state_tag>", "set_tag<variables::national_flag_tag>", "multiset_tag<modifiers::national_modifier_tag>", "multiset_tag<nations::timed_national_modifier>", "array_tag<economy::money_qnty_type, nations::state_tag, true>", "array_tag<military::leader_tag, int32_t, false>", "array_tag<military::leader_tag, int32_t, false>", "array_tag<military::army_tag, int32_t, false>", "array_tag<military::fleet_tag, int32_t, false>", "array_tag<military::army_orders_tag, int32_t, false>", "array_tag<military::strategic_hq_tag, int32_t, false>", "array_tag<military::pending_cb, int32_t, false>", "set_tag<military::war_identifier>", "set_tag<nations::country_tag>", "set_tag<nations::country_tag>", "text_data::text_tag", "text_data::text_tag", "modifiers::national_modifier_tag", "modifiers::national_modifier_tag", "graphics::texture_tag", "graphics::color_rgb", "technologies::tech_tag", "int16_t", "int16_t", "int16_t", "int16_t", "int16_t", "int16_t", "uint16_t", "uint16_t", "uint16_t", "uint16_t", "uint16_t", "int16_t", "int16_t", "uint16_t", "uint16_t", "int8_t", "float", "nations::country_tag", "military::cb_type_tag", "governments::party_tag", "provinces::province_tag", "cultures::national_tag", "cultures::culture_tag", "cultures::culture_tag", "issues::option_tag", "ideologies::ideology_tag", "cultures::religion_tag", "cultures::religion_tag", "governments::government_tag", "ideologies::ideology_tag", "float", "float", "float", "float", "float", "float", "float", "float", "float", "float", "float", "bitfield_type", "bitfield_type", "bitfield_type", "bitfield_type", "bitfield_type", "bitfield_type", "bitfield_type", "bitfield_type", "bitfield_type", "bitfield_type" }, { sizeof(nations::country_tag), sizeof(nations::country_tag), sizeof(uint64_t), sizeof(int32_t), sizeof(float), sizeof(date_tag), sizeof(date_tag), sizeof(date_tag), sizeof(date_tag), sizeof(date_tag), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(set_tag<provinces::province_tag>), sizeof(set_tag<provinces::province_tag>), sizeof(set_tag<provinces::province_tag>), sizeof(set_tag<nations::country_tag>), sizeof(set_tag<nations::country_tag>), sizeof(set_tag<nations::country_tag>), sizeof(set_tag<nations::country_tag>), sizeof(set_tag<cultures::culture_tag>), sizeof(set_tag<nations::region_state_pair>), sizeof(set_tag<nations::influence>), sizeof(set_tag<nations::country_tag>), sizeof(set_tag<nations::relationship>), sizeof(set_tag<nations::truce>), sizeof(set_tag<nations::state_tag>), sizeof(set_tag<variables::national_flag_tag>), sizeof(multiset_tag<modifiers::national_modifier_tag>), sizeof(multiset_tag<nations::timed_national_modifier>), sizeof(array_tag<economy::money_qnty_type, nations::state_tag, true>), sizeof(array_tag<military::leader_tag, int32_t, false>), sizeof(array_tag<military::leader_tag, int32_t, false>), sizeof(array_tag<military::army_tag, int32_t, false>), sizeof(array_tag<military::fleet_tag, int32_t, false>), sizeof(array_tag<military::army_orders_tag, int32_t, false>), sizeof(array_tag<military::strategic_hq_tag, int32_t, false>), sizeof(array_tag<military::pending_cb, int32_t, false>), sizeof(set_tag<military::war_identifier>), sizeof(set_tag<nations::country_tag>), sizeof(set_tag<nations::country_tag>), sizeof(text_data::text_tag), sizeof(text_data::text_tag), sizeof(modifiers::national_modifier_tag), sizeof(modifiers::national_modifier_tag), sizeof(graphics::texture_tag), sizeof(graphics::color_rgb), sizeof(technologies::tech_tag), sizeof(int16_t), sizeof(int16_t), sizeof(int16_t), sizeof(int16_t), sizeof(int16_t), sizeof(int16_t), sizeof(uint16_t), sizeof(uint16_t), sizeof(uint16_t), sizeof(uint16_t), sizeof(uint16_t), sizeof(int16_t), sizeof(int16_t), sizeof(uint16_t), sizeof(uint16_t), sizeof(int8_t), sizeof(float), sizeof(nations::country_tag), sizeof(military::cb_type_tag), sizeof(governments::party_tag), sizeof(provinces::province_tag), sizeof(cultures::national_tag), sizeof(cultures::culture_tag), sizeof(cultures::culture_tag), sizeof(issues::option_tag), sizeof(ideologies::ideology_tag), sizeof(cultures::religion_tag), sizeof(cultures::religion_tag), sizeof(governments::government_tag), sizeof(ideologies::ideology_tag), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } };
+#endif
 
 		 public:
 		 friend class serialization::serializer<container>;
@@ -715,2634 +719,3292 @@ constexpr int32_t max_count = 700;
 
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::sphere_leader>, nations::country_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(nations::country_tag));
 			 return m_0.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::sphere_leader>, nations::country_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(nations::country_tag));
 			 return m_0.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::sphere_leader>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(nations::country_tag));
 			 m_0.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::sphere_leader>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(nations::country_tag));
 			 m_0.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::sphere_leader>, tagged_array_view<nations::country_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag, nations::country_tag>(m_0.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::sphere_leader>, tagged_array_view<nations::country_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag const, nations::country_tag>(m_0.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::overlord>, nations::country_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(nations::country_tag));
 			 return m_1.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::overlord>, nations::country_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(nations::country_tag));
 			 return m_1.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::overlord>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(nations::country_tag));
 			 m_1.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::overlord>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(nations::country_tag));
 			 m_1.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::overlord>, tagged_array_view<nations::country_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag, nations::country_tag>(m_1.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::overlord>, tagged_array_view<nations::country_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag const, nations::country_tag>(m_1.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::enabled_crimes>, uint64_t&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(uint64_t));
 			 return m_2.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::enabled_crimes>, uint64_t const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(uint64_t));
 			 return m_2.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::enabled_crimes>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(uint64_t));
 			 m_2.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::enabled_crimes>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(uint64_t));
 			 m_2.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::enabled_crimes>, tagged_array_view<uint64_t, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint64_t(size_used) * sizeof(uint64_t));
 			 return tagged_array_view<uint64_t, nations::country_tag>(m_2.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::enabled_crimes>, tagged_array_view<uint64_t const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint64_t(size_used) * sizeof(uint64_t));
 			 return tagged_array_view<uint64_t const, nations::country_tag>(m_2.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_rules>, int32_t&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(int32_t));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_rules>, int32_t const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(int32_t));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::current_rules>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(int32_t));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::current_rules>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(int32_t));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_rules>, tagged_array_view<int32_t, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(int32_t));
 			 return tagged_array_view<int32_t, nations::country_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_rules>, tagged_array_view<int32_t const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(int32_t));
 			 return tagged_array_view<int32_t const, nations::country_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::total_core_population>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(float));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::total_core_population>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(float));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::total_core_population>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(float));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::total_core_population>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(float));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::total_core_population>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::total_core_population>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::last_election>, date_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(date_tag));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::last_election>, date_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(date_tag));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::last_election>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(date_tag));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::last_election>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(date_tag));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::last_election>, tagged_array_view<date_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag, nations::country_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::last_election>, tagged_array_view<date_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag const, nations::country_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::last_reform_date>, date_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get, sizeof(date_tag));
 			 return m_6.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::last_reform_date>, date_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get, sizeof(date_tag));
 			 return m_6.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::last_reform_date>> {
+			 CONTAINER_ACCESS_RECORD(profile, 6, set, sizeof(date_tag));
 			 m_6.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::last_reform_date>> {
+			 CONTAINER_ACCESS_RECORD(profile, 6, set, sizeof(date_tag));
 			 m_6.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::last_reform_date>, tagged_array_view<date_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag, nations::country_tag>(m_6.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::last_reform_date>, tagged_array_view<date_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag const, nations::country_tag>(m_6.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::last_manual_ruling_party_change>, date_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get, sizeof(date_tag));
 			 return m_7.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::last_manual_ruling_party_change>, date_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get, sizeof(date_tag));
 			 return m_7.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::last_manual_ruling_party_change>> {
+			 CONTAINER_ACCESS_RECORD(profile, 7, set, sizeof(date_tag));
 			 m_7.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::last_manual_ruling_party_change>> {
+			 CONTAINER_ACCESS_RECORD(profile, 7, set, sizeof(date_tag));
 			 m_7.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::last_manual_ruling_party_change>, tagged_array_view<date_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag, nations::country_tag>(m_7.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::last_manual_ruling_party_change>, tagged_array_view<date_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag const, nations::country_tag>(m_7.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::last_lost_war>, date_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get, sizeof(date_tag));
 			 return m_8.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::last_lost_war>, date_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get, sizeof(date_tag));
 			 return m_8.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::last_lost_war>> {
+			 CONTAINER_ACCESS_RECORD(profile, 8, set, sizeof(date_tag));
 			 m_8.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::last_lost_war>> {
+			 CONTAINER_ACCESS_RECORD(profile, 8, set, sizeof(date_tag));
 			 m_8.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::last_lost_war>, tagged_array_view<date_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag, nations::country_tag>(m_8.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::last_lost_war>, tagged_array_view<date_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag const, nations::country_tag>(m_8.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::disarmed_until>, date_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get, sizeof(date_tag));
 			 return m_9.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::disarmed_until>, date_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get, sizeof(date_tag));
 			 return m_9.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::disarmed_until>> {
+			 CONTAINER_ACCESS_RECORD(profile, 9, set, sizeof(date_tag));
 			 m_9.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::disarmed_until>> {
+			 CONTAINER_ACCESS_RECORD(profile, 9, set, sizeof(date_tag));
 			 m_9.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::disarmed_until>, tagged_array_view<date_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag, nations::country_tag>(m_9.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::disarmed_until>, tagged_array_view<date_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag const, nations::country_tag>(m_9.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::total_foreign_investment>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get, sizeof(float));
 			 return m_10.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::total_foreign_investment>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get, sizeof(float));
 			 return m_10.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::total_foreign_investment>> {
+			 CONTAINER_ACCESS_RECORD(profile, 10, set, sizeof(float));
 			 m_10.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::total_foreign_investment>> {
+			 CONTAINER_ACCESS_RECORD(profile, 10, set, sizeof(float));
 			 m_10.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::total_foreign_investment>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_10.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::total_foreign_investment>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_10.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::treasury>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get, sizeof(float));
 			 return m_11.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::treasury>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get, sizeof(float));
 			 return m_11.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::treasury>> {
+			 CONTAINER_ACCESS_RECORD(profile, 11, set, sizeof(float));
 			 m_11.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::treasury>> {
+			 CONTAINER_ACCESS_RECORD(profile, 11, set, sizeof(float));
 			 m_11.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::treasury>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_11.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::treasury>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_11.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::plurality>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get, sizeof(float));
 			 return m_12.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::plurality>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get, sizeof(float));
 			 return m_12.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::plurality>> {
+			 CONTAINER_ACCESS_RECORD(profile, 12, set, sizeof(float));
 			 m_12.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::plurality>> {
+			 CONTAINER_ACCESS_RECORD(profile, 12, set, sizeof(float));
 			 m_12.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::plurality>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_12.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::plurality>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_12.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::revanchism>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get, sizeof(float));
 			 return m_13.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::revanchism>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get, sizeof(float));
 			 return m_13.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::revanchism>> {
+			 CONTAINER_ACCESS_RECORD(profile, 13, set, sizeof(float));
 			 m_13.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::revanchism>> {
+			 CONTAINER_ACCESS_RECORD(profile, 13, set, sizeof(float));
 			 m_13.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::revanchism>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_13.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::revanchism>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_13.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::base_prestige>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 14, get, sizeof(float));
 			 return m_14.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::base_prestige>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 14, get, sizeof(float));
 			 return m_14.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::base_prestige>> {
+			 CONTAINER_ACCESS_RECORD(profile, 14, set, sizeof(float));
 			 m_14.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::base_prestige>> {
+			 CONTAINER_ACCESS_RECORD(profile, 14, set, sizeof(float));
 			 m_14.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::base_prestige>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 14, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_14.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::base_prestige>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 14, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_14.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::infamy>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 15, get, sizeof(float));
 			 return m_15.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::infamy>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 15, get, sizeof(float));
 			 return m_15.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::infamy>> {
+			 CONTAINER_ACCESS_RECORD(profile, 15, set, sizeof(float));
 			 m_15.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::infamy>> {
+			 CONTAINER_ACCESS_RECORD(profile, 15, set, sizeof(float));
 			 m_15.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::infamy>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 15, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_15.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::infamy>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 15, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_15.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::war_exhaustion>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 16, get, sizeof(float));
 			 return m_16.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::war_exhaustion>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 16, get, sizeof(float));
 			 return m_16.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::war_exhaustion>> {
+			 CONTAINER_ACCESS_RECORD(profile, 16, set, sizeof(float));
 			 m_16.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::war_exhaustion>> {
+			 CONTAINER_ACCESS_RECORD(profile, 16, set, sizeof(float));
 			 m_16.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::war_exhaustion>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 16, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_16.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::war_exhaustion>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 16, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_16.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::suppression_points>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 17, get, sizeof(float));
 			 return m_17.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::suppression_points>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 17, get, sizeof(float));
 			 return m_17.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::suppression_points>> {
+			 CONTAINER_ACCESS_RECORD(profile, 17, set, sizeof(float));
 			 m_17.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::suppression_points>> {
+			 CONTAINER_ACCESS_RECORD(profile, 17, set, sizeof(float));
 			 m_17.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::suppression_points>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 17, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_17.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::suppression_points>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 17, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_17.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::diplomacy_points>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 18, get, sizeof(float));
 			 return m_18.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::diplomacy_points>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 18, get, sizeof(float));
 			 return m_18.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::diplomacy_points>> {
+			 CONTAINER_ACCESS_RECORD(profile, 18, set, sizeof(float));
 			 m_18.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::diplomacy_points>> {
+			 CONTAINER_ACCESS_RECORD(profile, 18, set, sizeof(float));
 			 m_18.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::diplomacy_points>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 18, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_18.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::diplomacy_points>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 18, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_18.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::research_points>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 19, get, sizeof(float));
 			 return m_19.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::research_points>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 19, get, sizeof(float));
 			 return m_19.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::research_points>> {
+			 CONTAINER_ACCESS_RECORD(profile, 19, set, sizeof(float));
 			 m_19.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::research_points>> {
+			 CONTAINER_ACCESS_RECORD(profile, 19, set, sizeof(float));
 			 m_19.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::research_points>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 19, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_19.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::research_points>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 19, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_19.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_debt>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 20, get, sizeof(float));
 			 return m_20.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_debt>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 20, get, sizeof(float));
 			 return m_20.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::national_debt>> {
+			 CONTAINER_ACCESS_RECORD(profile, 20, set, sizeof(float));
 			 m_20.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::national_debt>> {
+			 CONTAINER_ACCESS_RECORD(profile, 20, set, sizeof(float));
 			 m_20.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_debt>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 20, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_20.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_debt>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 20, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_20.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::tax_base>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 21, get, sizeof(float));
 			 return m_21.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::tax_base>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 21, get, sizeof(float));
 			 return m_21.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::tax_base>> {
+			 CONTAINER_ACCESS_RECORD(profile, 21, set, sizeof(float));
 			 m_21.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::tax_base>> {
+			 CONTAINER_ACCESS_RECORD(profile, 21, set, sizeof(float));
 			 m_21.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::tax_base>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 21, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_21.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::tax_base>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 21, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_21.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::political_interest_fraction>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 22, get, sizeof(float));
 			 return m_22.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::political_interest_fraction>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 22, get, sizeof(float));
 			 return m_22.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::political_interest_fraction>> {
+			 CONTAINER_ACCESS_RECORD(profile, 22, set, sizeof(float));
 			 m_22.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::political_interest_fraction>> {
+			 CONTAINER_ACCESS_RECORD(profile, 22, set, sizeof(float));
 			 m_22.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::political_interest_fraction>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 22, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_22.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::political_interest_fraction>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 22, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_22.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::social_interest_fraction>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 23, get, sizeof(float));
 			 return m_23.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::social_interest_fraction>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 23, get, sizeof(float));
 			 return m_23.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::social_interest_fraction>> {
+			 CONTAINER_ACCESS_RECORD(profile, 23, set, sizeof(float));
 			 m_23.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::social_interest_fraction>> {
+			 CONTAINER_ACCESS_RECORD(profile, 23, set, sizeof(float));
 			 m_23.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::social_interest_fraction>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 23, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_23.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::social_interest_fraction>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 23, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_23.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_administrative_efficiency>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 24, get, sizeof(float));
 			 return m_24.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_administrative_efficiency>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 24, get, sizeof(float));
 			 return m_24.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::national_administrative_efficiency>> {
+			 CONTAINER_ACCESS_RECORD(profile, 24, set, sizeof(float));
 			 m_24.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::national_administrative_efficiency>> {
+			 CONTAINER_ACCESS_RECORD(profile, 24, set, sizeof(float));
 			 m_24.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_administrative_efficiency>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 24, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_24.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_administrative_efficiency>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 24, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_24.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::social_movement_support>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 25, get, sizeof(float));
 			 return m_25.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::social_movement_support>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 25, get, sizeof(float));
 			 return m_25.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::social_movement_support>> {
+			 CONTAINER_ACCESS_RECORD(profile, 25, set, sizeof(float));
 			 m_25.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::social_movement_support>> {
+			 CONTAINER_ACCESS_RECORD(profile, 25, set, sizeof(float));
 			 m_25.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::social_movement_support>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 25, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_25.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::social_movement_support>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 25, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_25.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::political_movement_support>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 26, get, sizeof(float));
 			 return m_26.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::political_movement_support>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 26, get, sizeof(float));
 			 return m_26.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::political_movement_support>> {
+			 CONTAINER_ACCESS_RECORD(profile, 26, set, sizeof(float));
 			 m_26.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::political_movement_support>> {
+			 CONTAINER_ACCESS_RECORD(profile, 26, set, sizeof(float));
 			 m_26.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::political_movement_support>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 26, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_26.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::political_movement_support>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 26, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_26.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::owned_provinces>, set_tag<provinces::province_tag>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 27, get, sizeof(set_tag<provinces::province_tag>));
 			 return m_27.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::owned_provinces>, set_tag<provinces::province_tag> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 27, get, sizeof(set_tag<provinces::province_tag>));
 			 return m_27.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::owned_provinces>> {
+			 CONTAINER_ACCESS_RECORD(profile, 27, set, sizeof(set_tag<provinces::province_tag>));
 			 m_27.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::owned_provinces>> {
+			 CONTAINER_ACCESS_RECORD(profile, 27, set, sizeof(set_tag<provinces::province_tag>));
 			 m_27.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::owned_provinces>, tagged_array_view<set_tag<provinces::province_tag>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 27, get_row, uint64_t(size_used) * sizeof(set_tag<provinces::province_tag>));
 			 return tagged_array_view<set_tag<provinces::province_tag>, nations::country_tag>(m_27.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::owned_provinces>, tagged_array_view<set_tag<provinces::province_tag> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 27, get_row, uint64_t(size_used) * sizeof(set_tag<provinces::province_tag>));
 			 return tagged_array_view<set_tag<provinces::province_tag> const, nations::country_tag>(m_27.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::controlled_provinces>, set_tag<provinces::province_tag>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 28, get, sizeof(set_tag<provinces::province_tag>));
 			 return m_28.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::controlled_provinces>, set_tag<provinces::province_tag> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 28, get, sizeof(set_tag<provinces::province_tag>));
 			 return m_28.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::controlled_provinces>> {
+			 CONTAINER_ACCESS_RECORD(profile, 28, set, sizeof(set_tag<provinces::province_tag>));
 			 m_28.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::controlled_provinces>> {
+			 CONTAINER_ACCESS_RECORD(profile, 28, set, sizeof(set_tag<provinces::province_tag>));
 			 m_28.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::controlled_provinces>, tagged_array_view<set_tag<provinces::province_tag>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 28, get_row, uint64_t(size_used) * sizeof(set_tag<provinces::province_tag>));
 			 return tagged_array_view<set_tag<provinces::province_tag>, nations::country_tag>(m_28.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::controlled_provinces>, tagged_array_view<set_tag<provinces::province_tag> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 28, get_row, uint64_t(size_used) * sizeof(set_tag<provinces::province_tag>));
 			 return tagged_array_view<set_tag<provinces::province_tag> const, nations::country_tag>(m_28.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::naval_patrols>, set_tag<provinces::province_tag>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 29, get, sizeof(set_tag<provinces::province_tag>));
 			 return m_29.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::naval_patrols>, set_tag<provinces::province_tag> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 29, get, sizeof(set_tag<provinces::province_tag>));
 			 return m_29.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::naval_patrols>> {
+			 CONTAINER_ACCESS_RECORD(profile, 29, set, sizeof(set_tag<provinces::province_tag>));
 			 m_29.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::naval_patrols>> {
+			 CONTAINER_ACCESS_RECORD(profile, 29, set, sizeof(set_tag<provinces::province_tag>));
 			 m_29.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::naval_patrols>, tagged_array_view<set_tag<provinces::province_tag>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 29, get_row, uint64_t(size_used) * sizeof(set_tag<provinces::province_tag>));
 			 return tagged_array_view<set_tag<provinces::province_tag>, nations::country_tag>(m_29.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::naval_patrols>, tagged_array_view<set_tag<provinces::province_tag> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 29, get_row, uint64_t(size_used) * sizeof(set_tag<provinces::province_tag>));
 			 return tagged_array_view<set_tag<provinces::province_tag> const, nations::country_tag>(m_29.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::sphere_members>, set_tag<nations::country_tag>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 30, get, sizeof(set_tag<nations::country_tag>));
 			 return m_30.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::sphere_members>, set_tag<nations::country_tag> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 30, get, sizeof(set_tag<nations::country_tag>));
 			 return m_30.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::sphere_members>> {
+			 CONTAINER_ACCESS_RECORD(profile, 30, set, sizeof(set_tag<nations::country_tag>));
 			 m_30.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::sphere_members>> {
+			 CONTAINER_ACCESS_RECORD(profile, 30, set, sizeof(set_tag<nations::country_tag>));
 			 m_30.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::sphere_members>, tagged_array_view<set_tag<nations::country_tag>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 30, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag>, nations::country_tag>(m_30.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::sphere_members>, tagged_array_view<set_tag<nations::country_tag> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 30, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag> const, nations::country_tag>(m_30.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::vassals>, set_tag<nations::country_tag>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 31, get, sizeof(set_tag<nations::country_tag>));
 			 return m_31.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::vassals>, set_tag<nations::country_tag> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 31, get, sizeof(set_tag<nations::country_tag>));
 			 return m_31.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::vassals>> {
+			 CONTAINER_ACCESS_RECORD(profile, 31, set, sizeof(set_tag<nations::country_tag>));
 			 m_31.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::vassals>> {
+			 CONTAINER_ACCESS_RECORD(profile, 31, set, sizeof(set_tag<nations::country_tag>));
 			 m_31.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::vassals>, tagged_array_view<set_tag<nations::country_tag>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 31, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag>, nations::country_tag>(m_31.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::vassals>, tagged_array_view<set_tag<nations::country_tag> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 31, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag> const, nations::country_tag>(m_31.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::allies>, set_tag<nations::country_tag>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 32, get, sizeof(set_tag<nations::country_tag>));
 			 return m_32.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::allies>, set_tag<nations::country_tag> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 32, get, sizeof(set_tag<nations::country_tag>));
 			 return m_32.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::allies>> {
+			 CONTAINER_ACCESS_RECORD(profile, 32, set, sizeof(set_tag<nations::country_tag>));
 			 m_32.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::allies>> {
+			 CONTAINER_ACCESS_RECORD(profile, 32, set, sizeof(set_tag<nations::country_tag>));
 			 m_32.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::allies>, tagged_array_view<set_tag<nations::country_tag>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 32, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag>, nations::country_tag>(m_32.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::allies>, tagged_array_view<set_tag<nations::country_tag> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 32, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag> const, nations::country_tag>(m_32.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::neighboring_nations>, set_tag<nations::country_tag>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 33, get, sizeof(set_tag<nations::country_tag>));
 			 return m_33.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::neighboring_nations>, set_tag<nations::country_tag> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 33, get, sizeof(set_tag<nations::country_tag>));
 			 return m_33.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::neighboring_nations>> {
+			 CONTAINER_ACCESS_RECORD(profile, 33, set, sizeof(set_tag<nations::country_tag>));
 			 m_33.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::neighboring_nations>> {
+			 CONTAINER_ACCESS_RECORD(profile, 33, set, sizeof(set_tag<nations::country_tag>));
 			 m_33.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::neighboring_nations>, tagged_array_view<set_tag<nations::country_tag>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 33, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag>, nations::country_tag>(m_33.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::neighboring_nations>, tagged_array_view<set_tag<nations::country_tag> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 33, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag> const, nations::country_tag>(m_33.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::accepted_cultures>, set_tag<cultures::culture_tag>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 34, get, sizeof(set_tag<cultures::culture_tag>));
 			 return m_34.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::accepted_cultures>, set_tag<cultures::culture_tag> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 34, get, sizeof(set_tag<cultures::culture_tag>));
 			 return m_34.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::accepted_cultures>> {
+			 CONTAINER_ACCESS_RECORD(profile, 34, set, sizeof(set_tag<cultures::culture_tag>));
 			 m_34.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::accepted_cultures>> {
+			 CONTAINER_ACCESS_RECORD(profile, 34, set, sizeof(set_tag<cultures::culture_tag>));
 			 m_34.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::accepted_cultures>, tagged_array_view<set_tag<cultures::culture_tag>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 34, get_row, uint64_t(size_used) * sizeof(set_tag<cultures::culture_tag>));
 			 return tagged_array_view<set_tag<cultures::culture_tag>, nations::country_tag>(m_34.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::accepted_cultures>, tagged_array_view<set_tag<cultures::culture_tag> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 34, get_row, uint64_t(size_used) * sizeof(set_tag<cultures::culture_tag>));
 			 return tagged_array_view<set_tag<cultures::culture_tag> const, nations::country_tag>(m_34.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::member_states>, set_tag<nations::region_state_pair>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 35, get, sizeof(set_tag<nations::region_state_pair>));
 			 return m_35.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::member_states>, set_tag<nations::region_state_pair> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 35, get, sizeof(set_tag<nations::region_state_pair>));
 			 return m_35.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::member_states>> {
+			 CONTAINER_ACCESS_RECORD(profile, 35, set, sizeof(set_tag<nations::region_state_pair>));
 			 m_35.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::member_states>> {
+			 CONTAINER_ACCESS_RECORD(profile, 35, set, sizeof(set_tag<nations::region_state_pair>));
 			 m_35.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::member_states>, tagged_array_view<set_tag<nations::region_state_pair>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 35, get_row, uint64_t(size_used) * sizeof(set_tag<nations::region_state_pair>));
 			 return tagged_array_view<set_tag<nations::region_state_pair>, nations::country_tag>(m_35.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::member_states>, tagged_array_view<set_tag<nations::region_state_pair> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 35, get_row, uint64_t(size_used) * sizeof(set_tag<nations::region_state_pair>));
 			 return tagged_array_view<set_tag<nations::region_state_pair> const, nations::country_tag>(m_35.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::gp_influence>, set_tag<nations::influence>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 36, get, sizeof(set_tag<nations::influence>));
 			 return m_36.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::gp_influence>, set_tag<nations::influence> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 36, get, sizeof(set_tag<nations::influence>));
 			 return m_36.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::gp_influence>> {
+			 CONTAINER_ACCESS_RECORD(profile, 36, set, sizeof(set_tag<nations::influence>));
 			 m_36.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::gp_influence>> {
+			 CONTAINER_ACCESS_RECORD(profile, 36, set, sizeof(set_tag<nations::influence>));
 			 m_36.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::gp_influence>, tagged_array_view<set_tag<nations::influence>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 36, get_row, uint64_t(size_used) * sizeof(set_tag<nations::influence>));
 			 return tagged_array_view<set_tag<nations::influence>, nations::country_tag>(m_36.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::gp_influence>, tagged_array_view<set_tag<nations::influence> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 36, get_row, uint64_t(size_used) * sizeof(set_tag<nations::influence>));
 			 return tagged_array_view<set_tag<nations::influence> const, nations::country_tag>(m_36.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::influencers>, set_tag<nations::country_tag>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 37, get, sizeof(set_tag<nations::country_tag>));
 			 return m_37.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::influencers>, set_tag<nations::country_tag> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 37, get, sizeof(set_tag<nations::country_tag>));
 			 return m_37.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::influencers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 37, set, sizeof(set_tag<nations::country_tag>));
 			 m_37.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::influencers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 37, set, sizeof(set_tag<nations::country_tag>));
 			 m_37.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::influencers>, tagged_array_view<set_tag<nations::country_tag>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 37, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag>, nations::country_tag>(m_37.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::influencers>, tagged_array_view<set_tag<nations::country_tag> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 37, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag> const, nations::country_tag>(m_37.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::relations>, set_tag<nations::relationship>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 38, get, sizeof(set_tag<nations::relationship>));
 			 return m_38.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::relations>, set_tag<nations::relationship> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 38, get, sizeof(set_tag<nations::relationship>));
 			 return m_38.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::relations>> {
+			 CONTAINER_ACCESS_RECORD(profile, 38, set, sizeof(set_tag<nations::relationship>));
 			 m_38.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::relations>> {
+			 CONTAINER_ACCESS_RECORD(profile, 38, set, sizeof(set_tag<nations::relationship>));
 			 m_38.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::relations>, tagged_array_view<set_tag<nations::relationship>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 38, get_row, uint64_t(size_used) * sizeof(set_tag<nations::relationship>));
 			 return tagged_array_view<set_tag<nations::relationship>, nations::country_tag>(m_38.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::relations>, tagged_array_view<set_tag<nations::relationship> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 38, get_row, uint64_t(size_used) * sizeof(set_tag<nations::relationship>));
 			 return tagged_array_view<set_tag<nations::relationship> const, nations::country_tag>(m_38.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::truces>, set_tag<nations::truce>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 39, get, sizeof(set_tag<nations::truce>));
 			 return m_39.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::truces>, set_tag<nations::truce> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 39, get, sizeof(set_tag<nations::truce>));
 			 return m_39.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::truces>> {
+			 CONTAINER_ACCESS_RECORD(profile, 39, set, sizeof(set_tag<nations::truce>));
 			 m_39.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::truces>> {
+			 CONTAINER_ACCESS_RECORD(profile, 39, set, sizeof(set_tag<nations::truce>));
 			 m_39.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::truces>, tagged_array_view<set_tag<nations::truce>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 39, get_row, uint64_t(size_used) * sizeof(set_tag<nations::truce>));
 			 return tagged_array_view<set_tag<nations::truce>, nations::country_tag>(m_39.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::truces>, tagged_array_view<set_tag<nations::truce> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 39, get_row, uint64_t(size_used) * sizeof(set_tag<nations::truce>));
 			 return tagged_array_view<set_tag<nations::truce> const, nations::country_tag>(m_39.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_focus_locations>, set_tag<nations::state_tag>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 40, get, sizeof(set_tag<nations::state_tag>));
 			 return m_40.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_focus_locations>, set_tag<nations::state_tag> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 40, get, sizeof(set_tag<nations::state_tag>));
 			 return m_40.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::national_focus_locations>> {
+			 CONTAINER_ACCESS_RECORD(profile, 40, set, sizeof(set_tag<nations::state_tag>));
 			 m_40.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::national_focus_locations>> {
+			 CONTAINER_ACCESS_RECORD(profile, 40, set, sizeof(set_tag<nations::state_tag>));
 			 m_40.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_focus_locations>, tagged_array_view<set_tag<nations::state_tag>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 40, get_row, uint64_t(size_used) * sizeof(set_tag<nations::state_tag>));
 			 return tagged_array_view<set_tag<nations::state_tag>, nations::country_tag>(m_40.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_focus_locations>, tagged_array_view<set_tag<nations::state_tag> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 40, get_row, uint64_t(size_used) * sizeof(set_tag<nations::state_tag>));
 			 return tagged_array_view<set_tag<nations::state_tag> const, nations::country_tag>(m_40.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_flags>, set_tag<variables::national_flag_tag>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 41, get, sizeof(set_tag<variables::national_flag_tag>));
 			 return m_41.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_flags>, set_tag<variables::national_flag_tag> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 41, get, sizeof(set_tag<variables::national_flag_tag>));
 			 return m_41.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::national_flags>> {
+			 CONTAINER_ACCESS_RECORD(profile, 41, set, sizeof(set_tag<variables::national_flag_tag>));
 			 m_41.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::national_flags>> {
+			 CONTAINER_ACCESS_RECORD(profile, 41, set, sizeof(set_tag<variables::national_flag_tag>));
 			 m_41.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_flags>, tagged_array_view<set_tag<variables::national_flag_tag>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 41, get_row, uint64_t(size_used) * sizeof(set_tag<variables::national_flag_tag>));
 			 return tagged_array_view<set_tag<variables::national_flag_tag>, nations::country_tag>(m_41.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_flags>, tagged_array_view<set_tag<variables::national_flag_tag> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 41, get_row, uint64_t(size_used) * sizeof(set_tag<variables::national_flag_tag>));
 			 return tagged_array_view<set_tag<variables::national_flag_tag> const, nations::country_tag>(m_41.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::static_modifiers>, multiset_tag<modifiers::national_modifier_tag>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 42, get, sizeof(multiset_tag<modifiers::national_modifier_tag>));
 			 return m_42.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::static_modifiers>, multiset_tag<modifiers::national_modifier_tag> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 42, get, sizeof(multiset_tag<modifiers::national_modifier_tag>));
 			 return m_42.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::static_modifiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 42, set, sizeof(multiset_tag<modifiers::national_modifier_tag>));
 			 m_42.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::static_modifiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 42, set, sizeof(multiset_tag<modifiers::national_modifier_tag>));
 			 m_42.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::static_modifiers>, tagged_array_view<multiset_tag<modifiers::national_modifier_tag>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 42, get_row, uint64_t(size_used) * sizeof(multiset_tag<modifiers::national_modifier_tag>));
 			 return tagged_array_view<multiset_tag<modifiers::national_modifier_tag>, nations::country_tag>(m_42.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::static_modifiers>, tagged_array_view<multiset_tag<modifiers::national_modifier_tag> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 42, get_row, uint64_t(size_used) * sizeof(multiset_tag<modifiers::national_modifier_tag>));
 			 return tagged_array_view<multiset_tag<modifiers::national_modifier_tag> const, nations::country_tag>(m_42.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::timed_modifiers>, multiset_tag<nations::timed_national_modifier>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 43, get, sizeof(multiset_tag<nations::timed_national_modifier>));
 			 return m_43.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::timed_modifiers>, multiset_tag<nations::timed_national_modifier> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 43, get, sizeof(multiset_tag<nations::timed_national_modifier>));
 			 return m_43.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::timed_modifiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 43, set, sizeof(multiset_tag<nations::timed_national_modifier>));
 			 m_43.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::timed_modifiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 43, set, sizeof(multiset_tag<nations::timed_national_modifier>));
 			 m_43.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::timed_modifiers>, tagged_array_view<multiset_tag<nations::timed_national_modifier>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 43, get_row, uint64_t(size_used) * sizeof(multiset_tag<nations::timed_national_modifier>));
 			 return tagged_array_view<multiset_tag<nations::timed_national_modifier>, nations::country_tag>(m_43.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::timed_modifiers>, tagged_array_view<multiset_tag<nations::timed_national_modifier> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 43, get_row, uint64_t(size_used) * sizeof(multiset_tag<nations::timed_national_modifier>));
 			 return tagged_array_view<multiset_tag<nations::timed_national_modifier> const, nations::country_tag>(m_43.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::statewise_tariff_mask>, array_tag<economy::money_qnty_type, nations::state_tag, true>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 44, get, sizeof(array_tag<economy::money_qnty_type, nations::state_tag, true>));
 			 return m_44.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::statewise_tariff_mask>, array_tag<economy::money_qnty_type, nations::state_tag, true> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 44, get, sizeof(array_tag<economy::money_qnty_type, nations::state_tag, true>));
 			 return m_44.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::statewise_tariff_mask>> {
+			 CONTAINER_ACCESS_RECORD(profile, 44, set, sizeof(array_tag<economy::money_qnty_type, nations::state_tag, true>));
 			 m_44.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::statewise_tariff_mask>> {
+			 CONTAINER_ACCESS_RECORD(profile, 44, set, sizeof(array_tag<economy::money_qnty_type, nations::state_tag, true>));
 			 m_44.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::statewise_tariff_mask>, tagged_array_view<array_tag<economy::money_qnty_type, nations::state_tag, true>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 44, get_row, uint64_t(size_used) * sizeof(array_tag<economy::money_qnty_type, nations::state_tag, true>));
 			 return tagged_array_view<array_tag<economy::money_qnty_type, nations::state_tag, true>, nations::country_tag>(m_44.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::statewise_tariff_mask>, tagged_array_view<array_tag<economy::money_qnty_type, nations::state_tag, true> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 44, get_row, uint64_t(size_used) * sizeof(array_tag<economy::money_qnty_type, nations::state_tag, true>));
 			 return tagged_array_view<array_tag<economy::money_qnty_type, nations::state_tag, true> const, nations::country_tag>(m_44.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::generals>, array_tag<military::leader_tag, int32_t, false>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 45, get, sizeof(array_tag<military::leader_tag, int32_t, false>));
 			 return m_45.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::generals>, array_tag<military::leader_tag, int32_t, false> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 45, get, sizeof(array_tag<military::leader_tag, int32_t, false>));
 			 return m_45.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::generals>> {
+			 CONTAINER_ACCESS_RECORD(profile, 45, set, sizeof(array_tag<military::leader_tag, int32_t, false>));
 			 m_45.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::generals>> {
+			 CONTAINER_ACCESS_RECORD(profile, 45, set, sizeof(array_tag<military::leader_tag, int32_t, false>));
 			 m_45.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::generals>, tagged_array_view<array_tag<military::leader_tag, int32_t, false>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 45, get_row, uint64_t(size_used) * sizeof(array_tag<military::leader_tag, int32_t, false>));
 			 return tagged_array_view<array_tag<military::leader_tag, int32_t, false>, nations::country_tag>(m_45.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::generals>, tagged_array_view<array_tag<military::leader_tag, int32_t, false> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 45, get_row, uint64_t(size_used) * sizeof(array_tag<military::leader_tag, int32_t, false>));
 			 return tagged_array_view<array_tag<military::leader_tag, int32_t, false> const, nations::country_tag>(m_45.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::admirals>, array_tag<military::leader_tag, int32_t, false>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 46, get, sizeof(array_tag<military::leader_tag, int32_t, false>));
 			 return m_46.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::admirals>, array_tag<military::leader_tag, int32_t, false> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 46, get, sizeof(array_tag<military::leader_tag, int32_t, false>));
 			 return m_46.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::admirals>> {
+			 CONTAINER_ACCESS_RECORD(profile, 46, set, sizeof(array_tag<military::leader_tag, int32_t, false>));
 			 m_46.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::admirals>> {
+			 CONTAINER_ACCESS_RECORD(profile, 46, set, sizeof(array_tag<military::leader_tag, int32_t, false>));
 			 m_46.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::admirals>, tagged_array_view<array_tag<military::leader_tag, int32_t, false>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 46, get_row, uint64_t(size_used) * sizeof(array_tag<military::leader_tag, int32_t, false>));
 			 return tagged_array_view<array_tag<military::leader_tag, int32_t, false>, nations::country_tag>(m_46.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::admirals>, tagged_array_view<array_tag<military::leader_tag, int32_t, false> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 46, get_row, uint64_t(size_used) * sizeof(array_tag<military::leader_tag, int32_t, false>));
 			 return tagged_array_view<array_tag<military::leader_tag, int32_t, false> const, nations::country_tag>(m_46.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::armies>, array_tag<military::army_tag, int32_t, false>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 47, get, sizeof(array_tag<military::army_tag, int32_t, false>));
 			 return m_47.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::armies>, array_tag<military::army_tag, int32_t, false> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 47, get, sizeof(array_tag<military::army_tag, int32_t, false>));
 			 return m_47.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::armies>> {
+			 CONTAINER_ACCESS_RECORD(profile, 47, set, sizeof(array_tag<military::army_tag, int32_t, false>));
 			 m_47.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::armies>> {
+			 CONTAINER_ACCESS_RECORD(profile, 47, set, sizeof(array_tag<military::army_tag, int32_t, false>));
 			 m_47.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::armies>, tagged_array_view<array_tag<military::army_tag, int32_t, false>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 47, get_row, uint64_t(size_used) * sizeof(array_tag<military::army_tag, int32_t, false>));
 			 return tagged_array_view<array_tag<military::army_tag, int32_t, false>, nations::country_tag>(m_47.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::armies>, tagged_array_view<array_tag<military::army_tag, int32_t, false> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 47, get_row, uint64_t(size_used) * sizeof(array_tag<military::army_tag, int32_t, false>));
 			 return tagged_array_view<array_tag<military::army_tag, int32_t, false> const, nations::country_tag>(m_47.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::fleets>, array_tag<military::fleet_tag, int32_t, false>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 48, get, sizeof(array_tag<military::fleet_tag, int32_t, false>));
 			 return m_48.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::fleets>, array_tag<military::fleet_tag, int32_t, false> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 48, get, sizeof(array_tag<military::fleet_tag, int32_t, false>));
 			 return m_48.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::fleets>> {
+			 CONTAINER_ACCESS_RECORD(profile, 48, set, sizeof(array_tag<military::fleet_tag, int32_t, false>));
 			 m_48.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::fleets>> {
+			 CONTAINER_ACCESS_RECORD(profile, 48, set, sizeof(array_tag<military::fleet_tag, int32_t, false>));
 			 m_48.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::fleets>, tagged_array_view<array_tag<military::fleet_tag, int32_t, false>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 48, get_row, uint64_t(size_used) * sizeof(array_tag<military::fleet_tag, int32_t, false>));
 			 return tagged_array_view<array_tag<military::fleet_tag, int32_t, false>, nations::country_tag>(m_48.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::fleets>, tagged_array_view<array_tag<military::fleet_tag, int32_t, false> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 48, get_row, uint64_t(size_used) * sizeof(array_tag<military::fleet_tag, int32_t, false>));
 			 return tagged_array_view<array_tag<military::fleet_tag, int32_t, false> const, nations::country_tag>(m_48.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::active_orders>, array_tag<military::army_orders_tag, int32_t, false>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 49, get, sizeof(array_tag<military::army_orders_tag, int32_t, false>));
 			 return m_49.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::active_orders>, array_tag<military::army_orders_tag, int32_t, false> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 49, get, sizeof(array_tag<military::army_orders_tag, int32_t, false>));
 			 return m_49.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::active_orders>> {
+			 CONTAINER_ACCESS_RECORD(profile, 49, set, sizeof(array_tag<military::army_orders_tag, int32_t, false>));
 			 m_49.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::active_orders>> {
+			 CONTAINER_ACCESS_RECORD(profile, 49, set, sizeof(array_tag<military::army_orders_tag, int32_t, false>));
 			 m_49.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::active_orders>, tagged_array_view<array_tag<military::army_orders_tag, int32_t, false>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 49, get_row, uint64_t(size_used) * sizeof(array_tag<military::army_orders_tag, int32_t, false>));
 			 return tagged_array_view<array_tag<military::army_orders_tag, int32_t, false>, nations::country_tag>(m_49.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::active_orders>, tagged_array_view<array_tag<military::army_orders_tag, int32_t, false> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 49, get_row, uint64_t(size_used) * sizeof(array_tag<military::army_orders_tag, int32_t, false>));
 			 return tagged_array_view<array_tag<military::army_orders_tag, int32_t, false> const, nations::country_tag>(m_49.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::strategic_hqs>, array_tag<military::strategic_hq_tag, int32_t, false>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 50, get, sizeof(array_tag<military::strategic_hq_tag, int32_t, false>));
 			 return m_50.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::strategic_hqs>, array_tag<military::strategic_hq_tag, int32_t, false> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 50, get, sizeof(array_tag<military::strategic_hq_tag, int32_t, false>));
 			 return m_50.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::strategic_hqs>> {
+			 CONTAINER_ACCESS_RECORD(profile, 50, set, sizeof(array_tag<military::strategic_hq_tag, int32_t, false>));
 			 m_50.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::strategic_hqs>> {
+			 CONTAINER_ACCESS_RECORD(profile, 50, set, sizeof(array_tag<military::strategic_hq_tag, int32_t, false>));
 			 m_50.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::strategic_hqs>, tagged_array_view<array_tag<military::strategic_hq_tag, int32_t, false>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 50, get_row, uint64_t(size_used) * sizeof(array_tag<military::strategic_hq_tag, int32_t, false>));
 			 return tagged_array_view<array_tag<military::strategic_hq_tag, int32_t, false>, nations::country_tag>(m_50.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::strategic_hqs>, tagged_array_view<array_tag<military::strategic_hq_tag, int32_t, false> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 50, get_row, uint64_t(size_used) * sizeof(array_tag<military::strategic_hq_tag, int32_t, false>));
 			 return tagged_array_view<array_tag<military::strategic_hq_tag, int32_t, false> const, nations::country_tag>(m_50.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::active_cbs>, array_tag<military::pending_cb, int32_t, false>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 51, get, sizeof(array_tag<military::pending_cb, int32_t, false>));
 			 return m_51.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::active_cbs>, array_tag<military::pending_cb, int32_t, false> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 51, get, sizeof(array_tag<military::pending_cb, int32_t, false>));
 			 return m_51.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::active_cbs>> {
+			 CONTAINER_ACCESS_RECORD(profile, 51, set, sizeof(array_tag<military::pending_cb, int32_t, false>));
 			 m_51.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::active_cbs>> {
+			 CONTAINER_ACCESS_RECORD(profile, 51, set, sizeof(array_tag<military::pending_cb, int32_t, false>));
 			 m_51.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::active_cbs>, tagged_array_view<array_tag<military::pending_cb, int32_t, false>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 51, get_row, uint64_t(size_used) * sizeof(array_tag<military::pending_cb, int32_t, false>));
 			 return tagged_array_view<array_tag<military::pending_cb, int32_t, false>, nations::country_tag>(m_51.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::active_cbs>, tagged_array_view<array_tag<military::pending_cb, int32_t, false> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 51, get_row, uint64_t(size_used) * sizeof(array_tag<military::pending_cb, int32_t, false>));
 			 return tagged_array_view<array_tag<military::pending_cb, int32_t, false> const, nations::country_tag>(m_51.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::wars_involved_in>, set_tag<military::war_identifier>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 52, get, sizeof(set_tag<military::war_identifier>));
 			 return m_52.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::wars_involved_in>, set_tag<military::war_identifier> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 52, get, sizeof(set_tag<military::war_identifier>));
 			 return m_52.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::wars_involved_in>> {
+			 CONTAINER_ACCESS_RECORD(profile, 52, set, sizeof(set_tag<military::war_identifier>));
 			 m_52.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::wars_involved_in>> {
+			 CONTAINER_ACCESS_RECORD(profile, 52, set, sizeof(set_tag<military::war_identifier>));
 			 m_52.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::wars_involved_in>, tagged_array_view<set_tag<military::war_identifier>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 52, get_row, uint64_t(size_used) * sizeof(set_tag<military::war_identifier>));
 			 return tagged_array_view<set_tag<military::war_identifier>, nations::country_tag>(m_52.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::wars_involved_in>, tagged_array_view<set_tag<military::war_identifier> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 52, get_row, uint64_t(size_used) * sizeof(set_tag<military::war_identifier>));
 			 return tagged_array_view<set_tag<military::war_identifier> const, nations::country_tag>(m_52.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::opponents_in_war>, set_tag<nations::country_tag>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 53, get, sizeof(set_tag<nations::country_tag>));
 			 return m_53.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::opponents_in_war>, set_tag<nations::country_tag> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 53, get, sizeof(set_tag<nations::country_tag>));
 			 return m_53.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::opponents_in_war>> {
+			 CONTAINER_ACCESS_RECORD(profile, 53, set, sizeof(set_tag<nations::country_tag>));
 			 m_53.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::opponents_in_war>> {
+			 CONTAINER_ACCESS_RECORD(profile, 53, set, sizeof(set_tag<nations::country_tag>));
 			 m_53.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::opponents_in_war>, tagged_array_view<set_tag<nations::country_tag>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 53, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag>, nations::country_tag>(m_53.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::opponents_in_war>, tagged_array_view<set_tag<nations::country_tag> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 53, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag> const, nations::country_tag>(m_53.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::allies_in_war>, set_tag<nations::country_tag>&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 54, get, sizeof(set_tag<nations::country_tag>));
 			 return m_54.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::allies_in_war>, set_tag<nations::country_tag> const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 54, get, sizeof(set_tag<nations::country_tag>));
 			 return m_54.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::allies_in_war>> {
+			 CONTAINER_ACCESS_RECORD(profile, 54, set, sizeof(set_tag<nations::country_tag>));
 			 m_54.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::allies_in_war>> {
+			 CONTAINER_ACCESS_RECORD(profile, 54, set, sizeof(set_tag<nations::country_tag>));
 			 m_54.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::allies_in_war>, tagged_array_view<set_tag<nations::country_tag>, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 54, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag>, nations::country_tag>(m_54.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::allies_in_war>, tagged_array_view<set_tag<nations::country_tag> const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 54, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag> const, nations::country_tag>(m_54.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::name>, text_data::text_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 55, get, sizeof(text_data::text_tag));
 			 return m_55.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::name>, text_data::text_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 55, get, sizeof(text_data::text_tag));
 			 return m_55.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::name>> {
+			 CONTAINER_ACCESS_RECORD(profile, 55, set, sizeof(text_data::text_tag));
 			 m_55.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::name>> {
+			 CONTAINER_ACCESS_RECORD(profile, 55, set, sizeof(text_data::text_tag));
 			 m_55.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::name>, tagged_array_view<text_data::text_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 55, get_row, uint64_t(size_used) * sizeof(text_data::text_tag));
 			 return tagged_array_view<text_data::text_tag, nations::country_tag>(m_55.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::name>, tagged_array_view<text_data::text_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 55, get_row, uint64_t(size_used) * sizeof(text_data::text_tag));
 			 return tagged_array_view<text_data::text_tag const, nations::country_tag>(m_55.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::adjective>, text_data::text_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 56, get, sizeof(text_data::text_tag));
 			 return m_56.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::adjective>, text_data::text_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 56, get, sizeof(text_data::text_tag));
 			 return m_56.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::adjective>> {
+			 CONTAINER_ACCESS_RECORD(profile, 56, set, sizeof(text_data::text_tag));
 			 m_56.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::adjective>> {
+			 CONTAINER_ACCESS_RECORD(profile, 56, set, sizeof(text_data::text_tag));
 			 m_56.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::adjective>, tagged_array_view<text_data::text_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 56, get_row, uint64_t(size_used) * sizeof(text_data::text_tag));
 			 return tagged_array_view<text_data::text_tag, nations::country_tag>(m_56.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::adjective>, tagged_array_view<text_data::text_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 56, get_row, uint64_t(size_used) * sizeof(text_data::text_tag));
 			 return tagged_array_view<text_data::text_tag const, nations::country_tag>(m_56.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_value>, modifiers::national_modifier_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 57, get, sizeof(modifiers::national_modifier_tag));
 			 return m_57.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_value>, modifiers::national_modifier_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 57, get, sizeof(modifiers::national_modifier_tag));
 			 return m_57.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::national_value>> {
+			 CONTAINER_ACCESS_RECORD(profile, 57, set, sizeof(modifiers::national_modifier_tag));
 			 m_57.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::national_value>> {
+			 CONTAINER_ACCESS_RECORD(profile, 57, set, sizeof(modifiers::national_modifier_tag));
 			 m_57.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_value>, tagged_array_view<modifiers::national_modifier_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 57, get_row, uint64_t(size_used) * sizeof(modifiers::national_modifier_tag));
 			 return tagged_array_view<modifiers::national_modifier_tag, nations::country_tag>(m_57.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_value>, tagged_array_view<modifiers::national_modifier_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 57, get_row, uint64_t(size_used) * sizeof(modifiers::national_modifier_tag));
 			 return tagged_array_view<modifiers::national_modifier_tag const, nations::country_tag>(m_57.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::tech_school>, modifiers::national_modifier_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 58, get, sizeof(modifiers::national_modifier_tag));
 			 return m_58.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::tech_school>, modifiers::national_modifier_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 58, get, sizeof(modifiers::national_modifier_tag));
 			 return m_58.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::tech_school>> {
+			 CONTAINER_ACCESS_RECORD(profile, 58, set, sizeof(modifiers::national_modifier_tag));
 			 m_58.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::tech_school>> {
+			 CONTAINER_ACCESS_RECORD(profile, 58, set, sizeof(modifiers::national_modifier_tag));
 			 m_58.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::tech_school>, tagged_array_view<modifiers::national_modifier_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 58, get_row, uint64_t(size_used) * sizeof(modifiers::national_modifier_tag));
 			 return tagged_array_view<modifiers::national_modifier_tag, nations::country_tag>(m_58.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::tech_school>, tagged_array_view<modifiers::national_modifier_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 58, get_row, uint64_t(size_used) * sizeof(modifiers::national_modifier_tag));
 			 return tagged_array_view<modifiers::national_modifier_tag const, nations::country_tag>(m_58.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::flag>, graphics::texture_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 59, get, sizeof(graphics::texture_tag));
 			 return m_59.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::flag>, graphics::texture_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 59, get, sizeof(graphics::texture_tag));
 			 return m_59.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::flag>> {
+			 CONTAINER_ACCESS_RECORD(profile, 59, set, sizeof(graphics::texture_tag));
 			 m_59.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::flag>> {
+			 CONTAINER_ACCESS_RECORD(profile, 59, set, sizeof(graphics::texture_tag));
 			 m_59.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::flag>, tagged_array_view<graphics::texture_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 59, get_row, uint64_t(size_used) * sizeof(graphics::texture_tag));
 			 return tagged_array_view<graphics::texture_tag, nations::country_tag>(m_59.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::flag>, tagged_array_view<graphics::texture_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 59, get_row, uint64_t(size_used) * sizeof(graphics::texture_tag));
 			 return tagged_array_view<graphics::texture_tag const, nations::country_tag>(m_59.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_color>, graphics::color_rgb&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 60, get, sizeof(graphics::color_rgb));
 			 return m_60.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_color>, graphics::color_rgb const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 60, get, sizeof(graphics::color_rgb));
 			 return m_60.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::current_color>> {
+			 CONTAINER_ACCESS_RECORD(profile, 60, set, sizeof(graphics::color_rgb));
 			 m_60.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::current_color>> {
+			 CONTAINER_ACCESS_RECORD(profile, 60, set, sizeof(graphics::color_rgb));
 			 m_60.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_color>, tagged_array_view<graphics::color_rgb, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 60, get_row, uint64_t(size_used) * sizeof(graphics::color_rgb));
 			 return tagged_array_view<graphics::color_rgb, nations::country_tag>(m_60.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_color>, tagged_array_view<graphics::color_rgb const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 60, get_row, uint64_t(size_used) * sizeof(graphics::color_rgb));
 			 return tagged_array_view<graphics::color_rgb const, nations::country_tag>(m_60.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_research>, technologies::tech_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 61, get, sizeof(technologies::tech_tag));
 			 return m_61.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_research>, technologies::tech_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 61, get, sizeof(technologies::tech_tag));
 			 return m_61.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::current_research>> {
+			 CONTAINER_ACCESS_RECORD(profile, 61, set, sizeof(technologies::tech_tag));
 			 m_61.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::current_research>> {
+			 CONTAINER_ACCESS_RECORD(profile, 61, set, sizeof(technologies::tech_tag));
 			 m_61.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_research>, tagged_array_view<technologies::tech_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 61, get_row, uint64_t(size_used) * sizeof(technologies::tech_tag));
 			 return tagged_array_view<technologies::tech_tag, nations::country_tag>(m_61.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_research>, tagged_array_view<technologies::tech_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 61, get_row, uint64_t(size_used) * sizeof(technologies::tech_tag));
 			 return tagged_array_view<technologies::tech_tag const, nations::country_tag>(m_61.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::military_score>, int16_t&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 62, get, sizeof(int16_t));
 			 return m_62.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::military_score>, int16_t const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 62, get, sizeof(int16_t));
 			 return m_62.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::military_score>> {
+			 CONTAINER_ACCESS_RECORD(profile, 62, set, sizeof(int16_t));
 			 m_62.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::military_score>> {
+			 CONTAINER_ACCESS_RECORD(profile, 62, set, sizeof(int16_t));
 			 m_62.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::military_score>, tagged_array_view<int16_t, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 62, get_row, uint64_t(size_used) * sizeof(int16_t));
 			 return tagged_array_view<int16_t, nations::country_tag>(m_62.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::military_score>, tagged_array_view<int16_t const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 62, get_row, uint64_t(size_used) * sizeof(int16_t));
 			 return tagged_array_view<int16_t const, nations::country_tag>(m_62.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::industrial_score>, int16_t&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 63, get, sizeof(int16_t));
 			 return m_63.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::industrial_score>, int16_t const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 63, get, sizeof(int16_t));
 			 return m_63.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::industrial_score>> {
+			 CONTAINER_ACCESS_RECORD(profile, 63, set, sizeof(int16_t));
 			 m_63.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::industrial_score>> {
+			 CONTAINER_ACCESS_RECORD(profile, 63, set, sizeof(int16_t));
 			 m_63.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::industrial_score>, tagged_array_view<int16_t, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 63, get_row, uint64_t(size_used) * sizeof(int16_t));
 			 return tagged_array_view<int16_t, nations::country_tag>(m_63.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::industrial_score>, tagged_array_view<int16_t const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 63, get_row, uint64_t(size_used) * sizeof(int16_t));
 			 return tagged_array_view<int16_t const, nations::country_tag>(m_63.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::overall_rank>, int16_t&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 64, get, sizeof(int16_t));
 			 return m_64.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::overall_rank>, int16_t const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 64, get, sizeof(int16_t));
 			 return m_64.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::overall_rank>> {
+			 CONTAINER_ACCESS_RECORD(profile, 64, set, sizeof(int16_t));
 			 m_64.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::overall_rank>> {
+			 CONTAINER_ACCESS_RECORD(profile, 64, set, sizeof(int16_t));
 			 m_64.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::overall_rank>, tagged_array_view<int16_t, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 64, get_row, uint64_t(size_used) * sizeof(int16_t));
 			 return tagged_array_view<int16_t, nations::country_tag>(m_64.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::overall_rank>, tagged_array_view<int16_t const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 64, get_row, uint64_t(size_used) * sizeof(int16_t));
 			 return tagged_array_view<int16_t const, nations::country_tag>(m_64.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::prestige_rank>, int16_t&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 65, get, sizeof(int16_t));
 			 return m_65.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::prestige_rank>, int16_t const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 65, get, sizeof(int16_t));
 			 return m_65.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::prestige_rank>> {
+			 CONTAINER_ACCESS_RECORD(profile, 65, set, sizeof(int16_t));
 			 m_65.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::prestige_rank>> {
+			 CONTAINER_ACCESS_RECORD(profile, 65, set, sizeof(int16_t));
 			 m_65.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::prestige_rank>, tagged_array_view<int16_t, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 65, get_row, uint64_t(size_used) * sizeof(int16_t));
 			 return tagged_array_view<int16_t, nations::country_tag>(m_65.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::prestige_rank>, tagged_array_view<int16_t const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 65, get_row, uint64_t(size_used) * sizeof(int16_t));
 			 return tagged_array_view<int16_t const, nations::country_tag>(m_65.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::military_rank>, int16_t&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 66, get, sizeof(int16_t));
 			 return m_66.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::military_rank>, int16_t const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 66, get, sizeof(int16_t));
 			 return m_66.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::military_rank>> {
+			 CONTAINER_ACCESS_RECORD(profile, 66, set, sizeof(int16_t));
 			 m_66.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::military_rank>> {
+			 CONTAINER_ACCESS_RECORD(profile, 66, set, sizeof(int16_t));
 			 m_66.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::military_rank>, tagged_array_view<int16_t, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 66, get_row, uint64_t(size_used) * sizeof(int16_t));
 			 return tagged_array_view<int16_t, nations::country_tag>(m_66.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::military_rank>, tagged_array_view<int16_t const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 66, get_row, uint64_t(size_used) * sizeof(int16_t));
 			 return tagged_array_view<int16_t const, nations::country_tag>(m_66.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::industrial_rank>, int16_t&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 67, get, sizeof(int16_t));
 			 return m_67.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::industrial_rank>, int16_t const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 67, get, sizeof(int16_t));
 			 return m_67.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::industrial_rank>> {
+			 CONTAINER_ACCESS_RECORD(profile, 67, set, sizeof(int16_t));
 			 m_67.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::industrial_rank>> {
+			 CONTAINER_ACCESS_RECORD(profile, 67, set, sizeof(int16_t));
 			 m_67.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::industrial_rank>, tagged_array_view<int16_t, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 67, get_row, uint64_t(size_used) * sizeof(int16_t));
 			 return tagged_array_view<int16_t, nations::country_tag>(m_67.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::industrial_rank>, tagged_array_view<int16_t const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 67, get_row, uint64_t(size_used) * sizeof(int16_t));
 			 return tagged_array_view<int16_t const, nations::country_tag>(m_67.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::province_count>, uint16_t&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 68, get, sizeof(uint16_t));
 			 return m_68.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::province_count>, uint16_t const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 68, get, sizeof(uint16_t));
 			 return m_68.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::province_count>> {
+			 CONTAINER_ACCESS_RECORD(profile, 68, set, sizeof(uint16_t));
 			 m_68.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::province_count>> {
+			 CONTAINER_ACCESS_RECORD(profile, 68, set, sizeof(uint16_t));
 			 m_68.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::province_count>, tagged_array_view<uint16_t, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 68, get_row, uint64_t(size_used) * sizeof(uint16_t));
 			 return tagged_array_view<uint16_t, nations::country_tag>(m_68.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::province_count>, tagged_array_view<uint16_t const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 68, get_row, uint64_t(size_used) * sizeof(uint16_t));
 			 return tagged_array_view<uint16_t const, nations::country_tag>(m_68.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::central_province_count>, uint16_t&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 69, get, sizeof(uint16_t));
 			 return m_69.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::central_province_count>, uint16_t const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 69, get, sizeof(uint16_t));
 			 return m_69.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::central_province_count>> {
+			 CONTAINER_ACCESS_RECORD(profile, 69, set, sizeof(uint16_t));
 			 m_69.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::central_province_count>> {
+			 CONTAINER_ACCESS_RECORD(profile, 69, set, sizeof(uint16_t));
 			 m_69.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::central_province_count>, tagged_array_view<uint16_t, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 69, get_row, uint64_t(size_used) * sizeof(uint16_t));
 			 return tagged_array_view<uint16_t, nations::country_tag>(m_69.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::central_province_count>, tagged_array_view<uint16_t const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 69, get_row, uint64_t(size_used) * sizeof(uint16_t));
 			 return tagged_array_view<uint16_t const, nations::country_tag>(m_69.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::rebel_controlled_provinces>, uint16_t&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 70, get, sizeof(uint16_t));
 			 return m_70.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::rebel_controlled_provinces>, uint16_t const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 70, get, sizeof(uint16_t));
 			 return m_70.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::rebel_controlled_provinces>> {
+			 CONTAINER_ACCESS_RECORD(profile, 70, set, sizeof(uint16_t));
 			 m_70.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::rebel_controlled_provinces>> {
+			 CONTAINER_ACCESS_RECORD(profile, 70, set, sizeof(uint16_t));
 			 m_70.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::rebel_controlled_provinces>, tagged_array_view<uint16_t, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 70, get_row, uint64_t(size_used) * sizeof(uint16_t));
 			 return tagged_array_view<uint16_t, nations::country_tag>(m_70.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::rebel_controlled_provinces>, tagged_array_view<uint16_t const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 70, get_row, uint64_t(size_used) * sizeof(uint16_t));
 			 return tagged_array_view<uint16_t const, nations::country_tag>(m_70.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::blockaded_count>, uint16_t&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 71, get, sizeof(uint16_t));
 			 return m_71.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::blockaded_count>, uint16_t const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 71, get, sizeof(uint16_t));
 			 return m_71.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::blockaded_count>> {
+			 CONTAINER_ACCESS_RECORD(profile, 71, set, sizeof(uint16_t));
 			 m_71.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::blockaded_count>> {
+			 CONTAINER_ACCESS_RECORD(profile, 71, set, sizeof(uint16_t));
 			 m_71.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::blockaded_count>, tagged_array_view<uint16_t, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 71, get_row, uint64_t(size_used) * sizeof(uint16_t));
 			 return tagged_array_view<uint16_t, nations::country_tag>(m_71.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::blockaded_count>, tagged_array_view<uint16_t const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 71, get_row, uint64_t(size_used) * sizeof(uint16_t));
 			 return tagged_array_view<uint16_t const, nations::country_tag>(m_71.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::crime_count>, uint16_t&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 72, get, sizeof(uint16_t));
 			 return m_72.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::crime_count>, uint16_t const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 72, get, sizeof(uint16_t));
 			 return m_72.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::crime_count>> {
+			 CONTAINER_ACCESS_RECORD(profile, 72, set, sizeof(uint16_t));
 			 m_72.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::crime_count>> {
+			 CONTAINER_ACCESS_RECORD(profile, 72, set, sizeof(uint16_t));
 			 m_72.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::crime_count>, tagged_array_view<uint16_t, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 72, get_row, uint64_t(size_used) * sizeof(uint16_t));
 			 return tagged_array_view<uint16_t, nations::country_tag>(m_72.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::crime_count>, tagged_array_view<uint16_t const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 72, get_row, uint64_t(size_used) * sizeof(uint16_t));
 			 return tagged_array_view<uint16_t const, nations::country_tag>(m_72.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::leadership_points>, int16_t&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 73, get, sizeof(int16_t));
 			 return m_73.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::leadership_points>, int16_t const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 73, get, sizeof(int16_t));
 			 return m_73.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::leadership_points>> {
+			 CONTAINER_ACCESS_RECORD(profile, 73, set, sizeof(int16_t));
 			 m_73.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::leadership_points>> {
+			 CONTAINER_ACCESS_RECORD(profile, 73, set, sizeof(int16_t));
 			 m_73.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::leadership_points>, tagged_array_view<int16_t, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 73, get_row, uint64_t(size_used) * sizeof(int16_t));
 			 return tagged_array_view<int16_t, nations::country_tag>(m_73.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::leadership_points>, tagged_array_view<int16_t const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 73, get_row, uint64_t(size_used) * sizeof(int16_t));
 			 return tagged_array_view<int16_t const, nations::country_tag>(m_73.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::base_colonial_points>, int16_t&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 74, get, sizeof(int16_t));
 			 return m_74.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::base_colonial_points>, int16_t const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 74, get, sizeof(int16_t));
 			 return m_74.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::base_colonial_points>> {
+			 CONTAINER_ACCESS_RECORD(profile, 74, set, sizeof(int16_t));
 			 m_74.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::base_colonial_points>> {
+			 CONTAINER_ACCESS_RECORD(profile, 74, set, sizeof(int16_t));
 			 m_74.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::base_colonial_points>, tagged_array_view<int16_t, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 74, get_row, uint64_t(size_used) * sizeof(int16_t));
 			 return tagged_array_view<int16_t, nations::country_tag>(m_74.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::base_colonial_points>, tagged_array_view<int16_t const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 74, get_row, uint64_t(size_used) * sizeof(int16_t));
 			 return tagged_array_view<int16_t const, nations::country_tag>(m_74.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::num_connected_ports>, uint16_t&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 75, get, sizeof(uint16_t));
 			 return m_75.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::num_connected_ports>, uint16_t const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 75, get, sizeof(uint16_t));
 			 return m_75.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::num_connected_ports>> {
+			 CONTAINER_ACCESS_RECORD(profile, 75, set, sizeof(uint16_t));
 			 m_75.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::num_connected_ports>> {
+			 CONTAINER_ACCESS_RECORD(profile, 75, set, sizeof(uint16_t));
 			 m_75.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::num_connected_ports>, tagged_array_view<uint16_t, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 75, get_row, uint64_t(size_used) * sizeof(uint16_t));
 			 return tagged_array_view<uint16_t, nations::country_tag>(m_75.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::num_connected_ports>, tagged_array_view<uint16_t const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 75, get_row, uint64_t(size_used) * sizeof(uint16_t));
 			 return tagged_array_view<uint16_t const, nations::country_tag>(m_75.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::num_ports>, uint16_t&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 76, get, sizeof(uint16_t));
 			 return m_76.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::num_ports>, uint16_t const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 76, get, sizeof(uint16_t));
 			 return m_76.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::num_ports>> {
+			 CONTAINER_ACCESS_RECORD(profile, 76, set, sizeof(uint16_t));
 			 m_76.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::num_ports>> {
+			 CONTAINER_ACCESS_RECORD(profile, 76, set, sizeof(uint16_t));
 			 m_76.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::num_ports>, tagged_array_view<uint16_t, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 76, get_row, uint64_t(size_used) * sizeof(uint16_t));
 			 return tagged_array_view<uint16_t, nations::country_tag>(m_76.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::num_ports>, tagged_array_view<uint16_t const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 76, get_row, uint64_t(size_used) * sizeof(uint16_t));
 			 return tagged_array_view<uint16_t const, nations::country_tag>(m_76.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::player_importance>, int8_t&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 77, get, sizeof(int8_t));
 			 return m_77.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::player_importance>, int8_t const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 77, get, sizeof(int8_t));
 			 return m_77.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::player_importance>> {
+			 CONTAINER_ACCESS_RECORD(profile, 77, set, sizeof(int8_t));
 			 m_77.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::player_importance>> {
+			 CONTAINER_ACCESS_RECORD(profile, 77, set, sizeof(int8_t));
 			 m_77.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::player_importance>, tagged_array_view<int8_t, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 77, get_row, uint64_t(size_used) * sizeof(int8_t));
 			 return tagged_array_view<int8_t, nations::country_tag>(m_77.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::player_importance>, tagged_array_view<int8_t const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 77, get_row, uint64_t(size_used) * sizeof(int8_t));
 			 return tagged_array_view<int8_t const, nations::country_tag>(m_77.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::cb_construction_progress>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 78, get, sizeof(float));
 			 return m_78.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::cb_construction_progress>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 78, get, sizeof(float));
 			 return m_78.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::cb_construction_progress>> {
+			 CONTAINER_ACCESS_RECORD(profile, 78, set, sizeof(float));
 			 m_78.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::cb_construction_progress>> {
+			 CONTAINER_ACCESS_RECORD(profile, 78, set, sizeof(float));
 			 m_78.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::cb_construction_progress>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 78, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_78.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::cb_construction_progress>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 78, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_78.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::cb_construction_target>, nations::country_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 79, get, sizeof(nations::country_tag));
 			 return m_79.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::cb_construction_target>, nations::country_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 79, get, sizeof(nations::country_tag));
 			 return m_79.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::cb_construction_target>> {
+			 CONTAINER_ACCESS_RECORD(profile, 79, set, sizeof(nations::country_tag));
 			 m_79.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::cb_construction_target>> {
+			 CONTAINER_ACCESS_RECORD(profile, 79, set, sizeof(nations::country_tag));
 			 m_79.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::cb_construction_target>, tagged_array_view<nations::country_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 79, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag, nations::country_tag>(m_79.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::cb_construction_target>, tagged_array_view<nations::country_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 79, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag const, nations::country_tag>(m_79.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::cb_construction_type>, military::cb_type_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 80, get, sizeof(military::cb_type_tag));
 			 return m_80.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::cb_construction_type>, military::cb_type_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 80, get, sizeof(military::cb_type_tag));
 			 return m_80.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::cb_construction_type>> {
+			 CONTAINER_ACCESS_RECORD(profile, 80, set, sizeof(military::cb_type_tag));
 			 m_80.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::cb_construction_type>> {
+			 CONTAINER_ACCESS_RECORD(profile, 80, set, sizeof(military::cb_type_tag));
 			 m_80.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::cb_construction_type>, tagged_array_view<military::cb_type_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 80, get_row, uint64_t(size_used) * sizeof(military::cb_type_tag));
 			 return tagged_array_view<military::cb_type_tag, nations::country_tag>(m_80.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::cb_construction_type>, tagged_array_view<military::cb_type_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 80, get_row, uint64_t(size_used) * sizeof(military::cb_type_tag));
 			 return tagged_array_view<military::cb_type_tag const, nations::country_tag>(m_80.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::ruling_party>, governments::party_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 81, get, sizeof(governments::party_tag));
 			 return m_81.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::ruling_party>, governments::party_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 81, get, sizeof(governments::party_tag));
 			 return m_81.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::ruling_party>> {
+			 CONTAINER_ACCESS_RECORD(profile, 81, set, sizeof(governments::party_tag));
 			 m_81.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::ruling_party>> {
+			 CONTAINER_ACCESS_RECORD(profile, 81, set, sizeof(governments::party_tag));
 			 m_81.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::ruling_party>, tagged_array_view<governments::party_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 81, get_row, uint64_t(size_used) * sizeof(governments::party_tag));
 			 return tagged_array_view<governments::party_tag, nations::country_tag>(m_81.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::ruling_party>, tagged_array_view<governments::party_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 81, get_row, uint64_t(size_used) * sizeof(governments::party_tag));
 			 return tagged_array_view<governments::party_tag const, nations::country_tag>(m_81.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_capital>, provinces::province_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 82, get, sizeof(provinces::province_tag));
 			 return m_82.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_capital>, provinces::province_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 82, get, sizeof(provinces::province_tag));
 			 return m_82.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::current_capital>> {
+			 CONTAINER_ACCESS_RECORD(profile, 82, set, sizeof(provinces::province_tag));
 			 m_82.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::current_capital>> {
+			 CONTAINER_ACCESS_RECORD(profile, 82, set, sizeof(provinces::province_tag));
 			 m_82.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_capital>, tagged_array_view<provinces::province_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 82, get_row, uint64_t(size_used) * sizeof(provinces::province_tag));
 			 return tagged_array_view<provinces::province_tag, nations::country_tag>(m_82.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_capital>, tagged_array_view<provinces::province_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 82, get_row, uint64_t(size_used) * sizeof(provinces::province_tag));
 			 return tagged_array_view<provinces::province_tag const, nations::country_tag>(m_82.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::tag>, cultures::national_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 83, get, sizeof(cultures::national_tag));
 			 return m_83.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::tag>, cultures::national_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 83, get, sizeof(cultures::national_tag));
 			 return m_83.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::tag>> {
+			 CONTAINER_ACCESS_RECORD(profile, 83, set, sizeof(cultures::national_tag));
 			 m_83.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::tag>> {
+			 CONTAINER_ACCESS_RECORD(profile, 83, set, sizeof(cultures::national_tag));
 			 m_83.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::tag>, tagged_array_view<cultures::national_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 83, get_row, uint64_t(size_used) * sizeof(cultures::national_tag));
 			 return tagged_array_view<cultures::national_tag, nations::country_tag>(m_83.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::tag>, tagged_array_view<cultures::national_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 83, get_row, uint64_t(size_used) * sizeof(cultures::national_tag));
 			 return tagged_array_view<cultures::national_tag const, nations::country_tag>(m_83.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::primary_culture>, cultures::culture_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 84, get, sizeof(cultures::culture_tag));
 			 return m_84.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::primary_culture>, cultures::culture_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 84, get, sizeof(cultures::culture_tag));
 			 return m_84.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::primary_culture>> {
+			 CONTAINER_ACCESS_RECORD(profile, 84, set, sizeof(cultures::culture_tag));
 			 m_84.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::primary_culture>> {
+			 CONTAINER_ACCESS_RECORD(profile, 84, set, sizeof(cultures::culture_tag));
 			 m_84.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::primary_culture>, tagged_array_view<cultures::culture_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 84, get_row, uint64_t(size_used) * sizeof(cultures::culture_tag));
 			 return tagged_array_view<cultures::culture_tag, nations::country_tag>(m_84.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::primary_culture>, tagged_array_view<cultures::culture_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 84, get_row, uint64_t(size_used) * sizeof(cultures::culture_tag));
 			 return tagged_array_view<cultures::culture_tag const, nations::country_tag>(m_84.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::dominant_culture>, cultures::culture_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 85, get, sizeof(cultures::culture_tag));
 			 return m_85.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::dominant_culture>, cultures::culture_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 85, get, sizeof(cultures::culture_tag));
 			 return m_85.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::dominant_culture>> {
+			 CONTAINER_ACCESS_RECORD(profile, 85, set, sizeof(cultures::culture_tag));
 			 m_85.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::dominant_culture>> {
+			 CONTAINER_ACCESS_RECORD(profile, 85, set, sizeof(cultures::culture_tag));
 			 m_85.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::dominant_culture>, tagged_array_view<cultures::culture_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 85, get_row, uint64_t(size_used) * sizeof(cultures::culture_tag));
 			 return tagged_array_view<cultures::culture_tag, nations::country_tag>(m_85.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::dominant_culture>, tagged_array_view<cultures::culture_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 85, get_row, uint64_t(size_used) * sizeof(cultures::culture_tag));
 			 return tagged_array_view<cultures::culture_tag const, nations::country_tag>(m_85.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::dominant_issue>, issues::option_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 86, get, sizeof(issues::option_tag));
 			 return m_86.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::dominant_issue>, issues::option_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 86, get, sizeof(issues::option_tag));
 			 return m_86.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::dominant_issue>> {
+			 CONTAINER_ACCESS_RECORD(profile, 86, set, sizeof(issues::option_tag));
 			 m_86.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::dominant_issue>> {
+			 CONTAINER_ACCESS_RECORD(profile, 86, set, sizeof(issues::option_tag));
 			 m_86.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::dominant_issue>, tagged_array_view<issues::option_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 86, get_row, uint64_t(size_used) * sizeof(issues::option_tag));
 			 return tagged_array_view<issues::option_tag, nations::country_tag>(m_86.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::dominant_issue>, tagged_array_view<issues::option_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 86, get_row, uint64_t(size_used) * sizeof(issues::option_tag));
 			 return tagged_array_view<issues::option_tag const, nations::country_tag>(m_86.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::dominant_ideology>, ideologies::ideology_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 87, get, sizeof(ideologies::ideology_tag));
 			 return m_87.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::dominant_ideology>, ideologies::ideology_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 87, get, sizeof(ideologies::ideology_tag));
 			 return m_87.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::dominant_ideology>> {
+			 CONTAINER_ACCESS_RECORD(profile, 87, set, sizeof(ideologies::ideology_tag));
 			 m_87.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::dominant_ideology>> {
+			 CONTAINER_ACCESS_RECORD(profile, 87, set, sizeof(ideologies::ideology_tag));
 			 m_87.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::dominant_ideology>, tagged_array_view<ideologies::ideology_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 87, get_row, uint64_t(size_used) * sizeof(ideologies::ideology_tag));
 			 return tagged_array_view<ideologies::ideology_tag, nations::country_tag>(m_87.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::dominant_ideology>, tagged_array_view<ideologies::ideology_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 87, get_row, uint64_t(size_used) * sizeof(ideologies::ideology_tag));
 			 return tagged_array_view<ideologies::ideology_tag const, nations::country_tag>(m_87.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::dominant_religion>, cultures::religion_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 88, get, sizeof(cultures::religion_tag));
 			 return m_88.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::dominant_religion>, cultures::religion_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 88, get, sizeof(cultures::religion_tag));
 			 return m_88.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::dominant_religion>> {
+			 CONTAINER_ACCESS_RECORD(profile, 88, set, sizeof(cultures::religion_tag));
 			 m_88.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::dominant_religion>> {
+			 CONTAINER_ACCESS_RECORD(profile, 88, set, sizeof(cultures::religion_tag));
 			 m_88.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::dominant_religion>, tagged_array_view<cultures::religion_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 88, get_row, uint64_t(size_used) * sizeof(cultures::religion_tag));
 			 return tagged_array_view<cultures::religion_tag, nations::country_tag>(m_88.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::dominant_religion>, tagged_array_view<cultures::religion_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 88, get_row, uint64_t(size_used) * sizeof(cultures::religion_tag));
 			 return tagged_array_view<cultures::religion_tag const, nations::country_tag>(m_88.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_religion>, cultures::religion_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 89, get, sizeof(cultures::religion_tag));
 			 return m_89.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_religion>, cultures::religion_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 89, get, sizeof(cultures::religion_tag));
 			 return m_89.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::national_religion>> {
+			 CONTAINER_ACCESS_RECORD(profile, 89, set, sizeof(cultures::religion_tag));
 			 m_89.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::national_religion>> {
+			 CONTAINER_ACCESS_RECORD(profile, 89, set, sizeof(cultures::religion_tag));
 			 m_89.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_religion>, tagged_array_view<cultures::religion_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 89, get_row, uint64_t(size_used) * sizeof(cultures::religion_tag));
 			 return tagged_array_view<cultures::religion_tag, nations::country_tag>(m_89.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::national_religion>, tagged_array_view<cultures::religion_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 89, get_row, uint64_t(size_used) * sizeof(cultures::religion_tag));
 			 return tagged_array_view<cultures::religion_tag const, nations::country_tag>(m_89.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_government>, governments::government_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 90, get, sizeof(governments::government_tag));
 			 return m_90.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_government>, governments::government_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 90, get, sizeof(governments::government_tag));
 			 return m_90.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::current_government>> {
+			 CONTAINER_ACCESS_RECORD(profile, 90, set, sizeof(governments::government_tag));
 			 m_90.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::current_government>> {
+			 CONTAINER_ACCESS_RECORD(profile, 90, set, sizeof(governments::government_tag));
 			 m_90.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_government>, tagged_array_view<governments::government_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 90, get_row, uint64_t(size_used) * sizeof(governments::government_tag));
 			 return tagged_array_view<governments::government_tag, nations::country_tag>(m_90.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::current_government>, tagged_array_view<governments::government_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 90, get_row, uint64_t(size_used) * sizeof(governments::government_tag));
 			 return tagged_array_view<governments::government_tag const, nations::country_tag>(m_90.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::ruling_ideology>, ideologies::ideology_tag&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 91, get, sizeof(ideologies::ideology_tag));
 			 return m_91.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::ruling_ideology>, ideologies::ideology_tag const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 91, get, sizeof(ideologies::ideology_tag));
 			 return m_91.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::ruling_ideology>> {
+			 CONTAINER_ACCESS_RECORD(profile, 91, set, sizeof(ideologies::ideology_tag));
 			 m_91.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::ruling_ideology>> {
+			 CONTAINER_ACCESS_RECORD(profile, 91, set, sizeof(ideologies::ideology_tag));
 			 m_91.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::ruling_ideology>, tagged_array_view<ideologies::ideology_tag, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 91, get_row, uint64_t(size_used) * sizeof(ideologies::ideology_tag));
 			 return tagged_array_view<ideologies::ideology_tag, nations::country_tag>(m_91.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::ruling_ideology>, tagged_array_view<ideologies::ideology_tag const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 91, get_row, uint64_t(size_used) * sizeof(ideologies::ideology_tag));
 			 return tagged_array_view<ideologies::ideology_tag const, nations::country_tag>(m_91.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_rich_tax>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 92, get, sizeof(float));
 			 return m_92.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_rich_tax>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 92, get, sizeof(float));
 			 return m_92.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_rich_tax>> {
+			 CONTAINER_ACCESS_RECORD(profile, 92, set, sizeof(float));
 			 m_92.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_rich_tax>> {
+			 CONTAINER_ACCESS_RECORD(profile, 92, set, sizeof(float));
 			 m_92.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_rich_tax>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 92, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_92.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_rich_tax>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 92, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_92.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_middle_tax>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 93, get, sizeof(float));
 			 return m_93.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_middle_tax>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 93, get, sizeof(float));
 			 return m_93.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_middle_tax>> {
+			 CONTAINER_ACCESS_RECORD(profile, 93, set, sizeof(float));
 			 m_93.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_middle_tax>> {
+			 CONTAINER_ACCESS_RECORD(profile, 93, set, sizeof(float));
 			 m_93.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_middle_tax>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 93, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_93.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_middle_tax>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 93, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_93.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_poor_tax>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 94, get, sizeof(float));
 			 return m_94.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_poor_tax>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 94, get, sizeof(float));
 			 return m_94.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_poor_tax>> {
+			 CONTAINER_ACCESS_RECORD(profile, 94, set, sizeof(float));
 			 m_94.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_poor_tax>> {
+			 CONTAINER_ACCESS_RECORD(profile, 94, set, sizeof(float));
 			 m_94.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_poor_tax>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 94, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_94.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_poor_tax>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 94, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_94.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_social_spending>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 95, get, sizeof(float));
 			 return m_95.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_social_spending>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 95, get, sizeof(float));
 			 return m_95.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_social_spending>> {
+			 CONTAINER_ACCESS_RECORD(profile, 95, set, sizeof(float));
 			 m_95.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_social_spending>> {
+			 CONTAINER_ACCESS_RECORD(profile, 95, set, sizeof(float));
 			 m_95.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_social_spending>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 95, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_95.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_social_spending>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 95, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_95.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_administrative_spending>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 96, get, sizeof(float));
 			 return m_96.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_administrative_spending>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 96, get, sizeof(float));
 			 return m_96.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_administrative_spending>> {
+			 CONTAINER_ACCESS_RECORD(profile, 96, set, sizeof(float));
 			 m_96.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_administrative_spending>> {
+			 CONTAINER_ACCESS_RECORD(profile, 96, set, sizeof(float));
 			 m_96.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_administrative_spending>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 96, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_96.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_administrative_spending>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 96, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_96.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_education_spending>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 97, get, sizeof(float));
 			 return m_97.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_education_spending>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 97, get, sizeof(float));
 			 return m_97.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_education_spending>> {
+			 CONTAINER_ACCESS_RECORD(profile, 97, set, sizeof(float));
 			 m_97.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_education_spending>> {
+			 CONTAINER_ACCESS_RECORD(profile, 97, set, sizeof(float));
 			 m_97.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_education_spending>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 97, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_97.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_education_spending>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 97, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_97.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_military_spending>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 98, get, sizeof(float));
 			 return m_98.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_military_spending>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 98, get, sizeof(float));
 			 return m_98.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_military_spending>> {
+			 CONTAINER_ACCESS_RECORD(profile, 98, set, sizeof(float));
 			 m_98.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_military_spending>> {
+			 CONTAINER_ACCESS_RECORD(profile, 98, set, sizeof(float));
 			 m_98.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_military_spending>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 98, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_98.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_military_spending>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 98, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_98.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_tariffs>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 99, get, sizeof(float));
 			 return m_99.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_tariffs>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 99, get, sizeof(float));
 			 return m_99.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_tariffs>> {
+			 CONTAINER_ACCESS_RECORD(profile, 99, set, sizeof(float));
 			 m_99.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_tariffs>> {
+			 CONTAINER_ACCESS_RECORD(profile, 99, set, sizeof(float));
 			 m_99.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_tariffs>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 99, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_99.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_tariffs>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 99, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_99.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_army_stockpile_spending>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 100, get, sizeof(float));
 			 return m_100.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_army_stockpile_spending>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 100, get, sizeof(float));
 			 return m_100.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_army_stockpile_spending>> {
+			 CONTAINER_ACCESS_RECORD(profile, 100, set, sizeof(float));
 			 m_100.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_army_stockpile_spending>> {
+			 CONTAINER_ACCESS_RECORD(profile, 100, set, sizeof(float));
 			 m_100.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_army_stockpile_spending>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 100, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_100.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_army_stockpile_spending>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 100, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_100.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_navy_stockpile_spending>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 101, get, sizeof(float));
 			 return m_101.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_navy_stockpile_spending>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 101, get, sizeof(float));
 			 return m_101.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_navy_stockpile_spending>> {
+			 CONTAINER_ACCESS_RECORD(profile, 101, set, sizeof(float));
 			 m_101.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_navy_stockpile_spending>> {
+			 CONTAINER_ACCESS_RECORD(profile, 101, set, sizeof(float));
 			 m_101.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_navy_stockpile_spending>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 101, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_101.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_navy_stockpile_spending>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 101, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_101.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_projects_stockpile_spending>, float&> get(nations::country_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 102, get, sizeof(float));
 			 return m_102.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_projects_stockpile_spending>, float const&> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 102, get, sizeof(float));
 			 return m_102.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_projects_stockpile_spending>> {
+			 CONTAINER_ACCESS_RECORD(profile, 102, set, sizeof(float));
 			 m_102.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::country_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, nation::f_projects_stockpile_spending>> {
+			 CONTAINER_ACCESS_RECORD(profile, 102, set, sizeof(float));
 			 m_102.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_projects_stockpile_spending>, tagged_array_view<float, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 102, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::country_tag>(m_102.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::f_projects_stockpile_spending>, tagged_array_view<float const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 102, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::country_tag>(m_102.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_civilized>, bool> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 103, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_103.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(nations::country_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, nation::is_civilized>> {
+			 CONTAINER_ACCESS_RECORD(profile, 103, set, sizeof(bitfield_type));
 			 bit_vector_set(m_103.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_civilized>, tagged_array_view<bitfield_type, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 103, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, nations::country_tag>(m_103.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_civilized>, tagged_array_view<bitfield_type const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 103, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, nations::country_tag>(m_103.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_substate>, bool> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 104, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_104.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(nations::country_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, nation::is_substate>> {
+			 CONTAINER_ACCESS_RECORD(profile, 104, set, sizeof(bitfield_type));
 			 bit_vector_set(m_104.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_substate>, tagged_array_view<bitfield_type, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 104, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, nations::country_tag>(m_104.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_substate>, tagged_array_view<bitfield_type const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 104, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, nations::country_tag>(m_104.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_mobilized>, bool> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 105, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_105.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(nations::country_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, nation::is_mobilized>> {
+			 CONTAINER_ACCESS_RECORD(profile, 105, set, sizeof(bitfield_type));
 			 bit_vector_set(m_105.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_mobilized>, tagged_array_view<bitfield_type, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 105, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, nations::country_tag>(m_105.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_mobilized>, tagged_array_view<bitfield_type const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 105, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, nations::country_tag>(m_105.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_at_war>, bool> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 106, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_106.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(nations::country_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, nation::is_at_war>> {
+			 CONTAINER_ACCESS_RECORD(profile, 106, set, sizeof(bitfield_type));
 			 bit_vector_set(m_106.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_at_war>, tagged_array_view<bitfield_type, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 106, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, nations::country_tag>(m_106.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_at_war>, tagged_array_view<bitfield_type const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 106, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, nations::country_tag>(m_106.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_not_ai_controlled>, bool> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 107, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_107.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(nations::country_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, nation::is_not_ai_controlled>> {
+			 CONTAINER_ACCESS_RECORD(profile, 107, set, sizeof(bitfield_type));
 			 bit_vector_set(m_107.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_not_ai_controlled>, tagged_array_view<bitfield_type, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 107, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, nations::country_tag>(m_107.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_not_ai_controlled>, tagged_array_view<bitfield_type const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 107, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, nations::country_tag>(m_107.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_holding_election>, bool> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 108, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_108.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(nations::country_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, nation::is_holding_election>> {
+			 CONTAINER_ACCESS_RECORD(profile, 108, set, sizeof(bitfield_type));
 			 bit_vector_set(m_108.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_holding_election>, tagged_array_view<bitfield_type, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 108, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, nations::country_tag>(m_108.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_holding_election>, tagged_array_view<bitfield_type const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 108, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, nations::country_tag>(m_108.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_colonial_nation>, bool> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 109, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_109.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(nations::country_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, nation::is_colonial_nation>> {
+			 CONTAINER_ACCESS_RECORD(profile, 109, set, sizeof(bitfield_type));
 			 bit_vector_set(m_109.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_colonial_nation>, tagged_array_view<bitfield_type, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 109, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, nations::country_tag>(m_109.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::is_colonial_nation>, tagged_array_view<bitfield_type const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 109, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, nations::country_tag>(m_109.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::cb_construction_discovered>, bool> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 110, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_110.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(nations::country_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, nation::cb_construction_discovered>> {
+			 CONTAINER_ACCESS_RECORD(profile, 110, set, sizeof(bitfield_type));
 			 bit_vector_set(m_110.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::cb_construction_discovered>, tagged_array_view<bitfield_type, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 110, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, nations::country_tag>(m_110.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::cb_construction_discovered>, tagged_array_view<bitfield_type const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 110, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, nations::country_tag>(m_110.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::has_gas_attack>, bool> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 111, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_111.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(nations::country_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, nation::has_gas_attack>> {
+			 CONTAINER_ACCESS_RECORD(profile, 111, set, sizeof(bitfield_type));
 			 bit_vector_set(m_111.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::has_gas_attack>, tagged_array_view<bitfield_type, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 111, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, nations::country_tag>(m_111.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::has_gas_attack>, tagged_array_view<bitfield_type const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 111, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, nations::country_tag>(m_111.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::has_gas_defence>, bool> get(nations::country_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 112, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_112.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(nations::country_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, nation::has_gas_defence>> {
+			 CONTAINER_ACCESS_RECORD(profile, 112, set, sizeof(bitfield_type));
 			 bit_vector_set(m_112.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::has_gas_defence>, tagged_array_view<bitfield_type, nations::country_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 112, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, nations::country_tag>(m_112.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, nation::has_gas_defence>, tagged_array_view<bitfield_type const, nations::country_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 112, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, nations::country_tag>(m_112.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 
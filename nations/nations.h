@@ -48,6 +48,18 @@ namespace nations {
 		bool operator<(influence const& other)  const noexcept { return target < other.target; }
 		bool operator==(influence const& other) const noexcept { return target == other.target; }
 	};
+
+	constexpr int32_t great_power_count = 8;
+
+	// bits of nations_state::influence_flags
+	namespace influence_bits {
+		constexpr int32_t has_record = 0x01; // the great power has an influence record for the target
+		constexpr int32_t banned = 0x02;
+		constexpr int32_t neighbor = 0x04;
+		constexpr int32_t at_war = 0x08;
+		constexpr int32_t raised_level = 0x10; // set by the daily update: the opinion level went up
+		constexpr int32_t sphere_candidate = 0x20; // set by the daily update: at level 4 with full influence
+	}
 	struct relationship {
 		country_tag tag;
 		int16_t value = 0;
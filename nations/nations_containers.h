@@ -3,12 +3,25 @@
 #include "nations_io.h"
 #include "state.h"
 #include "nation.h"
+#include "concurrency_tools\\incremental_ranking.h"
 
 namespace nations {
 	class nations_state {
 	public:
 		array_tag<country_tag, int32_t, false> nations_by_rank;
 
+		// rankings by to_index of the nation, kept in order from day to day by update_nation_ranks
+		incremental_ranking industrial_ranking;
+		incremental_ranking military_ranking;
+		incremental_ranking prestige_ranking;
+		incremental_ranking overall_ranking;
+
+		// the nations whose ranks changed in the last update, and how many updates have changed any rank, so that
+		// code interested in the ranks can check these instead of comparing every rank itself
+		std::vector<country_tag> rank_changed_nations;
+		uint32_t rank_generation = 0;
+		bool great_powers_changed = false;
+
 		nation::container nations;
 		state::container states;
 
@@ -17,12 +30,25 @@ namespace nations {
 		fixed_vectorizable_2d_array<nations::country_tag, float, nation::container_size, modifiers::national_offsets::count> modifier_values;
 		fixed_vectorizable_2d_array<nations::country_tag, float, nation::container_size, technologies::tech_offset::count> tech_attributes;
 
+		// great power x nation influence matrices, one row per great power in overall rank order (see influence_gps);
+		// daily_influence_update fills them from influence_arrays, works on them, and writes the records back, so
+		// influence_arrays remains the saved state read by get_influence and friends
+		country_tag influence_gps[great_power_count];
+		fixed_vectorizable_2d_array<nations::country_tag, float, nation::container_size, great_power_count> influence_amount;
+		fixed_vectorizable_2d_array<nations::country_tag, float, nation::container_size, great_power_count> influence_investment;
+		fixed_vectorizable_2d_array<nations::country_tag, float, nation::container_size, great_power_count> influence_relation;
+		fixed_vectorizable_2d_array<nations::country_tag, float, nation::container_size, great_power_count> influence_weight; // priority factor of the targets that can be influenced
+		fixed_vectorizable_2d_array<nations::country_tag, int32_t, nation::container_size, great_power_count> influence_level;
+		fixed_vectorizable_2d_array<nations::country_tag, int32_t, nation::container_size, great_power_count> influence_priority;
+		fixed_vectorizable_2d_array<nations::country_tag, int32_t, nation::container_size, great_power_count> influence_flags; // influence_bits
+
 		stable_2d_vector<float, nations::country_tag, population::rebel_type_tag, 512, 16> local_rebel_support;
 		stable_2d_vector<float, nations::country_tag, issues::option_tag, 512, 16> local_movement_support;
 		stable_2d_vector<float, nations::country_tag, issues::option_tag, 512, 16> local_movement_radicalism;
 		stable_2d_vector<float, nations::country_tag, issues::option_tag, 512, 16> local_movement_radicalism_cache;
 
 		varying_vectorizable_2d_array<nations::country_tag, technologies::tech_tag, bitfield_type, nation::container_size> active_technologies;
+		varying_vectorizable_2d_array<nations::country_tag, technologies::tech_tag, bitfield_type, nation::container_size> invention_candidates; // rows for inventions only
 		varying_vectorizable_2d_array<nations::country_tag, issues::issue_tag, issues::option_tag, nation::container_size> active_issue_options;
 
 
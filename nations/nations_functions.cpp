@@ -7,6 +7,7 @@
 #include "governments\\governments_functions.h"
 #include "issues\\issues_functions.h"
 #include "population\\population_functions.hpp"
+#include "population\\population_rollup.h"
 #include "provinces\\province_functions.h"
 #include <ppl.h>
 #include "economy\\economy_functions.h"
@@ -580,6 +581,7 @@ namespace nations {
 		ws.w.nation_s.active_parties.reset(ws.s.ideologies_m.ideologies_count);
 		ws.w.nation_s.upper_house.reset(ws.s.ideologies_m.ideologies_count);
 		ws.w.nation_s.active_technologies.resize(int32_t(ws.s.technology_m.technologies_container.size()));
+		ws.w.nation_s.invention_candidates.resize(int32_t(ws.s.technology_m.technologies_container.size()));
 		ws.w.nation_s.active_goods.reset((ws.s.economy_m.goods_count + 7ui32) / 8ui32);
 		ws.w.nation_s.collected_tariffs.reset(ws.s.economy_m.goods_count);
 		ws.w.nation_s.active_issue_options.resize(int32_t(ws.s.issues_m.issues_container.size()));
@@ -614,80 +616,7 @@ namespace nations {
 	}
 
 	void recalculate_state_nation_demographics(world_state& ws) {
-		const auto full_vector_size = population::aligned_32_demo_size(ws);
-
-		ws.w.nation_s.nations.parallel_for_each([&ws, full_vector_size](country_tag n) {
-			auto nation_demo = ws.w.nation_s.nation_demographics.get_row(n);
-			auto nation_c_demo = ws.w.nation_s.nation_colonial_demographics.get_row(n);
-			const auto demo_size = ws.w.nation_s.nation_demographics.inner_size;
-			
-			ve::set_zero(demo_size, nation_demo, ve::serial_exact());
-			ve::set_zero(demo_size, nation_c_demo, ve::serial_exact());
-
-			const auto state_range = get_range(ws.w.nation_s.state_arrays, ws.w.nation_s.nations.get<nation::member_states>(n));
-
-			for(auto s = state_range.first; s != state_range.second; ++s) {
-				auto state_demo = ws.w.nation_s.state_demographics.get_row(s->state);
-				
-				ve::set_zero(demo_size, state_demo);
-
-				const auto p_in_region_range = ws.s.province_m.states_to_province_index.get_range(s->region_id);
-				for(auto p = p_in_region_range.first; p != p_in_region_range.second; ++p) {
-					if(ws.w.province_s.province_state_container.get<province_state::owner>(*p) == n) {
-						auto province_demo = ws.w.province_s.province_demographics.get_row(*p);
-						ve::accumulate(demo_size, state_demo, province_demo, ve::serial_exact());
-					}
-				}
-
-				if(state_demo[population::total_population_tag] != 0) {
-					const auto culture_offset = population::to_demo_tag(ws, cultures::culture_tag(0));
-					auto max_culture_off = maximum_index(state_demo.data() + to_index(culture_offset), int32_t(ws.s.culture_m.count_cultures));
-					ws.w.nation_s.states.set<state::dominant_culture>(s->state, cultures::culture_tag(static_cast<value_base_of<cultures::culture_tag>>(max_culture_off)));
-
-					const auto religion_offset = population::to_demo_tag(ws, cultures::religion_tag(0));
-					auto max_religion_off = maximum_index(state_demo.data() + to_index(religion_offset), int32_t(ws.s.culture_m.count_religions));
-					ws.w.nation_s.states.set<state::dominant_religion>(s->state, cultures::religion_tag(static_cast<value_base_of<cultures::religion_tag>>(max_religion_off)));
-
-					const auto ideology_offset = population::to_demo_tag(ws, ideologies::ideology_tag(0));
-					auto max_ideology_off = maximum_index(state_demo.data() + to_index(ideology_offset), int32_t(ws.s.ideologies_m.ideologies_count));
-					ws.w.nation_s.states.set<state::dominant_ideology>(s->state, ideologies::ideology_tag(static_cast<value_base_of<ideologies::ideology_tag>>(max_ideology_off)));
-
-					const auto options_offset = population::to_demo_tag(ws, issues::option_tag(0));
-					auto max_opinion_off = maximum_index(state_demo.data() + to_index(options_offset), int32_t(ws.s.issues_m.tracked_options_count));
-					ws.w.nation_s.states.set<state::dominant_issue>(s->state, issues::option_tag(static_cast<value_base_of<issues::option_tag>>(max_opinion_off)));
-				}
-
-				ws.w.nation_s.states.set<state::total_population>(s->state, state_demo[population::total_population_tag]);
-
-				if(!nations::is_colonial_or_protectorate(ws, s->state))
-					ve::accumulate(demo_size, nation_demo, state_demo, ve::serial_exact());
-				else
-					ve::accumulate(demo_size, nation_c_demo, state_demo, ve::serial_exact());
-			}
-
-			if(nation_demo[population::total_population_tag] != 0) {
-				const auto culture_offset = population::to_demo_tag(ws, cultures::culture_tag(0));
-				auto max_culture_off = maximum_index(nation_demo.data() + to_index(culture_offset), int32_t(ws.s.culture_m.count_cultures));
-				ws.w.nation_s.nations.set<nation::dominant_culture>(n, cultures::culture_tag(static_cast<value_base_of<cultures::culture_tag>>(max_culture_off)));
-
-				const auto religion_offset = population::to_demo_tag(ws, cultures::religion_tag(0));
-				auto max_religion_off = maximum_index(nation_demo.data() + to_index(religion_offset), int32_t(ws.s.culture_m.count_religions));
-				ws.w.nation_s.nations.set<nation::dominant_religion>(n, cultures::religion_tag(static_cast<value_base_of<cultures::religion_tag>>(max_religion_off)));
-
-				const auto ideology_offset = population::to_demo_tag(ws, ideologies::ideology_tag(0));
-				auto max_ideology_off = maximum_index(nation_demo.data() + to_index(ideology_offset), int32_t(ws.s.ideologies_m.ideologies_count));
-				ws.w.nation_s.nations.set<nation::dominant_ideology>(n, ideologies::ideology_tag(static_cast<value_base_of<ideologies::ideology_tag>>(max_ideology_off)));
-
-				const auto options_offset = population::to_demo_tag(ws, issues::option_tag(0));
-				auto max_opinion_off = maximum_index(nation_demo.data() + to_index(options_offset), int32_t(ws.s.issues_m.tracked_options_count));
-				ws.w.nation_s.nations.set<nation::dominant_issue>(n, issues::option_tag(static_cast<value_base_of<issues::option_tag>>(max_opinion_off)));
-			}
-
-			ws.w.nation_s.nations.set<nation::total_core_population>(n, nation_demo[population::total_population_tag]);
-
-			ws.w.nation_s.nations.set<nation::political_interest_fraction>(n, issues::calculate_political_interest(ws, ws.w.nation_s.nation_demographics.get_row(n)));
-			ws.w.nation_s.nations.set<nation::social_interest_fraction>(n, issues::calculate_social_interest(ws, ws.w.nation_s.nation_demographics.get_row(n)));
-		});
+		population::rollup_to_states_and_nations(ws, population::make_demographic_rollup(ws));
 	}
 
 	void fix_capitals(world_state& ws) {
@@ -1234,54 +1163,76 @@ namespace nations {
 		return int32_t(total_sum);
 	}
 
-	void update_nation_ranks(world_state& ws) {
-		int32_t nations_count = 0;
-		ws.w.nation_s.nations.for_each([&nations_count](nations::country_tag n) {
-			++nations_count;
-		});
-
-		country_tag* temp_buf = (country_tag*)_alloca(sizeof(country_tag) * ws.w.nation_s.nations.size());
-		std::uninitialized_value_construct_n(temp_buf, ws.w.nation_s.nations.size());
-		ws.w.nation_s.nations.for_each([temp_buf, temp_count = 0](nations::country_tag n) {
-			temp_buf[to_index(n)] = n;
-		});
-		std::stable_partition(temp_buf, temp_buf + ws.w.nation_s.nations.size(), [](nations::country_tag a) { return is_valid_index(a); });
-
-		std::sort(temp_buf, temp_buf + nations_count, [&ws](nations::country_tag a, nations::country_tag b) {
-			return ws.w.nation_s.nations.get<nation::industrial_score>(a) > ws.w.nation_s.nations.get<nation::industrial_score>(b);
-		});
-		for(int32_t i = 0; i < nations_count; ++i)
-			ws.w.nation_s.nations.set<nation::industrial_rank>(temp_buf[i], int16_t(i + 1));
-		std::sort(temp_buf, temp_buf + nations_count, [&ws](nations::country_tag a, nations::country_tag b) {
-			return ws.w.nation_s.nations.get<nation::military_score>(a) > ws.w.nation_s.nations.get<nation::military_score>(b);
-		});
-		for(int32_t i = 0; i < nations_count; ++i)
-			ws.w.nation_s.nations.set<nation::military_rank>(temp_buf[i], int16_t(i + 1));
-		std::sort(temp_buf, temp_buf + nations_count, [&ws](nations::country_tag a, nations::country_tag b) {
-			return nations::get_prestige(ws, a) > nations::get_prestige(ws, b);
-		});
-		for(int32_t i = 0; i < nations_count; ++i)
-			ws.w.nation_s.nations.set<nation::prestige_rank>(temp_buf[i], int16_t(i + 1));
+	namespace {
+		template<typename rank_column>
+		void store_rank_changes(world_state& ws, incremental_ranking const& r, std::vector<country_tag>& changed_nations) {
+			for(auto const& c : r.changed()) {
+				if(c.new_rank != -1) {
+					auto const n = country_tag(country_tag::value_base_t(c.item));
+					ws.w.nation_s.nations.set<rank_column>(n, int16_t(c.new_rank + 1));
+					changed_nations.push_back(n);
+				}
+			}
+		}
+	}
 
-		std::sort(temp_buf, temp_buf + nations_count, [&ws](nations::country_tag a, nations::country_tag b) {
-			return (nations::get_prestige(ws, a) + ws.w.nation_s.nations.get<nation::military_score>(a) + ws.w.nation_s.nations.get<nation::industrial_score>(a))
-		> (nations::get_prestige(ws, b) + ws.w.nation_s.nations.get<nation::military_score>(b) + ws.w.nation_s.nations.get<nation::industrial_score>(b));
-		});
-		std::stable_partition(temp_buf, temp_buf + nations_count, [&ws](nations::country_tag a) {
-			return !is_valid_index(ws.w.nation_s.nations.get<nation::overlord>(a));
-		});
-		std::stable_partition(temp_buf, temp_buf + nations_count, [&ws](nations::country_tag a) {
-			return ws.w.nation_s.nations.get<nation::is_civilized>(a);
-		});
-		std::stable_partition(temp_buf, temp_buf + nations_count, [&ws](nations::country_tag a) {
-			return is_valid_index(ws.w.nation_s.nations.get<nation::current_capital>(a));
+	void update_nation_ranks(world_state& ws) {
+		auto& nations_s = ws.w.nation_s;
+
+		nations_s.nations.for_each([&ws, &nations_s](nations::country_tag n) {
+			auto const prestige = nations::get_prestige(ws, n);
+			auto const military = float(nations_s.nations.get<nation::military_score>(n));
+			auto const industrial = float(nations_s.nations.get<nation::industrial_score>(n));
+
+			// ranked first: nations with a capital, then civilized nations, then nations that are not vassals
+			int32_t const overall_group =
+				(is_valid_index(nations_s.nations.get<nation::current_capital>(n)) ? 0 : 4)
+				+ (nations_s.nations.get<nation::is_civilized>(n) ? 0 : 2)
+				+ (is_valid_index(nations_s.nations.get<nation::overlord>(n)) ? 1 : 0);
+
+			nations_s.industrial_ranking.set(int32_t(to_index(n)), ranking_key{ 0, industrial });
+			nations_s.military_ranking.set(int32_t(to_index(n)), ranking_key{ 0, military });
+			nations_s.prestige_ranking.set(int32_t(to_index(n)), ranking_key{ 0, prestige });
+			nations_s.overall_ranking.set(int32_t(to_index(n)), ranking_key{ overall_group, prestige + military + industrial });
 		});
 
-		resize(ws.w.nation_s.nations_arrays, ws.w.nation_s.nations_by_rank, nations_count);
-		for(int32_t i = 0; i < nations_count; ++i) {
-			ws.w.nation_s.nations.set<nation::overall_rank>(temp_buf[i], int16_t(i + 1));
-			get(ws.w.nation_s.nations_arrays, ws.w.nation_s.nations_by_rank, i) = temp_buf[i];
+		nations_s.rank_changed_nations.clear();
+		bool const industrial_changed = nations_s.industrial_ranking.update();
+		bool const military_changed = nations_s.military_ranking.update();
+		bool const prestige_changed = nations_s.prestige_ranking.update();
+		bool const overall_changed = nations_s.overall_ranking.update();
+
+		if(industrial_changed)
+			store_rank_changes<nation::industrial_rank>(ws, nations_s.industrial_ranking, nations_s.rank_changed_nations);
+		if(military_changed)
+			store_rank_changes<nation::military_rank>(ws, nations_s.military_ranking, nations_s.rank_changed_nations);
+		if(prestige_changed)
+			store_rank_changes<nation::prestige_rank>(ws, nations_s.prestige_ranking, nations_s.rank_changed_nations);
+		if(overall_changed) {
+			store_rank_changes<nation::overall_rank>(ws, nations_s.overall_ranking, nations_s.rank_changed_nations);
+
+			auto const& order = nations_s.overall_ranking.ordered_items();
+			resize(nations_s.nations_arrays, nations_s.nations_by_rank, uint32_t(order.size()));
+			for(int32_t i = 0; i < int32_t(order.size()); ++i)
+				get(nations_s.nations_arrays, nations_s.nations_by_rank, i) = country_tag(country_tag::value_base_t(order[i]));
 		}
+		nations_s.great_powers_changed = overall_changed && nations_s.overall_ranking.boundary_moved(great_power_count);
+
+		if(nations_s.rank_changed_nations.size() != 0) {
+			std::sort(nations_s.rank_changed_nations.begin(), nations_s.rank_changed_nations.end());
+			nations_s.rank_changed_nations.erase(
+				std::unique(nations_s.rank_changed_nations.begin(), nations_s.rank_changed_nations.end()),
+				nations_s.rank_changed_nations.end());
+			++nations_s.rank_generation;
+		}
+	}
+
+	void rebuild_nation_ranks(world_state& ws) {
+		ws.w.nation_s.industrial_ranking = incremental_ranking();
+		ws.w.nation_s.military_ranking = incremental_ranking();
+		ws.w.nation_s.prestige_ranking = incremental_ranking();
+		ws.w.nation_s.overall_ranking = incremental_ranking();
+		update_nation_ranks(ws);
 	}
 
 	void change_tag(world_state& ws, nations::country_tag this_nation, cultures::national_tag new_tag) {
@@ -1479,125 +1430,239 @@ namespace nations {
 		return true;
 	}
 
-	constexpr float priority_to_factor(int32_t n) {
-		switch(n) {
-			case 0: return 0.0f;
-			case 1: return 1.0f;
-			case 2: return 2.0f;
-			case 3: return 4.0f;
-			default: return 0.0f;
-		}
-	}
-
-	void update_nation_influence(world_state& ws, nations::country_tag n) {
-		auto inf_range = get_range(ws.w.nation_s.influence_arrays, ws.w.nation_s.nations.get<nation::gp_influence>(n));
-
-		float total_priority = 0;
-		for(auto& i : inf_range) {
-			if(can_influence(ws, n, i.target)) {
-				total_priority += priority_to_factor(i.priority());
+	namespace {
+		// fills one row of the influence matrices from the great power's influence records and relation lists
+		void gather_influence_row(world_state& ws, int32_t row, nations::country_tag gp, uint32_t vsize) {
+			auto& ns = ws.w.nation_s;
+
+			std::fill_n(ns.influence_amount.get_row(row).data(), vsize, 0.0f);
+			std::fill_n(ns.influence_investment.get_row(row).data(), vsize, 0.0f);
+			std::fill_n(ns.influence_relation.get_row(row).data(), vsize, 0.0f);
+			std::fill_n(ns.influence_weight.get_row(row).data(), vsize, 0.0f);
+			std::fill_n(ns.influence_level.get_row(row).data(), vsize, 0);
+			std::fill_n(ns.influence_priority.get_row(row).data(), vsize, 0);
+			std::fill_n(ns.influence_flags.get_row(row).data(), vsize, 0);
+
+			ns.influence_gps[row] = gp;
+			if(!is_valid_index(gp))
+				return;
+
+			for(auto& i : get_range(ns.influence_arrays, ns.nations.get<nation::gp_influence>(gp))) {
+				ns.influence_amount.get(i.target, row) = i.amount;
+				ns.influence_investment.get(i.target, row) = i.investment_amount;
+				ns.influence_level.get(i.target, row) = i.level();
+				ns.influence_priority.get(i.target, row) = i.priority();
+				ns.influence_flags.get(i.target, row) = influence_bits::has_record | (i.is_banned() ? influence_bits::banned : 0);
 			}
+			for(auto n : get_range(ns.nations_arrays, ns.nations.get<nation::neighboring_nations>(gp)))
+				ns.influence_flags.get(n, row) |= influence_bits::neighbor;
+			for(auto n : get_range(ns.nations_arrays, ns.nations.get<nation::opponents_in_war>(gp)))
+				ns.influence_flags.get(n, row) |= influence_bits::at_war;
+			for(auto& r : get_range(ns.relations_arrays, ns.nations.get<nation::relations>(gp)))
+				ns.influence_relation.get(r.tag, row) = float(r.value);
 		}
 
-		auto const influence_per_priority = (ws.s.modifiers_m.global_defines.base_greatpower_daily_influence 
-			* (ws.w.nation_s.modifier_values.get<modifiers::national_offsets::influence_modifier>(n) + 1.0f)
-			* (ws.w.nation_s.tech_attributes.get<technologies::tech_offset::influence>(n) + 1.0f)) / total_priority;
-
-		auto const n_array = ws.w.nation_s.nations.get<nation::neighboring_nations>(n);
-		auto const continent = ws.s.province_m.province_container.get<province::continent>(ws.w.nation_s.nations.get<nation::current_capital>(n));
+		void scatter_influence_row(world_state& ws, int32_t row) {
+			auto& ns = ws.w.nation_s;
+			if(!is_valid_index(ns.influence_gps[row]))
+				return;
 
-		for(auto& i : inf_range) {
-			if(can_influence(ws, n, i.target)) {
-				auto const target_continent = ws.s.province_m.province_container.get<province::continent>(ws.w.nation_s.nations.get<nation::current_capital>(i.target));
-				auto const target_investment_total = ws.w.nation_s.nations.get<nation::total_foreign_investment>(i.target);
-
-				auto const pfactor = priority_to_factor(i.priority()) * influence_per_priority;
-				if(pfactor > 0) {
-					auto const with_bonus = pfactor * (
-						1.0f
-						+ (contains_item(ws.w.nation_s.nations_arrays, n_array, i.target) ? ws.s.modifiers_m.global_defines.neighbour_bonus_influence_percent : 0.0f)
-						+ (target_continent != continent ? ws.s.modifiers_m.global_defines.other_continent_bonus_influence_percent : 0.0f)
-						+ (ws.w.nation_s.nations.get<nation::overlord>(i.target) == n ? ws.s.modifiers_m.global_defines.puppet_bonus_influence_percent : 0.0f)
-						+ (target_investment_total > 0 ? (ws.s.modifiers_m.global_defines.investment_influence_defense * i.investment_amount / target_investment_total) : 0.0f)
-						+ float(get_relationship(ws, i.target, n)) / ws.s.modifiers_m.global_defines.relation_influence_modifier);
-					i.amount += with_bonus;
-				}
+			for(auto& i : get_range(ns.influence_arrays, ns.nations.get<nation::gp_influence>(ns.influence_gps[row]))) {
+				i.amount = ns.influence_amount.get(i.target, row);
+				i.level(ns.influence_level.get(i.target, row));
 			}
 		}
-	}
 
-	struct sphere_member_change {
-		nations::country_tag sphere_leader;
-		nations::country_tag sphere_member;
-		bool add = false;
-	};
+		class influence_weight_operation {
+		public:
+			world_state& ws;
+			int32_t const row;
 
-	void update_influencers(world_state& ws, nations::country_tag n, concurrency::concurrent_queue<sphere_member_change, concurrent_allocator<sphere_member_change>>& changes) {
-		auto inf_range = get_range(ws.w.nation_s.nations_arrays, ws.w.nation_s.nations.get<nation::influencers>(n));
-		auto current_sphere_leader = ws.w.nation_s.nations.get<nation::sphere_leader>(n);
+			influence_weight_operation(world_state& w, int32_t r) : ws(w), row(r) {}
 
-		auto const increase_cost = ws.s.modifiers_m.global_defines.increaseopinion_influence_cost;
-		auto const sphere_cost = ws.s.modifiers_m.global_defines.addtosphere_influence_cost;
-		auto const remove_sphere_cost = ws.s.modifiers_m.global_defines.removefromsphere_influence_cost;
+			template<typename T>
+			RELEASE_INLINE void operator()(T v) {
+				auto const flags = ve::load(v, ws.w.nation_s.influence_flags.get_row(row));
+				auto const priority = ve::load(v, ws.w.nation_s.influence_priority.get_row(row));
+				auto const can_influence = ve::bit_test(flags, influence_bits::has_record)
+					& !(ve::bit_test(flags, influence_bits::banned) | ve::bit_test(flags, influence_bits::at_war))
+					& !is_great_power(ws, v) & nation_exists(ws, v);
 
-		boost::container::small_vector<std::pair<nations::country_tag, influence*>, 16> inf_ptrs;
-		for(auto i : inf_range) {
-			if(auto const f = find(ws.w.nation_s.influence_arrays, ws.w.nation_s.nations.get<nation::gp_influence>(i), influence(n)); f)
-				inf_ptrs.emplace_back(i, f);
-		}
-		float total_excess = 0.0f;
-		for(auto p : inf_ptrs) {
-			if(p.second->amount > 100.0f) {
-				total_excess += (p.second->amount - 100.0f);
+				// priorities 0, 1, 2, 3 weigh 0, 1, 2, 4
+				auto const factor = ve::to_float(priority) + ve::select(priority == ve::int_vector(3), ve::fp_vector(1.0f), ve::fp_vector());
+				ve::store(v, ws.w.nation_s.influence_weight.get_row(row), ve::select(can_influence, factor, ve::fp_vector()));
 			}
-		}
-		for(auto p : inf_ptrs) {
-			p.second->amount -= total_excess;
-			if(p.second->amount < 0) {
-				if(p.second->level() > 2 && p.second->level() < 5) {
-					p.second->level(p.second->level() - 1);
-					p.second->amount += increase_cost;
-				} else {
-					p.second->amount = 0.0f;
+		};
+
+		class influence_gain_operation {
+		public:
+			world_state& ws;
+			int32_t const row;
+			nations::country_tag const gp;
+			modifiers::provincial_modifier_tag const continent;
+			float const per_priority;
+
+			influence_gain_operation(world_state& w, int32_t r, nations::country_tag g, modifiers::provincial_modifier_tag c, float p) :
+				ws(w), row(r), gp(g), continent(c), per_priority(p) {}
+
+			template<typename T>
+			RELEASE_INLINE void operator()(T v) {
+				auto const& defines = ws.s.modifiers_m.global_defines;
+				auto const flags = ve::load(v, ws.w.nation_s.influence_flags.get_row(row));
+				auto const weight = ve::load(v, ws.w.nation_s.influence_weight.get_row(row));
+				auto const amount = ve::load(v, ws.w.nation_s.influence_amount.get_row(row));
+				auto const target_continent = ve::load(ve::load(v, ws.w.nation_s.nations.get_row<nation::current_capital>()),
+					ws.s.province_m.province_container.get_row<province::continent>());
+				auto const target_investment_total = ve::load(v, ws.w.nation_s.nations.get_row<nation::total_foreign_investment>());
+
+				auto const bonus = ve::fp_vector(1.0f)
+					+ ve::select(ve::bit_test(flags, influence_bits::neighbor), ve::fp_vector(defines.neighbour_bonus_influence_percent), ve::fp_vector())
+					+ ve::select(target_continent != continent, ve::fp_vector(defines.other_continent_bonus_influence_percent), ve::fp_vector())
+					+ ve::select(ve::load(v, ws.w.nation_s.nations.get_row<nation::overlord>()) == gp, ve::fp_vector(defines.puppet_bonus_influence_percent), ve::fp_vector())
+					+ ve::select(target_investment_total > ve::fp_vector(),
+						ve::fp_vector(defines.investment_influence_defense) * ve::load(v, ws.w.nation_s.influence_investment.get_row(row)) / target_investment_total,
+						ve::fp_vector())
+					+ ve::load(v, ws.w.nation_s.influence_relation.get_row(row)) / ve::fp_vector(defines.relation_influence_modifier);
+
+				ve::store(v, ws.w.nation_s.influence_amount.get_row(row),
+					ve::select(weight > ve::fp_vector(), ve::multiply_and_add(weight * ve::fp_vector(per_priority), bonus, amount), amount));
+			}
+		};
+
+		// splits the influence over each target that exceeds 100 off all of the target's influencers, moves opinion levels
+		// and marks the level increases and sphere candidates in influence_flags; the targets with marks are collected
+		class influence_decay_operation {
+		public:
+			world_state& ws;
+			std::vector<nations::country_tag>& marked_targets;
+
+			influence_decay_operation(world_state& w, std::vector<nations::country_tag>& m) : ws(w), marked_targets(m) {}
+
+			template<typename T>
+			RELEASE_INLINE void operator()(T v) {
+				auto& ns = ws.w.nation_s;
+				auto const increase_cost = ve::fp_vector(ws.s.modifiers_m.global_defines.increaseopinion_influence_cost);
+
+				ve::fp_vector total_excess;
+				for(int32_t g = 0; g < great_power_count; ++g) {
+					total_excess = total_excess + ve::select(ve::bit_test(ve::load(v, ns.influence_flags.get_row(g)), influence_bits::has_record),
+						ve::max(ve::load(v, ns.influence_amount.get_row(g)) - ve::fp_vector(100.0f), ve::fp_vector()), ve::fp_vector());
+				}
+
+				ve::mask_vector any_marked;
+				for(int32_t g = 0; g < great_power_count; ++g) {
+					auto const flags = ve::load(v, ns.influence_flags.get_row(g));
+					auto const has_record = ve::bit_test(flags, influence_bits::has_record);
+					auto const level = ve::load(v, ns.influence_level.get_row(g));
+					auto const old_amount = ve::load(v, ns.influence_amount.get_row(g));
+					auto const amount = old_amount - total_excess;
+
+					auto const below_zero = amount < ve::fp_vector();
+					auto const dropped = below_zero & (level > ve::int_vector(2)) & (level < ve::int_vector(5));
+					auto const raised = !below_zero & (amount > increase_cost) & (level < ve::int_vector(4));
+					auto const full = !below_zero & !raised & (amount > ve::fp_vector(99.99f));
+					auto const candidate = full & (level == ve::int_vector(4));
+
+					auto const new_level = ve::select(dropped, level - ve::int_vector(1), ve::select(raised, level + ve::int_vector(1), level));
+					auto const new_amount = ve::select(below_zero,
+						ve::select(dropped, amount + increase_cost, ve::fp_vector()),
+						ve::select(raised, amount - increase_cost, ve::select(full & (level == ve::int_vector(5)), ve::fp_vector(100.0f), amount)));
+					auto const marks = ve::select(raised, ve::int_vector(influence_bits::raised_level), ve::int_vector())
+						+ ve::select(candidate, ve::int_vector(influence_bits::sphere_candidate), ve::int_vector());
+
+					ve::store(v, ns.influence_level.get_row(g), ve::select(has_record, new_level, level));
+					ve::store(v, ns.influence_amount.get_row(g), ve::select(has_record, new_amount, old_amount));
+					ve::store(v, ns.influence_flags.get_row(g), ve::select(has_record, flags + marks, flags));
+
+					any_marked = any_marked | (has_record & (raised | candidate));
 				}
-			} else if(p.second->amount > increase_cost && p.second->level() < 4) {
-				messages::increase_opinion(ws, p.first, n, p.second->level() + 1);
-				p.second->level(p.second->level() + 1);
-				p.second->amount = p.second->amount - increase_cost;
-			} else if(p.second->amount > 99.99f) {
-				if(p.second->level() == 5) { // in sphere
-					p.second->amount = 100.0f;
-				} else if(p.second->level() == 4) { // almost in sphere
+
+				if(auto const mask_bits = ve::compress_mask(any_marked); mask_bits != 0) {
+					for(int32_t j = 0; j < ve::vector_size; ++j) {
+						if((mask_bits & (1 << j)) != 0)
+							marked_targets.push_back(nations::country_tag(nations::country_tag::value_base_t(v.value + j)));
+					}
+				}
+			}
+		};
+
+		struct sphere_member_change {
+			nations::country_tag sphere_leader;
+			nations::country_tag sphere_member;
+			bool add = false;
+		};
+
+		// sends the messages for the marks left by influence_decay_operation and resolves the sphere candidates,
+		// in great power rank order
+		void apply_influence_marks(world_state& ws, nations::country_tag n, std::vector<sphere_member_change>& changes) {
+			auto& ns = ws.w.nation_s;
+			auto const current_sphere_leader = ns.nations.get<nation::sphere_leader>(n);
+			auto const remove_sphere_cost = ws.s.modifiers_m.global_defines.removefromsphere_influence_cost;
+
+			for(int32_t g = 0; g < great_power_count; ++g) {
+				auto const flags = ns.influence_flags.get(n, g);
+				auto const gp = ns.influence_gps[g];
+
+				if((flags & influence_bits::raised_level) != 0) {
+					messages::increase_opinion(ws, gp, n, ns.influence_level.get(n, g));
+				} else if((flags & influence_bits::sphere_candidate) != 0) {
 					if(is_valid_index(current_sphere_leader)) {
-						messages::remove_from_sphere(ws, p.first, current_sphere_leader, n);
-						changes.push(sphere_member_change{ current_sphere_leader, n, false });
-						ws.w.nation_s.nations.set<nation::sphere_leader>(n, nations::country_tag());
-						p.second->amount = 100.0f - remove_sphere_cost;
+						messages::remove_from_sphere(ws, gp, current_sphere_leader, n);
+						changes.push_back(sphere_member_change{ current_sphere_leader, n, false });
+						ns.nations.set<nation::sphere_leader>(n, nations::country_tag());
+						ns.influence_amount.get(n, g) = 100.0f - remove_sphere_cost;
 					} else {
-						messages::add_to_sphere(ws, p.first, n);
-						changes.push(sphere_member_change{p.first, n, true});
-						ws.w.nation_s.nations.set<nation::sphere_leader>(n, p.first);
-						p.second->amount = 100.0f;
-						p.second->level(5);
+						messages::add_to_sphere(ws, gp, n);
+						changes.push_back(sphere_member_change{ gp, n, true });
+						ns.nations.set<nation::sphere_leader>(n, gp);
+						ns.influence_amount.get(n, g) = 100.0f;
+						ns.influence_level.get(n, g) = 5;
 					}
 				}
 			}
 		}
 	}
 
+	void update_nation_influence(world_state& ws, int32_t row, uint32_t vsize) {
+		auto const n = ws.w.nation_s.influence_gps[row];
+
+		ve::execute_serial<nations::country_tag>(vsize, influence_weight_operation(ws, row));
+		auto const total_priority = ve::reduce(vsize, ws.w.nation_s.influence_weight.get_row(row), ve::serial{});
+		if(total_priority <= 0.0f)
+			return;
+
+		auto const influence_per_priority = (ws.s.modifiers_m.global_defines.base_greatpower_daily_influence 
+			* (ws.w.nation_s.modifier_values.get<modifiers::national_offsets::influence_modifier>(n) + 1.0f)
+			* (ws.w.nation_s.tech_attributes.get<technologies::tech_offset::influence>(n) + 1.0f)) / total_priority;
+		auto const continent = ws.s.province_m.province_container.get<province::continent>(ws.w.nation_s.nations.get<nation::current_capital>(n));
+
+		ve::execute_serial<nations::country_tag>(vsize, influence_gain_operation(ws, row, n, continent, influence_per_priority));
+	}
+
 	void daily_influence_update(world_state& ws) {
+		auto const vsize = ws.w.nation_s.nations.vector_size();
 		auto const gp_range = get_range(ws.w.nation_s.nations_arrays, ws.w.nation_s.nations_by_rank);
-		concurrency::parallel_for(0, 8, 1, [&ws, gp_range](int32_t i) {
-			if(gp_range.first + i < gp_range.second && nation_exists(ws, gp_range.first[i]) && is_great_power(ws, gp_range.first[i])) {
-				update_nation_influence(ws, gp_range.first[i]);
-			}
+
+		concurrency::parallel_for(0, great_power_count, 1, [&ws, gp_range, vsize](int32_t i) {
+			auto const gp = (gp_range.first + i < gp_range.second && nation_exists(ws, gp_range.first[i]) && is_great_power(ws, gp_range.first[i]))
+				? gp_range.first[i] : nations::country_tag();
+			gather_influence_row(ws, i, gp, vsize);
+			if(is_valid_index(gp))
+				update_nation_influence(ws, i, vsize);
 		});
-		concurrency::concurrent_queue<sphere_member_change, concurrent_allocator<sphere_member_change>> sphere_changes;
-		ws.w.nation_s.nations.parallel_for_each([&ws, &sphere_changes](nations::country_tag n) {
-			update_influencers(ws, n, sphere_changes);
+
+		std::vector<nations::country_tag> marked_targets;
+		ve::execute_serial<nations::country_tag>(vsize, influence_decay_operation(ws, marked_targets));
+
+		std::vector<sphere_member_change> sphere_changes;
+		for(auto n : marked_targets)
+			apply_influence_marks(ws, n, sphere_changes);
+
+		concurrency::parallel_for(0, great_power_count, 1, [&ws](int32_t i) {
+			scatter_influence_row(ws, i);
 		});
-		sphere_member_change r;
-		while(sphere_changes.try_pop(r)) {
+
+		for(auto& r : sphere_changes) {
 			if(r.add) {
 				add_item(ws.w.nation_s.nations_arrays, ws.w.nation_s.nations.get<nation::sphere_members>(r.sphere_leader), r.sphere_member);
 			} else {
@@ -1607,5 +1672,17 @@ namespace nations {
 				}
 			}
 		}
+
+		// the influence of every great power, and that over each nation it has influence with, moved
+		std::vector<ui::data_key> changed;
+		for(int32_t i = 0; i < great_power_count; ++i) {
+			auto const gp = ws.w.nation_s.influence_gps[i];
+			if(!is_valid_index(gp))
+				continue;
+			changed.push_back(ui::data_key{ ui::world_data::nation_relations, uint16_t(to_index(gp)) });
+			for(auto& inf : get_range(ws.w.nation_s.influence_arrays, ws.w.nation_s.nations.get<nation::gp_influence>(gp)))
+				changed.push_back(ui::data_key{ ui::world_data::nation_relations, uint16_t(to_index(inf.target)) });
+		}
+		ws.w.gui_m.publish_changes(changed);
 	}
 }
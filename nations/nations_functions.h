@@ -142,7 +142,9 @@ namespace nations {
 	int32_t calculate_industrial_score(world_state const& ws, nations::country_tag this_nation);
 	int32_t calculate_military_score(world_state const& ws, nations::country_tag this_nation);
 
+	// re-ranks only when scores changed; nations_state::rank_changed_nations lists the nations whose ranks moved
 	void update_nation_ranks(world_state& ws);
+	void rebuild_nation_ranks(world_state& ws); // ranks and reports every nation; after loading
 	void civilize_nation(world_state& ws, nations::country_tag this_nation);
 	void uncivilize_nation(world_state& ws, nations::country_tag this_nation);
 	void perform_nationalization(world_state& ws, nations::country_tag this_nation);
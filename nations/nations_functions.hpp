@@ -189,7 +189,7 @@ namespace nations {
 
 	template<typename T>
 	auto is_great_power(world_state const& ws, T this_nation)-> decltype(ve::widen_to<T>(true)) {
-		return ve::load(this_nation, ws.w.nation_s.nations.get_row<nation::overall_rank>()) <= 8i16;
+		return ve::load(this_nation, ws.w.nation_s.nations.get_row<nation::overall_rank>()) <= int16_t(great_power_count);
 	}
 
 	template<typename T>
@@ -5,6 +5,18 @@ namespace nations {
 	void close_button::button_function(ui::simple_button<close_button>&, world_state& ws) {
 		ws.w.diplomacy_w.hide_diplomacy_window(ws.w.gui_m);
 	}
+	void diplomacy_window_base::update(world_state& ws) {
+		// the great powers and the nation list show the scores, ranks, spheres and influence of every nation, and the
+		// cb tab their cb construction; the details pane also shows the population of the selected nation
+		ws.w.nation_s.nations.for_each([&ws](nations::country_tag n) {
+			auto const index = uint16_t(to_index(n));
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_rank, index });
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_scores, index });
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_relations, index });
+		});
+		if(auto const selected = ws.w.diplomacy_w.selected_nation; is_valid_index(selected))
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_demographics, uint16_t(to_index(selected)) });
+	}
 	void diplomacy_tab_button_group::on_select(world_state & ws, uint32_t i) {
 		if(i == 0) {
 			ws.w.diplomacy_w.show_diplomacy_window_gp(ws.w.gui_m);
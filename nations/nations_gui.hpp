@@ -93,6 +93,7 @@ namespace nations {
 		
 		template<typename W>
 		void on_create(W& w, world_state&);
+		void update(world_state& ws);
 	};
 
 	class close_button {
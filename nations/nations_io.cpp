@@ -519,6 +519,7 @@ namespace nations {
 			ws.w.nation_s.active_technologies.set(target_nation, technologies::tech_tag(technologies::tech_tag::value_base_t(i)), bit_vector_test(npo.tech_bit_vector.data(), i));
 			//tech_row.data()[i] = npo.tech_bit_vector[i];
 		}
+		technologies::update_invention_candidates(ws, target_nation);
 
 		for(int32_t i = 0; i < ws.s.issues_m.issues_container.size(); ++i) {
 			auto itag = issues::issue_tag(issues::issue_tag::value_base_t(i));
@@ -2,6 +2,7 @@
 #include "common\\shared_tags.h"
 #include "concurrency_tools\\ve.h"
 #include "simple_serialize\\simple_serialize.hpp"
+#include "concurrency_tools\\access_profiling.h"
 
 #pragma warning( push )
 #pragma warning( disable : 4324 )
@@ -143,6 +144,9 @@ namespace state {
 			 std::array<economy::factory_instance, state::factories_count> values[(sizeof(std::array<economy::factory_instance, state::factories_count>) <= 64 ? (uint32_t(900) + (64ui32 / uint32_t(sizeof(std::array<economy::factory_instance, state::factories_count>))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(std::array<economy::factory_instance, state::factories_count>)) - 1ui32) : uint32_t(900))]; 
 			 dtype_19() { std::uninitialized_value_construct_n(values - 1, (sizeof(std::array<economy::factory_instance, state::factories_count>) <= 64 ? (uint32_t(900) + (64ui32 / uint32_t(sizeof(std::array<economy::factory_instance, state::factories_count>))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(std::array<economy::factory_instance, state::factories_count>)) - 1ui32) : uint32_t(900)) + 1); }
 		 } m_19;
+#ifdef CONTAINER_ACCESS_PROFILING
+		 inline static access_profiling::container_profile profile{ "state", { "is_slave_state", "is_colonial", "is_protectorate", "dominant_religion", "dominant_ideology", "dominant_issue", "region_id", "crisis_tag", "dominant_culture", "state_capital", "name", "current_tension", "administrative_efficiency", "total_population", "flashpoint_tension_focuses", "project", "owner_national_focus", "owner", "colonizers", "factories" }, { "bitfield_type", "bitfield_type", "bitfield_type", "cultures::religion_tag", "ideologies::ideology_tag", "issues::option_tag", "provinces::state_tag", "cultures::national_tag", "cultures::culture_tag", "provinces::province_tag", "text_data::text_tag", "float", "float", "float", "set_tag<nations::country_tag>", "nations::pop_project", "modifiers::national_focus_tag", "nations::country_tag", "std::array<std::pair<nations::country_tag, int32_t>, state::colonizers_count>", "std::array<economy::factory_instance, state::factories_count>" }, { 0, 0, 0, sizeof(cultures::religion_tag), sizeof(ideologies::ideology_tag), sizeof(issues::option_tag), sizeof(provinces::state_tag), sizeof(cultures::national_tag), sizeof(cultures::culture_tag), sizeof(provinces::province_tag), sizeof(text_data::text_tag), sizeof(float), sizeof(float), sizeof(float), sizeof(set_tag<nations::country_tag>), sizeof(nations::pop_project), sizeof(modifiers::national_focus_tag), sizeof(nations::country_tag), sizeof(std::array<std::pair<nations::country_tag, int32_t>, state::colonizers_count>), sizeof(std::array<economy::factory_instance, state::factories_count>) } };
+#endif
 
 		 public:
 		 friend class serialization::serializer<container>;
@@ -155,458 +159,572 @@ namespace state {
 
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, is_slave_state>, bool> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_0.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(nations::state_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, is_slave_state>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(bitfield_type));
 			 bit_vector_set(m_0.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, is_slave_state>, tagged_array_view<bitfield_type, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, nations::state_tag>(m_0.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, is_slave_state>, tagged_array_view<bitfield_type const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, nations::state_tag>(m_0.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, is_colonial>, bool> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_1.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(nations::state_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, is_colonial>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(bitfield_type));
 			 bit_vector_set(m_1.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, is_colonial>, tagged_array_view<bitfield_type, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, nations::state_tag>(m_1.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, is_colonial>, tagged_array_view<bitfield_type const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, nations::state_tag>(m_1.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, is_protectorate>, bool> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_2.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(nations::state_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, is_protectorate>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(bitfield_type));
 			 bit_vector_set(m_2.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, is_protectorate>, tagged_array_view<bitfield_type, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, nations::state_tag>(m_2.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, is_protectorate>, tagged_array_view<bitfield_type const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, nations::state_tag>(m_2.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, dominant_religion>, cultures::religion_tag&> get(nations::state_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(cultures::religion_tag));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, dominant_religion>, cultures::religion_tag const&> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(cultures::religion_tag));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, dominant_religion>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(cultures::religion_tag));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, dominant_religion>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(cultures::religion_tag));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, dominant_religion>, tagged_array_view<cultures::religion_tag, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(cultures::religion_tag));
 			 return tagged_array_view<cultures::religion_tag, nations::state_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, dominant_religion>, tagged_array_view<cultures::religion_tag const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(cultures::religion_tag));
 			 return tagged_array_view<cultures::religion_tag const, nations::state_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, dominant_ideology>, ideologies::ideology_tag&> get(nations::state_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(ideologies::ideology_tag));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, dominant_ideology>, ideologies::ideology_tag const&> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(ideologies::ideology_tag));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, dominant_ideology>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(ideologies::ideology_tag));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, dominant_ideology>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(ideologies::ideology_tag));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, dominant_ideology>, tagged_array_view<ideologies::ideology_tag, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(ideologies::ideology_tag));
 			 return tagged_array_view<ideologies::ideology_tag, nations::state_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, dominant_ideology>, tagged_array_view<ideologies::ideology_tag const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(ideologies::ideology_tag));
 			 return tagged_array_view<ideologies::ideology_tag const, nations::state_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, dominant_issue>, issues::option_tag&> get(nations::state_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(issues::option_tag));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, dominant_issue>, issues::option_tag const&> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(issues::option_tag));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, dominant_issue>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(issues::option_tag));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, dominant_issue>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(issues::option_tag));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, dominant_issue>, tagged_array_view<issues::option_tag, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(issues::option_tag));
 			 return tagged_array_view<issues::option_tag, nations::state_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, dominant_issue>, tagged_array_view<issues::option_tag const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(issues::option_tag));
 			 return tagged_array_view<issues::option_tag const, nations::state_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, region_id>, provinces::state_tag&> get(nations::state_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get, sizeof(provinces::state_tag));
 			 return m_6.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, region_id>, provinces::state_tag const&> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get, sizeof(provinces::state_tag));
 			 return m_6.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, region_id>> {
+			 CONTAINER_ACCESS_RECORD(profile, 6, set, sizeof(provinces::state_tag));
 			 m_6.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, region_id>> {
+			 CONTAINER_ACCESS_RECORD(profile, 6, set, sizeof(provinces::state_tag));
 			 m_6.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, region_id>, tagged_array_view<provinces::state_tag, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get_row, uint64_t(size_used) * sizeof(provinces::state_tag));
 			 return tagged_array_view<provinces::state_tag, nations::state_tag>(m_6.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, region_id>, tagged_array_view<provinces::state_tag const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get_row, uint64_t(size_used) * sizeof(provinces::state_tag));
 			 return tagged_array_view<provinces::state_tag const, nations::state_tag>(m_6.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, crisis_tag>, cultures::national_tag&> get(nations::state_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get, sizeof(cultures::national_tag));
 			 return m_7.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, crisis_tag>, cultures::national_tag const&> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get, sizeof(cultures::national_tag));
 			 return m_7.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, crisis_tag>> {
+			 CONTAINER_ACCESS_RECORD(profile, 7, set, sizeof(cultures::national_tag));
 			 m_7.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, crisis_tag>> {
+			 CONTAINER_ACCESS_RECORD(profile, 7, set, sizeof(cultures::national_tag));
 			 m_7.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, crisis_tag>, tagged_array_view<cultures::national_tag, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get_row, uint64_t(size_used) * sizeof(cultures::national_tag));
 			 return tagged_array_view<cultures::national_tag, nations::state_tag>(m_7.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, crisis_tag>, tagged_array_view<cultures::national_tag const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get_row, uint64_t(size_used) * sizeof(cultures::national_tag));
 			 return tagged_array_view<cultures::national_tag const, nations::state_tag>(m_7.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, dominant_culture>, cultures::culture_tag&> get(nations::state_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get, sizeof(cultures::culture_tag));
 			 return m_8.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, dominant_culture>, cultures::culture_tag const&> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get, sizeof(cultures::culture_tag));
 			 return m_8.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, dominant_culture>> {
+			 CONTAINER_ACCESS_RECORD(profile, 8, set, sizeof(cultures::culture_tag));
 			 m_8.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, dominant_culture>> {
+			 CONTAINER_ACCESS_RECORD(profile, 8, set, sizeof(cultures::culture_tag));
 			 m_8.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, dominant_culture>, tagged_array_view<cultures::culture_tag, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get_row, uint64_t(size_used) * sizeof(cultures::culture_tag));
 			 return tagged_array_view<cultures::culture_tag, nations::state_tag>(m_8.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, dominant_culture>, tagged_array_view<cultures::culture_tag const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get_row, uint64_t(size_used) * sizeof(cultures::culture_tag));
 			 return tagged_array_view<cultures::culture_tag const, nations::state_tag>(m_8.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, state_capital>, provinces::province_tag&> get(nations::state_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get, sizeof(provinces::province_tag));
 			 return m_9.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, state_capital>, provinces::province_tag const&> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get, sizeof(provinces::province_tag));
 			 return m_9.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, state_capital>> {
+			 CONTAINER_ACCESS_RECORD(profile, 9, set, sizeof(provinces::province_tag));
 			 m_9.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, state_capital>> {
+			 CONTAINER_ACCESS_RECORD(profile, 9, set, sizeof(provinces::province_tag));
 			 m_9.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, state_capital>, tagged_array_view<provinces::province_tag, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get_row, uint64_t(size_used) * sizeof(provinces::province_tag));
 			 return tagged_array_view<provinces::province_tag, nations::state_tag>(m_9.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, state_capital>, tagged_array_view<provinces::province_tag const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get_row, uint64_t(size_used) * sizeof(provinces::province_tag));
 			 return tagged_array_view<provinces::province_tag const, nations::state_tag>(m_9.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, name>, text_data::text_tag&> get(nations::state_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get, sizeof(text_data::text_tag));
 			 return m_10.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, name>, text_data::text_tag const&> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get, sizeof(text_data::text_tag));
 			 return m_10.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, name>> {
+			 CONTAINER_ACCESS_RECORD(profile, 10, set, sizeof(text_data::text_tag));
 			 m_10.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, name>> {
+			 CONTAINER_ACCESS_RECORD(profile, 10, set, sizeof(text_data::text_tag));
 			 m_10.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, name>, tagged_array_view<text_data::text_tag, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get_row, uint64_t(size_used) * sizeof(text_data::text_tag));
 			 return tagged_array_view<text_data::text_tag, nations::state_tag>(m_10.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, name>, tagged_array_view<text_data::text_tag const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get_row, uint64_t(size_used) * sizeof(text_data::text_tag));
 			 return tagged_array_view<text_data::text_tag const, nations::state_tag>(m_10.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, current_tension>, float&> get(nations::state_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get, sizeof(float));
 			 return m_11.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, current_tension>, float const&> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get, sizeof(float));
 			 return m_11.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, current_tension>> {
+			 CONTAINER_ACCESS_RECORD(profile, 11, set, sizeof(float));
 			 m_11.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, current_tension>> {
+			 CONTAINER_ACCESS_RECORD(profile, 11, set, sizeof(float));
 			 m_11.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, current_tension>, tagged_array_view<float, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::state_tag>(m_11.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, current_tension>, tagged_array_view<float const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::state_tag>(m_11.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, administrative_efficiency>, float&> get(nations::state_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get, sizeof(float));
 			 return m_12.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, administrative_efficiency>, float const&> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get, sizeof(float));
 			 return m_12.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, administrative_efficiency>> {
+			 CONTAINER_ACCESS_RECORD(profile, 12, set, sizeof(float));
 			 m_12.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, administrative_efficiency>> {
+			 CONTAINER_ACCESS_RECORD(profile, 12, set, sizeof(float));
 			 m_12.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, administrative_efficiency>, tagged_array_view<float, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::state_tag>(m_12.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, administrative_efficiency>, tagged_array_view<float const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::state_tag>(m_12.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, total_population>, float&> get(nations::state_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get, sizeof(float));
 			 return m_13.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, total_population>, float const&> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get, sizeof(float));
 			 return m_13.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, total_population>> {
+			 CONTAINER_ACCESS_RECORD(profile, 13, set, sizeof(float));
 			 m_13.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, total_population>> {
+			 CONTAINER_ACCESS_RECORD(profile, 13, set, sizeof(float));
 			 m_13.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, total_population>, tagged_array_view<float, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, nations::state_tag>(m_13.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, total_population>, tagged_array_view<float const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, nations::state_tag>(m_13.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, flashpoint_tension_focuses>, set_tag<nations::country_tag>&> get(nations::state_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 14, get, sizeof(set_tag<nations::country_tag>));
 			 return m_14.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, flashpoint_tension_focuses>, set_tag<nations::country_tag> const&> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 14, get, sizeof(set_tag<nations::country_tag>));
 			 return m_14.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, flashpoint_tension_focuses>> {
+			 CONTAINER_ACCESS_RECORD(profile, 14, set, sizeof(set_tag<nations::country_tag>));
 			 m_14.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, flashpoint_tension_focuses>> {
+			 CONTAINER_ACCESS_RECORD(profile, 14, set, sizeof(set_tag<nations::country_tag>));
 			 m_14.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, flashpoint_tension_focuses>, tagged_array_view<set_tag<nations::country_tag>, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 14, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag>, nations::state_tag>(m_14.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, flashpoint_tension_focuses>, tagged_array_view<set_tag<nations::country_tag> const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 14, get_row, uint64_t(size_used) * sizeof(set_tag<nations::country_tag>));
 			 return tagged_array_view<set_tag<nations::country_tag> const, nations::state_tag>(m_14.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, project>, nations::pop_project&> get(nations::state_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 15, get, sizeof(nations::pop_project));
 			 return m_15.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, project>, nations::pop_project const&> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 15, get, sizeof(nations::pop_project));
 			 return m_15.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, project>> {
+			 CONTAINER_ACCESS_RECORD(profile, 15, set, sizeof(nations::pop_project));
 			 m_15.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, project>> {
+			 CONTAINER_ACCESS_RECORD(profile, 15, set, sizeof(nations::pop_project));
 			 m_15.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, project>, tagged_array_view<nations::pop_project, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 15, get_row, uint64_t(size_used) * sizeof(nations::pop_project));
 			 return tagged_array_view<nations::pop_project, nations::state_tag>(m_15.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, project>, tagged_array_view<nations::pop_project const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 15, get_row, uint64_t(size_used) * sizeof(nations::pop_project));
 			 return tagged_array_view<nations::pop_project const, nations::state_tag>(m_15.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, owner_national_focus>, modifiers::national_focus_tag&> get(nations::state_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 16, get, sizeof(modifiers::national_focus_tag));
 			 return m_16.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, owner_national_focus>, modifiers::national_focus_tag const&> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 16, get, sizeof(modifiers::national_focus_tag));
 			 return m_16.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, owner_national_focus>> {
+			 CONTAINER_ACCESS_RECORD(profile, 16, set, sizeof(modifiers::national_focus_tag));
 			 m_16.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, owner_national_focus>> {
+			 CONTAINER_ACCESS_RECORD(profile, 16, set, sizeof(modifiers::national_focus_tag));
 			 m_16.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, owner_national_focus>, tagged_array_view<modifiers::national_focus_tag, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 16, get_row, uint64_t(size_used) * sizeof(modifiers::national_focus_tag));
 			 return tagged_array_view<modifiers::national_focus_tag, nations::state_tag>(m_16.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, owner_national_focus>, tagged_array_view<modifiers::national_focus_tag const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 16, get_row, uint64_t(size_used) * sizeof(modifiers::national_focus_tag));
 			 return tagged_array_view<modifiers::national_focus_tag const, nations::state_tag>(m_16.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, owner>, nations::country_tag&> get(nations::state_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 17, get, sizeof(nations::country_tag));
 			 return m_17.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, owner>, nations::country_tag const&> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 17, get, sizeof(nations::country_tag));
 			 return m_17.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, owner>> {
+			 CONTAINER_ACCESS_RECORD(profile, 17, set, sizeof(nations::country_tag));
 			 m_17.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, owner>> {
+			 CONTAINER_ACCESS_RECORD(profile, 17, set, sizeof(nations::country_tag));
 			 m_17.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, owner>, tagged_array_view<nations::country_tag, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 17, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag, nations::state_tag>(m_17.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, owner>, tagged_array_view<nations::country_tag const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 17, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag const, nations::state_tag>(m_17.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, colonizers>, std::array<std::pair<nations::country_tag, int32_t>, state::colonizers_count>&> get(nations::state_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 18, get, sizeof(std::array<std::pair<nations::country_tag, int32_t>, state::colonizers_count>));
 			 return m_18.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, colonizers>, std::array<std::pair<nations::country_tag, int32_t>, state::colonizers_count> const&> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 18, get, sizeof(std::array<std::pair<nations::country_tag, int32_t>, state::colonizers_count>));
 			 return m_18.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, colonizers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 18, set, sizeof(std::array<std::pair<nations::country_tag, int32_t>, state::colonizers_count>));
 			 m_18.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, colonizers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 18, set, sizeof(std::array<std::pair<nations::country_tag, int32_t>, state::colonizers_count>));
 			 m_18.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, colonizers>, tagged_array_view<std::array<std::pair<nations::country_tag, int32_t>, state::colonizers_count>, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 18, get_row, uint64_t(size_used) * sizeof(std::array<std::pair<nations::country_tag, int32_t>, state::colonizers_count>));
 			 return tagged_array_view<std::array<std::pair<nations::country_tag, int32_t>, state::colonizers_count>, nations::state_tag>(m_18.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, colonizers>, tagged_array_view<std::array<std::pair<nations::country_tag, int32_t>, state::colonizers_count> const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 18, get_row, uint64_t(size_used) * sizeof(std::array<std::pair<nations::country_tag, int32_t>, state::colonizers_count>));
 			 return tagged_array_view<std::array<std::pair<nations::country_tag, int32_t>, state::colonizers_count> const, nations::state_tag>(m_18.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, factories>, std::array<economy::factory_instance, state::factories_count>&> get(nations::state_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 19, get, sizeof(std::array<economy::factory_instance, state::factories_count>));
 			 return m_19.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, factories>, std::array<economy::factory_instance, state::factories_count> const&> get(nations::state_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 19, get, sizeof(std::array<economy::factory_instance, state::factories_count>));
 			 return m_19.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, factories>> {
+			 CONTAINER_ACCESS_RECORD(profile, 19, set, sizeof(std::array<economy::factory_instance, state::factories_count>));
 			 m_19.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(nations::state_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, factories>> {
+			 CONTAINER_ACCESS_RECORD(profile, 19, set, sizeof(std::array<economy::factory_instance, state::factories_count>));
 			 m_19.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, factories>, tagged_array_view<std::array<economy::factory_instance, state::factories_count>, nations::state_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 19, get_row, uint64_t(size_used) * sizeof(std::array<economy::factory_instance, state::factories_count>));
 			 return tagged_array_view<std::array<economy::factory_instance, state::factories_count>, nations::state_tag>(m_19.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, factories>, tagged_array_view<std::array<economy::factory_instance, state::factories_count> const, nations::state_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 19, get_row, uint64_t(size_used) * sizeof(std::array<economy::factory_instance, state::factories_count>));
 			 return tagged_array_view<std::array<economy::factory_instance, state::factories_count> const, nations::state_tag>(m_19.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 
@@ -2,6 +2,7 @@
 #include "common\\shared_tags.h"
 #include "concurrency_tools\\ve.h"
 #include "simple_serialize\\simple_serialize.hpp"
+#include "concurrency_tools\\access_profiling.h"
 
 #pragma warning( push )
 #pragma warning( disable : 4324 )
@@ -36,6 +37,19 @@ namespace pop {
 	struct militancy;
 	struct consciousness;
 
+	constexpr int32_t max_count = pop::container_size;
+
+	struct group_0_block {
+		 alignas(sizeof(population::pop_type_tag) * ve::vector_size) population::pop_type_tag v3[ve::vector_size];
+		 alignas(sizeof(cultures::religion_tag) * ve::vector_size) cultures::religion_tag v4[ve::vector_size];
+		 alignas(sizeof(cultures::culture_tag) * ve::vector_size) cultures::culture_tag v5[ve::vector_size];
+		 alignas(sizeof(float) * ve::vector_size) float v7[ve::vector_size];
+		 alignas(sizeof(float) * ve::vector_size) float v17[ve::vector_size];
+		 alignas(sizeof(float) * ve::vector_size) float v18[ve::vector_size];
+		 alignas(sizeof(float) * ve::vector_size) float v19[ve::vector_size];
+		 alignas(sizeof(float) * ve::vector_size) float v20[ve::vector_size];
+	};
+
 	class alignas(64) container {
 		 int32_t size_used = 0;
 		 population::pop_tag first_free;
@@ -59,31 +73,11 @@ namespace pop {
 			 bitfield_type values[((uint32_t(pop::container_size + 7)) / 8ui32 + 63ui32) & ~63ui32]; 
 			 dtype_2() { std::fill_n(values - 1, 1 + ((uint32_t(pop::container_size + 7)) / 8ui32 + 63ui32) & ~63ui32, bitfield_type{ 0ui8 }); }
 		 } m_2;
-		 struct alignas(64) dtype_3 { 
-			 uint8_t padding[(sizeof(population::pop_type_tag) + 63ui32) & ~63ui32]; 
-			 population::pop_type_tag values[(sizeof(population::pop_type_tag) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(population::pop_type_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(population::pop_type_tag)) - 1ui32) : uint32_t(pop::container_size))]; 
-			 dtype_3() { std::uninitialized_value_construct_n(values - 1, (sizeof(population::pop_type_tag) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(population::pop_type_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(population::pop_type_tag)) - 1ui32) : uint32_t(pop::container_size)) + 1); }
-		 } m_3;
-		 struct alignas(64) dtype_4 { 
-			 uint8_t padding[(sizeof(cultures::religion_tag) + 63ui32) & ~63ui32]; 
-			 cultures::religion_tag values[(sizeof(cultures::religion_tag) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(cultures::religion_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(cultures::religion_tag)) - 1ui32) : uint32_t(pop::container_size))]; 
-			 dtype_4() { std::uninitialized_value_construct_n(values - 1, (sizeof(cultures::religion_tag) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(cultures::religion_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(cultures::religion_tag)) - 1ui32) : uint32_t(pop::container_size)) + 1); }
-		 } m_4;
-		 struct alignas(64) dtype_5 { 
-			 uint8_t padding[(sizeof(cultures::culture_tag) + 63ui32) & ~63ui32]; 
-			 cultures::culture_tag values[(sizeof(cultures::culture_tag) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(cultures::culture_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(cultures::culture_tag)) - 1ui32) : uint32_t(pop::container_size))]; 
-			 dtype_5() { std::uninitialized_value_construct_n(values - 1, (sizeof(cultures::culture_tag) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(cultures::culture_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(cultures::culture_tag)) - 1ui32) : uint32_t(pop::container_size)) + 1); }
-		 } m_5;
 		 struct alignas(64) dtype_6 { 
 			 uint8_t padding[(sizeof(provinces::province_tag) + 63ui32) & ~63ui32]; 
 			 provinces::province_tag values[(sizeof(provinces::province_tag) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(provinces::province_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(provinces::province_tag)) - 1ui32) : uint32_t(pop::container_size))]; 
 			 dtype_6() { std::uninitialized_value_construct_n(values - 1, (sizeof(provinces::province_tag) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(provinces::province_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(provinces::province_tag)) - 1ui32) : uint32_t(pop::container_size)) + 1); }
 		 } m_6;
-		 struct alignas(64) dtype_7 { 
-			 uint8_t padding[(sizeof(float) + 63ui32) & ~63ui32]; 
-			 float values[(sizeof(float) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(float))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(float)) - 1ui32) : uint32_t(pop::container_size))]; 
-			 dtype_7() { std::uninitialized_value_construct_n(values - 1, (sizeof(float) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(float))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(float)) - 1ui32) : uint32_t(pop::container_size)) + 1); }
-		 } m_7;
 		 struct alignas(64) dtype_8 { 
 			 uint8_t padding[(sizeof(float) + 63ui32) & ~63ui32]; 
 			 float values[(sizeof(float) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(float))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(float)) - 1ui32) : uint32_t(pop::container_size))]; 
@@ -115,40 +109,28 @@ namespace pop {
 			 dtype_13() { std::uninitialized_value_construct_n(values - 1, (sizeof(float) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(float))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(float)) - 1ui32) : uint32_t(pop::container_size)) + 1); }
 		 } m_13;
 		 struct alignas(64) dtype_14 { 
-			 uint8_t padding[(sizeof(float) + 63ui32) & ~63ui32]; 
-			 float values[(sizeof(float) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(float))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(float)) - 1ui32) : uint32_t(pop::container_size))]; 
-			 dtype_14() { std::uninitialized_value_construct_n(values - 1, (sizeof(float) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(float))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(float)) - 1ui32) : uint32_t(pop::container_size)) + 1); }
+			 uint8_t padding[(sizeof(unorm16_type) + 63ui32) & ~63ui32]; 
+			 unorm16_type values[(sizeof(unorm16_type) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(unorm16_type))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(unorm16_type)) - 1ui32) : uint32_t(pop::container_size))]; 
+			 dtype_14() { std::uninitialized_value_construct_n(values - 1, (sizeof(unorm16_type) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(unorm16_type))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(unorm16_type)) - 1ui32) : uint32_t(pop::container_size)) + 1); }
 		 } m_14;
 		 struct alignas(64) dtype_15 { 
-			 uint8_t padding[(sizeof(float) + 63ui32) & ~63ui32]; 
-			 float values[(sizeof(float) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(float))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(float)) - 1ui32) : uint32_t(pop::container_size))]; 
-			 dtype_15() { std::uninitialized_value_construct_n(values - 1, (sizeof(float) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(float))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(float)) - 1ui32) : uint32_t(pop::container_size)) + 1); }
+			 uint8_t padding[(sizeof(unorm16_type) + 63ui32) & ~63ui32]; 
+			 unorm16_type values[(sizeof(unorm16_type) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(unorm16_type))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(unorm16_type)) - 1ui32) : uint32_t(pop::container_size))]; 
+			 dtype_15() { std::uninitialized_value_construct_n(values - 1, (sizeof(unorm16_type) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(unorm16_type))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(unorm16_type)) - 1ui32) : uint32_t(pop::container_size)) + 1); }
 		 } m_15;
 		 struct alignas(64) dtype_16 { 
 			 uint8_t padding[(sizeof(float) + 63ui32) & ~63ui32]; 
 			 float values[(sizeof(float) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(float))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(float)) - 1ui32) : uint32_t(pop::container_size))]; 
 			 dtype_16() { std::uninitialized_value_construct_n(values - 1, (sizeof(float) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(float))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(float)) - 1ui32) : uint32_t(pop::container_size)) + 1); }
 		 } m_16;
-		 struct alignas(64) dtype_17 { 
-			 uint8_t padding[(sizeof(float) + 63ui32) & ~63ui32]; 
-			 float values[(sizeof(float) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(float))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(float)) - 1ui32) : uint32_t(pop::container_size))]; 
-			 dtype_17() { std::uninitialized_value_construct_n(values - 1, (sizeof(float) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(float))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(float)) - 1ui32) : uint32_t(pop::container_size)) + 1); }
-		 } m_17;
-		 struct alignas(64) dtype_18 { 
-			 uint8_t padding[(sizeof(float) + 63ui32) & ~63ui32]; 
-			 float values[(sizeof(float) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(float))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(float)) - 1ui32) : uint32_t(pop::container_size))]; 
-			 dtype_18() { std::uninitialized_value_construct_n(values - 1, (sizeof(float) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(float))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(float)) - 1ui32) : uint32_t(pop::container_size)) + 1); }
-		 } m_18;
-		 struct alignas(64) dtype_19 { 
-			 uint8_t padding[(sizeof(float) + 63ui32) & ~63ui32]; 
-			 float values[(sizeof(float) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(float))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(float)) - 1ui32) : uint32_t(pop::container_size))]; 
-			 dtype_19() { std::uninitialized_value_construct_n(values - 1, (sizeof(float) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(float))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(float)) - 1ui32) : uint32_t(pop::container_size)) + 1); }
-		 } m_19;
-		 struct alignas(64) dtype_20 { 
-			 uint8_t padding[(sizeof(float) + 63ui32) & ~63ui32]; 
-			 float values[(sizeof(float) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(float))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(float)) - 1ui32) : uint32_t(pop::container_size))]; 
-			 dtype_20() { std::uninitialized_value_construct_n(values - 1, (sizeof(float) <= 64 ? (uint32_t(pop::container_size) + (64ui32 / uint32_t(sizeof(float))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(float)) - 1ui32) : uint32_t(pop::container_size)) + 1); }
-		 } m_20;
+		 struct alignas(64) dtype_g0 { 
+			 group_0_block padding; 
+			 group_0_block values[(uint32_t(pop::container_size) + uint32_t(ve::vector_size - 1)) / uint32_t(ve::vector_size)]; 
+			 dtype_g0() { std::uninitialized_value_construct_n(values - 1, (uint32_t(pop::container_size) + uint32_t(ve::vector_size - 1)) / uint32_t(ve::vector_size) + 1); }
+		 } m_g0;
+#ifdef CONTAINER_ACCESS_PROFILING
+		 inline static access_profiling::container_profile profile{ "pop", { "is_accepted", "is_poor", "is_middle", "type", "religion", "culture", "location", "size", "size_change_from_combat", "size_change_from_growth", "size_change_from_type_change_away", "size_change_from_assimilation_away", "size_change_from_local_migration", "size_change_from_emigration", "political_interest", "social_interest", "money", "needs_satisfaction", "literacy", "militancy", "consciousness" }, { "bitfield_type", "bitfield_type", "bitfield_type", "population::pop_type_tag", "cultures::religion_tag", "cultures::culture_tag", "provinces::province_tag", "float", "float", "float", "float", "float", "float", "float", "unorm16_type", "unorm16_type", "float", "float", "float", "float", "float" }, { 0, 0, 0, sizeof(population::pop_type_tag), sizeof(cultures::religion_tag), sizeof(cultures::culture_tag), sizeof(provinces::province_tag), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(unorm16_type), sizeof(unorm16_type), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float) } };
+#endif
 
 		 public:
 		 friend class serialization::serializer<container>;
@@ -161,483 +143,543 @@ namespace pop {
 
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::is_accepted>, bool> get(population::pop_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_0.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(population::pop_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, pop::is_accepted>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(bitfield_type));
 			 bit_vector_set(m_0.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::is_accepted>, tagged_array_view<bitfield_type, population::pop_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, population::pop_tag>(m_0.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::is_accepted>, tagged_array_view<bitfield_type const, population::pop_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, population::pop_tag>(m_0.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::is_poor>, bool> get(population::pop_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_1.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(population::pop_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, pop::is_poor>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(bitfield_type));
 			 bit_vector_set(m_1.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::is_poor>, tagged_array_view<bitfield_type, population::pop_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, population::pop_tag>(m_1.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::is_poor>, tagged_array_view<bitfield_type const, population::pop_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, population::pop_tag>(m_1.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::is_middle>, bool> get(population::pop_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_2.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(population::pop_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, pop::is_middle>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(bitfield_type));
 			 bit_vector_set(m_2.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::is_middle>, tagged_array_view<bitfield_type, population::pop_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, population::pop_tag>(m_2.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::is_middle>, tagged_array_view<bitfield_type const, population::pop_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, population::pop_tag>(m_2.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::type>, population::pop_type_tag&> get(population::pop_tag i) {
-			 return m_3.values[to_index(i)];
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(population::pop_type_tag));
+			 return tagged_interleaved_view<population::pop_type_tag, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(population::pop_type_tag))>(m_g0.values[0].v3, size_used)[i];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::type>, population::pop_type_tag const&> get(population::pop_tag i) const {
-			 return m_3.values[to_index(i)];
-		 }
-		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::type>> {
-			 m_3.values[to_index(i)] = v;
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(population::pop_type_tag));
+			 return tagged_interleaved_view<population::pop_type_tag const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(population::pop_type_tag))>(m_g0.values[0].v3, size_used)[i];
 		 }
 		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::type>> {
-			 m_3.values[to_index(i)] = v;
+		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<std::is_same_v<INDEX, pop::type>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(population::pop_type_tag));
+			 tagged_interleaved_view<population::pop_type_tag, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(population::pop_type_tag))>(m_g0.values[0].v3, size_used)[i] = v;
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::type>, tagged_array_view<population::pop_type_tag, population::pop_tag>> get_row() {
-			 return tagged_array_view<population::pop_type_tag, population::pop_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::type>, tagged_interleaved_view<population::pop_type_tag, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(population::pop_type_tag))>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(population::pop_type_tag));
+			 return tagged_interleaved_view<population::pop_type_tag, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(population::pop_type_tag))>(m_g0.values[0].v3, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::type>, tagged_array_view<population::pop_type_tag const, population::pop_tag>> get_row() const {
-			 return tagged_array_view<population::pop_type_tag const, population::pop_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::type>, tagged_interleaved_view<population::pop_type_tag const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(population::pop_type_tag))>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(population::pop_type_tag));
+			 return tagged_interleaved_view<population::pop_type_tag const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(population::pop_type_tag))>(m_g0.values[0].v3, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::religion>, cultures::religion_tag&> get(population::pop_tag i) {
-			 return m_4.values[to_index(i)];
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(cultures::religion_tag));
+			 return tagged_interleaved_view<cultures::religion_tag, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(cultures::religion_tag))>(m_g0.values[0].v4, size_used)[i];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::religion>, cultures::religion_tag const&> get(population::pop_tag i) const {
-			 return m_4.values[to_index(i)];
-		 }
-		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::religion>> {
-			 m_4.values[to_index(i)] = v;
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(cultures::religion_tag));
+			 return tagged_interleaved_view<cultures::religion_tag const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(cultures::religion_tag))>(m_g0.values[0].v4, size_used)[i];
 		 }
 		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::religion>> {
-			 m_4.values[to_index(i)] = v;
+		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<std::is_same_v<INDEX, pop::religion>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(cultures::religion_tag));
+			 tagged_interleaved_view<cultures::religion_tag, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(cultures::religion_tag))>(m_g0.values[0].v4, size_used)[i] = v;
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::religion>, tagged_array_view<cultures::religion_tag, population::pop_tag>> get_row() {
-			 return tagged_array_view<cultures::religion_tag, population::pop_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::religion>, tagged_interleaved_view<cultures::religion_tag, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(cultures::religion_tag))>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(cultures::religion_tag));
+			 return tagged_interleaved_view<cultures::religion_tag, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(cultures::religion_tag))>(m_g0.values[0].v4, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::religion>, tagged_array_view<cultures::religion_tag const, population::pop_tag>> get_row() const {
-			 return tagged_array_view<cultures::religion_tag const, population::pop_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::religion>, tagged_interleaved_view<cultures::religion_tag const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(cultures::religion_tag))>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(cultures::religion_tag));
+			 return tagged_interleaved_view<cultures::religion_tag const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(cultures::religion_tag))>(m_g0.values[0].v4, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::culture>, cultures::culture_tag&> get(population::pop_tag i) {
-			 return m_5.values[to_index(i)];
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(cultures::culture_tag));
+			 return tagged_interleaved_view<cultures::culture_tag, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(cultures::culture_tag))>(m_g0.values[0].v5, size_used)[i];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::culture>, cultures::culture_tag const&> get(population::pop_tag i) const {
-			 return m_5.values[to_index(i)];
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(cultures::culture_tag));
+			 return tagged_interleaved_view<cultures::culture_tag const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(cultures::culture_tag))>(m_g0.values[0].v5, size_used)[i];
 		 }
 		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::culture>> {
-			 m_5.values[to_index(i)] = v;
-		 }
-		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::culture>> {
-			 m_5.values[to_index(i)] = v;
+		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<std::is_same_v<INDEX, pop::culture>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(cultures::culture_tag));
+			 tagged_interleaved_view<cultures::culture_tag, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(cultures::culture_tag))>(m_g0.values[0].v5, size_used)[i] = v;
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::culture>, tagged_array_view<cultures::culture_tag, population::pop_tag>> get_row() {
-			 return tagged_array_view<cultures::culture_tag, population::pop_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::culture>, tagged_interleaved_view<cultures::culture_tag, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(cultures::culture_tag))>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(cultures::culture_tag));
+			 return tagged_interleaved_view<cultures::culture_tag, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(cultures::culture_tag))>(m_g0.values[0].v5, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::culture>, tagged_array_view<cultures::culture_tag const, population::pop_tag>> get_row() const {
-			 return tagged_array_view<cultures::culture_tag const, population::pop_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::culture>, tagged_interleaved_view<cultures::culture_tag const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(cultures::culture_tag))>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(cultures::culture_tag));
+			 return tagged_interleaved_view<cultures::culture_tag const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(cultures::culture_tag))>(m_g0.values[0].v5, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::location>, provinces::province_tag&> get(population::pop_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get, sizeof(provinces::province_tag));
 			 return m_6.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::location>, provinces::province_tag const&> get(population::pop_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get, sizeof(provinces::province_tag));
 			 return m_6.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(population::pop_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::location>> {
+			 CONTAINER_ACCESS_RECORD(profile, 6, set, sizeof(provinces::province_tag));
 			 m_6.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::location>> {
+			 CONTAINER_ACCESS_RECORD(profile, 6, set, sizeof(provinces::province_tag));
 			 m_6.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::location>, tagged_array_view<provinces::province_tag, population::pop_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get_row, uint64_t(size_used) * sizeof(provinces::province_tag));
 			 return tagged_array_view<provinces::province_tag, population::pop_tag>(m_6.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::location>, tagged_array_view<provinces::province_tag const, population::pop_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get_row, uint64_t(size_used) * sizeof(provinces::province_tag));
 			 return tagged_array_view<provinces::province_tag const, population::pop_tag>(m_6.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size>, float&> get(population::pop_tag i) {
-			 return m_7.values[to_index(i)];
+			 CONTAINER_ACCESS_RECORD(profile, 7, get, sizeof(float));
+			 return tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v7, size_used)[i];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size>, float const&> get(population::pop_tag i) const {
-			 return m_7.values[to_index(i)];
+			 CONTAINER_ACCESS_RECORD(profile, 7, get, sizeof(float));
+			 return tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v7, size_used)[i];
 		 }
 		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::size>> {
-			 m_7.values[to_index(i)] = v;
-		 }
-		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::size>> {
-			 m_7.values[to_index(i)] = v;
+		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<std::is_same_v<INDEX, pop::size>> {
+			 CONTAINER_ACCESS_RECORD(profile, 7, set, sizeof(float));
+			 tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v7, size_used)[i] = v;
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::size>, tagged_array_view<float, population::pop_tag>> get_row() {
-			 return tagged_array_view<float, population::pop_tag>(m_7.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::size>, tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get_row, uint64_t(size_used) * sizeof(float));
+			 return tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v7, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::size>, tagged_array_view<float const, population::pop_tag>> get_row() const {
-			 return tagged_array_view<float const, population::pop_tag>(m_7.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::size>, tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get_row, uint64_t(size_used) * sizeof(float));
+			 return tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v7, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_combat>, float&> get(population::pop_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get, sizeof(float));
 			 return m_8.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_combat>, float const&> get(population::pop_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get, sizeof(float));
 			 return m_8.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(population::pop_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::size_change_from_combat>> {
+			 CONTAINER_ACCESS_RECORD(profile, 8, set, sizeof(float));
 			 m_8.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::size_change_from_combat>> {
+			 CONTAINER_ACCESS_RECORD(profile, 8, set, sizeof(float));
 			 m_8.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_combat>, tagged_array_view<float, population::pop_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, population::pop_tag>(m_8.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_combat>, tagged_array_view<float const, population::pop_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, population::pop_tag>(m_8.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_growth>, float&> get(population::pop_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get, sizeof(float));
 			 return m_9.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_growth>, float const&> get(population::pop_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get, sizeof(float));
 			 return m_9.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(population::pop_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::size_change_from_growth>> {
+			 CONTAINER_ACCESS_RECORD(profile, 9, set, sizeof(float));
 			 m_9.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::size_change_from_growth>> {
+			 CONTAINER_ACCESS_RECORD(profile, 9, set, sizeof(float));
 			 m_9.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_growth>, tagged_array_view<float, population::pop_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, population::pop_tag>(m_9.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_growth>, tagged_array_view<float const, population::pop_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, population::pop_tag>(m_9.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_type_change_away>, float&> get(population::pop_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get, sizeof(float));
 			 return m_10.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_type_change_away>, float const&> get(population::pop_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get, sizeof(float));
 			 return m_10.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(population::pop_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::size_change_from_type_change_away>> {
+			 CONTAINER_ACCESS_RECORD(profile, 10, set, sizeof(float));
 			 m_10.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::size_change_from_type_change_away>> {
+			 CONTAINER_ACCESS_RECORD(profile, 10, set, sizeof(float));
 			 m_10.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_type_change_away>, tagged_array_view<float, population::pop_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, population::pop_tag>(m_10.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_type_change_away>, tagged_array_view<float const, population::pop_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, population::pop_tag>(m_10.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_assimilation_away>, float&> get(population::pop_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get, sizeof(float));
 			 return m_11.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_assimilation_away>, float const&> get(population::pop_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get, sizeof(float));
 			 return m_11.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(population::pop_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::size_change_from_assimilation_away>> {
+			 CONTAINER_ACCESS_RECORD(profile, 11, set, sizeof(float));
 			 m_11.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::size_change_from_assimilation_away>> {
+			 CONTAINER_ACCESS_RECORD(profile, 11, set, sizeof(float));
 			 m_11.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_assimilation_away>, tagged_array_view<float, population::pop_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, population::pop_tag>(m_11.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_assimilation_away>, tagged_array_view<float const, population::pop_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, population::pop_tag>(m_11.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_local_migration>, float&> get(population::pop_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get, sizeof(float));
 			 return m_12.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_local_migration>, float const&> get(population::pop_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get, sizeof(float));
 			 return m_12.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(population::pop_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::size_change_from_local_migration>> {
+			 CONTAINER_ACCESS_RECORD(profile, 12, set, sizeof(float));
 			 m_12.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::size_change_from_local_migration>> {
+			 CONTAINER_ACCESS_RECORD(profile, 12, set, sizeof(float));
 			 m_12.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_local_migration>, tagged_array_view<float, population::pop_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, population::pop_tag>(m_12.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_local_migration>, tagged_array_view<float const, population::pop_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, population::pop_tag>(m_12.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_emigration>, float&> get(population::pop_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get, sizeof(float));
 			 return m_13.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_emigration>, float const&> get(population::pop_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get, sizeof(float));
 			 return m_13.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(population::pop_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::size_change_from_emigration>> {
+			 CONTAINER_ACCESS_RECORD(profile, 13, set, sizeof(float));
 			 m_13.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::size_change_from_emigration>> {
+			 CONTAINER_ACCESS_RECORD(profile, 13, set, sizeof(float));
 			 m_13.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_emigration>, tagged_array_view<float, population::pop_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, population::pop_tag>(m_13.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::size_change_from_emigration>, tagged_array_view<float const, population::pop_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, population::pop_tag>(m_13.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::political_interest>, float&> get(population::pop_tag i) {
-			 return m_14.values[to_index(i)];
+		 std::enable_if_t<std::is_same_v<INDEX, pop::political_interest>, float> get(population::pop_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 14, get, sizeof(unorm16_type));
+			 return dequantize(m_14.values[to_index(i)]);
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::political_interest>, float const&> get(population::pop_tag i) const {
-			 return m_14.values[to_index(i)];
-		 }
-		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::political_interest>> {
-			 m_14.values[to_index(i)] = v;
-		 }
-		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::political_interest>> {
-			 m_14.values[to_index(i)] = v;
+		 auto set(population::pop_tag i, float v) -> std::enable_if_t<std::is_same_v<INDEX, pop::political_interest>> {
+			 CONTAINER_ACCESS_RECORD(profile, 14, set, sizeof(unorm16_type));
+			 m_14.values[to_index(i)] = quantize<unorm16_type>(v);
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::political_interest>, tagged_array_view<float, population::pop_tag>> get_row() {
-			 return tagged_array_view<float, population::pop_tag>(m_14.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::political_interest>, tagged_array_view<unorm16_type, population::pop_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 14, get_row, uint64_t(size_used) * sizeof(unorm16_type));
+			 return tagged_array_view<unorm16_type, population::pop_tag>(m_14.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::political_interest>, tagged_array_view<float const, population::pop_tag>> get_row() const {
-			 return tagged_array_view<float const, population::pop_tag>(m_14.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::political_interest>, tagged_array_view<unorm16_type const, population::pop_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 14, get_row, uint64_t(size_used) * sizeof(unorm16_type));
+			 return tagged_array_view<unorm16_type const, population::pop_tag>(m_14.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::social_interest>, float&> get(population::pop_tag i) {
-			 return m_15.values[to_index(i)];
+		 std::enable_if_t<std::is_same_v<INDEX, pop::social_interest>, float> get(population::pop_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 15, get, sizeof(unorm16_type));
+			 return dequantize(m_15.values[to_index(i)]);
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::social_interest>, float const&> get(population::pop_tag i) const {
-			 return m_15.values[to_index(i)];
-		 }
-		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::social_interest>> {
-			 m_15.values[to_index(i)] = v;
-		 }
-		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::social_interest>> {
-			 m_15.values[to_index(i)] = v;
+		 auto set(population::pop_tag i, float v) -> std::enable_if_t<std::is_same_v<INDEX, pop::social_interest>> {
+			 CONTAINER_ACCESS_RECORD(profile, 15, set, sizeof(unorm16_type));
+			 m_15.values[to_index(i)] = quantize<unorm16_type>(v);
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::social_interest>, tagged_array_view<float, population::pop_tag>> get_row() {
-			 return tagged_array_view<float, population::pop_tag>(m_15.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::social_interest>, tagged_array_view<unorm16_type, population::pop_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 15, get_row, uint64_t(size_used) * sizeof(unorm16_type));
+			 return tagged_array_view<unorm16_type, population::pop_tag>(m_15.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::social_interest>, tagged_array_view<float const, population::pop_tag>> get_row() const {
-			 return tagged_array_view<float const, population::pop_tag>(m_15.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::social_interest>, tagged_array_view<unorm16_type const, population::pop_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 15, get_row, uint64_t(size_used) * sizeof(unorm16_type));
+			 return tagged_array_view<unorm16_type const, population::pop_tag>(m_15.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::money>, float&> get(population::pop_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 16, get, sizeof(float));
 			 return m_16.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::money>, float const&> get(population::pop_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 16, get, sizeof(float));
 			 return m_16.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(population::pop_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::money>> {
+			 CONTAINER_ACCESS_RECORD(profile, 16, set, sizeof(float));
 			 m_16.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::money>> {
+			 CONTAINER_ACCESS_RECORD(profile, 16, set, sizeof(float));
 			 m_16.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::money>, tagged_array_view<float, population::pop_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 16, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, population::pop_tag>(m_16.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::money>, tagged_array_view<float const, population::pop_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 16, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, population::pop_tag>(m_16.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::needs_satisfaction>, float&> get(population::pop_tag i) {
-			 return m_17.values[to_index(i)];
+			 CONTAINER_ACCESS_RECORD(profile, 17, get, sizeof(float));
+			 return tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v17, size_used)[i];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::needs_satisfaction>, float const&> get(population::pop_tag i) const {
-			 return m_17.values[to_index(i)];
+			 CONTAINER_ACCESS_RECORD(profile, 17, get, sizeof(float));
+			 return tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v17, size_used)[i];
 		 }
 		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::needs_satisfaction>> {
-			 m_17.values[to_index(i)] = v;
-		 }
-		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::needs_satisfaction>> {
-			 m_17.values[to_index(i)] = v;
+		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<std::is_same_v<INDEX, pop::needs_satisfaction>> {
+			 CONTAINER_ACCESS_RECORD(profile, 17, set, sizeof(float));
+			 tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v17, size_used)[i] = v;
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::needs_satisfaction>, tagged_array_view<float, population::pop_tag>> get_row() {
-			 return tagged_array_view<float, population::pop_tag>(m_17.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::needs_satisfaction>, tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 17, get_row, uint64_t(size_used) * sizeof(float));
+			 return tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v17, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::needs_satisfaction>, tagged_array_view<float const, population::pop_tag>> get_row() const {
-			 return tagged_array_view<float const, population::pop_tag>(m_17.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::needs_satisfaction>, tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 17, get_row, uint64_t(size_used) * sizeof(float));
+			 return tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v17, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::literacy>, float&> get(population::pop_tag i) {
-			 return m_18.values[to_index(i)];
+			 CONTAINER_ACCESS_RECORD(profile, 18, get, sizeof(float));
+			 return tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v18, size_used)[i];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::literacy>, float const&> get(population::pop_tag i) const {
-			 return m_18.values[to_index(i)];
-		 }
-		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::literacy>> {
-			 m_18.values[to_index(i)] = v;
+			 CONTAINER_ACCESS_RECORD(profile, 18, get, sizeof(float));
+			 return tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v18, size_used)[i];
 		 }
 		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::literacy>> {
-			 m_18.values[to_index(i)] = v;
+		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<std::is_same_v<INDEX, pop::literacy>> {
+			 CONTAINER_ACCESS_RECORD(profile, 18, set, sizeof(float));
+			 tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v18, size_used)[i] = v;
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::literacy>, tagged_array_view<float, population::pop_tag>> get_row() {
-			 return tagged_array_view<float, population::pop_tag>(m_18.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::literacy>, tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 18, get_row, uint64_t(size_used) * sizeof(float));
+			 return tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v18, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::literacy>, tagged_array_view<float const, population::pop_tag>> get_row() const {
-			 return tagged_array_view<float const, population::pop_tag>(m_18.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::literacy>, tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 18, get_row, uint64_t(size_used) * sizeof(float));
+			 return tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v18, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::militancy>, float&> get(population::pop_tag i) {
-			 return m_19.values[to_index(i)];
+			 CONTAINER_ACCESS_RECORD(profile, 19, get, sizeof(float));
+			 return tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v19, size_used)[i];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::militancy>, float const&> get(population::pop_tag i) const {
-			 return m_19.values[to_index(i)];
-		 }
-		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::militancy>> {
-			 m_19.values[to_index(i)] = v;
+			 CONTAINER_ACCESS_RECORD(profile, 19, get, sizeof(float));
+			 return tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v19, size_used)[i];
 		 }
 		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::militancy>> {
-			 m_19.values[to_index(i)] = v;
+		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<std::is_same_v<INDEX, pop::militancy>> {
+			 CONTAINER_ACCESS_RECORD(profile, 19, set, sizeof(float));
+			 tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v19, size_used)[i] = v;
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::militancy>, tagged_array_view<float, population::pop_tag>> get_row() {
-			 return tagged_array_view<float, population::pop_tag>(m_19.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::militancy>, tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 19, get_row, uint64_t(size_used) * sizeof(float));
+			 return tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v19, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::militancy>, tagged_array_view<float const, population::pop_tag>> get_row() const {
-			 return tagged_array_view<float const, population::pop_tag>(m_19.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::militancy>, tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 19, get_row, uint64_t(size_used) * sizeof(float));
+			 return tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v19, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::consciousness>, float&> get(population::pop_tag i) {
-			 return m_20.values[to_index(i)];
+			 CONTAINER_ACCESS_RECORD(profile, 20, get, sizeof(float));
+			 return tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v20, size_used)[i];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, pop::consciousness>, float const&> get(population::pop_tag i) const {
-			 return m_20.values[to_index(i)];
+			 CONTAINER_ACCESS_RECORD(profile, 20, get, sizeof(float));
+			 return tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v20, size_used)[i];
 		 }
 		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::consciousness>> {
-			 m_20.values[to_index(i)] = v;
-		 }
-		 template<typename INDEX, typename value_type>
-		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, pop::consciousness>> {
-			 m_20.values[to_index(i)] = v;
+		 auto set(population::pop_tag i, value_type const& v) -> std::enable_if_t<std::is_same_v<INDEX, pop::consciousness>> {
+			 CONTAINER_ACCESS_RECORD(profile, 20, set, sizeof(float));
+			 tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v20, size_used)[i] = v;
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::consciousness>, tagged_array_view<float, population::pop_tag>> get_row() {
-			 return tagged_array_view<float, population::pop_tag>(m_20.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::consciousness>, tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 20, get_row, uint64_t(size_used) * sizeof(float));
+			 return tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v20, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
-		 std::enable_if_t<std::is_same_v<INDEX, pop::consciousness>, tagged_array_view<float const, population::pop_tag>> get_row() const {
-			 return tagged_array_view<float const, population::pop_tag>(m_20.values, ve::to_vector_size(uint32_t(size_used)));
+		 std::enable_if_t<std::is_same_v<INDEX, pop::consciousness>, tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 20, get_row, uint64_t(size_used) * sizeof(float));
+			 return tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>(m_g0.values[0].v20, ve::to_vector_size(uint32_t(size_used)));
 		 }
 
 		 population::pop_tag get_new() {
@@ -668,8 +710,8 @@ namespace pop {
 			 set<pop::size_change_from_assimilation_away>(i, float());
 			 set<pop::size_change_from_local_migration>(i, float());
 			 set<pop::size_change_from_emigration>(i, float());
-			 set<pop::political_interest>(i, float());
-			 set<pop::social_interest>(i, float());
+			 set<pop::political_interest>(i, 0.0f);
+			 set<pop::social_interest>(i, 0.0f);
 			 set<pop::money>(i, float());
 			 set<pop::needs_satisfaction>(i, float());
 			 set<pop::literacy>(i, float());
@@ -741,24 +783,24 @@ struct supports_index<pop::container, pop::type> {
 	static constexpr bool value = true;
 	 using type = population::pop_type_tag&;
 	 using const_type = population::pop_type_tag const&;
-	 using row = tagged_array_view<population::pop_type_tag, population::pop_tag>;
-	 using const_row = tagged_array_view<population::pop_type_tag const, population::pop_tag>;
+	 using row = tagged_interleaved_view<population::pop_type_tag, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(population::pop_type_tag))>;
+	 using const_row = tagged_interleaved_view<population::pop_type_tag const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(population::pop_type_tag))>;
 };
 template<>
 struct supports_index<pop::container, pop::religion> {
 	static constexpr bool value = true;
 	 using type = cultures::religion_tag&;
 	 using const_type = cultures::religion_tag const&;
-	 using row = tagged_array_view<cultures::religion_tag, population::pop_tag>;
-	 using const_row = tagged_array_view<cultures::religion_tag const, population::pop_tag>;
+	 using row = tagged_interleaved_view<cultures::religion_tag, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(cultures::religion_tag))>;
+	 using const_row = tagged_interleaved_view<cultures::religion_tag const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(cultures::religion_tag))>;
 };
 template<>
 struct supports_index<pop::container, pop::culture> {
 	static constexpr bool value = true;
 	 using type = cultures::culture_tag&;
 	 using const_type = cultures::culture_tag const&;
-	 using row = tagged_array_view<cultures::culture_tag, population::pop_tag>;
-	 using const_row = tagged_array_view<cultures::culture_tag const, population::pop_tag>;
+	 using row = tagged_interleaved_view<cultures::culture_tag, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(cultures::culture_tag))>;
+	 using const_row = tagged_interleaved_view<cultures::culture_tag const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(cultures::culture_tag))>;
 };
 template<>
 struct supports_index<pop::container, pop::location> {
@@ -773,8 +815,8 @@ struct supports_index<pop::container, pop::size> {
 	static constexpr bool value = true;
 	 using type = float&;
 	 using const_type = float const&;
-	 using row = tagged_array_view<float, population::pop_tag>;
-	 using const_row = tagged_array_view<float const, population::pop_tag>;
+	 using row = tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>;
+	 using const_row = tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>;
 };
 template<>
 struct supports_index<pop::container, pop::size_change_from_combat> {
@@ -827,18 +869,18 @@ struct supports_index<pop::container, pop::size_change_from_emigration> {
 template<>
 struct supports_index<pop::container, pop::political_interest> {
 	static constexpr bool value = true;
-	 using type = float&;
-	 using const_type = float const&;
-	 using row = tagged_array_view<float, population::pop_tag>;
-	 using const_row = tagged_array_view<float const, population::pop_tag>;
+	 using type = float;
+	 using const_type = float;
+	 using row = tagged_array_view<unorm16_type, population::pop_tag>;
+	 using const_row = tagged_array_view<unorm16_type const, population::pop_tag>;
 };
 template<>
 struct supports_index<pop::container, pop::social_interest> {
 	static constexpr bool value = true;
-	 using type = float&;
-	 using const_type = float const&;
-	 using row = tagged_array_view<float, population::pop_tag>;
-	 using const_row = tagged_array_view<float const, population::pop_tag>;
+	 using type = float;
+	 using const_type = float;
+	 using row = tagged_array_view<unorm16_type, population::pop_tag>;
+	 using const_row = tagged_array_view<unorm16_type const, population::pop_tag>;
 };
 template<>
 struct supports_index<pop::container, pop::money> {
@@ -853,32 +895,32 @@ struct supports_index<pop::container, pop::needs_satisfaction> {
 	static constexpr bool value = true;
 	 using type = float&;
 	 using const_type = float const&;
-	 using row = tagged_array_view<float, population::pop_tag>;
-	 using const_row = tagged_array_view<float const, population::pop_tag>;
+	 using row = tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>;
+	 using const_row = tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>;
 };
 template<>
 struct supports_index<pop::container, pop::literacy> {
 	static constexpr bool value = true;
 	 using type = float&;
 	 using const_type = float const&;
-	 using row = tagged_array_view<float, population::pop_tag>;
-	 using const_row = tagged_array_view<float const, population::pop_tag>;
+	 using row = tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>;
+	 using const_row = tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>;
 };
 template<>
 struct supports_index<pop::container, pop::militancy> {
 	static constexpr bool value = true;
 	 using type = float&;
 	 using const_type = float const&;
-	 using row = tagged_array_view<float, population::pop_tag>;
-	 using const_row = tagged_array_view<float const, population::pop_tag>;
+	 using row = tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>;
+	 using const_row = tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>;
 };
 template<>
 struct supports_index<pop::container, pop::consciousness> {
 	static constexpr bool value = true;
 	 using type = float&;
 	 using const_type = float const&;
-	 using row = tagged_array_view<float, population::pop_tag>;
-	 using const_row = tagged_array_view<float const, population::pop_tag>;
+	 using row = tagged_interleaved_view<float, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>;
+	 using const_row = tagged_interleaved_view<float const, population::pop_tag, ve::vector_size, int32_t(sizeof(pop::group_0_block) / sizeof(float))>;
 };
 
 template<>
@@ -900,53 +942,17 @@ class serialization::serializer<pop::container> {
 		 serialization::serialize_array(output, obj.m_0.values, uint32_t(obj.size_used + 7) / 8ui32);
 		 serialization::serialize_array(output, obj.m_1.values, uint32_t(obj.size_used + 7) / 8ui32);
 		 serialization::serialize_array(output, obj.m_2.values, uint32_t(obj.size_used + 7) / 8ui32);
-		if constexpr(serialization::tagged_serializer<pop::type, population::pop_type_tag>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::type, population::pop_type_tag>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::type, population::pop_type_tag>::has_simple_serialize) {
-				 serialization::serialize_array(output, obj.m_3.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::type, population::pop_type_tag>::serialize_object(output, obj.m_3.values[i], std::forward<CONTEXT>(c)...);
-			 }
-		} else {
-			 if constexpr(serialization::tagged_serializer<pop::type, population::pop_type_tag>::has_simple_serialize) {
-				 serialization::serialize_array(output, obj.m_3.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::type, population::pop_type_tag>::serialize_object(output, obj.m_3.values[i], std::forward<CONTEXT>(c)...);
-			 }
+		if constexpr(!serialization::tagged_serializer<pop::type, population::pop_type_tag>::has_static_size || serialization::tagged_serializer<pop::type, population::pop_type_tag>::size() != 0) {
+			 for(int32_t i = 0; i < obj.size_used; ++i)
+				 serialization::tagged_serializer<pop::type, population::pop_type_tag>::serialize_object(output, obj.m_g0.values[i / ve::vector_size].v3[i % ve::vector_size], std::forward<CONTEXT>(c)...);
 		}
-		if constexpr(serialization::tagged_serializer<pop::religion, cultures::religion_tag>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::religion, cultures::religion_tag>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::religion, cultures::religion_tag>::has_simple_serialize) {
-				 serialization::serialize_array(output, obj.m_4.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::religion, cultures::religion_tag>::serialize_object(output, obj.m_4.values[i], std::forward<CONTEXT>(c)...);
-			 }
-		} else {
-			 if constexpr(serialization::tagged_serializer<pop::religion, cultures::religion_tag>::has_simple_serialize) {
-				 serialization::serialize_array(output, obj.m_4.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::religion, cultures::religion_tag>::serialize_object(output, obj.m_4.values[i], std::forward<CONTEXT>(c)...);
-			 }
+		if constexpr(!serialization::tagged_serializer<pop::religion, cultures::religion_tag>::has_static_size || serialization::tagged_serializer<pop::religion, cultures::religion_tag>::size() != 0) {
+			 for(int32_t i = 0; i < obj.size_used; ++i)
+				 serialization::tagged_serializer<pop::religion, cultures::religion_tag>::serialize_object(output, obj.m_g0.values[i / ve::vector_size].v4[i % ve::vector_size], std::forward<CONTEXT>(c)...);
 		}
-		if constexpr(serialization::tagged_serializer<pop::culture, cultures::culture_tag>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::culture, cultures::culture_tag>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::culture, cultures::culture_tag>::has_simple_serialize) {
-				 serialization::serialize_array(output, obj.m_5.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::culture, cultures::culture_tag>::serialize_object(output, obj.m_5.values[i], std::forward<CONTEXT>(c)...);
-			 }
-		} else {
-			 if constexpr(serialization::tagged_serializer<pop::culture, cultures::culture_tag>::has_simple_serialize) {
-				 serialization::serialize_array(output, obj.m_5.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::culture, cultures::culture_tag>::serialize_object(output, obj.m_5.values[i], std::forward<CONTEXT>(c)...);
-			 }
+		if constexpr(!serialization::tagged_serializer<pop::culture, cultures::culture_tag>::has_static_size || serialization::tagged_serializer<pop::culture, cultures::culture_tag>::size() != 0) {
+			 for(int32_t i = 0; i < obj.size_used; ++i)
+				 serialization::tagged_serializer<pop::culture, cultures::culture_tag>::serialize_object(output, obj.m_g0.values[i / ve::vector_size].v5[i % ve::vector_size], std::forward<CONTEXT>(c)...);
 		}
 		if constexpr(serialization::tagged_serializer<pop::location, provinces::province_tag>::has_static_size) {
 			 if constexpr(serialization::tagged_serializer<pop::location, provinces::province_tag>::size() == 0) {
@@ -964,21 +970,9 @@ class serialization::serializer<pop::container> {
 					 serialization::tagged_serializer<pop::location, provinces::province_tag>::serialize_object(output, obj.m_6.values[i], std::forward<CONTEXT>(c)...);
 			 }
 		}
-		if constexpr(serialization::tagged_serializer<pop::size, float>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::size, float>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::size, float>::has_simple_serialize) {
-				 serialization::serialize_array(output, obj.m_7.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::size, float>::serialize_object(output, obj.m_7.values[i], std::forward<CONTEXT>(c)...);
-			 }
-		} else {
-			 if constexpr(serialization::tagged_serializer<pop::size, float>::has_simple_serialize) {
-				 serialization::serialize_array(output, obj.m_7.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::size, float>::serialize_object(output, obj.m_7.values[i], std::forward<CONTEXT>(c)...);
-			 }
+		if constexpr(!serialization::tagged_serializer<pop::size, float>::has_static_size || serialization::tagged_serializer<pop::size, float>::size() != 0) {
+			 for(int32_t i = 0; i < obj.size_used; ++i)
+				 serialization::tagged_serializer<pop::size, float>::serialize_object(output, obj.m_g0.values[i / ve::vector_size].v7[i % ve::vector_size], std::forward<CONTEXT>(c)...);
 		}
 		if constexpr(serialization::tagged_serializer<pop::size_change_from_combat, float>::has_static_size) {
 			 if constexpr(serialization::tagged_serializer<pop::size_change_from_combat, float>::size() == 0) {
@@ -1076,36 +1070,36 @@ class serialization::serializer<pop::container> {
 					 serialization::tagged_serializer<pop::size_change_from_emigration, float>::serialize_object(output, obj.m_13.values[i], std::forward<CONTEXT>(c)...);
 			 }
 		}
-		if constexpr(serialization::tagged_serializer<pop::political_interest, float>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::political_interest, float>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::political_interest, float>::has_simple_serialize) {
+		if constexpr(serialization::tagged_serializer<pop::political_interest, unorm16_type>::has_static_size) {
+			 if constexpr(serialization::tagged_serializer<pop::political_interest, unorm16_type>::size() == 0) {
+			 } else if constexpr(serialization::tagged_serializer<pop::political_interest, unorm16_type>::has_simple_serialize) {
 				 serialization::serialize_array(output, obj.m_14.values, obj.size_used);
 			 } else {
 				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::political_interest, float>::serialize_object(output, obj.m_14.values[i], std::forward<CONTEXT>(c)...);
+					 serialization::tagged_serializer<pop::political_interest, unorm16_type>::serialize_object(output, obj.m_14.values[i], std::forward<CONTEXT>(c)...);
 			 }
 		} else {
-			 if constexpr(serialization::tagged_serializer<pop::political_interest, float>::has_simple_serialize) {
+			 if constexpr(serialization::tagged_serializer<pop::political_interest, unorm16_type>::has_simple_serialize) {
 				 serialization::serialize_array(output, obj.m_14.values, obj.size_used);
 			 } else {
 				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::political_interest, float>::serialize_object(output, obj.m_14.values[i], std::forward<CONTEXT>(c)...);
+					 serialization::tagged_serializer<pop::political_interest, unorm16_type>::serialize_object(output, obj.m_14.values[i], std::forward<CONTEXT>(c)...);
 			 }
 		}
-		if constexpr(serialization::tagged_serializer<pop::social_interest, float>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::social_interest, float>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::social_interest, float>::has_simple_serialize) {
+		if constexpr(serialization::tagged_serializer<pop::social_interest, unorm16_type>::has_static_size) {
+			 if constexpr(serialization::tagged_serializer<pop::social_interest, unorm16_type>::size() == 0) {
+			 } else if constexpr(serialization::tagged_serializer<pop::social_interest, unorm16_type>::has_simple_serialize) {
 				 serialization::serialize_array(output, obj.m_15.values, obj.size_used);
 			 } else {
 				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::social_interest, float>::serialize_object(output, obj.m_15.values[i], std::forward<CONTEXT>(c)...);
+					 serialization::tagged_serializer<pop::social_interest, unorm16_type>::serialize_object(output, obj.m_15.values[i], std::forward<CONTEXT>(c)...);
 			 }
 		} else {
-			 if constexpr(serialization::tagged_serializer<pop::social_interest, float>::has_simple_serialize) {
+			 if constexpr(serialization::tagged_serializer<pop::social_interest, unorm16_type>::has_simple_serialize) {
 				 serialization::serialize_array(output, obj.m_15.values, obj.size_used);
 			 } else {
 				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::social_interest, float>::serialize_object(output, obj.m_15.values[i], std::forward<CONTEXT>(c)...);
+					 serialization::tagged_serializer<pop::social_interest, unorm16_type>::serialize_object(output, obj.m_15.values[i], std::forward<CONTEXT>(c)...);
 			 }
 		}
 		if constexpr(serialization::tagged_serializer<pop::money, float>::has_static_size) {
@@ -1124,69 +1118,21 @@ class serialization::serializer<pop::container> {
 					 serialization::tagged_serializer<pop::money, float>::serialize_object(output, obj.m_16.values[i], std::forward<CONTEXT>(c)...);
 			 }
 		}
-		if constexpr(serialization::tagged_serializer<pop::needs_satisfaction, float>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::needs_satisfaction, float>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::needs_satisfaction, float>::has_simple_serialize) {
-				 serialization::serialize_array(output, obj.m_17.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::needs_satisfaction, float>::serialize_object(output, obj.m_17.values[i], std::forward<CONTEXT>(c)...);
-			 }
-		} else {
-			 if constexpr(serialization::tagged_serializer<pop::needs_satisfaction, float>::has_simple_serialize) {
-				 serialization::serialize_array(output, obj.m_17.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::needs_satisfaction, float>::serialize_object(output, obj.m_17.values[i], std::forward<CONTEXT>(c)...);
-			 }
+		if constexpr(!serialization::tagged_serializer<pop::needs_satisfaction, float>::has_static_size || serialization::tagged_serializer<pop::needs_satisfaction, float>::size() != 0) {
+			 for(int32_t i = 0; i < obj.size_used; ++i)
+				 serialization::tagged_serializer<pop::needs_satisfaction, float>::serialize_object(output, obj.m_g0.values[i / ve::vector_size].v17[i % ve::vector_size], std::forward<CONTEXT>(c)...);
 		}
-		if constexpr(serialization::tagged_serializer<pop::literacy, float>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::literacy, float>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::literacy, float>::has_simple_serialize) {
-				 serialization::serialize_array(output, obj.m_18.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::literacy, float>::serialize_object(output, obj.m_18.values[i], std::forward<CONTEXT>(c)...);
-			 }
-		} else {
-			 if constexpr(serialization::tagged_serializer<pop::literacy, float>::has_simple_serialize) {
-				 serialization::serialize_array(output, obj.m_18.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::literacy, float>::serialize_object(output, obj.m_18.values[i], std::forward<CONTEXT>(c)...);
-			 }
+		if constexpr(!serialization::tagged_serializer<pop::literacy, float>::has_static_size || serialization::tagged_serializer<pop::literacy, float>::size() != 0) {
+			 for(int32_t i = 0; i < obj.size_used; ++i)
+				 serialization::tagged_serializer<pop::literacy, float>::serialize_object(output, obj.m_g0.values[i / ve::vector_size].v18[i % ve::vector_size], std::forward<CONTEXT>(c)...);
 		}
-		if constexpr(serialization::tagged_serializer<pop::militancy, float>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::militancy, float>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::militancy, float>::has_simple_serialize) {
-				 serialization::serialize_array(output, obj.m_19.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::militancy, float>::serialize_object(output, obj.m_19.values[i], std::forward<CONTEXT>(c)...);
-			 }
-		} else {
-			 if constexpr(serialization::tagged_serializer<pop::militancy, float>::has_simple_serialize) {
-				 serialization::serialize_array(output, obj.m_19.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::militancy, float>::serialize_object(output, obj.m_19.values[i], std::forward<CONTEXT>(c)...);
-			 }
+		if constexpr(!serialization::tagged_serializer<pop::militancy, float>::has_static_size || serialization::tagged_serializer<pop::militancy, float>::size() != 0) {
+			 for(int32_t i = 0; i < obj.size_used; ++i)
+				 serialization::tagged_serializer<pop::militancy, float>::serialize_object(output, obj.m_g0.values[i / ve::vector_size].v19[i % ve::vector_size], std::forward<CONTEXT>(c)...);
 		}
-		if constexpr(serialization::tagged_serializer<pop::consciousness, float>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::consciousness, float>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::consciousness, float>::has_simple_serialize) {
-				 serialization::serialize_array(output, obj.m_20.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::consciousness, float>::serialize_object(output, obj.m_20.values[i], std::forward<CONTEXT>(c)...);
-			 }
-		} else {
-			 if constexpr(serialization::tagged_serializer<pop::consciousness, float>::has_simple_serialize) {
-				 serialization::serialize_array(output, obj.m_20.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::consciousness, float>::serialize_object(output, obj.m_20.values[i], std::forward<CONTEXT>(c)...);
-			 }
+		if constexpr(!serialization::tagged_serializer<pop::consciousness, float>::has_static_size || serialization::tagged_serializer<pop::consciousness, float>::size() != 0) {
+			 for(int32_t i = 0; i < obj.size_used; ++i)
+				 serialization::tagged_serializer<pop::consciousness, float>::serialize_object(output, obj.m_g0.values[i / ve::vector_size].v20[i % ve::vector_size], std::forward<CONTEXT>(c)...);
 		}
 	 }
 	 template<typename ... CONTEXT>
@@ -1208,53 +1154,17 @@ class serialization::serializer<pop::container> {
 		 serialization::deserialize_array(input, obj.m_0.values, uint32_t(obj.size_used + 7) / 8ui32);
 		 serialization::deserialize_array(input, obj.m_1.values, uint32_t(obj.size_used + 7) / 8ui32);
 		 serialization::deserialize_array(input, obj.m_2.values, uint32_t(obj.size_used + 7) / 8ui32);
-		if constexpr(serialization::tagged_serializer<pop::type, population::pop_type_tag>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::type, population::pop_type_tag>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::type, population::pop_type_tag>::has_simple_serialize) {
-				 serialization::deserialize_array(input, obj.m_3.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::type, population::pop_type_tag>::deserialize_object(input, obj.m_3.values[i], std::forward<CONTEXT>(c)...);
-			 }
-		} else {
-			 if constexpr(serialization::tagged_serializer<pop::type, population::pop_type_tag>::has_simple_serialize) {
-				 serialization::deserialize_array(input, obj.m_3.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::type, population::pop_type_tag>::deserialize_object(input, obj.m_3.values[i], std::forward<CONTEXT>(c)...);
-			 }
+		if constexpr(!serialization::tagged_serializer<pop::type, population::pop_type_tag>::has_static_size || serialization::tagged_serializer<pop::type, population::pop_type_tag>::size() != 0) {
+			 for(int32_t i = 0; i < obj.size_used; ++i)
+				 serialization::tagged_serializer<pop::type, population::pop_type_tag>::deserialize_object(input, obj.m_g0.values[i / ve::vector_size].v3[i % ve::vector_size], std::forward<CONTEXT>(c)...);
 		}
-		if constexpr(serialization::tagged_serializer<pop::religion, cultures::religion_tag>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::religion, cultures::religion_tag>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::religion, cultures::religion_tag>::has_simple_serialize) {
-				 serialization::deserialize_array(input, obj.m_4.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::religion, cultures::religion_tag>::deserialize_object(input, obj.m_4.values[i], std::forward<CONTEXT>(c)...);
-			 }
-		} else {
-			 if constexpr(serialization::tagged_serializer<pop::religion, cultures::religion_tag>::has_simple_serialize) {
-				 serialization::deserialize_array(input, obj.m_4.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::religion, cultures::religion_tag>::deserialize_object(input, obj.m_4.values[i], std::forward<CONTEXT>(c)...);
-			 }
+		if constexpr(!serialization::tagged_serializer<pop::religion, cultures::religion_tag>::has_static_size || serialization::tagged_serializer<pop::religion, cultures::religion_tag>::size() != 0) {
+			 for(int32_t i = 0; i < obj.size_used; ++i)
+				 serialization::tagged_serializer<pop::religion, cultures::religion_tag>::deserialize_object(input, obj.m_g0.values[i / ve::vector_size].v4[i % ve::vector_size], std::forward<CONTEXT>(c)...);
 		}
-		if constexpr(serialization::tagged_serializer<pop::culture, cultures::culture_tag>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::culture, cultures::culture_tag>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::culture, cultures::culture_tag>::has_simple_serialize) {
-				 serialization::deserialize_array(input, obj.m_5.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::culture, cultures::culture_tag>::deserialize_object(input, obj.m_5.values[i], std::forward<CONTEXT>(c)...);
-			 }
-		} else {
-			 if constexpr(serialization::tagged_serializer<pop::culture, cultures::culture_tag>::has_simple_serialize) {
-				 serialization::deserialize_array(input, obj.m_5.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::culture, cultures::culture_tag>::deserialize_object(input, obj.m_5.values[i], std::forward<CONTEXT>(c)...);
-			 }
+		if constexpr(!serialization::tagged_serializer<pop::culture, cultures::culture_tag>::has_static_size || serialization::tagged_serializer<pop::culture, cultures::culture_tag>::size() != 0) {
+			 for(int32_t i = 0; i < obj.size_used; ++i)
+				 serialization::tagged_serializer<pop::culture, cultures::culture_tag>::deserialize_object(input, obj.m_g0.values[i / ve::vector_size].v5[i % ve::vector_size], std::forward<CONTEXT>(c)...);
 		}
 		if constexpr(serialization::tagged_serializer<pop::location, provinces::province_tag>::has_static_size) {
 			 if constexpr(serialization::tagged_serializer<pop::location, provinces::province_tag>::size() == 0) {
@@ -1272,21 +1182,9 @@ class serialization::serializer<pop::container> {
 					 serialization::tagged_serializer<pop::location, provinces::province_tag>::deserialize_object(input, obj.m_6.values[i], std::forward<CONTEXT>(c)...);
 			 }
 		}
-		if constexpr(serialization::tagged_serializer<pop::size, float>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::size, float>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::size, float>::has_simple_serialize) {
-				 serialization::deserialize_array(input, obj.m_7.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::size, float>::deserialize_object(input, obj.m_7.values[i], std::forward<CONTEXT>(c)...);
-			 }
-		} else {
-			 if constexpr(serialization::tagged_serializer<pop::size, float>::has_simple_serialize) {
-				 serialization::deserialize_array(input, obj.m_7.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::size, float>::deserialize_object(input, obj.m_7.values[i], std::forward<CONTEXT>(c)...);
-			 }
+		if constexpr(!serialization::tagged_serializer<pop::size, float>::has_static_size || serialization::tagged_serializer<pop::size, float>::size() != 0) {
+			 for(int32_t i = 0; i < obj.size_used; ++i)
+				 serialization::tagged_serializer<pop::size, float>::deserialize_object(input, obj.m_g0.values[i / ve::vector_size].v7[i % ve::vector_size], std::forward<CONTEXT>(c)...);
 		}
 		if constexpr(serialization::tagged_serializer<pop::size_change_from_combat, float>::has_static_size) {
 			 if constexpr(serialization::tagged_serializer<pop::size_change_from_combat, float>::size() == 0) {
@@ -1384,36 +1282,36 @@ class serialization::serializer<pop::container> {
 					 serialization::tagged_serializer<pop::size_change_from_emigration, float>::deserialize_object(input, obj.m_13.values[i], std::forward<CONTEXT>(c)...);
 			 }
 		}
-		if constexpr(serialization::tagged_serializer<pop::political_interest, float>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::political_interest, float>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::political_interest, float>::has_simple_serialize) {
+		if constexpr(serialization::tagged_serializer<pop::political_interest, unorm16_type>::has_static_size) {
+			 if constexpr(serialization::tagged_serializer<pop::political_interest, unorm16_type>::size() == 0) {
+			 } else if constexpr(serialization::tagged_serializer<pop::political_interest, unorm16_type>::has_simple_serialize) {
 				 serialization::deserialize_array(input, obj.m_14.values, obj.size_used);
 			 } else {
 				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::political_interest, float>::deserialize_object(input, obj.m_14.values[i], std::forward<CONTEXT>(c)...);
+					 serialization::tagged_serializer<pop::political_interest, unorm16_type>::deserialize_object(input, obj.m_14.values[i], std::forward<CONTEXT>(c)...);
 			 }
 		} else {
-			 if constexpr(serialization::tagged_serializer<pop::political_interest, float>::has_simple_serialize) {
+			 if constexpr(serialization::tagged_serializer<pop::political_interest, unorm16_type>::has_simple_serialize) {
 				 serialization::deserialize_array(input, obj.m_14.values, obj.size_used);
 			 } else {
 				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::political_interest, float>::deserialize_object(input, obj.m_14.values[i], std::forward<CONTEXT>(c)...);
+					 serialization::tagged_serializer<pop::political_interest, unorm16_type>::deserialize_object(input, obj.m_14.values[i], std::forward<CONTEXT>(c)...);
 			 }
 		}
-		if constexpr(serialization::tagged_serializer<pop::social_interest, float>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::social_interest, float>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::social_interest, float>::has_simple_serialize) {
+		if constexpr(serialization::tagged_serializer<pop::social_interest, unorm16_type>::has_static_size) {
+			 if constexpr(serialization::tagged_serializer<pop::social_interest, unorm16_type>::size() == 0) {
+			 } else if constexpr(serialization::tagged_serializer<pop::social_interest, unorm16_type>::has_simple_serialize) {
 				 serialization::deserialize_array(input, obj.m_15.values, obj.size_used);
 			 } else {
 				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::social_interest, float>::deserialize_object(input, obj.m_15.values[i], std::forward<CONTEXT>(c)...);
+					 serialization::tagged_serializer<pop::social_interest, unorm16_type>::deserialize_object(input, obj.m_15.values[i], std::forward<CONTEXT>(c)...);
 			 }
 		} else {
-			 if constexpr(serialization::tagged_serializer<pop::social_interest, float>::has_simple_serialize) {
+			 if constexpr(serialization::tagged_serializer<pop::social_interest, unorm16_type>::has_simple_serialize) {
 				 serialization::deserialize_array(input, obj.m_15.values, obj.size_used);
 			 } else {
 				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::social_interest, float>::deserialize_object(input, obj.m_15.values[i], std::forward<CONTEXT>(c)...);
+					 serialization::tagged_serializer<pop::social_interest, unorm16_type>::deserialize_object(input, obj.m_15.values[i], std::forward<CONTEXT>(c)...);
 			 }
 		}
 		if constexpr(serialization::tagged_serializer<pop::money, float>::has_static_size) {
@@ -1432,110 +1330,53 @@ class serialization::serializer<pop::container> {
 					 serialization::tagged_serializer<pop::money, float>::deserialize_object(input, obj.m_16.values[i], std::forward<CONTEXT>(c)...);
 			 }
 		}
-		if constexpr(serialization::tagged_serializer<pop::needs_satisfaction, float>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::needs_satisfaction, float>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::needs_satisfaction, float>::has_simple_serialize) {
-				 serialization::deserialize_array(input, obj.m_17.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::needs_satisfaction, float>::deserialize_object(input, obj.m_17.values[i], std::forward<CONTEXT>(c)...);
-			 }
-		} else {
-			 if constexpr(serialization::tagged_serializer<pop::needs_satisfaction, float>::has_simple_serialize) {
-				 serialization::deserialize_array(input, obj.m_17.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::needs_satisfaction, float>::deserialize_object(input, obj.m_17.values[i], std::forward<CONTEXT>(c)...);
-			 }
+		if constexpr(!serialization::tagged_serializer<pop::needs_satisfaction, float>::has_static_size || serialization::tagged_serializer<pop::needs_satisfaction, float>::size() != 0) {
+			 for(int32_t i = 0; i < obj.size_used; ++i)
+				 serialization::tagged_serializer<pop::needs_satisfaction, float>::deserialize_object(input, obj.m_g0.values[i / ve::vector_size].v17[i % ve::vector_size], std::forward<CONTEXT>(c)...);
 		}
-		if constexpr(serialization::tagged_serializer<pop::literacy, float>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::literacy, float>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::literacy, float>::has_simple_serialize) {
-				 serialization::deserialize_array(input, obj.m_18.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::literacy, float>::deserialize_object(input, obj.m_18.values[i], std::forward<CONTEXT>(c)...);
-			 }
-		} else {
-			 if constexpr(serialization::tagged_serializer<pop::literacy, float>::has_simple_serialize) {
-				 serialization::deserialize_array(input, obj.m_18.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::literacy, float>::deserialize_object(input, obj.m_18.values[i], std::forward<CONTEXT>(c)...);
-			 }
+		if constexpr(!serialization::tagged_serializer<pop::literacy, float>::has_static_size || serialization::tagged_serializer<pop::literacy, float>::size() != 0) {
+			 for(int32_t i = 0; i < obj.size_used; ++i)
+				 serialization::tagged_serializer<pop::literacy, float>::deserialize_object(input, obj.m_g0.values[i / ve::vector_size].v18[i % ve::vector_size], std::forward<CONTEXT>(c)...);
 		}
-		if constexpr(serialization::tagged_serializer<pop::militancy, float>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::militancy, float>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::militancy, float>::has_simple_serialize) {
-				 serialization::deserialize_array(input, obj.m_19.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::militancy, float>::deserialize_object(input, obj.m_19.values[i], std::forward<CONTEXT>(c)...);
-			 }
-		} else {
-			 if constexpr(serialization::tagged_serializer<pop::militancy, float>::has_simple_serialize) {
-				 serialization::deserialize_array(input, obj.m_19.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::militancy, float>::deserialize_object(input, obj.m_19.values[i], std::forward<CONTEXT>(c)...);
-			 }
+		if constexpr(!serialization::tagged_serializer<pop::militancy, float>::has_static_size || serialization::tagged_serializer<pop::militancy, float>::size() != 0) {
+			 for(int32_t i = 0; i < obj.size_used; ++i)
+				 serialization::tagged_serializer<pop::militancy, float>::deserialize_object(input, obj.m_g0.values[i / ve::vector_size].v19[i % ve::vector_size], std::forward<CONTEXT>(c)...);
 		}
-		if constexpr(serialization::tagged_serializer<pop::consciousness, float>::has_static_size) {
-			 if constexpr(serialization::tagged_serializer<pop::consciousness, float>::size() == 0) {
-			 } else if constexpr(serialization::tagged_serializer<pop::consciousness, float>::has_simple_serialize) {
-				 serialization::deserialize_array(input, obj.m_20.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::consciousness, float>::deserialize_object(input, obj.m_20.values[i], std::forward<CONTEXT>(c)...);
-			 }
-		} else {
-			 if constexpr(serialization::tagged_serializer<pop::consciousness, float>::has_simple_serialize) {
-				 serialization::deserialize_array(input, obj.m_20.values, obj.size_used);
-			 } else {
-				 for(int32_t i = 0; i < obj.size_used; ++i)
-					 serialization::tagged_serializer<pop::consciousness, float>::deserialize_object(input, obj.m_20.values[i], std::forward<CONTEXT>(c)...);
-			 }
+		if constexpr(!serialization::tagged_serializer<pop::consciousness, float>::has_static_size || serialization::tagged_serializer<pop::consciousness, float>::size() != 0) {
+			 for(int32_t i = 0; i < obj.size_used; ++i)
+				 serialization::tagged_serializer<pop::consciousness, float>::deserialize_object(input, obj.m_g0.values[i / ve::vector_size].v20[i % ve::vector_size], std::forward<CONTEXT>(c)...);
 		}
 	 }
 	 template<typename ... CONTEXT>
 	 static size_t size(pop::container const& obj, CONTEXT&& ... c) {
 		 return size_t(sizeof(obj.size_used)+ sizeof(population::pop_tag) * obj.size_used+ sizeof(bitfield_type) * (uint32_t(obj.size_used + 7) / 8ui32)+ sizeof(bitfield_type) * (uint32_t(obj.size_used + 7) / 8ui32)+ sizeof(bitfield_type) * (uint32_t(obj.size_used + 7) / 8ui32)+ [&, max = obj.size_used](){
-			 if(max == 0)
-				 return size_t(0);
 			 if constexpr(serialization::tagged_serializer<pop::type, population::pop_type_tag>::has_static_size) {
 				 return size_t(max  * serialization::tagged_serializer<pop::type, population::pop_type_tag>::size());
-			 } else if constexpr(serialization::tagged_serializer<pop::type, population::pop_type_tag>::has_simple_serialize) {
-				 return size_t(serialization::tagged_serializer<pop::type, population::pop_type_tag>::size(obj.m_3.values[0], std::forward<CONTEXT>(c)...) * max); 
 			 } else {
-				 return size_t(std::transform_reduce(obj.m_3.values, obj.m_3.values + max, 0ui64, std::plus<>(), [&](population::pop_type_tag const& m) {
-					 return serialization::tagged_serializer<pop::type, population::pop_type_tag>::size(m, std::forward<CONTEXT>(c)...); 
-				 })); 
+				 size_t total = 0;
+				 for(int32_t j = 0; j < max; ++j)
+					 total += serialization::tagged_serializer<pop::type, population::pop_type_tag>::size(obj.m_g0.values[j / ve::vector_size].v3[j % ve::vector_size], std::forward<CONTEXT>(c)...);
+				 return total;
 			 }
 		 }()
 + [&, max = obj.size_used](){
-			 if(max == 0)
-				 return size_t(0);
 			 if constexpr(serialization::tagged_serializer<pop::religion, cultures::religion_tag>::has_static_size) {
 				 return size_t(max  * serialization::tagged_serializer<pop::religion, cultures::religion_tag>::size());
-			 } else if constexpr(serialization::tagged_serializer<pop::religion, cultures::religion_tag>::has_simple_serialize) {
-				 return size_t(serialization::tagged_serializer<pop::religion, cultures::religion_tag>::size(obj.m_4.values[0], std::forward<CONTEXT>(c)...) * max); 
 			 } else {
-				 return size_t(std::transform_reduce(obj.m_4.values, obj.m_4.values + max, 0ui64, std::plus<>(), [&](cultures::religion_tag const& m) {
-					 return serialization::tagged_serializer<pop::religion, cultures::religion_tag>::size(m, std::forward<CONTEXT>(c)...); 
-				 })); 
+				 size_t total = 0;
+				 for(int32_t j = 0; j < max; ++j)
+					 total += serialization::tagged_serializer<pop::religion, cultures::religion_tag>::size(obj.m_g0.values[j / ve::vector_size].v4[j % ve::vector_size], std::forward<CONTEXT>(c)...);
+				 return total;
 			 }
 		 }()
 + [&, max = obj.size_used](){
-			 if(max == 0)
-				 return size_t(0);
 			 if constexpr(serialization::tagged_serializer<pop::culture, cultures::culture_tag>::has_static_size) {
 				 return size_t(max  * serialization::tagged_serializer<pop::culture, cultures::culture_tag>::size());
-			 } else if constexpr(serialization::tagged_serializer<pop::culture, cultures::culture_tag>::has_simple_serialize) {
-				 return size_t(serialization::tagged_serializer<pop::culture, cultures::culture_tag>::size(obj.m_5.values[0], std::forward<CONTEXT>(c)...) * max); 
 			 } else {
-				 return size_t(std::transform_reduce(obj.m_5.values, obj.m_5.values + max, 0ui64, std::plus<>(), [&](cultures::culture_tag const& m) {
-					 return serialization::tagged_serializer<pop::culture, cultures::culture_tag>::size(m, std::forward<CONTEXT>(c)...); 
-				 })); 
+				 size_t total = 0;
+				 for(int32_t j = 0; j < max; ++j)
+					 total += serialization::tagged_serializer<pop::culture, cultures::culture_tag>::size(obj.m_g0.values[j / ve::vector_size].v5[j % ve::vector_size], std::forward<CONTEXT>(c)...);
+				 return total;
 			 }
 		 }()
 + [&, max = obj.size_used](){
@@ -1552,16 +1393,13 @@ class serialization::serializer<pop::container> {
 			 }
 		 }()
 + [&, max = obj.size_used](){
-			 if(max == 0)
-				 return size_t(0);
 			 if constexpr(serialization::tagged_serializer<pop::size, float>::has_static_size) {
 				 return size_t(max  * serialization::tagged_serializer<pop::size, float>::size());
-			 } else if constexpr(serialization::tagged_serializer<pop::size, float>::has_simple_serialize) {
-				 return size_t(serialization::tagged_serializer<pop::size, float>::size(obj.m_7.values[0], std::forward<CONTEXT>(c)...) * max); 
 			 } else {
-				 return size_t(std::transform_reduce(obj.m_7.values, obj.m_7.values + max, 0ui64, std::plus<>(), [&](float const& m) {
-					 return serialization::tagged_serializer<pop::size, float>::size(m, std::forward<CONTEXT>(c)...); 
-				 })); 
+				 size_t total = 0;
+				 for(int32_t j = 0; j < max; ++j)
+					 total += serialization::tagged_serializer<pop::size, float>::size(obj.m_g0.values[j / ve::vector_size].v7[j % ve::vector_size], std::forward<CONTEXT>(c)...);
+				 return total;
 			 }
 		 }()
 + [&, max = obj.size_used](){
@@ -1645,26 +1483,26 @@ class serialization::serializer<pop::container> {
 + [&, max = obj.size_used](){
 			 if(max == 0)
 				 return size_t(0);
-			 if constexpr(serialization::tagged_serializer<pop::political_interest, float>::has_static_size) {
-				 return size_t(max  * serialization::tagged_serializer<pop::political_interest, float>::size());
-			 } else if constexpr(serialization::tagged_serializer<pop::political_interest, float>::has_simple_serialize) {
-				 return size_t(serialization::tagged_serializer<pop::political_interest, float>::size(obj.m_14.values[0], std::forward<CONTEXT>(c)...) * max); 
+			 if constexpr(serialization::tagged_serializer<pop::political_interest, unorm16_type>::has_static_size) {
+				 return size_t(max  * serialization::tagged_serializer<pop::political_interest, unorm16_type>::size());
+			 } else if constexpr(serialization::tagged_serializer<pop::political_interest, unorm16_type>::has_simple_serialize) {
+				 return size_t(serialization::tagged_serializer<pop::political_interest, unorm16_type>::size(obj.m_14.values[0], std::forward<CONTEXT>(c)...) * max); 
 			 } else {
-				 return size_t(std::transform_reduce(obj.m_14.values, obj.m_14.values + max, 0ui64, std::plus<>(), [&](float const& m) {
-					 return serialization::tagged_serializer<pop::political_interest, float>::size(m, std::forward<CONTEXT>(c)...); 
+				 return size_t(std::transform_reduce(obj.m_14.values, obj.m_14.values + max, 0ui64, std::plus<>(), [&](unorm16_type const& m) {
+					 return serialization::tagged_serializer<pop::political_interest, unorm16_type>::size(m, std::forward<CONTEXT>(c)...); 
 				 })); 
 			 }
 		 }()
 + [&, max = obj.size_used](){
 			 if(max == 0)
 				 return size_t(0);
-			 if constexpr(serialization::tagged_serializer<pop::social_interest, float>::has_static_size) {
-				 return size_t(max  * serialization::tagged_serializer<pop::social_interest, float>::size());
-			 } else if constexpr(serialization::tagged_serializer<pop::social_interest, float>::has_simple_serialize) {
-				 return size_t(serialization::tagged_serializer<pop::social_interest, float>::size(obj.m_15.values[0], std::forward<CONTEXT>(c)...) * max); 
+			 if constexpr(serialization::tagged_serializer<pop::social_interest, unorm16_type>::has_static_size) {
+				 return size_t(max  * serialization::tagged_serializer<pop::social_interest, unorm16_type>::size());
+			 } else if constexpr(serialization::tagged_serializer<pop::social_interest, unorm16_type>::has_simple_serialize) {
+				 return size_t(serialization::tagged_serializer<pop::social_interest, unorm16_type>::size(obj.m_15.values[0], std::forward<CONTEXT>(c)...) * max); 
 			 } else {
-				 return size_t(std::transform_reduce(obj.m_15.values, obj.m_15.values + max, 0ui64, std::plus<>(), [&](float const& m) {
-					 return serialization::tagged_serializer<pop::social_interest, float>::size(m, std::forward<CONTEXT>(c)...); 
+				 return size_t(std::transform_reduce(obj.m_15.values, obj.m_15.values + max, 0ui64, std::plus<>(), [&](unorm16_type const& m) {
+					 return serialization::tagged_serializer<pop::social_interest, unorm16_type>::size(m, std::forward<CONTEXT>(c)...); 
 				 })); 
 			 }
 		 }()
@@ -1682,55 +1520,43 @@ class serialization::serializer<pop::container> {
 			 }
 		 }()
 + [&, max = obj.size_used](){
-			 if(max == 0)
-				 return size_t(0);
 			 if constexpr(serialization::tagged_serializer<pop::needs_satisfaction, float>::has_static_size) {
 				 return size_t(max  * serialization::tagged_serializer<pop::needs_satisfaction, float>::size());
-			 } else if constexpr(serialization::tagged_serializer<pop::needs_satisfaction, float>::has_simple_serialize) {
-				 return size_t(serialization::tagged_serializer<pop::needs_satisfaction, float>::size(obj.m_17.values[0], std::forward<CONTEXT>(c)...) * max); 
 			 } else {
-				 return size_t(std::transform_reduce(obj.m_17.values, obj.m_17.values + max, 0ui64, std::plus<>(), [&](float const& m) {
-					 return serialization::tagged_serializer<pop::needs_satisfaction, float>::size(m, std::forward<CONTEXT>(c)...); 
-				 })); 
+				 size_t total = 0;
+				 for(int32_t j = 0; j < max; ++j)
+					 total += serialization::tagged_serializer<pop::needs_satisfaction, float>::size(obj.m_g0.values[j / ve::vector_size].v17[j % ve::vector_size], std::forward<CONTEXT>(c)...);
+				 return total;
 			 }
 		 }()
 + [&, max = obj.size_used](){
-			 if(max == 0)
-				 return size_t(0);
 			 if constexpr(serialization::tagged_serializer<pop::literacy, float>::has_static_size) {
 				 return size_t(max  * serialization::tagged_serializer<pop::literacy, float>::size());
-			 } else if constexpr(serialization::tagged_serializer<pop::literacy, float>::has_simple_serialize) {
-				 return size_t(serialization::tagged_serializer<pop::literacy, float>::size(obj.m_18.values[0], std::forward<CONTEXT>(c)...) * max); 
 			 } else {
-				 return size_t(std::transform_reduce(obj.m_18.values, obj.m_18.values + max, 0ui64, std::plus<>(), [&](float const& m) {
-					 return serialization::tagged_serializer<pop::literacy, float>::size(m, std::forward<CONTEXT>(c)...); 
-				 })); 
+				 size_t total = 0;
+				 for(int32_t j = 0; j < max; ++j)
+					 total += serialization::tagged_serializer<pop::literacy, float>::size(obj.m_g0.values[j / ve::vector_size].v18[j % ve::vector_size], std::forward<CONTEXT>(c)...);
+				 return total;
 			 }
 		 }()
 + [&, max = obj.size_used](){
-			 if(max == 0)
-				 return size_t(0);
 			 if constexpr(serialization::tagged_serializer<pop::militancy, float>::has_static_size) {
 				 return size_t(max  * serialization::tagged_serializer<pop::militancy, float>::size());
-			 } else if constexpr(serialization::tagged_serializer<pop::militancy, float>::has_simple_serialize) {
-				 return size_t(serialization::tagged_serializer<pop::militancy, float>::size(obj.m_19.values[0], std::forward<CONTEXT>(c)...) * max); 
 			 } else {
-				 return size_t(std::transform_reduce(obj.m_19.values, obj.m_19.values + max, 0ui64, std::plus<>(), [&](float const& m) {
-					 return serialization::tagged_serializer<pop::militancy, float>::size(m, std::forward<CONTEXT>(c)...); 
-				 })); 
+				 size_t total = 0;
+				 for(int32_t j = 0; j < max; ++j)
+					 total += serialization::tagged_serializer<pop::militancy, float>::size(obj.m_g0.values[j / ve::vector_size].v19[j % ve::vector_size], std::forward<CONTEXT>(c)...);
+				 return total;
 			 }
 		 }()
 + [&, max = obj.size_used](){
-			 if(max == 0)
-				 return size_t(0);
 			 if constexpr(serialization::tagged_serializer<pop::consciousness, float>::has_static_size) {
 				 return size_t(max  * serialization::tagged_serializer<pop::consciousness, float>::size());
-			 } else if constexpr(serialization::tagged_serializer<pop::consciousness, float>::has_simple_serialize) {
-				 return size_t(serialization::tagged_serializer<pop::consciousness, float>::size(obj.m_20.values[0], std::forward<CONTEXT>(c)...) * max); 
 			 } else {
-				 return size_t(std::transform_reduce(obj.m_20.values, obj.m_20.values + max, 0ui64, std::plus<>(), [&](float const& m) {
-					 return serialization::tagged_serializer<pop::consciousness, float>::size(m, std::forward<CONTEXT>(c)...); 
-				 })); 
+				 size_t total = 0;
+				 for(int32_t j = 0; j < max; ++j)
+					 total += serialization::tagged_serializer<pop::consciousness, float>::size(obj.m_g0.values[j / ve::vector_size].v20[j % ve::vector_size], std::forward<CONTEXT>(c)...);
+				 return total;
 			 }
 		 }()
 );
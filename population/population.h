@@ -67,8 +67,8 @@ namespace pop {
 		size_change_from_local_migration, float,
 		size_change_from_emigration, float,
 
-		political_interest, float,
-		social_interest, float,
+		political_interest, unorm16_type,
+		social_interest, unorm16_type,
 		money, float,
 		needs_satisfaction, float,
 		literacy, float,
@@ -11,6 +11,7 @@
 #include "provinces\\province_functions.hpp"
 #include "concurrency_tools/ve_avx2.h"
 #include <random>
+#include <chrono>
 #include "economy/economy_functions.h"
 
 #undef min
@@ -39,6 +40,45 @@ namespace population {
 
 		std::mutex maybe_has_a_lock<true>::lock;
 
+		// first half of setting up a pop that has already been allocated and added to the pops of its location. is_poor, is_middle
+		// and is_accepted are packed several pops to a byte, so this part must not run concurrently for pops allocated together
+		void place_new_pop(
+			world_state& ws,
+			pop_tag new_id,
+			provinces::province_tag location,
+			pop_type_tag t,
+			cultures::culture_tag c,
+			cultures::religion_tag r) {
+
+			auto const prov_owner = ws.w.province_s.province_state_container.get<province_state::owner>(location);
+
+			ws.w.population_s.pops.set<pop::location>(new_id, location);
+			ws.w.population_s.pops.set<pop::culture>(new_id, c);
+			ws.w.population_s.pops.set<pop::religion>(new_id, r);
+
+			change_pop_type(ws, new_id, t);
+			ws.w.population_s.pops.set<pop::is_accepted>(new_id, is_pop_accepted(ws, new_id, prov_owner));
+		}
+
+		// second half: only writes the pop's own values, so different pops may be initialized in parallel
+		void initialize_new_pop(
+			world_state& ws,
+			pop_tag new_id,
+			float initial_size,
+			float militancy,
+			float consciousness,
+			float literacy) {
+
+			ws.w.population_s.pops.set<pop::militancy>(new_id, militancy);
+			ws.w.population_s.pops.set<pop::consciousness>(new_id, consciousness);
+			ws.w.population_s.pops.set<pop::literacy>(new_id, literacy);
+
+			init_pop_demographics(ws, new_id, initial_size);
+			default_initialize_issues_and_ideology(ws, new_id);
+
+			assert(ws.w.population_s.pops.get<pop::size>(new_id) == ws.w.population_s.pop_demographics.get(new_id, total_population_tag));
+		}
+
 		template<bool protect>
 		pop_tag make_new_pop_internal(
 			world_state& ws,
@@ -54,82 +94,26 @@ namespace population {
 			assert(std::isfinite(initial_size) && initial_size >= 1.0f);
 			assert(is_valid_index(t));
 
-			auto const new_id = [&ws, location]() {
+			auto const new_id = [&ws, location, t, c, r]() {
 				if constexpr(protect) {
 					std::lock_guard<std::mutex> guard(maybe_has_a_lock<true>().lock);
 					auto const n = allocate_new_pop(ws);
 					add_item(ws.w.population_s.pop_arrays, ws.w.province_s.province_state_container.get<province_state::pops>(location), n);
+					place_new_pop(ws, n, location, t, c, r);
 					return n;
 				} else {
 					auto const n = allocate_new_pop(ws);
 					add_item(ws.w.population_s.pop_arrays, ws.w.province_s.province_state_container.get<province_state::pops>(location), n);
+					place_new_pop(ws, n, location, t, c, r);
 					return n;
 				}
 			}();
-			auto const prov_owner = ws.w.province_s.province_state_container.get<province_state::owner>(location);
-
-			ws.w.population_s.pops.set<pop::location>(new_id, location);
-			ws.w.population_s.pops.set<pop::culture>(new_id, c);
-			ws.w.population_s.pops.set<pop::religion>(new_id, r);
-
-			ws.w.population_s.pops.set<pop::militancy>(new_id, militancy);
-			ws.w.population_s.pops.set<pop::consciousness>(new_id, consciousness);
-			ws.w.population_s.pops.set<pop::literacy>(new_id, literacy);
-
-			change_pop_type(ws, new_id, t);
-			init_pop_demographics(ws, new_id, initial_size);
-
-			
-			ws.w.population_s.pops.set<pop::is_accepted>(new_id, is_pop_accepted(ws, new_id, prov_owner));
-
-			default_initialize_issues_and_ideology(ws, new_id);
-
-			assert(ws.w.population_s.pops.get<pop::size>(new_id) == ws.w.population_s.pop_demographics.get(new_id, total_population_tag));
 
+			initialize_new_pop(ws, new_id, initial_size, militancy, consciousness, literacy);
 			return new_id;
 		}
 	}
 
-	pop_tag make_new_pop_deferred(world_state& ws,
-		float initial_size,
-		float militancy,
-		float consciousness,
-		float literacy,
-		provinces::province_tag location,
-		pop_type_tag t,
-		cultures::culture_tag c,
-		cultures::religion_tag r,
-		concurrency::task_group& tg) {
-		
-		auto const new_id = allocate_new_pop(ws);
-		add_item(ws.w.population_s.pop_arrays, ws.w.province_s.province_state_container.get<province_state::pops>(location), new_id);
-
-		ws.w.population_s.pop_demographics.get(new_id, total_population_tag) = initial_size;
-		ws.w.population_s.pops.set<pop::size>(new_id, initial_size);
-
-		ws.w.population_s.pops.set<pop::location>(new_id, location);
-		ws.w.population_s.pops.set<pop::culture>(new_id, c);
-		ws.w.population_s.pops.set<pop::religion>(new_id, r);
-
-		change_pop_type(ws, new_id, t);
-
-		tg.run([&ws, new_id, initial_size, militancy, consciousness, literacy, location, t, c, r]() {
-			if((ws.s.population_m.pop_types[t].flags & population::pop_type::is_employable) == 0)
-				ws.w.population_s.pop_demographics.get(new_id, total_employment_tag) = initial_size;
-
-			auto const prov_owner = ws.w.province_s.province_state_container.get<province_state::owner>(location);
-
-			ws.w.population_s.pops.set<pop::militancy>(new_id, militancy);
-			ws.w.population_s.pops.set<pop::consciousness>(new_id, consciousness);
-			ws.w.population_s.pops.set<pop::literacy>(new_id, literacy);
-
-			ws.w.population_s.pops.set<pop::is_accepted>(new_id, is_pop_accepted(ws, new_id, prov_owner));
-			default_initialize_issues_and_ideology(ws, new_id);
-		});
-
-		return new_id;
-	}
-
 	pop_tag make_new_pop(
 		world_state& ws,
 		float initial_size,
@@ -431,11 +415,39 @@ namespace population {
 	constexpr uint32_t pop_update_frequency = 32ui32;
 	constexpr uint32_t pop_update_group_size = uint32_t(std::max(16, ve::vector_size));
 
+	// tells the gui which provinces the pops in [first, last) are located in; pops are mostly grouped by province,
+	// so repeats are only dropped when they are adjacent and the rest is left to take_published_changes
+	void publish_pop_changes(world_state& ws, uint32_t first, uint32_t last) {
+		std::vector<ui::data_key> changed;
+		auto const locations = ws.w.population_s.pops.get_row<pop::location>();
+		provinces::province_tag previous;
+		for(uint32_t i = first; i < last; ++i) {
+			auto const p = locations[pop_tag(pop_tag::value_base_t(i))];
+			if(is_valid_index(p) && p != previous) {
+				changed.push_back(ui::data_key{ ui::world_data::province_pops, uint16_t(to_index(p)) });
+				previous = p;
+			}
+		}
+		ws.w.gui_m.publish_changes(changed);
+	}
+
+	// runs op over today's slice of the pops for the phase, which covers every pop about once per pop_update_frequency days
+	template<typename F>
+	void execute_scheduled_pop_slice(world_state& ws, current_state::amortized_phase phase, F& op) {
+		ws.w.update_schedule.run(int32_t(phase), pop_update_frequency, pop_update_group_size, ws.w.population_s.pops.vector_size(), [&ws, &op](schedule_slice s) {
+			if(!s.completes_set)
+				ve::execute_parallel<population::pop_tag>(s.first, s.last, op);
+			else
+				ve::execute_parallel_exact<population::pop_tag>(s.first, s.last, op);
+			publish_pop_changes(ws, s.first, std::min(s.last, uint32_t(ws.w.population_s.pops.size())));
+		});
+	}
+
 	struct literacy_update_operation {
 		tagged_array_view<float const, nations::state_tag> change_by_state;
 		tagged_array_view<provinces::province_tag const, population::pop_tag> pop_locations;
 		tagged_array_view<nations::state_tag const, provinces::province_tag> province_state_owners;
-		tagged_array_view<float, population::pop_tag> pop_literacy;
+		row_type<pop::container, pop::literacy> pop_literacy;
 
 		literacy_update_operation(world_state& ws, tagged_array_view<float const, nations::state_tag> a) :
 			change_by_state(a),
@@ -522,38 +534,16 @@ namespace population {
 		;
 	}
 
-	void update_literacy(world_state& ws) {
-		concurrent_cache_aligned_buffer<float, nations::state_tag, true> change_by_state(ws.w.nation_s.states.size());
-
-		ve::execute_parallel<nations::state_tag>(ws.w.nation_s.states.vector_size(),
-			gather_literacy_change_operation(ws, change_by_state.view()));
-
-		change_by_state.padding() = 0.0f;
-
-		const uint32_t pop_size = ws.w.population_s.pops.vector_size();
-		const uint32_t chunk_size = pop_size / (pop_update_frequency * pop_update_group_size);
-
-		const uint32_t chunk_index = uint32_t(to_index(ws.w.current_date) & (pop_update_frequency - 1));
-		if(chunk_index != pop_update_frequency - 1) {
-			ve::execute_parallel<population::pop_tag>(chunk_size * pop_update_group_size * chunk_index, chunk_size * pop_update_group_size * (chunk_index + 1ui32),
-				literacy_update_operation(ws, change_by_state.view()));
-		} else {
-			ve::execute_parallel_exact<population::pop_tag>(chunk_size * pop_update_group_size * chunk_index, pop_size,
-				literacy_update_operation(ws, change_by_state.view()));
-		}
-	}
-
 	void update_pop_ideology_and_issues(world_state& ws) {
-		const uint32_t pop_count = uint32_t(ws.w.population_s.pops.size());
-		const auto chunk_size = (pop_count + pop_update_frequency - 1) / pop_update_frequency;
-		const uint32_t chunk_index = uint32_t(to_index(ws.w.current_date) & (pop_update_frequency - 1));
-
-		concurrency::parallel_for(chunk_size * chunk_index, std::min(chunk_size * (chunk_index + 1), pop_count), [&ws](uint32_t i) {
-			pop_tag const pt = pop_tag(pop_tag::value_base_t(i));
-
-			update_ideology_preference(ws, pt);
-			update_issues_preference(ws, pt);
-		}, concurrency::static_partitioner());
+		ws.w.update_schedule.run(int32_t(current_state::amortized_phase::pop_ideology_and_issues), pop_update_frequency, 1ui32, uint32_t(ws.w.population_s.pops.size()), [&ws](schedule_slice s) {
+			concurrency::parallel_for(s.first, s.last, [&ws](uint32_t i) {
+				pop_tag const pt = pop_tag(pop_tag::value_base_t(i));
+
+				update_ideology_preference(ws, pt);
+				update_issues_preference(ws, pt);
+			}, concurrency::static_partitioner());
+			publish_pop_changes(ws, s.first, s.last);
+		});
 	}
 
 	struct gather_militancy_by_province_operation {
@@ -618,7 +608,7 @@ namespace population {
 	};
 
 	struct update_militancy_operation {
-		tagged_array_view<float, pop_tag> pop_militancy;
+		row_type<pop::container, pop::militancy> pop_militancy;
 
 		tagged_array_view<float const, provinces::province_tag> base_prov_modifier;
 		tagged_array_view<float const, provinces::province_tag> prov_non_accepted_modifier;
@@ -628,10 +618,10 @@ namespace population {
 
 		tagged_array_view<bitfield_type const, pop_tag> pop_acceptance;
 
-		tagged_array_view<float const, pop_tag> pop_size;
-		tagged_array_view<float const, pop_tag> pop_satisfaction;
-		tagged_array_view<float const, pop_tag> pop_political_reform_support;
-		tagged_array_view<float const, pop_tag> pop_social_reform_support;
+		const_row_type<pop::container, pop::size> pop_size;
+		const_row_type<pop::container, pop::needs_satisfaction> pop_satisfaction;
+		tagged_array_view<unorm16_type const, pop_tag> pop_political_reform_support;
+		tagged_array_view<unorm16_type const, pop_tag> pop_social_reform_support;
 
 		world_state const& ws;
 
@@ -798,27 +788,6 @@ namespace population {
 			* 0.1f;
 	}
 
-	void update_militancy(world_state& ws) {
-		concurrent_cache_aligned_buffer<float, provinces::province_tag, true> base_modifier(ws.w.province_s.province_state_container.size());
-		concurrent_cache_aligned_buffer<float, provinces::province_tag, true> non_accepted_modifier(ws.w.province_s.province_state_container.size());
-
-
-		ve::execute_parallel<provinces::province_tag>(ws.w.province_s.province_state_container.vector_size(),
-			gather_militancy_by_province_operation(ws, base_modifier.view(), non_accepted_modifier.view()));
-
-
-		uint32_t const pop_size = ws.w.population_s.pops.vector_size();
-		uint32_t const chunk_size = pop_size / (pop_update_frequency * pop_update_group_size);
-
-		update_militancy_operation op(ws, base_modifier.view(), non_accepted_modifier.view());
-
-		uint32_t const chunk_index = uint32_t(to_index(ws.w.current_date) & (pop_update_frequency - 1));
-		if(chunk_index != pop_update_frequency - 1)
-			ve::execute_parallel<population::pop_tag>(chunk_size * pop_update_group_size * chunk_index, chunk_size * pop_update_group_size * (chunk_index + 1ui32), op);
-		else
-			ve::execute_parallel_exact<population::pop_tag>(chunk_size * pop_update_group_size * chunk_index, pop_size, op);
-	}
-
 	struct gather_consciousness_factors_operation {
 		tagged_array_view<float, provinces::province_tag> fixed_factor_out;
 		tagged_array_view<float, provinces::province_tag> clergy_factor_out;
@@ -876,13 +845,13 @@ namespace population {
 	};
 
 	struct update_consciousness_operation {
-		tagged_array_view<float, pop_tag> pop_consciousness;
+		row_type<pop::container, pop::consciousness> pop_consciousness;
 
 		tagged_array_view<provinces::province_tag const, pop_tag> pop_locations;
 		tagged_array_view<nations::country_tag const, provinces::province_tag> owner_indices;
 
-		tagged_array_view<float const, pop_tag> pop_literacy;
-		tagged_array_view<float const, pop_tag> pop_satisfaction;
+		const_row_type<pop::container, pop::literacy> pop_literacy;
+		const_row_type<pop::container, pop::needs_satisfaction> pop_satisfaction;
 		tagged_array_view<float const, nations::country_tag> nat_non_accepted_con;
 
 		tagged_array_view<bitfield_type const, pop_tag> pop_is_poor;
@@ -979,27 +948,106 @@ namespace population {
 		return base_sum * 0.1f;
 	}
 
-	void update_consciousness(world_state& ws) {
-		concurrent_cache_aligned_buffer<float, provinces::province_tag, true> fixed_factor(ws.w.province_s.province_state_container.size());
-		concurrent_cache_aligned_buffer<float, provinces::province_tag, true> clergy_factor(ws.w.province_s.province_state_container.size());
-		concurrent_cache_aligned_buffer<float, provinces::province_tag, true> literacy_factor(ws.w.province_s.province_state_container.size());
+	// the per-state and per-province inputs of the literacy, militancy and consciousness updates
+	struct pop_attitude_factors {
+		concurrent_cache_aligned_buffer<float, nations::state_tag, true> literacy_change_by_state;
+		concurrent_cache_aligned_buffer<float, provinces::province_tag, true> militancy_base;
+		concurrent_cache_aligned_buffer<float, provinces::province_tag, true> militancy_non_accepted;
+		concurrent_cache_aligned_buffer<float, provinces::province_tag, true> consciousness_fixed;
+		concurrent_cache_aligned_buffer<float, provinces::province_tag, true> consciousness_clergy;
+		concurrent_cache_aligned_buffer<float, provinces::province_tag, true> consciousness_literacy;
+
+		pop_attitude_factors(world_state const& ws) :
+			literacy_change_by_state(ws.w.nation_s.states.size()),
+			militancy_base(ws.w.province_s.province_state_container.size()),
+			militancy_non_accepted(ws.w.province_s.province_state_container.size()),
+			consciousness_fixed(ws.w.province_s.province_state_container.size()),
+			consciousness_clergy(ws.w.province_s.province_state_container.size()),
+			consciousness_literacy(ws.w.province_s.province_state_container.size()) {}
+	};
+
+	// gathers the militancy and consciousness factors of each block of provinces together, so that the owner, state
+	// and modifier columns of the block are read from memory once for both
+	struct gather_pop_attitude_factors_operation {
+		gather_militancy_by_province_operation militancy;
+		gather_consciousness_factors_operation consciousness;
+
+		gather_pop_attitude_factors_operation(world_state& w, pop_attitude_factors& f) :
+			militancy(w, f.militancy_base.view(), f.militancy_non_accepted.view()),
+			consciousness(w, f.consciousness_fixed.view(), f.consciousness_clergy.view(), f.consciousness_literacy.view()) {}
 
+		template<typename T>
+		RELEASE_INLINE void operator()(T province_v) {
+			militancy(province_v);
+			consciousness(province_v);
+		}
+	};
+
+	// updates literacy, militancy and consciousness of each block of pops in turn, so that the pop columns and province
+	// factors of the block are read from memory once for all three; consciousness sees the updated literacy
+	struct update_pop_attitudes_operation {
+		literacy_update_operation literacy;
+		update_militancy_operation militancy;
+		update_consciousness_operation consciousness;
+
+		update_pop_attitudes_operation(world_state& w, pop_attitude_factors& f) :
+			literacy(w, f.literacy_change_by_state.view()),
+			militancy(w, f.militancy_base.view(), f.militancy_non_accepted.view()),
+			consciousness(w, f.consciousness_fixed.view(), f.consciousness_clergy.view(), f.consciousness_literacy.view()) {}
+
+		template<typename T>
+		RELEASE_INLINE void operator()(T pop_v) {
+			literacy(pop_v);
+			militancy(pop_v);
+			consciousness(pop_v);
+		}
+	};
+
+	void gather_pop_attitude_factors(world_state& ws, pop_attitude_factors& f) {
+		ve::execute_parallel<nations::state_tag>(ws.w.nation_s.states.vector_size(),
+			gather_literacy_change_operation(ws, f.literacy_change_by_state.view()));
+		f.literacy_change_by_state.padding() = 0.0f;
 
 		ve::execute_parallel<provinces::province_tag>(ws.w.province_s.province_state_container.vector_size(),
-			gather_consciousness_factors_operation(ws, fixed_factor.view(), clergy_factor.view(), literacy_factor.view()));
+			gather_pop_attitude_factors_operation(ws, f));
+		f.consciousness_clergy.padding() = 0.0f;
+	}
 
-		clergy_factor.padding() = 0.0f;
+	void update_pop_attitudes(world_state& ws) {
+		pop_attitude_factors f(ws);
+		gather_pop_attitude_factors(ws, f);
 
-		uint32_t const pop_size = ws.w.population_s.pops.vector_size();
-		uint32_t const chunk_size = pop_size / (pop_update_frequency * pop_update_group_size);
+		update_pop_attitudes_operation op(ws, f);
+		execute_scheduled_pop_slice(ws, current_state::amortized_phase::pop_attitudes, op);
+	}
 
-		update_consciousness_operation op(ws, fixed_factor.view(), clergy_factor.view(), literacy_factor.view());
+	void update_all_pop_attitudes(world_state& ws) {
+		pop_attitude_factors f(ws);
+		gather_pop_attitude_factors(ws, f);
 
-		uint32_t const chunk_index = uint32_t(to_index(ws.w.current_date) & (pop_update_frequency - 1));
-		if(chunk_index != pop_update_frequency - 1)
-			ve::execute_parallel<population::pop_tag>(chunk_size * pop_update_group_size * chunk_index, chunk_size * pop_update_group_size * (chunk_index + 1ui32), op);
-		else
-			ve::execute_parallel_exact<population::pop_tag>(chunk_size * pop_update_group_size * chunk_index, pop_size, op);
+		ve::execute_parallel_exact<population::pop_tag>(ws.w.population_s.pops.vector_size(), update_pop_attitudes_operation(ws, f));
+	}
+
+	void update_all_pop_attitudes_separately(world_state& ws) {
+		pop_attitude_factors f(ws);
+		auto const pop_count = ws.w.population_s.pops.vector_size();
+		auto const province_count = ws.w.province_s.province_state_container.vector_size();
+
+		ve::execute_parallel<nations::state_tag>(ws.w.nation_s.states.vector_size(),
+			gather_literacy_change_operation(ws, f.literacy_change_by_state.view()));
+		f.literacy_change_by_state.padding() = 0.0f;
+		ve::execute_parallel_exact<population::pop_tag>(pop_count, literacy_update_operation(ws, f.literacy_change_by_state.view()));
+
+		ve::execute_parallel<provinces::province_tag>(province_count,
+			gather_militancy_by_province_operation(ws, f.militancy_base.view(), f.militancy_non_accepted.view()));
+		ve::execute_parallel_exact<population::pop_tag>(pop_count,
+			update_militancy_operation(ws, f.militancy_base.view(), f.militancy_non_accepted.view()));
+
+		ve::execute_parallel<provinces::province_tag>(province_count,
+			gather_consciousness_factors_operation(ws, f.consciousness_fixed.view(), f.consciousness_clergy.view(), f.consciousness_literacy.view()));
+		f.consciousness_clergy.padding() = 0.0f;
+		ve::execute_parallel_exact<population::pop_tag>(pop_count,
+			update_consciousness_operation(ws, f.consciousness_fixed.view(), f.consciousness_clergy.view(), f.consciousness_literacy.view()));
 	}
 
 	struct calculate_promotion_operation {
@@ -1007,8 +1055,8 @@ namespace population {
 
 		tagged_array_view<float, pop_tag> change_amount;
 
-		tagged_array_view<pop_type_tag const, pop_tag> pop_types;
-		tagged_array_view<float const, pop_tag> pop_sizes;
+		const_row_type<pop::container, pop::type> pop_types;
+		const_row_type<pop::container, pop::size> pop_sizes;
 		tagged_array_view<provinces::province_tag const, pop_tag> pop_location;
 		tagged_array_view<nations::country_tag const, provinces::province_tag> province_owners;
 		tagged_array_view<float const, nations::country_tag> national_admin_eff;
@@ -1085,16 +1133,8 @@ namespace population {
 	}
 
 	void calculate_promotion_and_demotion_qnty(world_state& ws) {
-		const uint32_t pop_size = ws.w.population_s.pops.vector_size();
-		const uint32_t chunk_size = pop_size / (pop_update_frequency * pop_update_group_size);
-
 		calculate_promotion_operation op(ws);
-
-		const uint32_t chunk_index = uint32_t(to_index(ws.w.current_date) & (pop_update_frequency - 1));
-		if(chunk_index != pop_update_frequency - 1)
-			ve::execute_parallel<population::pop_tag>(chunk_size * pop_update_group_size * chunk_index, chunk_size * pop_update_group_size * (chunk_index + 1ui32), op);
-		else
-			ve::execute_parallel_exact<population::pop_tag>(chunk_size * pop_update_group_size * chunk_index, pop_size, op);
+		execute_scheduled_pop_slice(ws, current_state::amortized_phase::promotion_and_demotion, op);
 	}
 
 	struct calculate_migration_operation {
@@ -1104,7 +1144,7 @@ namespace population {
 		// tagged_array_view<float, pop_tag> colonial_migration_amount;
 		tagged_array_view<float, pop_tag> emigration_amount;
 
-		tagged_array_view<float const, pop_tag> pop_sizes;
+		const_row_type<pop::container, pop::size> pop_sizes;
 		tagged_array_view<provinces::province_tag const, pop_tag> pop_location;
 		tagged_array_view<bitfield_type const, provinces::province_tag> provinces_are_colonial;
 		// tagged_array_view<bitfield_type const, pop_tag> poor_pops;
@@ -1195,16 +1235,8 @@ namespace population {
 	}
 
 	void calculate_migration_qnty(world_state& ws) {
-		const uint32_t pop_size = ws.w.population_s.pops.vector_size();
-		const uint32_t chunk_size = pop_size / (pop_update_frequency * pop_update_group_size);
-
 		calculate_migration_operation op(ws);
-
-		const uint32_t chunk_index = uint32_t(to_index(ws.w.current_date) & (pop_update_frequency - 1));
-		if(chunk_index != pop_update_frequency - 1)
-			ve::execute_parallel<population::pop_tag>(chunk_size * pop_update_group_size * chunk_index, chunk_size * pop_update_group_size * (chunk_index + 1ui32), op);
-		else
-			ve::execute_parallel_exact<population::pop_tag>(chunk_size * pop_update_group_size * chunk_index, pop_size, op);
+		execute_scheduled_pop_slice(ws, current_state::amortized_phase::migration, op);
 	}
 
 	struct calculate_assimilation_operation {
@@ -1212,9 +1244,9 @@ namespace population {
 
 		tagged_array_view<float, pop_tag> assimilation_amount;
 
-		tagged_array_view<float const, pop_tag> pop_sizes;
+		const_row_type<pop::container, pop::size> pop_sizes;
 		tagged_array_view<provinces::province_tag const, pop_tag> pop_location;
-		tagged_array_view<cultures::religion_tag const, pop_tag> pop_religions;
+		const_row_type<pop::container, pop::religion> pop_religions;
 		tagged_array_view<bitfield_type const, pop_tag> is_accepted;
 		tagged_array_view<nations::country_tag const, provinces::province_tag> province_owners;
 		tagged_array_view<float const, provinces::province_tag> province_assimilation_mod;
@@ -1284,16 +1316,8 @@ namespace population {
 	}
 
 	void calculate_assimilation_qnty(world_state& ws) {
-		const uint32_t pop_size = ws.w.population_s.pops.vector_size();
-		const uint32_t chunk_size = pop_size / (pop_update_frequency * pop_update_group_size);
-
 		calculate_assimilation_operation op(ws);
-
-		const uint32_t chunk_index = uint32_t(to_index(ws.w.current_date) & (pop_update_frequency - 1));
-		if(chunk_index != pop_update_frequency - 1)
-			ve::execute_parallel<population::pop_tag>(chunk_size * pop_update_group_size * chunk_index, chunk_size * pop_update_group_size * (chunk_index + 1ui32), op);
-		else
-			ve::execute_parallel_exact<population::pop_tag>(chunk_size * pop_update_group_size * chunk_index, pop_size, op);
+		execute_scheduled_pop_slice(ws, current_state::amortized_phase::assimilation, op);
 	}
 
 	constexpr float max_movement_support = 0.5f;
@@ -1466,32 +1490,32 @@ namespace population {
 
 	void update_independence_movements(world_state& ws) {
 		const uint32_t tag_count = uint32_t(ws.s.culture_m.national_tags.size());
-		auto const chunk_size = (tag_count + independence_movement_update_frequency - 1ui32) / independence_movement_update_frequency;
-		uint32_t const chunk_index = uint32_t(to_index(ws.w.current_date) & (independence_movement_update_frequency - 1));
 
-		concurrency::parallel_for(chunk_size * chunk_index, std::min(chunk_size * (chunk_index + 1), tag_count), [&ws](uint32_t i) {
-			cultures::national_tag const t = cultures::national_tag(cultures::national_tag::value_base_t(i));
-			if(ws.s.culture_m.tags_to_groups[t]) {
-				update_union_independence_movement_and_rebels(ws, t);
-			} else {
-				update_non_union_independence_movement_and_rebels(ws, t);
-			}
-		}, concurrency::static_partitioner());
+		ws.w.update_schedule.run(int32_t(current_state::amortized_phase::independence_movements), independence_movement_update_frequency, 1ui32, tag_count, [&ws](schedule_slice s) {
+			concurrency::parallel_for(s.first, s.last, [&ws](uint32_t i) {
+				cultures::national_tag const t = cultures::national_tag(cultures::national_tag::value_base_t(i));
+				if(ws.s.culture_m.tags_to_groups[t]) {
+					update_union_independence_movement_and_rebels(ws, t);
+				} else {
+					update_non_union_independence_movement_and_rebels(ws, t);
+				}
+			}, concurrency::static_partitioner());
+		});
 	}
 
 	constexpr uint32_t rebel_update_frequency = 16;
 
 	void update_local_rebels_and_movements(world_state& ws) {
 		const uint32_t nation_count = uint32_t(ws.w.nation_s.nations.size());
-		auto const chunk_size = (nation_count + rebel_update_frequency - 1ui32) / rebel_update_frequency;
-		uint32_t const chunk_index = uint32_t(to_index(ws.w.current_date) & (rebel_update_frequency - 1));
 
-		concurrency::parallel_for(chunk_size * chunk_index, std::min(chunk_size * (chunk_index + 1), nation_count), [&ws](uint32_t i) {
-			nations::country_tag t = nations::country_tag(nations::country_tag::value_base_t(i));
-			if(ws.w.nation_s.nations.get<nation::current_capital>(t)) {
-				update_local_movements_and_rebels(ws, t);
-			}
-		}, concurrency::static_partitioner());
+		ws.w.update_schedule.run(int32_t(current_state::amortized_phase::local_rebels), rebel_update_frequency, 1ui32, nation_count, [&ws](schedule_slice s) {
+			concurrency::parallel_for(s.first, s.last, [&ws](uint32_t i) {
+				nations::country_tag t = nations::country_tag(nations::country_tag::value_base_t(i));
+				if(ws.w.nation_s.nations.get<nation::current_capital>(t)) {
+					update_local_movements_and_rebels(ws, t);
+				}
+			}, concurrency::static_partitioner());
+		});
 	}
 
 	pop_tag find_in_province(world_state const& ws, provinces::province_tag prov, pop_type_tag type, cultures::culture_tag c, cultures::religion_tag r) {
@@ -1563,38 +1587,84 @@ namespace population {
 		return population_range{ min_v, max_v };
 	}
 
-	struct pop_migration_key {
-		cultures::culture_tag c;
-		//cultures::religion_tag r;
-		pop_type_tag t;
-
-		constexpr bool operator==(pop_migration_key const& o) const {
-			return c == o.c /*&& r == o.r*/ && t == o.t;
-		}
+	// a pop leaving its province, recorded while the size changes of the province are calculated
+	struct outbound_pop_record {
+		float amount = 0.0f;
+		float pop_militancy = 0.0f;
+		float pop_consciousness = 0.0f;
+		float pop_literacy = 0.0f;
+		pop_tag from_pop;
+		nations::country_tag within_nation; // null when emigrating
+		cultures::culture_tag pop_culture;
+		cultures::religion_tag pop_religion;
+		pop_type_tag pop_type;
 	};
 
-	struct emigrating_pop_data {
-		float amount;
-		float pop_militancy;
-		float pop_consciousness;
-		float pop_literacy;
+	// the same move once its destination province has been chosen
+	struct inbound_pop_record {
+		float amount = 0.0f;
+		float pop_militancy = 0.0f;
+		float pop_consciousness = 0.0f;
+		float pop_literacy = 0.0f;
+		cultures::culture_tag pop_culture;
 		cultures::religion_tag pop_religion;
+		cultures::religion_tag destination_religion;
+		pop_type_tag fitted_type;
+		bool is_immigration = false;
 	};
-	struct migrating_pop_data {
-		float amount;
-		float pop_militancy;
-		float pop_consciousness;
-		float pop_literacy;
-		nations::country_tag within_nation;
-		cultures::religion_tag pop_religion;
+
+	template<typename T>
+	struct keyed_records {
+		std::vector<uint64_t> keys;
+		std::vector<T> values;
+
+		void push_back(uint64_t key, T const& value) {
+			keys.push_back(key);
+			values.push_back(value);
+		}
 	};
 
+	// outbound records are grouped by culture and type, which share destination weights, and inbound records by
+	// destination province. Both keys end in the moving pop and the kind of move, so that every record has its own
+	// key and the sorted order does not depend on which thread recorded what
+	constexpr uint32_t outbound_group_shift = 33;
+	constexpr uint32_t outbound_key_bits = 57;
+	constexpr uint32_t inbound_province_shift = 33;
+	constexpr uint32_t inbound_key_bits = 49;
+
+	inline uint64_t outbound_key(cultures::culture_tag c, pop_type_tag t, pop_tag p, bool emigrating) {
+		return (uint64_t(to_index(c)) << 41) | (uint64_t(to_index(t)) << outbound_group_shift) | (uint64_t(to_index(p)) << 1) | uint64_t(emigrating);
+	}
+	inline uint64_t inbound_key(provinces::province_tag destination, pop_tag p, bool immigrating) {
+		return (uint64_t(to_index(destination)) << inbound_province_shift) | (uint64_t(to_index(p)) << 1) | uint64_t(immigrating);
+	}
+
+	template<typename T>
+	keyed_records<T> sorted_records(concurrency::combinable<keyed_records<T>>& buffers, uint32_t key_bits) {
+		keyed_records<T> all;
+		buffers.combine_each([&all](keyed_records<T>& b) {
+			all.keys.insert(all.keys.end(), b.keys.begin(), b.keys.end());
+			all.values.insert(all.values.end(), b.values.begin(), b.values.end());
+		});
+		ve::radix_sort_by_key(uint32_t(all.keys.size()), all.keys.data(), all.values.data(), key_bits, ve::par());
+		return all;
+	}
+
+	// offsets of the first of each run of keys that agree above shift, followed by the total count
+	inline std::vector<int32_t> key_run_starts(std::vector<uint64_t> const& keys, uint32_t shift) {
+		std::vector<int32_t> starts;
+		for(size_t k = 0; k < keys.size(); ++k) {
+			if(k == 0 || (keys[k] >> shift) != (keys[k - 1] >> shift))
+				starts.push_back(int32_t(k));
+		}
+		starts.push_back(int32_t(keys.size()));
+		return starts;
+	}
+
 	struct pop_migration_data {
 		moveable_concurrent_cache_aligned_buffer<float, nations::country_tag, true> nation_weights;
 		moveable_concurrent_cache_aligned_buffer<float, provinces::province_tag, true> province_weights;
 		moveable_concurrent_cache_aligned_buffer<float, nations::country_tag, true> sum_province_weights_by_nation;
-		std::vector<emigrating_pop_data, concurrent_allocator<emigrating_pop_data>> emigrating_pops;
-		std::vector<migrating_pop_data, concurrent_allocator<migrating_pop_data>> migrating_pops;
 
 		float nation_weights_sum = 0.0f;
 		pop_tag from_pop;
@@ -1604,8 +1674,8 @@ namespace population {
 			sum_province_weights_by_nation(ws.w.nation_s.nations.vector_size()), from_pop(origin_pop) {
 		}
 
-		void populate_weights(world_state const& ws, pop_type_tag p_type, cultures::culture_tag p_culture) {
-			if(emigrating_pops.size() != 0) {
+		void populate_weights(world_state const& ws, pop_type_tag p_type, cultures::culture_tag p_culture, bool has_emigrants) {
+			if(has_emigrants) {
 				auto const nation_count = ws.w.nation_s.nations.size();
 
 				auto const mt_trigger = ws.s.population_m.pop_types[p_type].country_migration_target;
@@ -1647,10 +1717,10 @@ namespace population {
 			}
 		}
 
-		nations::country_tag choose_nation(world_state const& ws) {
+		nations::country_tag choose_nation(world_state const& ws, jsf_prng& generator) {
 			int32_t const nation_count = ws.w.nation_s.nations.size();
 			std::uniform_real_distribution<float> const dist(0.0f, nation_weights_sum);
-			auto const chosen = dist(get_local_generator());
+			auto const chosen = dist(generator);
 
 			auto const chosen_position = std::lower_bound(nation_weights.begin(), nation_weights.begin() + nation_count, chosen);
 			return (chosen_position != nation_weights.begin() + nation_count)
@@ -1658,7 +1728,7 @@ namespace population {
 				       : nations::country_tag();
 		}
 
-		provinces::province_tag choose_province_from_nation(world_state const& ws, nations::country_tag n) {
+		provinces::province_tag choose_province_from_nation(world_state const& ws, nations::country_tag n, jsf_prng& generator) {
 			auto p_range = get_range(ws.w.province_s.province_arrays, ws.w.nation_s.nations.get<nation::owned_provinces>(n));
 
 			if(sum_province_weights_by_nation[n] == 0.0f) {
@@ -1679,7 +1749,7 @@ namespace population {
 
 			auto const total_weights = sum_province_weights_by_nation[n];
 			std::uniform_real_distribution<float> const dist(0.0f, total_weights);
-			auto chosen = dist(get_local_generator());
+			auto chosen = dist(generator);
 
 			auto const chosen_position = std::lower_bound(
 				p_range.first,
@@ -1692,23 +1762,7 @@ namespace population {
 				: provinces::province_tag();
 		}
 	};
-}
-
-namespace std {
-	template<>
-	struct hash<population::pop_migration_key> {
-		size_t operator()(population::pop_migration_key k) const noexcept {
-			// from: https://github.com/martinus/robin-hood-hashing/blob/master/src/include/robin_hood.h
-			//uint32_t const v = (uint32_t(k.c.value) << 8) ^ (uint32_t(k.t.value) << 3) ^ uint32_t(k.r.value);
-			uint32_t const v = (uint32_t(k.c.value) << 5) ^ uint32_t(k.t.value);
 
-			__int64 const high_out = __mulh(0xfa1371431ef43ae1ui64, v);
-			return static_cast<uint64_t>(high_out) * 0xfe9b65e7da1b3187ui64;
-		}
-	};
-}
-
-namespace population {
 	void add_pop_to_array(float* array, pop_type_tag type, float size, float literacy) {
 		array[to_index(type) * 2] += size;
 		array[to_index(type) * 2 +  1] += size * literacy;
@@ -1864,11 +1918,13 @@ namespace population {
 
 		uint32_t const provinces_count = uint32_t(ws.s.province_m.first_sea_province);
 
-		uint32_t const chunk_size = (provinces_count / (pop_update_frequency * pop_update_group_size));
-		uint32_t const chunk_index = uint32_t(to_index(ws.w.current_date) & (pop_update_frequency - 1));
+		auto const slice = ws.w.update_schedule.next_slice(int32_t(current_state::amortized_phase::size_changes), pop_update_frequency, pop_update_group_size, provinces_count);
+		if(slice.first == slice.last)
+			return;
+		auto const start_time = std::chrono::steady_clock::now();
 
-		int32_t const lower_limit = int32_t(chunk_size * chunk_index * pop_update_group_size);
-		int32_t const upper_limit = int32_t(chunk_index != pop_update_frequency - 1 ? chunk_size * pop_update_group_size * (chunk_index + 1) : provinces_count);
+		int32_t const lower_limit = int32_t(slice.first);
+		int32_t const upper_limit = int32_t(slice.last);
 
 		concurrency::parallel_for(lower_limit, upper_limit, [&ws](uint32_t i) {
 			provinces::province_tag t = provinces::province_tag(provinces::province_tag::value_base_t(i));
@@ -1877,7 +1933,7 @@ namespace population {
 			});
 		}, concurrency::static_partitioner());
 
-		std::unordered_map<pop_migration_key, pop_migration_data> migration_map;
+		concurrency::combinable<keyed_records<outbound_pop_record>> outbound_buffers;
 
 		for(int32_t i = lower_limit; i < upper_limit; i += ve::vector_size) {
 			ve::contiguous_tags<provinces::province_tag> off(i);
@@ -1894,7 +1950,8 @@ namespace population {
 			ve::store(off, monthly_pop, 0.0f);
 		}
 
-		concurrency::parallel_for(lower_limit, upper_limit, [&ws](uint32_t i) {
+		// first stage: growth, promotion and assimilation are applied in place, while pops leaving the province are recorded
+		concurrency::parallel_for(lower_limit, upper_limit, [&ws, &outbound_buffers](uint32_t i) {
 			provinces::province_tag t = provinces::province_tag(provinces::province_tag::value_base_t(i));
 			auto const province_owner = ws.w.province_s.province_state_container.get<province_state::owner>(t);
 			auto const owner_culture = ws.w.nation_s.nations.get<nation::primary_culture>(province_owner);
@@ -1970,62 +2027,21 @@ namespace population {
 							assimilation_val);
 					}
 
-					//generic growth
-					auto const modified_prov_growth = (pop_j_satisfaction < ws.s.modifiers_m.global_defines.life_need_starvation_limit)
-						? (province_growth * (1.0f + 4.0f * (pop_j_satisfaction - ws.s.modifiers_m.global_defines.life_need_starvation_limit)))
-						: province_growth;
-					auto const growth_amount = (owner_growth_mod + modified_prov_growth) * pop_j_size;
-					ws.w.population_s.pops.get<pop::size_change_from_growth>(pop_j) += growth_amount;
-
-				} else {
-					// slave case
-					auto const modified_prov_growth = (pop_j_satisfaction < ws.s.modifiers_m.global_defines.life_need_starvation_limit)
-						? (province_growth * (1.0f + 4.0f * (pop_j_satisfaction - ws.s.modifiers_m.global_defines.life_need_starvation_limit)))
-						: province_growth;
-					auto const growth_amount = (owner_growth_mod + modified_prov_growth) * pop_j_size / ws.s.modifiers_m.global_defines.slave_growth_divisor;
-					ws.w.population_s.pops.get<pop::size_change_from_growth>(pop_j) += growth_amount;
-				}
-			}
-		});
-
-		// collect moving pops
-		for(int32_t i = lower_limit; i < upper_limit; ++i) {
-			provinces::province_tag t = provinces::province_tag(provinces::province_tag::value_base_t(i));
-			auto const province_owner = ws.w.province_s.province_state_container.get<province_state::owner>(t);
-
-			auto const pop_range = get_range(ws.w.population_s.pop_arrays, ws.w.province_s.province_state_container.get<province_state::pops>(t));
-
-			int32_t const fixed_pop_count = int32_t(pop_range.second - pop_range.first);
-			population::pop_tag* const fixed_range = static_cast<population::pop_tag*>(_alloca(sizeof(population::pop_tag) * fixed_pop_count));
-			std::copy_n(pop_range.first, fixed_pop_count, fixed_range);
-			
-			for(int32_t j = 0; j < fixed_pop_count; ++j) {
-				auto const pop_j = fixed_range[j];
-				auto const pop_j_type = ws.w.population_s.pops.get<pop::type>(pop_j);
-
-				if(pop_j_type != ws.s.population_m.slave) {
-					auto const pop_j_culture = ws.w.population_s.pops.get<pop::culture>(pop_j);
-					auto const pop_j_religion = ws.w.population_s.pops.get<pop::religion>(pop_j);
-
-
-					auto const pop_j_militancy = ws.w.population_s.pops.get<pop::militancy>(pop_j);
-					auto const pop_j_consciousness = ws.w.population_s.pops.get<pop::consciousness>(pop_j);
-					auto const pop_j_literacy = ws.w.population_s.pops.get<pop::literacy>(pop_j);
-
 					auto const migration_val = ws.w.population_s.pops.get<pop::size_change_from_local_migration>(pop_j);
 					if(migration_val >= 1.0f) {
 						// move within nation
-
-						//auto const emplace_result = migration_map.try_emplace(pop_migration_key{ pop_j_culture, pop_j_religion, pop_j_type }, ws, pop_j_type, pop_j);
-						auto const emplace_result = migration_map.try_emplace(pop_migration_key{ pop_j_culture, pop_j_type }, ws, pop_j_type, pop_j);
-						emplace_result.first->second.migrating_pops.push_back(
-							migrating_pop_data{
+						outbound_buffers.local().push_back(
+							outbound_key(pop_j_culture, pop_j_type, pop_j, false),
+							outbound_pop_record{
 								migration_val,
 								pop_j_militancy,
 								pop_j_consciousness,
 								pop_j_literacy,
+								pop_j,
 								province_owner,
-								pop_j_religion
+								pop_j_culture,
+								pop_j_religion,
+								pop_j_type
 							});
 						ws.w.province_s.province_state_container.get<province_state::net_migration_growth>(t) -= migration_val;
 					}
@@ -2033,94 +2049,135 @@ namespace population {
 					auto const emigration_val = ws.w.population_s.pops.get<pop::size_change_from_emigration>(pop_j);
 					if(emigration_val >= 1.0f) {
 						// move outside nation
-
-						//auto const emplace_result = migration_map.try_emplace(pop_migration_key{ pop_j_culture, pop_j_religion, pop_j_type }, ws, pop_j_type, pop_j);
-						auto const emplace_result = migration_map.try_emplace(pop_migration_key{ pop_j_culture, pop_j_type }, ws, pop_j_type, pop_j);
-						emplace_result.first->second.emigrating_pops.push_back(
-							emigrating_pop_data{
+						outbound_buffers.local().push_back(
+							outbound_key(pop_j_culture, pop_j_type, pop_j, true),
+							outbound_pop_record{
 								emigration_val,
 								pop_j_militancy,
 								pop_j_consciousness,
 								pop_j_literacy,
-								pop_j_religion
+								pop_j,
+								nations::country_tag(),
+								pop_j_culture,
+								pop_j_religion,
+								pop_j_type
 							});
 						ws.w.province_s.province_state_container.get<province_state::net_immigration_growth>(t) -= emigration_val;
 					}
+
+					//generic growth
+					auto const modified_prov_growth = (pop_j_satisfaction < ws.s.modifiers_m.global_defines.life_need_starvation_limit)
+						? (province_growth * (1.0f + 4.0f * (pop_j_satisfaction - ws.s.modifiers_m.global_defines.life_need_starvation_limit)))
+						: province_growth;
+					auto const growth_amount = (owner_growth_mod + modified_prov_growth) * pop_j_size;
+					ws.w.population_s.pops.get<pop::size_change_from_growth>(pop_j) += growth_amount;
+
+				} else {
+					// slave case
+					auto const modified_prov_growth = (pop_j_satisfaction < ws.s.modifiers_m.global_defines.life_need_starvation_limit)
+						? (province_growth * (1.0f + 4.0f * (pop_j_satisfaction - ws.s.modifiers_m.global_defines.life_need_starvation_limit)))
+						: province_growth;
+					auto const growth_amount = (owner_growth_mod + modified_prov_growth) * pop_j_size / ws.s.modifiers_m.global_defines.slave_growth_divisor;
+					ws.w.population_s.pops.get<pop::size_change_from_growth>(pop_j) += growth_amount;
 				}
 			}
-		}
+		});
 
-		// resolve migrating pops
-		concurrency::parallel_for_each(migration_map.begin(), migration_map.end(), [&ws](auto& map_pair) {
-			map_pair.second.populate_weights(ws, map_pair.first.t, map_pair.first.c);
+		// second stage: the destinations of each culture and type group are drawn from its own weights and generator
+		auto const outbound = sorted_records(outbound_buffers, outbound_key_bits);
+		auto const group_starts = key_run_starts(outbound.keys, outbound_group_shift);
+		uint32_t const base_seed = get_local_generator()();
+
+		concurrency::combinable<keyed_records<inbound_pop_record>> inbound_buffers;
+		concurrency::parallel_for(0, int32_t(group_starts.size()) - 1, [&ws, &outbound, &group_starts, &inbound_buffers, base_seed](int32_t g) {
+			int32_t const first = group_starts[g];
+			int32_t const last = group_starts[g + 1];
+			auto const& lead = outbound.values[first];
+
+			bool const has_emigrants = std::any_of(outbound.values.begin() + first, outbound.values.begin() + last,
+				[](outbound_pop_record const& r) { return !is_valid_index(r.within_nation); });
+
+			pop_migration_data destinations(ws, lead.pop_type, lead.from_pop);
+			destinations.populate_weights(ws, lead.pop_type, lead.pop_culture, has_emigrants);
+			jsf_prng generator(base_seed ^ (uint32_t(outbound.keys[first] >> outbound_group_shift) * 0x9E3779B9ui32));
+
+			auto& local_inbound = inbound_buffers.local();
+			for(int32_t k = first; k < last; ++k) {
+				auto const& r = outbound.values[k];
+				bool const emigrating = !is_valid_index(r.within_nation);
+
+				auto const dest_nation = emigrating ? destinations.choose_nation(ws, generator) : r.within_nation;
+				if(!dest_nation)
+					continue;
+				auto const dest_province = destinations.choose_province_from_nation(ws, dest_nation, generator);
+				if(!dest_province)
+					continue;
+
+				local_inbound.push_back(
+					inbound_key(dest_province, r.from_pop, emigrating),
+					inbound_pop_record{
+						r.amount,
+						r.pop_militancy,
+						r.pop_consciousness,
+						r.pop_literacy,
+						r.pop_culture,
+						r.pop_religion,
+						ws.w.nation_s.nations.get<nation::national_religion>(dest_nation),
+						fit_type_to_province(ws, dest_province, r.pop_type),
+						emigrating
+					});
+			}
 		});
 
-		static concurrency::task_group pop_creation_tg;
+		// third stage: arrivals merge into the pops of their destination, one task per destination province. Arrivals that
+		// need a new pop are coalesced, and the new pops are allocated afterwards in key order
+		auto const inbound = sorted_records(inbound_buffers, inbound_key_bits);
+		auto const province_starts = key_run_starts(inbound.keys, inbound_province_shift);
+		auto const destination_of = [&inbound](int32_t k) {
+			return provinces::province_tag(provinces::province_tag::value_base_t(inbound.keys[k] >> inbound_province_shift));
+		};
 
-		for(auto& map_pair : migration_map) {
-			for(auto& em_pop : map_pair.second.emigrating_pops) {
-				auto const dest_nation = map_pair.second.choose_nation(ws);
-				if(dest_nation) {
-					auto const dest_province = map_pair.second.choose_province_from_nation(ws, dest_nation);
-					auto const dest_nation_religion = ws.w.nation_s.nations.get<nation::national_religion>(dest_nation);
+		std::vector<float> new_pop_sizes(inbound.values.size(), 0.0f); // on the first arrival of each new pop: the size of all arrivals joining it
+		concurrency::parallel_for(0, int32_t(province_starts.size()) - 1, [&ws, &inbound, &province_starts, &new_pop_sizes, &destination_of](int32_t g) {
+			int32_t const first = province_starts[g];
+			int32_t const last = province_starts[g + 1];
+			auto const dest_province = destination_of(first);
 
-					if(dest_province) {
-						ws.w.province_s.province_state_container.get<province_state::net_immigration_growth>(dest_province) += em_pop.amount;
+			for(int32_t k = first; k < last; ++k) {
+				auto const& r = inbound.values[k];
+				if(r.is_immigration)
+					ws.w.province_s.province_state_container.get<province_state::net_immigration_growth>(dest_province) += r.amount;
+				else
+					ws.w.province_s.province_state_container.get<province_state::net_migration_growth>(dest_province) += r.amount;
 
-						auto const fitted_type = fit_type_to_province(ws, dest_province, map_pair.first.t);
-						auto const target_pop = find_in_province(ws, dest_province, fitted_type, map_pair.first.c, em_pop.pop_religion);
-						if(target_pop) {
-							grow_pop_immediate(ws, target_pop, em_pop.amount);
-						} else if(auto const immigrant_target_pop = find_in_province(ws, dest_province, fitted_type, ws.s.culture_m.immigrant_culture, dest_nation_religion); immigrant_target_pop) {
-							grow_pop_immediate(ws, immigrant_target_pop, em_pop.amount);
-						} else {
-							make_new_pop_deferred(
-								ws,
-								em_pop.amount,
-								em_pop.pop_militancy,
-								em_pop.pop_consciousness,
-								em_pop.pop_literacy,
-								dest_province,
-								fitted_type,
-								ws.s.culture_m.immigrant_culture,
-								dest_nation_religion,
-								pop_creation_tg);
-						}
-					}
+				if(auto const target_pop = find_in_province(ws, dest_province, r.fitted_type, r.pop_culture, r.pop_religion); target_pop) {
+					grow_pop_immediate(ws, target_pop, r.amount);
+				} else if(auto const immigrant_target_pop = find_in_province(ws, dest_province, r.fitted_type, ws.s.culture_m.immigrant_culture, r.destination_religion); immigrant_target_pop) {
+					grow_pop_immediate(ws, immigrant_target_pop, r.amount);
+				} else {
+					int32_t joined = first;
+					while(joined < k && !(new_pop_sizes[joined] != 0.0f && inbound.values[joined].fitted_type == r.fitted_type && inbound.values[joined].destination_religion == r.destination_religion))
+						++joined;
+					new_pop_sizes[joined] += r.amount;
 				}
 			}
-			for(auto& mi_pop : map_pair.second.migrating_pops) {
-				auto const dest_province = map_pair.second.choose_province_from_nation(ws, mi_pop.within_nation);
-				auto const dest_nation_religion = ws.w.nation_s.nations.get<nation::national_religion>(mi_pop.within_nation);
-
-				if(dest_province) {
-					
-					ws.w.province_s.province_state_container.get<province_state::net_migration_growth>(dest_province) += mi_pop.amount;
+		});
 
-					auto const fitted_type = fit_type_to_province(ws, dest_province, map_pair.first.t);
-					auto const target_pop = find_in_province(ws, dest_province, fitted_type, map_pair.first.c, mi_pop.pop_religion);
-					if(target_pop) {
-						grow_pop_immediate(ws, target_pop, mi_pop.amount);
-					} else if(auto const immigrant_target_pop = find_in_province(ws, dest_province, fitted_type, ws.s.culture_m.immigrant_culture, dest_nation_religion); immigrant_target_pop) {
-						grow_pop_immediate(ws, immigrant_target_pop, mi_pop.amount);
-					} else {
-						make_new_pop_deferred(
-							ws,
-							mi_pop.amount,
-							mi_pop.pop_militancy,
-							mi_pop.pop_consciousness,
-							mi_pop.pop_literacy,
-							dest_province,
-							fitted_type,
-							ws.s.culture_m.immigrant_culture,
-							dest_nation_religion,
-							pop_creation_tg);
-					}
-				}
+		std::vector<std::pair<int32_t, pop_tag>> new_pops;
+		for(int32_t k = 0; k < int32_t(new_pop_sizes.size()); ++k) {
+			if(new_pop_sizes[k] != 0.0f) {
+				auto const& r = inbound.values[k];
+				auto const n = allocate_new_pop(ws);
+				add_item(ws.w.population_s.pop_arrays, ws.w.province_s.province_state_container.get<province_state::pops>(destination_of(k)), n);
+				place_new_pop(ws, n, destination_of(k), r.fitted_type, ws.s.culture_m.immigrant_culture, r.destination_religion);
+				new_pops.emplace_back(k, n);
 			}
 		}
-
-		pop_creation_tg.wait();
+		concurrency::parallel_for(0, int32_t(new_pops.size()), [&ws, &inbound, &new_pops, &new_pop_sizes](int32_t i) {
+			auto const k = new_pops[i].first;
+			auto const& r = inbound.values[k];
+			initialize_new_pop(ws, new_pops[i].second, new_pop_sizes[k], r.pop_militancy, r.pop_consciousness, r.pop_literacy);
+		});
 
 		concurrency::parallel_for(lower_limit, upper_limit, [&ws](uint32_t i) {
 			static std::mutex release_lock;
@@ -2168,5 +2225,16 @@ namespace population {
 			});
 			ws.w.province_s.province_state_container.set<province_state::monthly_population>(t, total);
 		});
+
+		ws.w.update_schedule.record_time(std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start_time).count());
+
+		// the pops of the slice changed, and so did those of every province that received migrants
+		std::vector<ui::data_key> changed;
+		changed.reserve(size_t(upper_limit - lower_limit) + province_starts.size());
+		for(int32_t i = lower_limit; i < upper_limit; ++i)
+			changed.push_back(ui::data_key{ ui::world_data::province_pops, uint16_t(i) });
+		for(int32_t g = 0; g + 1 < int32_t(province_starts.size()); ++g)
+			changed.push_back(ui::data_key{ ui::world_data::province_pops, uint16_t(to_index(destination_of(province_starts[g]))) });
+		ws.w.gui_m.publish_changes(changed);
 	}
 }
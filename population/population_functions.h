@@ -53,10 +53,11 @@ namespace population {
 	float total_size_change(world_state const& ws, pop_tag this_pop);
 	pop_tag find_in_province(world_state const& ws, provinces::province_tag prov, pop_type_tag type, cultures::culture_tag c, cultures::religion_tag r);
 
-	void update_literacy(world_state& ws);
+	void update_pop_attitudes(world_state& ws); // literacy, militancy and consciousness of the day's pop slice, in one sweep
+	// the same updates over every pop, in one sweep or as separate literacy, militancy and consciousness passes
+	void update_all_pop_attitudes(world_state& ws);
+	void update_all_pop_attitudes_separately(world_state& ws);
 	void update_pop_ideology_and_issues(world_state& ws);
-	void update_militancy(world_state& ws);
-	void update_consciousness(world_state& ws);
 	void calculate_promotion_and_demotion_qnty(world_state& ws);
 	void calculate_migration_qnty(world_state& ws);
 	void calculate_assimilation_qnty(world_state& ws);
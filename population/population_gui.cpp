@@ -77,6 +77,52 @@ namespace population {
 		}
 	}
 
+	namespace {
+		void subscribe_to_pops(world_state& ws, provinces::province_tag p) {
+			ui::subscribe(ws, ui::data_key{ ui::world_data::province_pops, uint16_t(to_index(p)) });
+		}
+	}
+
+	void subscribe_to_displayed_pops(world_state& ws) {
+		auto const& pw = ws.w.population_w;
+		if(pw.display_type == population_display::province)
+			subscribe_to_pops(ws, pw.population_for_province);
+		else if(pw.display_type == population_display::state)
+			nations::for_each_province(ws, pw.population_for_state, [&ws](provinces::province_tag p) { subscribe_to_pops(ws, p); });
+		else if(pw.display_type == population_display::nation)
+			nations::for_each_province(ws, pw.population_for_nation, [&ws](provinces::province_tag p) { subscribe_to_pops(ws, p); });
+	}
+
+	void subscribe_to_displayed_incomes(world_state& ws) {
+		auto const& pw = ws.w.population_w;
+		nations::country_tag owner;
+		if(pw.display_type == population_display::province && is_valid_index(pw.population_for_province))
+			owner = ws.w.province_s.province_state_container.get<province_state::owner>(pw.population_for_province);
+		else if(pw.display_type == population_display::state && is_valid_index(pw.population_for_state))
+			owner = ws.w.nation_s.states.get<state::owner>(pw.population_for_state);
+		else if(pw.display_type == population_display::nation)
+			owner = pw.population_for_nation;
+
+		if(is_valid_index(owner))
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_economy, uint16_t(to_index(owner)) });
+	}
+
+	void population_window_base::update(world_state& ws) {
+		// the distribution charts only change with the pops of the displayed provinces; the pop list and the tree
+		// subscribe on their own
+		subscribe_to_displayed_pops(ws);
+	}
+
+	void pop_details_window_base::update(world_state& ws) {
+		if(!ws.w.population_s.pops.is_valid_index(pop_id))
+			return;
+		if(auto const location = ws.w.population_s.pops.get<pop::location>(pop_id); is_valid_index(location)) {
+			subscribe_to_pops(ws, location);
+			if(auto const owner = ws.w.province_s.province_state_container.get<province_state::owner>(location); is_valid_index(owner))
+				ui::subscribe(ws, ui::data_key{ ui::world_data::nation_economy, uint16_t(to_index(owner)) });
+		}
+	}
+
 	bool population_window_base::on_keydown(ui::gui_object_tag, world_state& ws, const ui::key_down & k) {
 		if(k.keycode == virtual_key::ESCAPE) {
 			ws.w.population_w.hide_population_window(ws.w.gui_m);
@@ -603,8 +649,11 @@ namespace population {
 
 	std::vector<nations::country_tag, concurrent_allocator<nations::country_tag>> pop_tree_view::base_list(world_state& ws) {
 		std::vector<nations::country_tag, concurrent_allocator<nations::country_tag>> result;
-		if(ws.w.local_player_nation)
+		if(ws.w.local_player_nation) {
 			result.push_back(ws.w.local_player_nation);
+			// the tree shows the sizes of every state and province of the nation
+			nations::for_each_province(ws, ws.w.local_player_nation, [&ws](provinces::province_tag p) { subscribe_to_pops(ws, p); });
+		}
 		return result;
 	}
 	population_window::population_window() : win(std::make_unique<population_window_t>()) {}
@@ -653,6 +702,7 @@ namespace population {
 		update_population_window(gui_m);
 	}
 	void population_window::update_population_window(ui::gui_manager& gui_m) {
+		pop_order.reset();
 		win->template get<CT_STRING("pop_list")>().new_list(nullptr, nullptr);
 		ui::make_visible_and_update(gui_m, *(win->associated_object));
 	}
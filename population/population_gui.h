@@ -1,6 +1,7 @@
 #pragma once
 #include "common\\common.h"
 #include "population.h"
+#include "concurrency_tools\\sorted_view.h"
 
 class world_state;
 
@@ -52,6 +53,10 @@ namespace population {
 
 		tagged_vector<uint8_t, population::pop_type_tag> filtered_pop_types;
 
+		// rows of pop_list, kept between refreshes so that only the pops that moved have to be re-sorted; reset by
+		// update_population_window, which every change of the sort, filter or displayed location goes through
+		sorted_view<population::pop_tag> pop_order;
+
 		population_window();
 		~population_window();
 		void init_population_window(world_state& ws);
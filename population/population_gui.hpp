@@ -120,6 +120,7 @@ namespace population {
 
 		template<typename W>
 		void on_create(W& w, world_state&);
+		void update(world_state& ws);
 	};
 
 	class close_pop_details_button {
@@ -962,6 +963,11 @@ namespace population {
 		pop_list_item_base
 	> ;
 
+	// called from update_data: subscribes to the pops of the provinces the population window displays, or to the
+	// economy of the nation those pops live in, which moves their money and needs
+	void subscribe_to_displayed_pops(world_state& ws);
+	void subscribe_to_displayed_incomes(world_state& ws);
+
 	class population_lb {
 	public:
 		template<typename lb_type>
@@ -1182,6 +1188,7 @@ namespace population {
 		bool on_keydown(ui::gui_object_tag, world_state& ws, const ui::key_down& k) final override;
 		template<typename W>
 		void on_create(W& w, world_state&);
+		void update(world_state& ws);
 	};
 
 	class popfilter_all_button {
@@ -1587,6 +1594,9 @@ namespace population {
 
 	template<typename lb_type>
 	void population_lb::populate_list(lb_type& lb, world_state& ws) {
+		subscribe_to_displayed_pops(ws);
+		subscribe_to_displayed_incomes(ws); // the rows show money and needs
+
 		boost::container::small_vector<pop_tag, 64, concurrent_allocator<pop_tag>> data;
 
 		if(ws.w.population_w.display_type == population_display::nation) {
@@ -1618,23 +1628,35 @@ namespace population {
 			});
 		}
 
+		auto& order = ws.w.population_w.pop_order;
+		const auto st = ws.w.population_w.sort_type;
+		if(st == population_sort::none || st == population_sort::ideoology || st == population_sort::issues || st == population_sort::revolt_risk)
+			order.clear(); // nothing sorts these: list the pops in the order they were gathered, not in that of an earlier sort
+		order.assign(data.begin(), data.end());
+
+		// only the rows up to the bottom of the visible page are put in order; moving the list further down builds it again
+		const uint32_t needed = lb.get_position() + lb.get_visible_count();
+		auto sort_pops = [&order, needed](auto const& less) {
+			order.sort_prefix(needed, [&less](pop_tag a, pop_tag b) { return less(a, b) || (!less(b, a) && a < b); });
+		};
+
 		//do sorting
 		switch(ws.w.population_w.sort_type) {
 			case population_sort::none: break;
 			case population_sort::size:
-				std::sort(data.begin(), data.end(), [&ws](pop_tag a, pop_tag b) {
+				sort_pops([&ws](pop_tag a, pop_tag b) {
 					return ws.w.population_s.pop_demographics.get(a, total_population_tag) > ws.w.population_s.pop_demographics.get(b, total_population_tag);
 				});
 				break;
 			case population_sort::type:
-				std::sort(data.begin(), data.end(), [&ws](pop_tag a, pop_tag b) {
+				sort_pops([&ws](pop_tag a, pop_tag b) {
 					return ws.w.population_s.pops.get<pop::type>(a) < ws.w.population_s.pops.get<pop::type>(b);
 				});
 				break;
 			case population_sort::culture:
 			{
 				vector_backed_string_lex_less<char16_t> lss(ws.s.gui_m.text_data_sequences.text_data);
-				std::sort(data.begin(), data.end(), [&ws, &lss](pop_tag a, pop_tag b) {
+				sort_pops([&ws, &lss](pop_tag a, pop_tag b) {
 					auto a_culture = ws.w.population_s.pops.get<pop::culture>(a);
 					auto b_culture = ws.w.population_s.pops.get<pop::culture>(b);
 					return lss(
@@ -1648,7 +1670,7 @@ namespace population {
 			case population_sort::religion:
 			{
 				vector_backed_string_lex_less<char16_t> lss(ws.s.gui_m.text_data_sequences.text_data);
-				std::sort(data.begin(), data.end(), [&ws, &lss](pop_tag a, pop_tag b) {
+				sort_pops([&ws, &lss](pop_tag a, pop_tag b) {
 					auto a_rel = ws.w.population_s.pops.get<pop::religion>(a);
 					auto b_rel = ws.w.population_s.pops.get<pop::religion>(b);
 					return lss(
@@ -1662,7 +1684,7 @@ namespace population {
 			case population_sort::location:
 			{
 				vector_backed_string_lex_less<char16_t> lss(ws.s.gui_m.text_data_sequences.text_data);
-				std::sort(data.begin(), data.end(), [&ws, &lss](pop_tag a, pop_tag b) {
+				sort_pops([&ws, &lss](pop_tag a, pop_tag b) {
 					auto a_loc = ws.w.population_s.pops.get<pop::location>(a);
 					auto b_loc = ws.w.population_s.pops.get<pop::location>(b);
 					return lss(
@@ -1674,19 +1696,19 @@ namespace population {
 			}
 				break;
 			case population_sort::militancy:
-				std::sort(data.begin(), data.end(), [&ws](pop_tag a, pop_tag b) {
+				sort_pops([&ws](pop_tag a, pop_tag b) {
 					return ws.w.population_s.pops.get<pop::militancy>(a) > ws.w.population_s.pops.get<pop::militancy>(b);
 				});
 				break;
 			case population_sort::consciousness:
-				std::sort(data.begin(), data.end(), [&ws](pop_tag a, pop_tag b) {
+				sort_pops([&ws](pop_tag a, pop_tag b) {
 					return ws.w.population_s.pops.get<pop::consciousness>(a) > ws.w.population_s.pops.get<pop::consciousness>(b);
 				});
 				break;
 			case population_sort::ideoology: break;
 			case population_sort::issues: break;
 			case population_sort::unemployment:
-				std::sort(data.begin(), data.end(), [&ws](pop_tag a, pop_tag b) {
+				sort_pops([&ws](pop_tag a, pop_tag b) {
 					auto a_size = float(std::max(1.0f, ws.w.population_s.pop_demographics.get(a, total_population_tag)));
 					auto b_size = float(std::max(1.0f, ws.w.population_s.pop_demographics.get(b, total_population_tag)));
 					return float(ws.w.population_s.pop_demographics.get(a, total_employment_tag)) / a_size <
@@ -1694,31 +1716,31 @@ namespace population {
 				});
 				break;
 			case population_sort::cash:
-				std::sort(data.begin(), data.end(), [&ws](pop_tag a, pop_tag b) {
+				sort_pops([&ws](pop_tag a, pop_tag b) {
 					return ws.w.population_s.pops.get<pop::money>(a) < ws.w.population_s.pops.get<pop::money>(b);
 				});
 				break;
 			case population_sort::life_needs: // fall through
 			case population_sort::everyday_needs: // fall through
 			case population_sort::luxury_needs:
-				std::sort(data.begin(), data.end(), [&ws](pop_tag a, pop_tag b) {
+				sort_pops([&ws](pop_tag a, pop_tag b) {
 					return ws.w.population_s.pops.get<pop::needs_satisfaction>(a) < ws.w.population_s.pops.get<pop::needs_satisfaction>(b);
 				});
 				break;
 			case population_sort::revolt_risk: break;
 			case population_sort::size_change:
-				std::sort(data.begin(), data.end(), [&ws](pop_tag a, pop_tag b) {
+				sort_pops([&ws](pop_tag a, pop_tag b) {
 					return total_size_change(ws, a) > total_size_change(ws, b);
 				});
 				break;
 			case population_sort::literacy:
-				std::sort(data.begin(), data.end(), [&ws](pop_tag a, pop_tag b) {
+				sort_pops([&ws](pop_tag a, pop_tag b) {
 					return ws.w.population_s.pops.get<pop::literacy>(a) > ws.w.population_s.pops.get<pop::literacy>(b);
 				});
 				break;
 		}
 
-		lb.update_list(data.begin().get_ptr(), data.end().get_ptr());
+		lb.new_list(order.begin(), order.end());
 	}
 
 	template<typename lb_type>
@@ -0,0 +1,263 @@
+#include "common\\common.h"
+#include "population_rollup.h"
+#include "world_state\\world_state.h"
+#include "concurrency_tools\\ve.h"
+#include "issues\\issues_functions.h"
+#include "nations\\nations_functions.hpp"
+#include <ppl.h>
+
+#undef min
+#undef max
+
+namespace population {
+	demographic_rollup make_demographic_rollup(world_state const& ws) {
+		demographic_rollup r;
+
+		auto const& pops = ws.w.population_s.pops;
+
+		r.pop_terms.push_back(pop_rollup_term{ const_row_type<pop::container, pop::size>(nullptr, 0),
+			{ poor_population_demo_tag(ws), middle_population_demo_tag(ws), rich_population_demo_tag(ws) } });
+		r.pop_terms.push_back(pop_rollup_term{ pops.get_row<pop::consciousness>(),
+			{ consciousness_demo_tag(ws), consciousness_demo_tag(ws), consciousness_demo_tag(ws) } });
+		r.pop_terms.push_back(pop_rollup_term{ pops.get_row<pop::literacy>(),
+			{ literacy_demo_tag(ws), literacy_demo_tag(ws), literacy_demo_tag(ws) } });
+		r.pop_terms.push_back(pop_rollup_term{ pops.get_row<pop::militancy>(),
+			{ militancy_demo_tag(ws), militancy_demo_tag(ws), militancy_demo_tag(ws) } });
+		r.pop_terms.push_back(pop_rollup_term{ pops.get_row<pop::militancy>(),
+			{ poor_militancy_demo_tag(ws), middle_militancy_demo_tag(ws), rich_militancy_demo_tag(ws) } });
+		// life needs below zero are summed as they are, only the higher tiers start from zero
+		r.pop_terms.push_back(pop_rollup_term{ pops.get_row<pop::needs_satisfaction>(),
+			{ poor_life_needs_demo_tag(ws), middle_life_needs_demo_tag(ws), rich_life_needs_demo_tag(ws) }, 0.0f, true, true, -std::numeric_limits<float>::max() });
+		r.pop_terms.push_back(pop_rollup_term{ pops.get_row<pop::needs_satisfaction>(),
+			{ poor_everyday_needs_demo_tag(ws), middle_everyday_needs_demo_tag(ws), rich_everyday_needs_demo_tag(ws) }, 1.0f, true });
+		r.pop_terms.push_back(pop_rollup_term{ pops.get_row<pop::needs_satisfaction>(),
+			{ poor_luxury_needs_demo_tag(ws), middle_luxury_needs_demo_tag(ws), rich_luxury_needs_demo_tag(ws) }, 2.0f, true });
+
+		r.category_terms.push_back(pop_category_term{ pop_category::culture, to_demo_tag(ws, cultures::culture_tag(0)), total_population_tag });
+		r.category_terms.push_back(pop_category_term{ pop_category::religion, to_demo_tag(ws, cultures::religion_tag(0)), total_population_tag });
+		r.category_terms.push_back(pop_category_term{ pop_category::type, to_demo_tag(ws, pop_type_tag(0)), total_population_tag });
+		r.category_terms.push_back(pop_category_term{ pop_category::type, to_employment_demo_tag(ws, pop_type_tag(0)), total_employment_tag });
+
+		r.dominant_terms.push_back(dominant_term{ to_demo_tag(ws, cultures::culture_tag(0)), ws.s.culture_m.count_cultures, dominant_kind::culture });
+		r.dominant_terms.push_back(dominant_term{ to_demo_tag(ws, cultures::religion_tag(0)), ws.s.culture_m.count_religions, dominant_kind::religion });
+		r.dominant_terms.push_back(dominant_term{ to_demo_tag(ws, ideologies::ideology_tag(0)), ws.s.ideologies_m.ideologies_count, dominant_kind::ideology });
+		r.dominant_terms.push_back(dominant_term{ to_demo_tag(ws, issues::option_tag(0)), ws.s.issues_m.tracked_options_count, dominant_kind::issue });
+
+		r.strata_by_type.resize(ws.s.population_m.count_poptypes + 1, 0);
+		for(uint32_t i = 0; i < ws.s.population_m.count_poptypes; ++i) {
+			auto const strata = ws.s.population_m.pop_types[pop_type_tag(pop_type_tag::value_base_t(i))].flags & pop_type::strata_mask;
+			r.strata_by_type[i + 1] = strata == pop_type::strata_poor ? 0 : (strata == pop_type::strata_middle ? 1 : 2);
+		}
+
+		return r;
+	}
+
+	namespace {
+		template<typename culture_index, typename religion_index, typename ideology_index, typename issue_index, typename container_type, typename tag_type>
+		void store_dominants(container_type& container, tag_type t, float const* row, std::vector<dominant_term> const& terms) {
+			for(auto const& d : terms) {
+				auto const max_off = maximum_index(row + to_index(d.first), int32_t(d.count));
+				switch(d.kind) {
+					case dominant_kind::culture:
+						container.template set<culture_index>(t, cultures::culture_tag(static_cast<value_base_of<cultures::culture_tag>>(max_off)));
+						break;
+					case dominant_kind::religion:
+						container.template set<religion_index>(t, cultures::religion_tag(static_cast<value_base_of<cultures::religion_tag>>(max_off)));
+						break;
+					case dominant_kind::ideology:
+						container.template set<ideology_index>(t, ideologies::ideology_tag(static_cast<value_base_of<ideologies::ideology_tag>>(max_off)));
+						break;
+					case dominant_kind::issue:
+						container.template set<issue_index>(t, issues::option_tag(static_cast<value_base_of<issues::option_tag>>(max_off)));
+						break;
+				}
+			}
+		}
+
+		// the tag values of the pop category: 0 for none, otherwise 1 + the index of the category
+		template<typename T>
+		RELEASE_INLINE ve::int_vector load_category(world_state const& ws, pop_category c, T pop_indices) {
+			switch(c) {
+				case pop_category::culture:
+					return ve::int_vector(ve::load(pop_indices, ws.w.population_s.pops.get_row<pop::culture>()).value);
+				case pop_category::religion:
+					return ve::int_vector(ve::load(pop_indices, ws.w.population_s.pops.get_row<pop::religion>()).value);
+				case pop_category::type:
+				default:
+					return ve::int_vector(ve::load(pop_indices, ws.w.population_s.pops.get_row<pop::type>()).value);
+			}
+		}
+
+		// per worker thread buffers for the category entries of the province being reduced, grown to the largest province seen
+		struct category_scratch {
+			std::vector<int32_t> slots;
+			std::vector<float> values;
+		};
+		thread_local category_scratch local_category_scratch;
+
+		// reduces the pops of one province; category_slots and category_values hold category_terms.size() runs of
+		// pop_count entries, filled here and scattered into the province row once the segment is done
+		struct pop_segment_operator {
+			world_state const& ws;
+			demographic_rollup const& r;
+			pop_tag const* const pop_data;
+			tagged_array_view<float, demo_tag> const row;
+			int32_t* const category_slots;
+			float* const category_values;
+			uint32_t const pop_count;
+
+			pop_segment_operator(world_state const& w, demographic_rollup const& rr, pop_tag const* pd, tagged_array_view<float, demo_tag> rw, int32_t* cs, float* cv, uint32_t pc) :
+				ws(w), r(rr), pop_data(pd), row(rw), category_slots(cs), category_values(cv), pop_count(pc) {}
+
+			template<typename T>
+			RELEASE_INLINE void operator()(T pop_v) {
+				auto const pop_indices = ve::load(pop_v, pop_data);
+				auto const sizes = ve::load(pop_indices, ws.w.population_s.pops.get_row<pop::size>());
+				auto const types = ve::load(pop_indices, ws.w.population_s.pops.get_row<pop::type>());
+				auto const strata = ve::load(ve::int_vector(types.value), r.strata_by_type.data());
+				auto const valid = sizes > ve::fp_vector();
+
+				for(auto const& t : r.pop_terms) {
+					auto value = t.column ? ve::load(pop_indices, t.column) : ve::fp_vector(1.0f);
+					if(t.clamped)
+						value = ve::min(ve::max(value - t.tier_offset, ve::fp_vector(t.clamp_minimum)), ve::fp_vector(1.0f));
+					value = t.size_weighted ? value * sizes : ve::select(valid, value, ve::fp_vector());
+
+					if(t.targets[0] == t.targets[1] && t.targets[1] == t.targets[2]) {
+						row[t.targets[0]] += value.reduce();
+					} else {
+						for(int32_t k = 0; k < 3; ++k)
+							row[t.targets[k]] += ve::select(strata == ve::int_vector(k), value, ve::fp_vector()).reduce();
+					}
+				}
+
+				// the pops' own rows are added lane by lane, as they are not adjacent in memory
+				auto const lanes = ve::ve_impl::lane_count(pop_v);
+				auto const pop_demo_size = ws.w.population_s.pop_demographics.inner_size;
+				float const* pop_rows[ve::vector_size] = {};
+				for(uint32_t j = 0; j < lanes; ++j) {
+					auto const p = pop_data[pop_v.value + j];
+					auto pop_demo_source = ws.w.population_s.pop_demographics.get_row(p);
+					assert(std::isfinite(pop_demo_source[total_population_tag]) && pop_demo_source[total_population_tag] > 0.0f
+						&& pop_demo_source[total_population_tag] == ws.w.population_s.pops.get<pop::size>(p));
+
+					ve::accumulate(pop_demo_size, row, pop_demo_source, ve::serial_exact());
+					pop_rows[j] = pop_demo_source.data();
+				}
+
+				for(uint32_t c = 0; c < uint32_t(r.category_terms.size()); ++c) {
+					auto const& term = r.category_terms[c];
+					auto const categories = load_category(ws, term.category, pop_indices);
+
+					float sources[ve::vector_size] = {};
+					for(uint32_t j = 0; j < lanes; ++j)
+						sources[j] = pop_rows[j][to_index(term.source)];
+
+					// a pop without a category adds nothing, to the slot just before the first one
+					auto const values = ve::select(categories == ve::int_vector(), ve::fp_vector(), ve::load(ve::unaligned_contiguous_tags<int32_t>(0ui32), sources));
+					ve::store(pop_v, category_slots + c * pop_count, categories + ve::int_vector(int32_t(to_index(term.first)) - 1));
+					ve::store(pop_v, category_values + c * pop_count, values);
+				}
+			}
+		};
+	}
+
+	void rollup_to_provinces(world_state& ws, demographic_rollup const& r) {
+		ws.w.province_s.province_state_container.parallel_for_each([&ws, &r](provinces::province_tag prov_id) {
+			if(to_index(prov_id) >= ws.s.province_m.first_sea_province)
+				return;
+
+			auto& container = ws.w.province_s.province_state_container;
+			auto province_full_demo = ws.w.province_s.province_demographics.get_row(prov_id);
+			ve::set_zero(ve::to_vector_size(ws.w.province_s.province_demographics.inner_size()), province_full_demo);
+
+			auto const pop_range = get_range(ws.w.population_s.pop_arrays, container.get<province_state::pops>(prov_id));
+			auto const pop_count = uint32_t(pop_range.second - pop_range.first);
+
+			if(pop_count != 0) {
+				auto const category_entries = uint32_t(r.category_terms.size()) * pop_count;
+				auto& scratch = local_category_scratch;
+				if(scratch.slots.size() < category_entries) {
+					scratch.slots.resize(category_entries);
+					scratch.values.resize(category_entries);
+				}
+				int32_t* const category_slots = scratch.slots.data();
+				float* const category_values = scratch.values.data();
+
+				ve::execute_subsequence<int32_t>(0ui32, pop_count,
+					pop_segment_operator(ws, r, pop_range.first, province_full_demo, category_slots, category_values, pop_count));
+
+				ve::scatter_add(category_entries,
+					tagged_array_view<int32_t const, int32_t>(category_slots, int32_t(category_entries)),
+					tagged_array_view<float const, int32_t>(category_values, int32_t(category_entries)),
+					ws.w.province_s.province_demographics.inner_size(), province_full_demo);
+			}
+
+			if(province_full_demo[total_population_tag] != 0)
+				store_dominants<province_state::dominant_culture, province_state::dominant_religion, province_state::dominant_ideology, province_state::dominant_issue>(
+					container, prov_id, province_full_demo.data(), r.dominant_terms);
+
+			container.set<province_state::total_population>(prov_id, province_full_demo[total_population_tag]);
+		});
+	}
+
+	void rollup_to_states_and_nations(world_state& ws, demographic_rollup const& r) {
+		const auto demo_size = ws.w.nation_s.state_demographics.inner_size;
+
+		ws.w.nation_s.states.parallel_for_each([&ws, &r, demo_size](nations::state_tag s) {
+			auto const owner = ws.w.nation_s.states.get<state::owner>(s);
+			if(!is_valid_index(owner))
+				return;
+
+			auto state_demo = ws.w.nation_s.state_demographics.get_row(s);
+			ve::set_zero(demo_size, state_demo);
+
+			const auto p_in_region_range = ws.s.province_m.states_to_province_index.get_range(ws.w.nation_s.states.get<state::region_id>(s));
+			for(auto p = p_in_region_range.first; p != p_in_region_range.second; ++p) {
+				if(ws.w.province_s.province_state_container.get<province_state::owner>(*p) == owner)
+					ve::accumulate(demo_size, state_demo, ws.w.province_s.province_demographics.get_row(*p), ve::serial_exact());
+			}
+
+			if(state_demo[total_population_tag] != 0)
+				store_dominants<state::dominant_culture, state::dominant_religion, state::dominant_ideology, state::dominant_issue>(
+					ws.w.nation_s.states, s, state_demo.data(), r.dominant_terms);
+
+			ws.w.nation_s.states.set<state::total_population>(s, state_demo[total_population_tag]);
+		});
+
+		ws.w.nation_s.nations.parallel_for_each([&ws, &r, demo_size](nations::country_tag n) {
+			auto nation_demo = ws.w.nation_s.nation_demographics.get_row(n);
+			auto nation_c_demo = ws.w.nation_s.nation_colonial_demographics.get_row(n);
+
+			ve::set_zero(demo_size, nation_demo, ve::serial_exact());
+			ve::set_zero(demo_size, nation_c_demo, ve::serial_exact());
+
+			// member states are combined in member order so that the nation totals do not depend on scheduling
+			const auto state_range = get_range(ws.w.nation_s.state_arrays, ws.w.nation_s.nations.get<nation::member_states>(n));
+			for(auto s = state_range.first; s != state_range.second; ++s) {
+				if(!nations::is_colonial_or_protectorate(ws, s->state))
+					ve::accumulate(demo_size, nation_demo, ws.w.nation_s.state_demographics.get_row(s->state), ve::serial_exact());
+				else
+					ve::accumulate(demo_size, nation_c_demo, ws.w.nation_s.state_demographics.get_row(s->state), ve::serial_exact());
+			}
+
+			if(nation_demo[total_population_tag] != 0)
+				store_dominants<nation::dominant_culture, nation::dominant_religion, nation::dominant_ideology, nation::dominant_issue>(
+					ws.w.nation_s.nations, n, nation_demo.data(), r.dominant_terms);
+
+			ws.w.nation_s.nations.set<nation::total_core_population>(n, nation_demo[total_population_tag]);
+
+			ws.w.nation_s.nations.set<nation::political_interest_fraction>(n, issues::calculate_political_interest(ws, nation_demo));
+			ws.w.nation_s.nations.set<nation::social_interest_fraction>(n, issues::calculate_social_interest(ws, nation_demo));
+		});
+	}
+
+	void update_demographics(world_state& ws) {
+		auto const r = make_demographic_rollup(ws);
+		rollup_to_provinces(ws, r);
+		rollup_to_states_and_nations(ws, r);
+
+		// the totals of every nation were formed again; the support of its movements is recomputed from them later in the day
+		ws.w.gui_m.publish_change_for_all(ui::world_data::nation_demographics, uint32_t(ws.w.nation_s.nations.size()));
+	}
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "common\\common.h"
+#include "population.h"
+#include "population_containers.h"
+#include <vector>
+
+class world_state;
+
+namespace population {
+	// A declarative description of the pop -> province -> state -> nation demographic rollup.
+	// Each level is one pass: the pops of a province are one segment, reduced in a single pass over blocks of
+	// ve::vector_size pops that evaluates every pop term, sums the pops' own demographics rows and collects the
+	// category terms, which are then scattered into the province row at once. States then sum the rows of their
+	// owned provinces and nations the rows of their member states, in parallel. The dominant terms are evaluated
+	// on each level's finished row.
+
+	// adds value(pop) * pop size (or just value(pop) if not size weighted) into the slot chosen by the pop's strata;
+	// a null column reads as 1. Clamped terms contribute clamp(value - tier_offset, clamp_minimum, 1), which is how
+	// the life / everyday / luxury needs tiers split needs satisfaction. Size weighted sums are weighted average
+	// numerators: divide by the total population slot of the same row to read the average. The column may be any float
+	// column of the pop container's per_pop group, as they share one row type
+	struct pop_rollup_term {
+		const_row_type<pop::container, pop::size> column;
+		demo_tag targets[3]; // poor, middle, rich; all equal for terms that do not depend on strata
+		float tier_offset = 0.0f;
+		bool clamped = false;
+		bool size_weighted = true;
+		float clamp_minimum = 0.0f;
+	};
+
+	enum class pop_category : uint8_t {
+		culture, religion, type
+	};
+
+	// adds the value in the source slot of the pop's own demographics into the slot first + the index of the pop's category
+	struct pop_category_term {
+		pop_category category = pop_category::culture;
+		demo_tag first;
+		demo_tag source;
+	};
+
+	enum class dominant_kind : uint8_t {
+		culture, religion, ideology, issue
+	};
+
+	// stores the index of the largest value of count consecutive slots starting at first
+	struct dominant_term {
+		demo_tag first;
+		uint32_t count = 0;
+		dominant_kind kind = dominant_kind::culture;
+	};
+
+	struct demographic_rollup {
+		std::vector<pop_rollup_term> pop_terms;
+		std::vector<pop_category_term> category_terms;
+		std::vector<dominant_term> dominant_terms;
+		std::vector<int32_t, aligned_allocator_32<int32_t>> strata_by_type; // one leading slot for the null pop type
+	};
+
+	demographic_rollup make_demographic_rollup(world_state const& ws); // the rollup the simulation uses
+
+	void rollup_to_provinces(world_state& ws, demographic_rollup const& r);
+	void rollup_to_states_and_nations(world_state& ws, demographic_rollup const& r);
+	void update_demographics(world_state& ws); // daily: all levels, in order
+}
@@ -2,6 +2,7 @@
 #include "common\\shared_tags.h"
 #include "concurrency_tools\\ve.h"
 #include "simple_serialize\\simple_serialize.hpp"
+#include "concurrency_tools\\access_profiling.h"
 
 #pragma warning( push )
 #pragma warning( disable : 4324 )
@@ -73,199 +74,250 @@ namespace province {
 			 provinces::state_tag values[(sizeof(provinces::state_tag) <= 64 ? (uint32_t(province::container_size) + (64ui32 / uint32_t(sizeof(provinces::state_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(provinces::state_tag)) - 1ui32) : uint32_t(province::container_size))]; 
 			 dtype_8() { std::uninitialized_value_construct_n(values - 1, (sizeof(provinces::state_tag) <= 64 ? (uint32_t(province::container_size) + (64ui32 / uint32_t(sizeof(provinces::state_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(provinces::state_tag)) - 1ui32) : uint32_t(province::container_size)) + 1); }
 		 } m_8;
+#ifdef CONTAINER_ACCESS_PROFILING
+		 inline static access_profiling::container_profile profile{ "province", { "is_sea", "is_coastal", "is_lake", "area", "centroid", "centroid_2d", "continent", "climate", "state_id" }, { "bitfield_type", "bitfield_type", "bitfield_type", "float", "Eigen::Vector3f", "Eigen::Vector2f", "modifiers::provincial_modifier_tag", "modifiers::provincial_modifier_tag", "provinces::state_tag" }, { 0, 0, 0, sizeof(float), sizeof(Eigen::Vector3f), sizeof(Eigen::Vector2f), sizeof(modifiers::provincial_modifier_tag), sizeof(modifiers::provincial_modifier_tag), sizeof(provinces::state_tag) } };
+#endif
 
 		 public:
 		 friend class serialization::serializer<container>;
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::is_sea>, bool> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_0.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(provinces::province_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, province::is_sea>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(bitfield_type));
 			 bit_vector_set(m_0.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::is_sea>, tagged_array_view<bitfield_type, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, provinces::province_tag>(m_0.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::is_sea>, tagged_array_view<bitfield_type const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, provinces::province_tag>(m_0.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::is_coastal>, bool> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_1.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(provinces::province_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, province::is_coastal>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(bitfield_type));
 			 bit_vector_set(m_1.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::is_coastal>, tagged_array_view<bitfield_type, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, provinces::province_tag>(m_1.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::is_coastal>, tagged_array_view<bitfield_type const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, provinces::province_tag>(m_1.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::is_lake>, bool> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_2.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(provinces::province_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, province::is_lake>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(bitfield_type));
 			 bit_vector_set(m_2.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::is_lake>, tagged_array_view<bitfield_type, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, provinces::province_tag>(m_2.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::is_lake>, tagged_array_view<bitfield_type const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, provinces::province_tag>(m_2.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::area>, float&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(float));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::area>, float const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(float));
 			 return m_3.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province::area>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(float));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province::area>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(float));
 			 m_3.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::area>, tagged_array_view<float, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, provinces::province_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::area>, tagged_array_view<float const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, provinces::province_tag>(m_3.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::centroid>, Eigen::Vector3f&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(Eigen::Vector3f));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::centroid>, Eigen::Vector3f const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(Eigen::Vector3f));
 			 return m_4.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province::centroid>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(Eigen::Vector3f));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province::centroid>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(Eigen::Vector3f));
 			 m_4.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::centroid>, tagged_array_view<Eigen::Vector3f, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(Eigen::Vector3f));
 			 return tagged_array_view<Eigen::Vector3f, provinces::province_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::centroid>, tagged_array_view<Eigen::Vector3f const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint64_t(size_used) * sizeof(Eigen::Vector3f));
 			 return tagged_array_view<Eigen::Vector3f const, provinces::province_tag>(m_4.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::centroid_2d>, Eigen::Vector2f&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(Eigen::Vector2f));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::centroid_2d>, Eigen::Vector2f const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(Eigen::Vector2f));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province::centroid_2d>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(Eigen::Vector2f));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province::centroid_2d>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(Eigen::Vector2f));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::centroid_2d>, tagged_array_view<Eigen::Vector2f, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(Eigen::Vector2f));
 			 return tagged_array_view<Eigen::Vector2f, provinces::province_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::centroid_2d>, tagged_array_view<Eigen::Vector2f const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(Eigen::Vector2f));
 			 return tagged_array_view<Eigen::Vector2f const, provinces::province_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::continent>, modifiers::provincial_modifier_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get, sizeof(modifiers::provincial_modifier_tag));
 			 return m_6.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::continent>, modifiers::provincial_modifier_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get, sizeof(modifiers::provincial_modifier_tag));
 			 return m_6.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province::continent>> {
+			 CONTAINER_ACCESS_RECORD(profile, 6, set, sizeof(modifiers::provincial_modifier_tag));
 			 m_6.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province::continent>> {
+			 CONTAINER_ACCESS_RECORD(profile, 6, set, sizeof(modifiers::provincial_modifier_tag));
 			 m_6.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::continent>, tagged_array_view<modifiers::provincial_modifier_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get_row, uint64_t(size_used) * sizeof(modifiers::provincial_modifier_tag));
 			 return tagged_array_view<modifiers::provincial_modifier_tag, provinces::province_tag>(m_6.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::continent>, tagged_array_view<modifiers::provincial_modifier_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get_row, uint64_t(size_used) * sizeof(modifiers::provincial_modifier_tag));
 			 return tagged_array_view<modifiers::provincial_modifier_tag const, provinces::province_tag>(m_6.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::climate>, modifiers::provincial_modifier_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get, sizeof(modifiers::provincial_modifier_tag));
 			 return m_7.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::climate>, modifiers::provincial_modifier_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get, sizeof(modifiers::provincial_modifier_tag));
 			 return m_7.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province::climate>> {
+			 CONTAINER_ACCESS_RECORD(profile, 7, set, sizeof(modifiers::provincial_modifier_tag));
 			 m_7.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province::climate>> {
+			 CONTAINER_ACCESS_RECORD(profile, 7, set, sizeof(modifiers::provincial_modifier_tag));
 			 m_7.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::climate>, tagged_array_view<modifiers::provincial_modifier_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get_row, uint64_t(size_used) * sizeof(modifiers::provincial_modifier_tag));
 			 return tagged_array_view<modifiers::provincial_modifier_tag, provinces::province_tag>(m_7.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::climate>, tagged_array_view<modifiers::provincial_modifier_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get_row, uint64_t(size_used) * sizeof(modifiers::provincial_modifier_tag));
 			 return tagged_array_view<modifiers::provincial_modifier_tag const, provinces::province_tag>(m_7.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::state_id>, provinces::state_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get, sizeof(provinces::state_tag));
 			 return m_8.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::state_id>, provinces::state_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get, sizeof(provinces::state_tag));
 			 return m_8.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province::state_id>> {
+			 CONTAINER_ACCESS_RECORD(profile, 8, set, sizeof(provinces::state_tag));
 			 m_8.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province::state_id>> {
+			 CONTAINER_ACCESS_RECORD(profile, 8, set, sizeof(provinces::state_tag));
 			 m_8.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::state_id>, tagged_array_view<provinces::state_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get_row, uint64_t(size_used) * sizeof(provinces::state_tag));
 			 return tagged_array_view<provinces::state_tag, provinces::province_tag>(m_8.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province::state_id>, tagged_array_view<provinces::state_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get_row, uint64_t(size_used) * sizeof(provinces::state_tag));
 			 return tagged_array_view<provinces::state_tag const, provinces::province_tag>(m_8.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 
@@ -2,6 +2,7 @@
 #include "province_functions.hpp"
 #include "modifiers\\modifiers.h"
 #include "population\\population_functions.hpp"
+#include "population\\population_rollup.h"
 #include "nations\\nations_functions.h"
 #include "modifiers\\modifier_functions.h"
 #include "military\\military_functions.h"
@@ -92,150 +93,7 @@ namespace provinces {
 	}
 
 	void recalculate_province_demographics(world_state& ws) {
-		const auto vector_size = population::aligned_32_issues_ideology_demo_size(ws);
-		const auto full_vector_size = population::aligned_32_demo_size(ws);
-
-		const auto ppdt = population::poor_population_demo_tag(ws);
-		const auto mpdt = population::middle_population_demo_tag(ws);
-		const auto rpdt = population::rich_population_demo_tag(ws);
-
-		const auto cdt = population::consciousness_demo_tag(ws);
-		const auto mdt = population::militancy_demo_tag(ws);
-		const auto ldt = population::literacy_demo_tag(ws);
-
-		const auto pmpdt = population::poor_militancy_demo_tag(ws);
-		const auto mmpdt = population::middle_militancy_demo_tag(ws);
-		const auto rmpdt = population::rich_militancy_demo_tag(ws);
-
-		const auto plndt = population::poor_life_needs_demo_tag(ws);
-		const auto mlndt = population::middle_life_needs_demo_tag(ws);
-		const auto rlndt = population::rich_life_needs_demo_tag(ws);
-
-		const auto pendt = population::poor_everyday_needs_demo_tag(ws);
-		const auto mendt = population::middle_everyday_needs_demo_tag(ws);
-		const auto rendt = population::rich_everyday_needs_demo_tag(ws);
-
-		const auto pxndt = population::poor_luxury_needs_demo_tag(ws);
-		const auto mxndt = population::middle_luxury_needs_demo_tag(ws);
-		const auto rxndt = population::rich_luxury_needs_demo_tag(ws);
-
-		ws.w.province_s.province_state_container.parallel_for_each([
-			&ws, vector_size, full_vector_size,
-				ppdt, mpdt, rpdt, cdt, mdt, ldt, pmpdt, mmpdt, rmpdt, plndt, mlndt, rlndt, pendt, mendt, rendt, pxndt, mxndt, rxndt
-		](provinces::province_tag prov_id) {
-			if(to_index(prov_id) >= ws.s.province_m.first_sea_province)
-				return;
-
-			auto& container = ws.w.province_s.province_state_container;
-
-			auto pop_range = get_range(ws.w.population_s.pop_arrays, container.get<province_state::pops>(prov_id));
-
-			auto province_full_demo = ws.w.province_s.province_demographics.get_row(prov_id);
-
-			ve::set_zero(ve::to_vector_size(ws.w.province_s.province_demographics.inner_size()), province_full_demo);
-			const auto pop_demo_size = ws.w.population_s.pop_demographics.inner_size;
-
-			for(auto p : pop_range) {
-				auto pop_demo_source = ws.w.population_s.pop_demographics.get_row(p);
-				ve::accumulate(pop_demo_size, province_full_demo, pop_demo_source, ve::serial_exact());
-
-				auto ptype = ws.w.population_s.pops.get<pop::type>(p);
-				auto needs_satisfaction = ws.w.population_s.pops.get<pop::needs_satisfaction>(p);
-
-				auto pop_size = pop_demo_source[population::total_population_tag];
-				auto other_pop_size = ws.w.population_s.pops.get<pop::size>(p);
-				assert(std::isfinite(pop_size) && pop_size > 0.0f && pop_size == other_pop_size);
-
-				province_full_demo[population::to_demo_tag(ws, ws.w.population_s.pops.get<pop::culture>(p))] += pop_size;
-				province_full_demo[population::to_demo_tag(ws, ws.w.population_s.pops.get<pop::religion>(p))] += pop_size;
-				province_full_demo[population::to_demo_tag(ws, ptype)] += pop_size;
-				province_full_demo[population::to_employment_demo_tag(ws, ptype)] += pop_demo_source[population::total_employment_tag];
-
-
-				province_full_demo[cdt] += ws.w.population_s.pops.get<pop::consciousness>(p) * pop_size;
-				province_full_demo[ldt] += ws.w.population_s.pops.get<pop::literacy>(p) * pop_size;
-
-				const float weighted_militancy = ws.w.population_s.pops.get<pop::militancy>(p) * pop_size;
-				province_full_demo[mdt] += weighted_militancy;
-
-				const auto strata = ws.s.population_m.pop_types[ptype].flags & population::pop_type::strata_mask;
-				if(strata == population::pop_type::strata_poor) {
-					province_full_demo[pmpdt] += weighted_militancy;
-					province_full_demo[ppdt] += pop_size;
-					if(needs_satisfaction < 1.0f) {
-						province_full_demo[plndt] += float(pop_size) * needs_satisfaction;
-					} else {
-						province_full_demo[plndt] += pop_size;
-						if(needs_satisfaction < 2.0f) {
-							province_full_demo[pendt] += float(pop_size) * (needs_satisfaction - 1.0f);
-						} else {
-							province_full_demo[pendt] += pop_size;
-							if(needs_satisfaction < 3.0f) {
-								province_full_demo[pxndt] += float(pop_size) * (needs_satisfaction - 2.0f);
-							} else {
-								province_full_demo[pxndt] += pop_size;
-							}
-						}
-					}
-				} else if(strata == population::pop_type::strata_middle) {
-					province_full_demo[mmpdt] += weighted_militancy;
-					province_full_demo[mpdt] += pop_size;
-					if(needs_satisfaction < 1.0f) {
-						province_full_demo[mlndt] += float(pop_size) * needs_satisfaction;
-					} else {
-						province_full_demo[mlndt] += pop_size;
-						if(needs_satisfaction < 2.0f) {
-							province_full_demo[mendt] += float(pop_size) * (needs_satisfaction - 1.0f);
-						} else {
-							province_full_demo[mendt] += pop_size;
-							if(needs_satisfaction < 3.0f) {
-								province_full_demo[mxndt] += float(pop_size) * (needs_satisfaction - 2.0f);
-							} else {
-								province_full_demo[mxndt] += pop_size;
-							}
-						}
-					}
-				} else /*if(strata == population::pop_type::strata_rich)*/ {
-					province_full_demo[rmpdt] += weighted_militancy;
-					province_full_demo[rpdt] += pop_size;
-					if(needs_satisfaction < 1.0f) {
-						province_full_demo[rlndt] += float(pop_size) * needs_satisfaction;
-					} else {
-						province_full_demo[rlndt] += pop_size;
-						if(needs_satisfaction < 2.0f) {
-							province_full_demo[rendt] += float(pop_size) * (needs_satisfaction - 1.0f);
-						} else {
-							province_full_demo[rendt] += pop_size;
-							if(needs_satisfaction < 3.0f) {
-								province_full_demo[rxndt] += float(pop_size) * (needs_satisfaction - 2.0f);
-							} else {
-								province_full_demo[rxndt] += pop_size;
-							}
-						}
-					}
-				}
-			}
-
-			if(province_full_demo[population::total_population_tag] != 0) {
-				const auto culture_offset = population::to_demo_tag(ws, cultures::culture_tag(0));
-				auto max_culture_off = maximum_index(province_full_demo.data() + to_index(culture_offset), int32_t(ws.s.culture_m.count_cultures));
-				container.set<province_state::dominant_culture>(prov_id, cultures::culture_tag(static_cast<value_base_of<cultures::culture_tag>>(max_culture_off)));
-
-				const auto religion_offset = population::to_demo_tag(ws, cultures::religion_tag(0));
-				auto max_religion_off = maximum_index(province_full_demo.data() + to_index(religion_offset), int32_t(ws.s.culture_m.count_religions));
-				container.set<province_state::dominant_religion>(prov_id, cultures::religion_tag(static_cast<value_base_of<cultures::religion_tag>>(max_religion_off)));
-
-				const auto ideology_offset = population::to_demo_tag(ws, ideologies::ideology_tag(0));
-				auto max_ideology_off = maximum_index(province_full_demo.data() + to_index(ideology_offset), int32_t(ws.s.ideologies_m.ideologies_count));
-				container.set<province_state::dominant_ideology>(prov_id, ideologies::ideology_tag(static_cast<value_base_of<ideologies::ideology_tag>>(max_ideology_off)));
-
-				const auto options_offset = population::to_demo_tag(ws, issues::option_tag(0));
-				auto max_opinion_off = maximum_index(province_full_demo.data() + to_index(options_offset), int32_t(ws.s.issues_m.tracked_options_count));
-				container.set<province_state::dominant_issue>(prov_id, issues::option_tag(static_cast<value_base_of<issues::option_tag>>(max_opinion_off)));
-			}
-
-			ws.w.province_s.province_state_container.set<province_state::total_population>(prov_id, province_full_demo[population::total_population_tag]);
-		});
+		population::rollup_to_provinces(ws, population::make_demographic_rollup(ws));
 	}
 
 	nations::country_tag get_province_seiger(world_state&, province_tag) {
@@ -683,11 +541,13 @@ namespace provinces {
 		auto const part = ve::generate_partition_range<crime_update_frequency, crime_update_size>(
 			index, ws.s.province_m.first_sea_province);
 
-		concurrency::parallel_for(part.low, part.high, [&ws](uint32_t i) {
+		std::vector<uint8_t> crime_changed(size_t(part.high - part.low), uint8_t(0));
+		concurrency::parallel_for(part.low, part.high, [&ws, &crime_changed, low = part.low](uint32_t i) {
 			auto const val = provinces::province_tag(provinces::province_tag::value_base_t(i));
 
 			auto cf_value = crime_fighting_value(ws, val);
 			auto& current_crime = ws.w.province_s.province_state_container.get<province_state::crime>(val);
+			auto const previous_crime = current_crime;
 
 
 			std::uniform_real_distribution<float> const dist(0.0f, 1.0f);
@@ -703,7 +563,15 @@ namespace provinces {
 				if(bit_vector_test((bitfield_type*)(&(ws.w.nation_s.nations.get<nation::enabled_crimes>(prov_owner))), uint32_t(index)))
 					current_crime = ws.s.modifiers_m.crimes[index].modifier;
 			}
+			crime_changed[i - low] = uint8_t(current_crime != previous_crime);
 		});
+
+		std::vector<ui::data_key> changed;
+		for(uint32_t i = part.low; i < part.high; ++i) {
+			if(crime_changed[i - part.low] != 0)
+				changed.push_back(ui::data_key{ ui::world_data::province_crime, uint16_t(i) });
+		}
+		ws.w.gui_m.publish_changes(changed);
 	}
 
 	auto get_connected_owned_provinces(world_state const& ws, provinces::province_tag start)->boost::container::flat_set<provinces::province_tag, std::less<provinces::province_tag>, concurrent_allocator<provinces::province_tag>> {
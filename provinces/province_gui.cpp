@@ -261,6 +261,22 @@ namespace provinces {
 		});
 	}
 
+	void province_window_base::update(world_state& ws) {
+		// besides the crime of the province itself, the panes show its rgo output and construction progress, its
+		// administration and the scores, ranks and diplomacy of its owner; the pop charts subscribe on their own
+		auto const selected_prov = ws.w.province_w.selected_province;
+		if(!is_valid_index(selected_prov))
+			return;
+		ui::subscribe(ws, ui::data_key{ ui::world_data::province_crime, uint16_t(to_index(selected_prov)) });
+		if(auto const owner = ws.w.province_s.province_state_container.get<province_state::owner>(selected_prov); is_valid_index(owner)) {
+			auto const index = uint16_t(to_index(owner));
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_economy, index });
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_scores, index });
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_rank, index });
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_relations, index });
+		}
+	}
+
 	void province_window_header_base::on_create(world_state&) {
 		associated_object->size = ui::xy_pair{ 406i16, 200i16 };
 		associated_object->position += ui::xy_pair{ 0i16, 1i16 };
@@ -400,6 +416,7 @@ namespace provinces {
 		float value = 0;
 		auto selected_prov = ws.w.province_w.selected_province;
 		if(is_valid_index(selected_prov)) {
+			ui::subscribe(ws, ui::data_key{ ui::world_data::province_pops, uint16_t(to_index(selected_prov)) });
 			auto demo_row = ws.w.province_s.province_demographics.get_row(selected_prov);
 			value = demo_row[population::total_population_tag];
 		}
@@ -409,6 +426,7 @@ namespace provinces {
 	void poptype_pie_chart::update(ui::piechart<poptype_pie_chart>& pie, world_state& ws) {
 		auto selected_prov = ws.w.province_w.selected_province;
 		if(is_valid_index(selected_prov)) {
+			ui::subscribe(ws, ui::data_key{ ui::world_data::province_pops, uint16_t(to_index(selected_prov)) });
 			auto demo_row = ws.w.province_s.province_demographics.get_row(selected_prov);
 			const float total_pop = float(demo_row[population::total_population_tag]);
 
@@ -433,6 +451,7 @@ namespace provinces {
 	void ideology_pie_chart::update(ui::piechart<ideology_pie_chart>& pie, world_state& ws) {
 		auto selected_prov = ws.w.province_w.selected_province;
 		if(is_valid_index(selected_prov)) {
+			ui::subscribe(ws, ui::data_key{ ui::world_data::province_pops, uint16_t(to_index(selected_prov)) });
 			auto demo_row = ws.w.province_s.province_demographics.get_row(selected_prov);
 			const float total_pop = float(demo_row[population::total_population_tag]);
 
@@ -457,6 +476,7 @@ namespace provinces {
 	void culture_pie_chart::update(ui::piechart<culture_pie_chart>& pie, world_state& ws) {
 		auto selected_prov = ws.w.province_w.selected_province;
 		if(is_valid_index(selected_prov)) {
+			ui::subscribe(ws, ui::data_key{ ui::world_data::province_pops, uint16_t(to_index(selected_prov)) });
 			auto demo_row = ws.w.province_s.province_demographics.get_row(selected_prov);
 			const float total_pop = float(demo_row[population::total_population_tag]);
 
@@ -839,6 +839,7 @@ namespace provinces {
 		template<typename ...P>
 		explicit province_window_base(P&& ... params) : ui::draggable_region(std::forward<P>(params)...) {}
 		void on_create(world_state&);
+		void update(world_state& ws);
 	};
 
 	class province_window_t : public ui::gui_window <
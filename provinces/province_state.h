@@ -2,6 +2,7 @@
 #include "common\\shared_tags.h"
 #include "concurrency_tools\\ve.h"
 #include "simple_serialize\\simple_serialize.hpp"
+#include "concurrency_tools\\access_profiling.h"
 
 #pragma warning( push )
 #pragma warning( disable : 4324 )
@@ -301,1095 +302,1370 @@ namespace province_state {
 			 military::strategic_hq_tag values[(sizeof(military::strategic_hq_tag) <= 64 ? (uint32_t(province_state::container_size) + (64ui32 / uint32_t(sizeof(military::strategic_hq_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(military::strategic_hq_tag)) - 1ui32) : uint32_t(province_state::container_size))]; 
 			 dtype_46() { std::uninitialized_value_construct_n(values - 1, (sizeof(military::strategic_hq_tag) <= 64 ? (uint32_t(province_state::container_size) + (64ui32 / uint32_t(sizeof(military::strategic_hq_tag))) - 1ui32) & ~(64ui32 / uint32_t(sizeof(military::strategic_hq_tag)) - 1ui32) : uint32_t(province_state::container_size)) + 1); }
 		 } m_46;
+#ifdef CONTAINER_ACCESS_PROFILING
+		 inline static access_profiling::container_profile profile{ "province_state", { "is_blockaded", "is_overseas", "has_owner_core", "owner_building_railroad", "is_non_state", "fort_level", "railroad_level", "naval_base_level", "rgo_size", "dominant_religion", "dominant_ideology", "dominant_issue", "artisan_production", "rgo_production", "dominant_culture", "base_life_rating", "terrain", "crime", "name", "timed_modifiers", "static_modifiers", "fleets", "pops", "cores", "armies", "rgo_worker_data", "total_population", "last_controller_change", "last_immigration", "nationalism", "siege_progress", "fort_upgrade_progress", "railroad_upgrade_progress", "naval_base_upgrade_progress", "artisan_production_scale", "net_migration_growth", "net_immigration_growth", "monthly_population", "old_migration_growth", "old_immigration_growth", "old_monthly_population", "owner", "controller", "rebel_controller", "state_instance", "orders", "strat_hq" }, { "bitfield_type", "bitfield_type", "bitfield_type", "bitfield_type", "bitfield_type", "uint8_t", "uint8_t", "uint8_t", "uint8_t", "cultures::religion_tag", "ideologies::ideology_tag", "issues::option_tag", "economy::goods_tag", "economy::goods_tag", "cultures::culture_tag", "float", "modifiers::provincial_modifier_tag", "modifiers::provincial_modifier_tag", "text_data::text_tag", "multiset_tag<provinces::timed_provincial_modifier>", "set_tag<modifiers::provincial_modifier_tag>", "set_tag<military::fleet_presence>", "array_tag<population::pop_tag, int32_t, false>", "set_tag<cultures::national_tag>", "array_tag<military::army_tag, int32_t, false>", "economy::worked_instance", "float", "date_tag", "date_tag", "float", "float", "float", "float", "float", "float", "float", "float", "float", "float", "float", "float", "nations::country_tag", "nations::country_tag", "population::rebel_faction_tag", "nations::state_tag", "military::army_orders_tag", "military::strategic_hq_tag" }, { 0, 0, 0, 0, 0, sizeof(uint8_t), sizeof(uint8_t), sizeof(uint8_t), sizeof(uint8_t), sizeof(cultures::religion_tag), sizeof(ideologies::ideology_tag), sizeof(issues::option_tag), sizeof(economy::goods_tag), sizeof(economy::goods_tag), sizeof(cultures::culture_tag), sizeof(float), sizeof(modifiers::provincial_modifier_tag), sizeof(modifiers::provincial_modifier_tag), sizeof(text_data::text_tag), sizeof(multiset_tag<provinces::timed_provincial_modifier>), sizeof(set_tag<modifiers::provincial_modifier_tag>), sizeof(set_tag<military::fleet_presence>), sizeof(array_tag<population::pop_tag, int32_t, false>), sizeof(set_tag<cultures::national_tag>), sizeof(array_tag<military::army_tag, int32_t, false>), sizeof(economy::worked_instance), sizeof(float), sizeof(date_tag), sizeof(date_tag), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(float), sizeof(nations::country_tag), sizeof(nations::country_tag), sizeof(population::rebel_faction_tag), sizeof(nations::state_tag), sizeof(military::army_orders_tag), sizeof(military::strategic_hq_tag) } };
+#endif
 
 		 public:
 		 friend class serialization::serializer<container>;
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::is_blockaded>, bool> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_0.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(provinces::province_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, province_state::is_blockaded>> {
+			 CONTAINER_ACCESS_RECORD(profile, 0, set, sizeof(bitfield_type));
 			 bit_vector_set(m_0.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::is_blockaded>, tagged_array_view<bitfield_type, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, provinces::province_tag>(m_0.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::is_blockaded>, tagged_array_view<bitfield_type const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 0, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, provinces::province_tag>(m_0.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::is_overseas>, bool> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_1.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(provinces::province_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, province_state::is_overseas>> {
+			 CONTAINER_ACCESS_RECORD(profile, 1, set, sizeof(bitfield_type));
 			 bit_vector_set(m_1.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::is_overseas>, tagged_array_view<bitfield_type, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, provinces::province_tag>(m_1.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::is_overseas>, tagged_array_view<bitfield_type const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 1, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, provinces::province_tag>(m_1.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::has_owner_core>, bool> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_2.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(provinces::province_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, province_state::has_owner_core>> {
+			 CONTAINER_ACCESS_RECORD(profile, 2, set, sizeof(bitfield_type));
 			 bit_vector_set(m_2.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::has_owner_core>, tagged_array_view<bitfield_type, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, provinces::province_tag>(m_2.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::has_owner_core>, tagged_array_view<bitfield_type const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 2, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, provinces::province_tag>(m_2.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::owner_building_railroad>, bool> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_3.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(provinces::province_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, province_state::owner_building_railroad>> {
+			 CONTAINER_ACCESS_RECORD(profile, 3, set, sizeof(bitfield_type));
 			 bit_vector_set(m_3.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::owner_building_railroad>, tagged_array_view<bitfield_type, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, provinces::province_tag>(m_3.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::owner_building_railroad>, tagged_array_view<bitfield_type const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 3, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, provinces::province_tag>(m_3.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::is_non_state>, bool> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get, sizeof(bitfield_type));
 			 return bit_vector_test(m_4.values, to_index(i));
 		 }
 		 template<typename INDEX>
 		 auto set(provinces::province_tag i, bool v) -> std::enable_if_t<std::is_same_v<INDEX, province_state::is_non_state>> {
+			 CONTAINER_ACCESS_RECORD(profile, 4, set, sizeof(bitfield_type));
 			 bit_vector_set(m_4.values, to_index(i), v);
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::is_non_state>, tagged_array_view<bitfield_type, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type, provinces::province_tag>(m_4.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::is_non_state>, tagged_array_view<bitfield_type const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 4, get_row, uint32_t(size_used + 7) / 8ui32);
 			 return tagged_array_view<bitfield_type const, provinces::province_tag>(m_4.values, int32_t(uint32_t(size_used + 7) / 8ui32));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::fort_level>, uint8_t&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(uint8_t));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::fort_level>, uint8_t const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get, sizeof(uint8_t));
 			 return m_5.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::fort_level>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(uint8_t));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::fort_level>> {
+			 CONTAINER_ACCESS_RECORD(profile, 5, set, sizeof(uint8_t));
 			 m_5.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::fort_level>, tagged_array_view<uint8_t, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(uint8_t));
 			 return tagged_array_view<uint8_t, provinces::province_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::fort_level>, tagged_array_view<uint8_t const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 5, get_row, uint64_t(size_used) * sizeof(uint8_t));
 			 return tagged_array_view<uint8_t const, provinces::province_tag>(m_5.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::railroad_level>, uint8_t&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get, sizeof(uint8_t));
 			 return m_6.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::railroad_level>, uint8_t const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get, sizeof(uint8_t));
 			 return m_6.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::railroad_level>> {
+			 CONTAINER_ACCESS_RECORD(profile, 6, set, sizeof(uint8_t));
 			 m_6.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::railroad_level>> {
+			 CONTAINER_ACCESS_RECORD(profile, 6, set, sizeof(uint8_t));
 			 m_6.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::railroad_level>, tagged_array_view<uint8_t, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get_row, uint64_t(size_used) * sizeof(uint8_t));
 			 return tagged_array_view<uint8_t, provinces::province_tag>(m_6.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::railroad_level>, tagged_array_view<uint8_t const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 6, get_row, uint64_t(size_used) * sizeof(uint8_t));
 			 return tagged_array_view<uint8_t const, provinces::province_tag>(m_6.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::naval_base_level>, uint8_t&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get, sizeof(uint8_t));
 			 return m_7.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::naval_base_level>, uint8_t const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get, sizeof(uint8_t));
 			 return m_7.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::naval_base_level>> {
+			 CONTAINER_ACCESS_RECORD(profile, 7, set, sizeof(uint8_t));
 			 m_7.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::naval_base_level>> {
+			 CONTAINER_ACCESS_RECORD(profile, 7, set, sizeof(uint8_t));
 			 m_7.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::naval_base_level>, tagged_array_view<uint8_t, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get_row, uint64_t(size_used) * sizeof(uint8_t));
 			 return tagged_array_view<uint8_t, provinces::province_tag>(m_7.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::naval_base_level>, tagged_array_view<uint8_t const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 7, get_row, uint64_t(size_used) * sizeof(uint8_t));
 			 return tagged_array_view<uint8_t const, provinces::province_tag>(m_7.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::rgo_size>, uint8_t&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get, sizeof(uint8_t));
 			 return m_8.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::rgo_size>, uint8_t const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get, sizeof(uint8_t));
 			 return m_8.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::rgo_size>> {
+			 CONTAINER_ACCESS_RECORD(profile, 8, set, sizeof(uint8_t));
 			 m_8.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::rgo_size>> {
+			 CONTAINER_ACCESS_RECORD(profile, 8, set, sizeof(uint8_t));
 			 m_8.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::rgo_size>, tagged_array_view<uint8_t, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get_row, uint64_t(size_used) * sizeof(uint8_t));
 			 return tagged_array_view<uint8_t, provinces::province_tag>(m_8.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::rgo_size>, tagged_array_view<uint8_t const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 8, get_row, uint64_t(size_used) * sizeof(uint8_t));
 			 return tagged_array_view<uint8_t const, provinces::province_tag>(m_8.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::dominant_religion>, cultures::religion_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get, sizeof(cultures::religion_tag));
 			 return m_9.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::dominant_religion>, cultures::religion_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get, sizeof(cultures::religion_tag));
 			 return m_9.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::dominant_religion>> {
+			 CONTAINER_ACCESS_RECORD(profile, 9, set, sizeof(cultures::religion_tag));
 			 m_9.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::dominant_religion>> {
+			 CONTAINER_ACCESS_RECORD(profile, 9, set, sizeof(cultures::religion_tag));
 			 m_9.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::dominant_religion>, tagged_array_view<cultures::religion_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get_row, uint64_t(size_used) * sizeof(cultures::religion_tag));
 			 return tagged_array_view<cultures::religion_tag, provinces::province_tag>(m_9.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::dominant_religion>, tagged_array_view<cultures::religion_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 9, get_row, uint64_t(size_used) * sizeof(cultures::religion_tag));
 			 return tagged_array_view<cultures::religion_tag const, provinces::province_tag>(m_9.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::dominant_ideology>, ideologies::ideology_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get, sizeof(ideologies::ideology_tag));
 			 return m_10.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::dominant_ideology>, ideologies::ideology_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get, sizeof(ideologies::ideology_tag));
 			 return m_10.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::dominant_ideology>> {
+			 CONTAINER_ACCESS_RECORD(profile, 10, set, sizeof(ideologies::ideology_tag));
 			 m_10.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::dominant_ideology>> {
+			 CONTAINER_ACCESS_RECORD(profile, 10, set, sizeof(ideologies::ideology_tag));
 			 m_10.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::dominant_ideology>, tagged_array_view<ideologies::ideology_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get_row, uint64_t(size_used) * sizeof(ideologies::ideology_tag));
 			 return tagged_array_view<ideologies::ideology_tag, provinces::province_tag>(m_10.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::dominant_ideology>, tagged_array_view<ideologies::ideology_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 10, get_row, uint64_t(size_used) * sizeof(ideologies::ideology_tag));
 			 return tagged_array_view<ideologies::ideology_tag const, provinces::province_tag>(m_10.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::dominant_issue>, issues::option_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get, sizeof(issues::option_tag));
 			 return m_11.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::dominant_issue>, issues::option_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get, sizeof(issues::option_tag));
 			 return m_11.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::dominant_issue>> {
+			 CONTAINER_ACCESS_RECORD(profile, 11, set, sizeof(issues::option_tag));
 			 m_11.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::dominant_issue>> {
+			 CONTAINER_ACCESS_RECORD(profile, 11, set, sizeof(issues::option_tag));
 			 m_11.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::dominant_issue>, tagged_array_view<issues::option_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get_row, uint64_t(size_used) * sizeof(issues::option_tag));
 			 return tagged_array_view<issues::option_tag, provinces::province_tag>(m_11.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::dominant_issue>, tagged_array_view<issues::option_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 11, get_row, uint64_t(size_used) * sizeof(issues::option_tag));
 			 return tagged_array_view<issues::option_tag const, provinces::province_tag>(m_11.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::artisan_production>, economy::goods_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get, sizeof(economy::goods_tag));
 			 return m_12.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::artisan_production>, economy::goods_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get, sizeof(economy::goods_tag));
 			 return m_12.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::artisan_production>> {
+			 CONTAINER_ACCESS_RECORD(profile, 12, set, sizeof(economy::goods_tag));
 			 m_12.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::artisan_production>> {
+			 CONTAINER_ACCESS_RECORD(profile, 12, set, sizeof(economy::goods_tag));
 			 m_12.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::artisan_production>, tagged_array_view<economy::goods_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get_row, uint64_t(size_used) * sizeof(economy::goods_tag));
 			 return tagged_array_view<economy::goods_tag, provinces::province_tag>(m_12.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::artisan_production>, tagged_array_view<economy::goods_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 12, get_row, uint64_t(size_used) * sizeof(economy::goods_tag));
 			 return tagged_array_view<economy::goods_tag const, provinces::province_tag>(m_12.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::rgo_production>, economy::goods_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get, sizeof(economy::goods_tag));
 			 return m_13.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::rgo_production>, economy::goods_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get, sizeof(economy::goods_tag));
 			 return m_13.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::rgo_production>> {
+			 CONTAINER_ACCESS_RECORD(profile, 13, set, sizeof(economy::goods_tag));
 			 m_13.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::rgo_production>> {
+			 CONTAINER_ACCESS_RECORD(profile, 13, set, sizeof(economy::goods_tag));
 			 m_13.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::rgo_production>, tagged_array_view<economy::goods_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get_row, uint64_t(size_used) * sizeof(economy::goods_tag));
 			 return tagged_array_view<economy::goods_tag, provinces::province_tag>(m_13.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::rgo_production>, tagged_array_view<economy::goods_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 13, get_row, uint64_t(size_used) * sizeof(economy::goods_tag));
 			 return tagged_array_view<economy::goods_tag const, provinces::province_tag>(m_13.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::dominant_culture>, cultures::culture_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 14, get, sizeof(cultures::culture_tag));
 			 return m_14.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::dominant_culture>, cultures::culture_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 14, get, sizeof(cultures::culture_tag));
 			 return m_14.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::dominant_culture>> {
+			 CONTAINER_ACCESS_RECORD(profile, 14, set, sizeof(cultures::culture_tag));
 			 m_14.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::dominant_culture>> {
+			 CONTAINER_ACCESS_RECORD(profile, 14, set, sizeof(cultures::culture_tag));
 			 m_14.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::dominant_culture>, tagged_array_view<cultures::culture_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 14, get_row, uint64_t(size_used) * sizeof(cultures::culture_tag));
 			 return tagged_array_view<cultures::culture_tag, provinces::province_tag>(m_14.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::dominant_culture>, tagged_array_view<cultures::culture_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 14, get_row, uint64_t(size_used) * sizeof(cultures::culture_tag));
 			 return tagged_array_view<cultures::culture_tag const, provinces::province_tag>(m_14.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::base_life_rating>, float&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 15, get, sizeof(float));
 			 return m_15.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::base_life_rating>, float const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 15, get, sizeof(float));
 			 return m_15.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::base_life_rating>> {
+			 CONTAINER_ACCESS_RECORD(profile, 15, set, sizeof(float));
 			 m_15.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::base_life_rating>> {
+			 CONTAINER_ACCESS_RECORD(profile, 15, set, sizeof(float));
 			 m_15.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::base_life_rating>, tagged_array_view<float, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 15, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, provinces::province_tag>(m_15.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::base_life_rating>, tagged_array_view<float const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 15, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, provinces::province_tag>(m_15.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::terrain>, modifiers::provincial_modifier_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 16, get, sizeof(modifiers::provincial_modifier_tag));
 			 return m_16.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::terrain>, modifiers::provincial_modifier_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 16, get, sizeof(modifiers::provincial_modifier_tag));
 			 return m_16.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::terrain>> {
+			 CONTAINER_ACCESS_RECORD(profile, 16, set, sizeof(modifiers::provincial_modifier_tag));
 			 m_16.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::terrain>> {
+			 CONTAINER_ACCESS_RECORD(profile, 16, set, sizeof(modifiers::provincial_modifier_tag));
 			 m_16.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::terrain>, tagged_array_view<modifiers::provincial_modifier_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 16, get_row, uint64_t(size_used) * sizeof(modifiers::provincial_modifier_tag));
 			 return tagged_array_view<modifiers::provincial_modifier_tag, provinces::province_tag>(m_16.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::terrain>, tagged_array_view<modifiers::provincial_modifier_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 16, get_row, uint64_t(size_used) * sizeof(modifiers::provincial_modifier_tag));
 			 return tagged_array_view<modifiers::provincial_modifier_tag const, provinces::province_tag>(m_16.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::crime>, modifiers::provincial_modifier_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 17, get, sizeof(modifiers::provincial_modifier_tag));
 			 return m_17.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::crime>, modifiers::provincial_modifier_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 17, get, sizeof(modifiers::provincial_modifier_tag));
 			 return m_17.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::crime>> {
+			 CONTAINER_ACCESS_RECORD(profile, 17, set, sizeof(modifiers::provincial_modifier_tag));
 			 m_17.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::crime>> {
+			 CONTAINER_ACCESS_RECORD(profile, 17, set, sizeof(modifiers::provincial_modifier_tag));
 			 m_17.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::crime>, tagged_array_view<modifiers::provincial_modifier_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 17, get_row, uint64_t(size_used) * sizeof(modifiers::provincial_modifier_tag));
 			 return tagged_array_view<modifiers::provincial_modifier_tag, provinces::province_tag>(m_17.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::crime>, tagged_array_view<modifiers::provincial_modifier_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 17, get_row, uint64_t(size_used) * sizeof(modifiers::provincial_modifier_tag));
 			 return tagged_array_view<modifiers::provincial_modifier_tag const, provinces::province_tag>(m_17.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::name>, text_data::text_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 18, get, sizeof(text_data::text_tag));
 			 return m_18.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::name>, text_data::text_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 18, get, sizeof(text_data::text_tag));
 			 return m_18.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::name>> {
+			 CONTAINER_ACCESS_RECORD(profile, 18, set, sizeof(text_data::text_tag));
 			 m_18.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::name>> {
+			 CONTAINER_ACCESS_RECORD(profile, 18, set, sizeof(text_data::text_tag));
 			 m_18.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::name>, tagged_array_view<text_data::text_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 18, get_row, uint64_t(size_used) * sizeof(text_data::text_tag));
 			 return tagged_array_view<text_data::text_tag, provinces::province_tag>(m_18.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::name>, tagged_array_view<text_data::text_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 18, get_row, uint64_t(size_used) * sizeof(text_data::text_tag));
 			 return tagged_array_view<text_data::text_tag const, provinces::province_tag>(m_18.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::timed_modifiers>, multiset_tag<provinces::timed_provincial_modifier>&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 19, get, sizeof(multiset_tag<provinces::timed_provincial_modifier>));
 			 return m_19.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::timed_modifiers>, multiset_tag<provinces::timed_provincial_modifier> const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 19, get, sizeof(multiset_tag<provinces::timed_provincial_modifier>));
 			 return m_19.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::timed_modifiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 19, set, sizeof(multiset_tag<provinces::timed_provincial_modifier>));
 			 m_19.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::timed_modifiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 19, set, sizeof(multiset_tag<provinces::timed_provincial_modifier>));
 			 m_19.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::timed_modifiers>, tagged_array_view<multiset_tag<provinces::timed_provincial_modifier>, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 19, get_row, uint64_t(size_used) * sizeof(multiset_tag<provinces::timed_provincial_modifier>));
 			 return tagged_array_view<multiset_tag<provinces::timed_provincial_modifier>, provinces::province_tag>(m_19.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::timed_modifiers>, tagged_array_view<multiset_tag<provinces::timed_provincial_modifier> const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 19, get_row, uint64_t(size_used) * sizeof(multiset_tag<provinces::timed_provincial_modifier>));
 			 return tagged_array_view<multiset_tag<provinces::timed_provincial_modifier> const, provinces::province_tag>(m_19.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::static_modifiers>, set_tag<modifiers::provincial_modifier_tag>&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 20, get, sizeof(set_tag<modifiers::provincial_modifier_tag>));
 			 return m_20.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::static_modifiers>, set_tag<modifiers::provincial_modifier_tag> const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 20, get, sizeof(set_tag<modifiers::provincial_modifier_tag>));
 			 return m_20.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::static_modifiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 20, set, sizeof(set_tag<modifiers::provincial_modifier_tag>));
 			 m_20.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::static_modifiers>> {
+			 CONTAINER_ACCESS_RECORD(profile, 20, set, sizeof(set_tag<modifiers::provincial_modifier_tag>));
 			 m_20.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::static_modifiers>, tagged_array_view<set_tag<modifiers::provincial_modifier_tag>, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 20, get_row, uint64_t(size_used) * sizeof(set_tag<modifiers::provincial_modifier_tag>));
 			 return tagged_array_view<set_tag<modifiers::provincial_modifier_tag>, provinces::province_tag>(m_20.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::static_modifiers>, tagged_array_view<set_tag<modifiers::provincial_modifier_tag> const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 20, get_row, uint64_t(size_used) * sizeof(set_tag<modifiers::provincial_modifier_tag>));
 			 return tagged_array_view<set_tag<modifiers::provincial_modifier_tag> const, provinces::province_tag>(m_20.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::fleets>, set_tag<military::fleet_presence>&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 21, get, sizeof(set_tag<military::fleet_presence>));
 			 return m_21.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::fleets>, set_tag<military::fleet_presence> const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 21, get, sizeof(set_tag<military::fleet_presence>));
 			 return m_21.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::fleets>> {
+			 CONTAINER_ACCESS_RECORD(profile, 21, set, sizeof(set_tag<military::fleet_presence>));
 			 m_21.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::fleets>> {
+			 CONTAINER_ACCESS_RECORD(profile, 21, set, sizeof(set_tag<military::fleet_presence>));
 			 m_21.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::fleets>, tagged_array_view<set_tag<military::fleet_presence>, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 21, get_row, uint64_t(size_used) * sizeof(set_tag<military::fleet_presence>));
 			 return tagged_array_view<set_tag<military::fleet_presence>, provinces::province_tag>(m_21.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::fleets>, tagged_array_view<set_tag<military::fleet_presence> const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 21, get_row, uint64_t(size_used) * sizeof(set_tag<military::fleet_presence>));
 			 return tagged_array_view<set_tag<military::fleet_presence> const, provinces::province_tag>(m_21.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::pops>, array_tag<population::pop_tag, int32_t, false>&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 22, get, sizeof(array_tag<population::pop_tag, int32_t, false>));
 			 return m_22.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::pops>, array_tag<population::pop_tag, int32_t, false> const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 22, get, sizeof(array_tag<population::pop_tag, int32_t, false>));
 			 return m_22.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::pops>> {
+			 CONTAINER_ACCESS_RECORD(profile, 22, set, sizeof(array_tag<population::pop_tag, int32_t, false>));
 			 m_22.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::pops>> {
+			 CONTAINER_ACCESS_RECORD(profile, 22, set, sizeof(array_tag<population::pop_tag, int32_t, false>));
 			 m_22.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::pops>, tagged_array_view<array_tag<population::pop_tag, int32_t, false>, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 22, get_row, uint64_t(size_used) * sizeof(array_tag<population::pop_tag, int32_t, false>));
 			 return tagged_array_view<array_tag<population::pop_tag, int32_t, false>, provinces::province_tag>(m_22.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::pops>, tagged_array_view<array_tag<population::pop_tag, int32_t, false> const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 22, get_row, uint64_t(size_used) * sizeof(array_tag<population::pop_tag, int32_t, false>));
 			 return tagged_array_view<array_tag<population::pop_tag, int32_t, false> const, provinces::province_tag>(m_22.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::cores>, set_tag<cultures::national_tag>&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 23, get, sizeof(set_tag<cultures::national_tag>));
 			 return m_23.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::cores>, set_tag<cultures::national_tag> const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 23, get, sizeof(set_tag<cultures::national_tag>));
 			 return m_23.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::cores>> {
+			 CONTAINER_ACCESS_RECORD(profile, 23, set, sizeof(set_tag<cultures::national_tag>));
 			 m_23.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::cores>> {
+			 CONTAINER_ACCESS_RECORD(profile, 23, set, sizeof(set_tag<cultures::national_tag>));
 			 m_23.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::cores>, tagged_array_view<set_tag<cultures::national_tag>, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 23, get_row, uint64_t(size_used) * sizeof(set_tag<cultures::national_tag>));
 			 return tagged_array_view<set_tag<cultures::national_tag>, provinces::province_tag>(m_23.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::cores>, tagged_array_view<set_tag<cultures::national_tag> const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 23, get_row, uint64_t(size_used) * sizeof(set_tag<cultures::national_tag>));
 			 return tagged_array_view<set_tag<cultures::national_tag> const, provinces::province_tag>(m_23.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::armies>, array_tag<military::army_tag, int32_t, false>&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 24, get, sizeof(array_tag<military::army_tag, int32_t, false>));
 			 return m_24.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::armies>, array_tag<military::army_tag, int32_t, false> const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 24, get, sizeof(array_tag<military::army_tag, int32_t, false>));
 			 return m_24.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::armies>> {
+			 CONTAINER_ACCESS_RECORD(profile, 24, set, sizeof(array_tag<military::army_tag, int32_t, false>));
 			 m_24.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::armies>> {
+			 CONTAINER_ACCESS_RECORD(profile, 24, set, sizeof(array_tag<military::army_tag, int32_t, false>));
 			 m_24.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::armies>, tagged_array_view<array_tag<military::army_tag, int32_t, false>, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 24, get_row, uint64_t(size_used) * sizeof(array_tag<military::army_tag, int32_t, false>));
 			 return tagged_array_view<array_tag<military::army_tag, int32_t, false>, provinces::province_tag>(m_24.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::armies>, tagged_array_view<array_tag<military::army_tag, int32_t, false> const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 24, get_row, uint64_t(size_used) * sizeof(array_tag<military::army_tag, int32_t, false>));
 			 return tagged_array_view<array_tag<military::army_tag, int32_t, false> const, provinces::province_tag>(m_24.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::rgo_worker_data>, economy::worked_instance&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 25, get, sizeof(economy::worked_instance));
 			 return m_25.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::rgo_worker_data>, economy::worked_instance const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 25, get, sizeof(economy::worked_instance));
 			 return m_25.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::rgo_worker_data>> {
+			 CONTAINER_ACCESS_RECORD(profile, 25, set, sizeof(economy::worked_instance));
 			 m_25.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::rgo_worker_data>> {
+			 CONTAINER_ACCESS_RECORD(profile, 25, set, sizeof(economy::worked_instance));
 			 m_25.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::rgo_worker_data>, tagged_array_view<economy::worked_instance, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 25, get_row, uint64_t(size_used) * sizeof(economy::worked_instance));
 			 return tagged_array_view<economy::worked_instance, provinces::province_tag>(m_25.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::rgo_worker_data>, tagged_array_view<economy::worked_instance const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 25, get_row, uint64_t(size_used) * sizeof(economy::worked_instance));
 			 return tagged_array_view<economy::worked_instance const, provinces::province_tag>(m_25.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::total_population>, float&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 26, get, sizeof(float));
 			 return m_26.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::total_population>, float const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 26, get, sizeof(float));
 			 return m_26.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::total_population>> {
+			 CONTAINER_ACCESS_RECORD(profile, 26, set, sizeof(float));
 			 m_26.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::total_population>> {
+			 CONTAINER_ACCESS_RECORD(profile, 26, set, sizeof(float));
 			 m_26.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::total_population>, tagged_array_view<float, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 26, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, provinces::province_tag>(m_26.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::total_population>, tagged_array_view<float const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 26, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, provinces::province_tag>(m_26.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::last_controller_change>, date_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 27, get, sizeof(date_tag));
 			 return m_27.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::last_controller_change>, date_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 27, get, sizeof(date_tag));
 			 return m_27.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::last_controller_change>> {
+			 CONTAINER_ACCESS_RECORD(profile, 27, set, sizeof(date_tag));
 			 m_27.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::last_controller_change>> {
+			 CONTAINER_ACCESS_RECORD(profile, 27, set, sizeof(date_tag));
 			 m_27.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::last_controller_change>, tagged_array_view<date_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 27, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag, provinces::province_tag>(m_27.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::last_controller_change>, tagged_array_view<date_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 27, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag const, provinces::province_tag>(m_27.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::last_immigration>, date_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 28, get, sizeof(date_tag));
 			 return m_28.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::last_immigration>, date_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 28, get, sizeof(date_tag));
 			 return m_28.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::last_immigration>> {
+			 CONTAINER_ACCESS_RECORD(profile, 28, set, sizeof(date_tag));
 			 m_28.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::last_immigration>> {
+			 CONTAINER_ACCESS_RECORD(profile, 28, set, sizeof(date_tag));
 			 m_28.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::last_immigration>, tagged_array_view<date_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 28, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag, provinces::province_tag>(m_28.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::last_immigration>, tagged_array_view<date_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 28, get_row, uint64_t(size_used) * sizeof(date_tag));
 			 return tagged_array_view<date_tag const, provinces::province_tag>(m_28.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::nationalism>, float&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 29, get, sizeof(float));
 			 return m_29.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::nationalism>, float const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 29, get, sizeof(float));
 			 return m_29.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::nationalism>> {
+			 CONTAINER_ACCESS_RECORD(profile, 29, set, sizeof(float));
 			 m_29.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::nationalism>> {
+			 CONTAINER_ACCESS_RECORD(profile, 29, set, sizeof(float));
 			 m_29.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::nationalism>, tagged_array_view<float, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 29, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, provinces::province_tag>(m_29.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::nationalism>, tagged_array_view<float const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 29, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, provinces::province_tag>(m_29.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::siege_progress>, float&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 30, get, sizeof(float));
 			 return m_30.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::siege_progress>, float const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 30, get, sizeof(float));
 			 return m_30.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::siege_progress>> {
+			 CONTAINER_ACCESS_RECORD(profile, 30, set, sizeof(float));
 			 m_30.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::siege_progress>> {
+			 CONTAINER_ACCESS_RECORD(profile, 30, set, sizeof(float));
 			 m_30.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::siege_progress>, tagged_array_view<float, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 30, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, provinces::province_tag>(m_30.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::siege_progress>, tagged_array_view<float const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 30, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, provinces::province_tag>(m_30.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::fort_upgrade_progress>, float&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 31, get, sizeof(float));
 			 return m_31.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::fort_upgrade_progress>, float const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 31, get, sizeof(float));
 			 return m_31.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::fort_upgrade_progress>> {
+			 CONTAINER_ACCESS_RECORD(profile, 31, set, sizeof(float));
 			 m_31.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::fort_upgrade_progress>> {
+			 CONTAINER_ACCESS_RECORD(profile, 31, set, sizeof(float));
 			 m_31.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::fort_upgrade_progress>, tagged_array_view<float, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 31, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, provinces::province_tag>(m_31.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::fort_upgrade_progress>, tagged_array_view<float const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 31, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, provinces::province_tag>(m_31.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::railroad_upgrade_progress>, float&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 32, get, sizeof(float));
 			 return m_32.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::railroad_upgrade_progress>, float const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 32, get, sizeof(float));
 			 return m_32.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::railroad_upgrade_progress>> {
+			 CONTAINER_ACCESS_RECORD(profile, 32, set, sizeof(float));
 			 m_32.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::railroad_upgrade_progress>> {
+			 CONTAINER_ACCESS_RECORD(profile, 32, set, sizeof(float));
 			 m_32.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::railroad_upgrade_progress>, tagged_array_view<float, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 32, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, provinces::province_tag>(m_32.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::railroad_upgrade_progress>, tagged_array_view<float const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 32, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, provinces::province_tag>(m_32.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::naval_base_upgrade_progress>, float&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 33, get, sizeof(float));
 			 return m_33.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::naval_base_upgrade_progress>, float const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 33, get, sizeof(float));
 			 return m_33.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::naval_base_upgrade_progress>> {
+			 CONTAINER_ACCESS_RECORD(profile, 33, set, sizeof(float));
 			 m_33.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::naval_base_upgrade_progress>> {
+			 CONTAINER_ACCESS_RECORD(profile, 33, set, sizeof(float));
 			 m_33.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::naval_base_upgrade_progress>, tagged_array_view<float, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 33, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, provinces::province_tag>(m_33.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::naval_base_upgrade_progress>, tagged_array_view<float const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 33, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, provinces::province_tag>(m_33.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::artisan_production_scale>, float&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 34, get, sizeof(float));
 			 return m_34.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::artisan_production_scale>, float const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 34, get, sizeof(float));
 			 return m_34.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::artisan_production_scale>> {
+			 CONTAINER_ACCESS_RECORD(profile, 34, set, sizeof(float));
 			 m_34.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::artisan_production_scale>> {
+			 CONTAINER_ACCESS_RECORD(profile, 34, set, sizeof(float));
 			 m_34.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::artisan_production_scale>, tagged_array_view<float, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 34, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, provinces::province_tag>(m_34.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::artisan_production_scale>, tagged_array_view<float const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 34, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, provinces::province_tag>(m_34.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::net_migration_growth>, float&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 35, get, sizeof(float));
 			 return m_35.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::net_migration_growth>, float const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 35, get, sizeof(float));
 			 return m_35.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::net_migration_growth>> {
+			 CONTAINER_ACCESS_RECORD(profile, 35, set, sizeof(float));
 			 m_35.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::net_migration_growth>> {
+			 CONTAINER_ACCESS_RECORD(profile, 35, set, sizeof(float));
 			 m_35.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::net_migration_growth>, tagged_array_view<float, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 35, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, provinces::province_tag>(m_35.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::net_migration_growth>, tagged_array_view<float const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 35, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, provinces::province_tag>(m_35.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::net_immigration_growth>, float&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 36, get, sizeof(float));
 			 return m_36.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::net_immigration_growth>, float const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 36, get, sizeof(float));
 			 return m_36.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::net_immigration_growth>> {
+			 CONTAINER_ACCESS_RECORD(profile, 36, set, sizeof(float));
 			 m_36.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::net_immigration_growth>> {
+			 CONTAINER_ACCESS_RECORD(profile, 36, set, sizeof(float));
 			 m_36.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::net_immigration_growth>, tagged_array_view<float, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 36, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, provinces::province_tag>(m_36.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::net_immigration_growth>, tagged_array_view<float const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 36, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, provinces::province_tag>(m_36.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::monthly_population>, float&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 37, get, sizeof(float));
 			 return m_37.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::monthly_population>, float const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 37, get, sizeof(float));
 			 return m_37.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::monthly_population>> {
+			 CONTAINER_ACCESS_RECORD(profile, 37, set, sizeof(float));
 			 m_37.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::monthly_population>> {
+			 CONTAINER_ACCESS_RECORD(profile, 37, set, sizeof(float));
 			 m_37.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::monthly_population>, tagged_array_view<float, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 37, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, provinces::province_tag>(m_37.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::monthly_population>, tagged_array_view<float const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 37, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, provinces::province_tag>(m_37.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::old_migration_growth>, float&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 38, get, sizeof(float));
 			 return m_38.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::old_migration_growth>, float const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 38, get, sizeof(float));
 			 return m_38.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::old_migration_growth>> {
+			 CONTAINER_ACCESS_RECORD(profile, 38, set, sizeof(float));
 			 m_38.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::old_migration_growth>> {
+			 CONTAINER_ACCESS_RECORD(profile, 38, set, sizeof(float));
 			 m_38.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::old_migration_growth>, tagged_array_view<float, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 38, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, provinces::province_tag>(m_38.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::old_migration_growth>, tagged_array_view<float const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 38, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, provinces::province_tag>(m_38.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::old_immigration_growth>, float&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 39, get, sizeof(float));
 			 return m_39.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::old_immigration_growth>, float const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 39, get, sizeof(float));
 			 return m_39.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::old_immigration_growth>> {
+			 CONTAINER_ACCESS_RECORD(profile, 39, set, sizeof(float));
 			 m_39.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::old_immigration_growth>> {
+			 CONTAINER_ACCESS_RECORD(profile, 39, set, sizeof(float));
 			 m_39.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::old_immigration_growth>, tagged_array_view<float, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 39, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, provinces::province_tag>(m_39.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::old_immigration_growth>, tagged_array_view<float const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 39, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, provinces::province_tag>(m_39.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::old_monthly_population>, float&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 40, get, sizeof(float));
 			 return m_40.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::old_monthly_population>, float const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 40, get, sizeof(float));
 			 return m_40.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::old_monthly_population>> {
+			 CONTAINER_ACCESS_RECORD(profile, 40, set, sizeof(float));
 			 m_40.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::old_monthly_population>> {
+			 CONTAINER_ACCESS_RECORD(profile, 40, set, sizeof(float));
 			 m_40.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::old_monthly_population>, tagged_array_view<float, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 40, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float, provinces::province_tag>(m_40.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::old_monthly_population>, tagged_array_view<float const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 40, get_row, uint64_t(size_used) * sizeof(float));
 			 return tagged_array_view<float const, provinces::province_tag>(m_40.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::owner>, nations::country_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 41, get, sizeof(nations::country_tag));
 			 return m_41.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::owner>, nations::country_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 41, get, sizeof(nations::country_tag));
 			 return m_41.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::owner>> {
+			 CONTAINER_ACCESS_RECORD(profile, 41, set, sizeof(nations::country_tag));
 			 m_41.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::owner>> {
+			 CONTAINER_ACCESS_RECORD(profile, 41, set, sizeof(nations::country_tag));
 			 m_41.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::owner>, tagged_array_view<nations::country_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 41, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag, provinces::province_tag>(m_41.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::owner>, tagged_array_view<nations::country_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 41, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag const, provinces::province_tag>(m_41.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::controller>, nations::country_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 42, get, sizeof(nations::country_tag));
 			 return m_42.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::controller>, nations::country_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 42, get, sizeof(nations::country_tag));
 			 return m_42.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::controller>> {
+			 CONTAINER_ACCESS_RECORD(profile, 42, set, sizeof(nations::country_tag));
 			 m_42.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::controller>> {
+			 CONTAINER_ACCESS_RECORD(profile, 42, set, sizeof(nations::country_tag));
 			 m_42.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::controller>, tagged_array_view<nations::country_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 42, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag, provinces::province_tag>(m_42.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::controller>, tagged_array_view<nations::country_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 42, get_row, uint64_t(size_used) * sizeof(nations::country_tag));
 			 return tagged_array_view<nations::country_tag const, provinces::province_tag>(m_42.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::rebel_controller>, population::rebel_faction_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 43, get, sizeof(population::rebel_faction_tag));
 			 return m_43.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::rebel_controller>, population::rebel_faction_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 43, get, sizeof(population::rebel_faction_tag));
 			 return m_43.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::rebel_controller>> {
+			 CONTAINER_ACCESS_RECORD(profile, 43, set, sizeof(population::rebel_faction_tag));
 			 m_43.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::rebel_controller>> {
+			 CONTAINER_ACCESS_RECORD(profile, 43, set, sizeof(population::rebel_faction_tag));
 			 m_43.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::rebel_controller>, tagged_array_view<population::rebel_faction_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 43, get_row, uint64_t(size_used) * sizeof(population::rebel_faction_tag));
 			 return tagged_array_view<population::rebel_faction_tag, provinces::province_tag>(m_43.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::rebel_controller>, tagged_array_view<population::rebel_faction_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 43, get_row, uint64_t(size_used) * sizeof(population::rebel_faction_tag));
 			 return tagged_array_view<population::rebel_faction_tag const, provinces::province_tag>(m_43.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::state_instance>, nations::state_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 44, get, sizeof(nations::state_tag));
 			 return m_44.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::state_instance>, nations::state_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 44, get, sizeof(nations::state_tag));
 			 return m_44.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::state_instance>> {
+			 CONTAINER_ACCESS_RECORD(profile, 44, set, sizeof(nations::state_tag));
 			 m_44.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::state_instance>> {
+			 CONTAINER_ACCESS_RECORD(profile, 44, set, sizeof(nations::state_tag));
 			 m_44.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::state_instance>, tagged_array_view<nations::state_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 44, get_row, uint64_t(size_used) * sizeof(nations::state_tag));
 			 return tagged_array_view<nations::state_tag, provinces::province_tag>(m_44.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::state_instance>, tagged_array_view<nations::state_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 44, get_row, uint64_t(size_used) * sizeof(nations::state_tag));
 			 return tagged_array_view<nations::state_tag const, provinces::province_tag>(m_44.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::orders>, military::army_orders_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 45, get, sizeof(military::army_orders_tag));
 			 return m_45.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::orders>, military::army_orders_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 45, get, sizeof(military::army_orders_tag));
 			 return m_45.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::orders>> {
+			 CONTAINER_ACCESS_RECORD(profile, 45, set, sizeof(military::army_orders_tag));
 			 m_45.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::orders>> {
+			 CONTAINER_ACCESS_RECORD(profile, 45, set, sizeof(military::army_orders_tag));
 			 m_45.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::orders>, tagged_array_view<military::army_orders_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 45, get_row, uint64_t(size_used) * sizeof(military::army_orders_tag));
 			 return tagged_array_view<military::army_orders_tag, provinces::province_tag>(m_45.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::orders>, tagged_array_view<military::army_orders_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 45, get_row, uint64_t(size_used) * sizeof(military::army_orders_tag));
 			 return tagged_array_view<military::army_orders_tag const, provinces::province_tag>(m_45.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::strat_hq>, military::strategic_hq_tag&> get(provinces::province_tag i) {
+			 CONTAINER_ACCESS_RECORD(profile, 46, get, sizeof(military::strategic_hq_tag));
 			 return m_46.values[to_index(i)];
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::strat_hq>, military::strategic_hq_tag const&> get(provinces::province_tag i) const {
+			 CONTAINER_ACCESS_RECORD(profile, 46, get, sizeof(military::strategic_hq_tag));
 			 return m_46.values[to_index(i)];
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type v) -> std::enable_if_t<std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::strat_hq>> {
+			 CONTAINER_ACCESS_RECORD(profile, 46, set, sizeof(military::strategic_hq_tag));
 			 m_46.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX, typename value_type>
 		 auto set(provinces::province_tag i, value_type const& v) -> std::enable_if_t<!std::is_trivially_copyable_v<value_type> && std::is_same_v<INDEX, province_state::strat_hq>> {
+			 CONTAINER_ACCESS_RECORD(profile, 46, set, sizeof(military::strategic_hq_tag));
 			 m_46.values[to_index(i)] = v;
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::strat_hq>, tagged_array_view<military::strategic_hq_tag, provinces::province_tag>> get_row() {
+			 CONTAINER_ACCESS_RECORD(profile, 46, get_row, uint64_t(size_used) * sizeof(military::strategic_hq_tag));
 			 return tagged_array_view<military::strategic_hq_tag, provinces::province_tag>(m_46.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 		 template<typename INDEX>
 		 std::enable_if_t<std::is_same_v<INDEX, province_state::strat_hq>, tagged_array_view<military::strategic_hq_tag const, provinces::province_tag>> get_row() const {
+			 CONTAINER_ACCESS_RECORD(profile, 46, get_row, uint64_t(size_used) * sizeof(military::strategic_hq_tag));
 			 return tagged_array_view<military::strategic_hq_tag const, provinces::province_tag>(m_46.values, ve::to_vector_size(uint32_t(size_used)));
 		 }
 
@@ -12,6 +12,7 @@
 #include "nations\\nations_functions.h"
 #include "world_state\\world_state.h"
 #include "graphics\\world_map.h"
+#include <immintrin.h>
 
 
 void serialization::serializer<provinces::provinces_state>::serialize_object(std::byte *& output, provinces::provinces_state const & obj, world_state const & ws) {
@@ -1041,53 +1042,186 @@ namespace provinces {
 		return tagged_vector<uint8_t, province_tag>();
 	}
 
-	void load_province_map_data(province_manager& m, directory const& root) {
-		const auto map_dir = root.get_directory(u"\\map");
-		
-		auto map_peek = map_dir.peek_file(u"provinces.png");
-		if(!map_peek)
-			map_peek = map_dir.peek_file(u"provinces.bmp");
-		if(map_peek) {
-			auto fi = map_peek->open_file();
-			if(fi) {
-				const auto sz = fi->size();
-				std::unique_ptr<char[]> file_data = std::unique_ptr<char[]>(new char[sz]);
-				fi->read_to_buffer(file_data.get(), sz);
+	namespace {
+		constexpr uint32_t map_cache_kind = 0x50414D50ui32;
+		constexpr uint32_t map_cache_version = 2ui32;
+
+		// the start of the payload of a cached map, which continues with the map and then the adjacencies
+		struct map_cache_sizes {
+			int32_t width = 0;
+			int32_t height = 0;
+			uint32_t adjacency_count = 0; // pairs of provinces, each stored once with the lower index first
+			uint32_t padding = 0;
+		};
+
+		// the number of pixels, starting from the first, with the same color as the first; at most count
+		int32_t same_color_run(uint8_t const* rgb, int32_t count) {
+			// pixel k + 1 matches pixel k exactly when bytes 3k to 3k + 2 match the three bytes that follow them, so the
+			// end of the run is the first byte that differs from the byte three further on, found sixteen bytes at a time
+			int32_t const byte_count = (count - 1) * 3;
+			int32_t b = 0;
+			for(; b + 16 <= byte_count; b += 16) {
+				__m128i const x = _mm_loadu_si128((__m128i const*)(rgb + b));
+				__m128i const y = _mm_loadu_si128((__m128i const*)(rgb + b + 3));
+				uint32_t const mismatch = ~uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y))) & 0xFFFFui32;
+				if(mismatch != 0)
+					return (b + int32_t(_tzcnt_u32(mismatch))) / 3 + 1;
+			}
+			for(; b < byte_count; ++b) {
+				if(rgb[b] != rgb[b + 3])
+					return b / 3 + 1;
+			}
+			return count;
+		}
 
-				int32_t channels = 3;
-				const auto raw_data = SOIL_load_image_from_memory((unsigned char*)(file_data.get()), static_cast<int32_t>(sz), &m.province_map_width, &m.province_map_height, &channels, 3);
-				m.province_map_data.resize(static_cast<size_t>(m.province_map_width * m.province_map_height));
+		std::vector<char> read_province_bitmap(directory const& root) {
+			const auto map_dir = root.get_directory(u"\\map");
+
+			auto map_peek = map_dir.peek_file(u"provinces.png");
+			if(!map_peek)
+				map_peek = map_dir.peek_file(u"provinces.bmp");
+			if(map_peek) {
+				if(auto fi = map_peek->open_file(); fi) {
+					std::vector<char> file_data(fi->size());
+					fi->read_to_buffer(file_data.data(), file_data.size());
+					return file_data;
+				}
+			}
+			return std::vector<char>();
+		}
+
+		boost::container::flat_map<uint32_t, uint16_t> province_color_table(province_manager const& m, directory const& root) {
+			const auto color_mapping = read_province_definition_file(root);
+
+			boost::container::flat_map<uint32_t, uint16_t> result;
+			result.reserve(color_mapping.size());
+			for(auto const& c : color_mapping)
+				result.emplace_hint(result.end(), c.first, uint16_t(to_index(m.integer_to_province[c.second])));
+			return result;
+		}
+
+		void decode_province_bitmap(province_manager& m, std::vector<char> const& file_data, boost::container::flat_map<uint32_t, uint16_t> const& color_table) {
+			int32_t channels = 3;
+			const auto raw_data = SOIL_load_image_from_memory((unsigned char const*)(file_data.data()), static_cast<int32_t>(file_data.size()), &m.province_map_width, &m.province_map_height, &channels, 3);
+			m.province_map_data.resize(static_cast<size_t>(m.province_map_width * m.province_map_height));
+
+			map_colors_to_provinces(m.province_map_data.data(), raw_data, m.province_map_width, m.province_map_height, color_table);
 
-				const auto color_mapping = read_province_definition_file(root);
+			SOIL_free_image_data(raw_data);
+		}
+
+		// the bitmap alone does not determine the result, so the color definitions are hashed along with it
+		serialization::blob_cache_key province_map_cache_key(std::vector<char> const& file_data, boost::container::flat_map<uint32_t, uint16_t> const& color_table) {
+			std::vector<uint32_t> table_data;
+			table_data.reserve(color_table.size() * 2);
+			for(auto const& c : color_table) {
+				table_data.push_back(c.first);
+				table_data.push_back(c.second);
+			}
+
+			serialization::blob_cache_key key;
+			key.kind = map_cache_kind;
+			key.version = map_cache_version;
+			key.source_hash = serialization::blob_hash(table_data.data(), table_data.size() * sizeof(uint32_t),
+				serialization::blob_hash(file_data.data(), file_data.size()));
+			key.source_size = file_data.size();
+			return key;
+		}
 
-				const auto last = m.province_map_width * m.province_map_height - 1;
-				uint32_t previous_color_index = provinces::rgb_to_prov_index(raw_data[last * 3 + 0], raw_data[last * 3 + 1], raw_data[last * 3 + 2]);
-				province_tag prev_result = province_tag(0);
-				if(auto it = color_mapping.find(previous_color_index); it != color_mapping.end()) {
-					prev_result = m.integer_to_province[it->second];
-					m.province_map_data[static_cast<size_t>(last)] = uint16_t(to_index(prev_result));
+		bool read_cached_province_map(const std::u16string& cache_name, serialization::blob_cache_key const& key, province_manager& m, std::map<province_tag, boost::container::flat_set<province_tag>>& adjacencies) {
+			return serialization::read_cached_blob(cache_name, key, [&m, &adjacencies](std::byte const* payload, uint64_t payload_size) {
+				map_cache_sizes sizes;
+				if(payload_size < sizeof(map_cache_sizes))
+					return false;
+				memcpy(&sizes, payload, sizeof(map_cache_sizes));
+
+				const auto map_size = size_t(sizes.width) * size_t(sizes.height) * sizeof(uint16_t);
+				const auto adjacency_size = size_t(sizes.adjacency_count) * 2 * sizeof(uint16_t);
+				if(sizes.width <= 0 || sizes.height <= 0 || payload_size < sizeof(map_cache_sizes) + map_size + adjacency_size)
+					return false;
+
+				m.province_map_width = sizes.width;
+				m.province_map_height = sizes.height;
+				m.province_map_data.resize(size_t(sizes.width) * size_t(sizes.height));
+				memcpy(m.province_map_data.data(), payload + sizeof(map_cache_sizes), map_size);
+
+				uint16_t const* pairs = (uint16_t const*)(payload + sizeof(map_cache_sizes) + map_size);
+				for(uint32_t i = 0; i < sizes.adjacency_count; ++i) {
+					adjacencies[province_tag(pairs[i * 2])].insert(province_tag(pairs[i * 2 + 1]));
+					adjacencies[province_tag(pairs[i * 2 + 1])].insert(province_tag(pairs[i * 2]));
 				}
+				return true;
+			});
+		}
 
-				for(int32_t t = m.province_map_width * m.province_map_height - 2; t >= 0; --t) {
-					uint32_t color_index = provinces::rgb_to_prov_index(raw_data[t * 3 + 0], raw_data[t * 3 + 1], raw_data[t * 3 + 2]);
-					if(color_index == previous_color_index) {
-						m.province_map_data[static_cast<size_t>(t)] = uint16_t(to_index(prev_result));
-					} else {
-						previous_color_index = color_index;
-						if(auto it = color_mapping.find(color_index); it != color_mapping.end())
-							m.province_map_data[static_cast<size_t>(t)] = uint16_t(to_index(m.integer_to_province[it->second]));
-						else
-							m.province_map_data[static_cast<size_t>(t)] = 0ui16;
-						prev_result = province_tag(m.province_map_data[static_cast<size_t>(t)]);
+		void write_cached_province_map(const std::u16string& cache_name, serialization::blob_cache_key const& key, province_manager const& m, std::map<province_tag, boost::container::flat_set<province_tag>> const& adjacencies) {
+			std::vector<uint16_t> pairs;
+			for(auto const& a : adjacencies) {
+				for(auto b : a.second) {
+					if(a.first < b) {
+						pairs.push_back(uint16_t(to_index(a.first)));
+						pairs.push_back(uint16_t(to_index(b)));
 					}
 				}
+			}
 
+			map_cache_sizes sizes;
+			sizes.width = m.province_map_width;
+			sizes.height = m.province_map_height;
+			sizes.adjacency_count = uint32_t(pairs.size() / 2);
 
-				SOIL_free_image_data(raw_data);
+			serialization::write_cached_blob(cache_name, key, {
+				serialization::blob_part{ &sizes, sizeof(map_cache_sizes) },
+				serialization::blob_part{ m.province_map_data.data(), m.province_map_data.size() * sizeof(uint16_t) },
+				serialization::blob_part{ pairs.data(), pairs.size() * sizeof(uint16_t) } });
+		}
+	}
+
+	void map_colors_to_provinces(uint16_t* province_map_data, uint8_t const* rgb_data, int32_t width, int32_t height, boost::container::flat_map<uint32_t, uint16_t> const& color_to_province) {
+		concurrency::parallel_for(0, height, [province_map_data, rgb_data, width, &color_to_province](int32_t j) {
+			uint8_t const* row = rgb_data + size_t(j) * size_t(width) * 3;
+			uint16_t* out = province_map_data + size_t(j) * size_t(width);
+
+			for(int32_t i = 0; i < width; ) {
+				int32_t const run = same_color_run(row + i * 3, width - i);
+				auto const it = color_to_province.find(rgb_to_prov_index(row[i * 3 + 0], row[i * 3 + 1], row[i * 3 + 2]));
+				std::fill_n(out + i, run, it != color_to_province.end() ? it->second : 0ui16);
+				i += run;
 			}
+		});
+	}
+
+	void load_province_map_data(province_manager& m, directory const& root) {
+		const auto file_data = read_province_bitmap(root);
+		if(file_data.size() != 0)
+			decode_province_bitmap(m, file_data, province_color_table(m, root));
+	}
+
+	std::map<province_tag, boost::container::flat_set<province_tag>> load_province_map_and_adjacencies(province_manager& m, directory const& root, const std::u16string& cache_directory) {
+		std::map<province_tag, boost::container::flat_set<province_tag>> result;
+
+		const auto file_data = read_province_bitmap(root);
+		if(file_data.size() == 0)
+			return result;
+
+		const auto color_table = province_color_table(m, root);
+
+		serialization::blob_cache_key key;
+		std::u16string cache_name;
+		if(cache_directory.length() != 0) {
+			key = province_map_cache_key(file_data, color_table);
+			cache_name = serialization::blob_cache_file_name(cache_directory, key, u".pmap");
+			if(read_cached_province_map(cache_name, key, m, result))
+				return result;
 		}
 
-		
+		decode_province_bitmap(m, file_data, color_table);
+		result = generate_map_adjacencies(m.province_map_data.data(), m.province_map_height, m.province_map_width);
+
+		if(cache_name.length() != 0)
+			write_cached_province_map(cache_name, key, m, result);
+
+		return result;
 	}
 
 	tagged_vector<uint8_t, province_tag> generate_province_terrain_inverse(size_t province_count, uint16_t const* province_map_data, uint8_t const* terrain_color_map_data, int32_t height, int32_t width) {
@@ -1269,11 +1403,9 @@ namespace provinces {
 
 		province_m.borders.borders.resize(wblocks * hblocks);
 
-		concurrency::parallel_for(0, hblocks, 1, [&province_m, wblocks](int32_t j) {
-			for(int32_t i = 0; i < wblocks; ++i) {
-				province_m.borders.borders[i + j * wblocks] = 
-					graphics::create_border_block_data(province_m, i, j, province_m.province_map_data.data(), province_m.province_map_width, province_m.province_map_height);
-			}
+		concurrency::parallel_for(0, wblocks * hblocks, 1, [&province_m, wblocks](int32_t k) {
+			province_m.borders.borders[k] = 
+				graphics::create_border_block_data(province_m, k % wblocks, k / wblocks, province_m.province_map_data.data(), province_m.province_map_width, province_m.province_map_height);
 		});
 	}
 
@@ -158,7 +158,12 @@ namespace provinces {
 	
 	tagged_vector<uint8_t, province_tag> generate_province_terrain(size_t province_count, uint16_t const* province_map_data, uint8_t const* terrain_color_map_data, int32_t height, int32_t width);
 	tagged_vector<uint8_t, province_tag> generate_province_terrain_inverse(size_t province_count, uint16_t const* province_map_data, uint8_t const* terrain_color_map_data, int32_t height, int32_t width);
+	// maps each rgb pixel to the index of the province with that color, or to 0, one row at a time in parallel
+	void map_colors_to_provinces(uint16_t* province_map_data, uint8_t const* rgb_data, int32_t width, int32_t height, boost::container::flat_map<uint32_t, uint16_t> const& color_to_province);
 	void load_province_map_data(province_manager& m, directory const& root); // returns province to terrain color array
+	// load_province_map_data followed by generate_map_adjacencies; when cache_directory is not empty the results are stored there,
+	// keyed by a hash of the province bitmap and color definitions, and are read back from there instead of decoding the bitmap
+	std::map<province_tag, boost::container::flat_set<province_tag>> load_province_map_and_adjacencies(province_manager& m, directory const& root, const std::u16string& cache_directory);
 	tagged_vector<uint8_t, province_tag> load_province_terrain_data(province_manager& m, directory const& root);
 	void assign_terrain_color(provinces_state& m, tagged_vector<uint8_t, province_tag> const & terrain_colors, color_to_terrain_map const & terrain_map);
 	
@@ -267,6 +267,43 @@ TEST(provinces_test, colors) {
 	EXPECT_EQ(province_tag(4), result[rgb_to_prov_index(192ui8, 0ui8, 0ui8)]);
 }
 
+TEST(provinces_test, map_colors) {
+	boost::container::flat_map<uint32_t, uint16_t> color_to_province;
+	color_to_province.emplace(rgb_to_prov_index(204ui8, 229ui8, 152ui8), uint16_t(1));
+	color_to_province.emplace(rgb_to_prov_index(204ui8, 179ui8, 153ui8), uint16_t(2));
+	color_to_province.emplace(rgb_to_prov_index(192ui8, 0ui8, 0ui8), uint16_t(4));
+
+	constexpr int32_t width = 40;
+	constexpr int32_t height = 3;
+
+	std::vector<uint8_t> rgb(width * height * 3);
+	std::vector<uint16_t> expected(width * height);
+	auto set_pixel = [&](int32_t i, uint8_t r, uint8_t g, uint8_t b, uint16_t result) {
+		rgb[i * 3 + 0] = r;
+		rgb[i * 3 + 1] = g;
+		rgb[i * 3 + 2] = b;
+		expected[i] = result;
+	};
+
+	for(int32_t i = 0; i < width * height; ++i) {
+		if(i < 23 || (i >= width + 30 && i < 2 * width))
+			set_pixel(i, 204ui8, 229ui8, 152ui8, 1ui16);
+		else if(i < width + 30)
+			set_pixel(i, 204ui8, 179ui8, 153ui8, 2ui16);
+		else if(i % 3 == 0)
+			set_pixel(i, 192ui8, 0ui8, 0ui8, 4ui16);
+		else
+			set_pixel(i, 1ui8, 2ui8, 3ui8, 0ui16);
+	}
+	set_pixel(7, 204ui8, 229ui8, 153ui8, 0ui16); // differs from its neighbors in the last channel only
+
+	std::vector<uint16_t> result(width * height, 9ui16);
+	map_colors_to_provinces(result.data(), rgb.data(), width, height, color_to_province);
+
+	for(int32_t i = 0; i < width * height; ++i)
+		EXPECT_EQ(expected[i], result[i]);
+}
+
 TEST(provinces_test, adjacent) {
 	preparse_test_files real_fs;
 	file_system f;
@@ -55,6 +55,52 @@ namespace serialization {
 		return uint64_t(pvalue.QuadPart);
 	}
 
+	uint64_t blob_hash(void const* data, size_t size, uint64_t seed) {
+		uint64_t hash = seed;
+		for(size_t i = 0; i < size; ++i) {
+			hash ^= uint64_t(((unsigned char const*)data)[i]);
+			hash *= 0x100000001b3ui64;
+		}
+		return hash;
+	}
+
+	namespace {
+		void append_hex(std::u16string& out, uint64_t value) {
+			static const char16_t digits[] = u"0123456789abcdef";
+			for(int32_t shift = 60; shift >= 0; shift -= 4)
+				out += digits[(value >> shift) & 0xF];
+		}
+	}
+
+	std::u16string blob_cache_file_name(std::u16string const& cache_directory, blob_cache_key const& key, char16_t const* extension) {
+		std::u16string result = cache_directory;
+		result += u'\\';
+		append_hex(result, key.source_hash);
+		result += u'_';
+		append_hex(result, key.detail);
+		result += extension;
+		return result;
+	}
+
+	void write_cached_blob(std::u16string const& file_name, blob_cache_key const& key, std::initializer_list<blob_part> parts) {
+		blob_cache_header header;
+		header.key = key;
+		for(auto const& p : parts)
+			header.payload_size += p.size;
+
+		serialize_file_wrapper cache_out(file_name, size_t(sizeof(blob_cache_header) + header.payload_size));
+		if(!cache_out.file_valid())
+			return;
+
+		auto out = cache_out.get_bytes() + sizeof(blob_cache_header);
+		for(auto const& p : parts) {
+			if(p.size != 0)
+				memcpy(out, p.data, p.size);
+			out += p.size;
+		}
+		memcpy(cache_out.get_bytes(), &header, sizeof(blob_cache_header));
+	}
+
 	uint64_t impl_get_compressed_upper_bound(uint64_t source_size) {
 		return compressBound(uLong(source_size));
 	}
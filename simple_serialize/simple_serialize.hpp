@@ -1,6 +1,9 @@
 #pragma once
 #include "simple_serialize.h"
 #include <numeric>
+#include <string>
+#include <initializer_list>
+#include <type_traits>
 
 #define CHECK_SERIALIZE_SIZE
 
@@ -79,6 +82,12 @@ namespace serialization {
 	template<>
 	class serializer<bitfield_type> : public memcpy_serializer<bitfield_type> {};
 	template<>
+	class serializer<half_type> : public memcpy_serializer<half_type> {};
+	template<>
+	class serializer<unorm16_type> : public memcpy_serializer<unorm16_type> {};
+	template<int32_t denominator>
+	class serializer<fixed16_type<denominator>> : public memcpy_serializer<fixed16_type<denominator>> {};
+	template<>
 	class serializer<bool> : public memcpy_serializer<bool> {};
 	template<>
 	class serializer<char> : public memcpy_serializer<char> {};
@@ -609,16 +618,71 @@ namespace serialization {
 		void set_final_size(uint64_t s) { final_size = s; }
 	};
 
+	// Data derived from some source (decoded images, baked glyphs, a decoded map) can be kept in a cache directory, in
+	// files named after the hash of the source. Each file starts with the blob_cache_key it was written under, and
+	// read_cached_blob ignores a file whose key differs from the one asked for, so stale files are simply rebuilt.
+	// The payload is written before the header, so a file left incomplete is never mistaken for a valid one.
+
+	constexpr uint64_t blob_hash_seed = 0xcbf29ce484222325ui64;
+	uint64_t blob_hash(void const* data, size_t size, uint64_t seed = blob_hash_seed); // pass a previous hash as seed to continue it
+
+	struct blob_cache_key {
+		uint32_t kind = 0; // tells the users of the cache apart
+		uint32_t version = 0; // to be bumped whenever the layout of the payload of that kind changes
+		uint64_t source_hash = 0ui64;
+		uint64_t source_size = 0ui64;
+		uint64_t detail = 0ui64; // anything else the payload depends on
+
+		bool operator==(blob_cache_key const& o) const {
+			return kind == o.kind && version == o.version && source_hash == o.source_hash && source_size == o.source_size && detail == o.detail;
+		}
+		bool operator!=(blob_cache_key const& o) const { return !(*this == o); }
+	};
+
+	struct blob_cache_header {
+		blob_cache_key key;
+		uint64_t payload_size = 0ui64;
+	};
+
+	struct blob_part {
+		void const* data = nullptr;
+		size_t size = 0;
+	};
+
+	std::u16string blob_cache_file_name(std::u16string const& cache_directory, blob_cache_key const& key, char16_t const* extension);
+	void write_cached_blob(std::u16string const& file_name, blob_cache_key const& key, std::initializer_list<blob_part> parts);
+
+	// calls f(payload, payload_size) when the file exists and was written under key; returns false otherwise, or if f does
+	template<typename F>
+	bool read_cached_blob(std::u16string const& file_name, blob_cache_key const& key, F&& f) {
+		serialize_file_wrapper cached(file_name);
+		if(!cached.file_valid() || cached.get_size() < sizeof(blob_cache_header))
+			return false;
+
+		blob_cache_header header;
+		memcpy(&header, cached.get_bytes(), sizeof(blob_cache_header));
+		if(header.key != key || cached.get_size() < sizeof(blob_cache_header) + header.payload_size)
+			return false;
+
+		return f(cached.get_bytes() + sizeof(blob_cache_header), header.payload_size);
+	}
+
 	uint64_t impl_get_compressed_upper_bound(uint64_t source_size);
 	uint64_t impl_compress(uint64_t source_size, std::byte* source, std::byte* dest); // returns actual size used
 	void impl_decompress(uint64_t source_size, std::byte const* source, uint64_t dest_size, std::byte* dest);
 
+	// the format version written into the header of a file holding a T: serializer<T>::file_version, or 1 if it has none
+	template<typename T, typename = void>
+	constexpr uint64_t file_version_of = 1ui64;
+	template<typename T>
+	constexpr uint64_t file_version_of<T, std::void_t<decltype(serializer<T>::file_version)>> = serializer<T>::file_version;
+
 	template<typename T, typename ... CONTEXT>
 	void serialize_to_file(std::u16string const& file_name, bool compress, serialize_file_header& header, T const& obj, CONTEXT&& ... c) {
 		const auto fsize = serialize_size(obj, std::forward<CONTEXT>(c) ...);
 		const auto header_size = serialize_size(header);
 
-		header.version = 1ui64;
+		header.version = file_version_of<T>;
 
 		if(!compress) {
 			header.decompressed_size = 0ui64;
@@ -141,6 +141,11 @@ namespace technologies {
 	class technologies_state {
 	public:
 		tagged_vector<int32_t, tech_tag> discovery_count;
+
+		// for each invention, the range of invention_prerequisites holding the technologies that its allow trigger
+		// requires unconditionally; only nations with all of them are invention candidates (see nations_state)
+		tagged_vector<std::pair<uint32_t, uint32_t>, tech_tag> prerequisite_ranges;
+		std::vector<tech_tag> invention_prerequisites;
 	};
 
 	class technologies_manager {
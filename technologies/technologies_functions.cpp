@@ -8,12 +8,53 @@
 #include "concurrency_tools\\ve.h"
 #include "world_state\\messages.h"
 #include "nations\\nations_functions.hpp"
+#include "triggers\\trigger_functions.h"
 #include <random>
 
 namespace technologies {
 	void init_technology_state(world_state& ws) {
 		ws.w.technology_s.discovery_count.resize(ws.s.technology_m.technologies_container.size());
 		std::fill_n(ws.w.technology_s.discovery_count.data(), ws.s.technology_m.technologies_container.size(), 0);
+
+		ws.w.technology_s.prerequisite_ranges.resize(ws.s.technology_m.technologies_container.size());
+		ws.w.technology_s.invention_prerequisites.clear();
+		for(auto i : ws.s.technology_m.inventions) {
+			auto const first = uint32_t(ws.w.technology_s.invention_prerequisites.size());
+			triggers::append_required_technologies(ws.s.technology_m.technologies_container[i].allow, ws, ws.w.technology_s.invention_prerequisites);
+			ws.w.technology_s.prerequisite_ranges[i] = std::pair<uint32_t, uint32_t>(first, uint32_t(ws.w.technology_s.invention_prerequisites.size()));
+		}
+	}
+
+	void update_invention_candidates(world_state& ws, nations::country_tag this_nation) {
+		for(auto i : ws.s.technology_m.inventions) {
+			auto const range = ws.w.technology_s.prerequisite_ranges[i];
+
+			bool candidate = !ws.w.nation_s.active_technologies.get(this_nation, i);
+			for(uint32_t j = range.first; candidate && j < range.second; ++j)
+				candidate = ws.w.nation_s.active_technologies.get(this_nation, ws.w.technology_s.invention_prerequisites[j]);
+
+			ws.w.nation_s.invention_candidates.set(this_nation, i, candidate);
+		}
+	}
+
+	void rebuild_invention_candidates(world_state& ws) {
+		// whole rows at a time: a candidate lacks the invention and has every prerequisite
+		int32_t const row_size = nation::container_size;
+		int32_t const byte_count = (row_size + 7) / 8;
+
+		concurrency::parallel_for_each(ws.s.technology_m.inventions.begin(), ws.s.technology_m.inventions.end(), [&ws, row_size, byte_count](tech_tag i) {
+			bitfield_type* const candidates = ws.w.nation_s.invention_candidates.get_row(i, row_size).data();
+			bitfield_type const* const researched = ws.w.nation_s.active_technologies.get_row(i, row_size).data();
+			auto const range = ws.w.technology_s.prerequisite_ranges[i];
+
+			for(int32_t k = 0; k < byte_count; ++k)
+				candidates[k].v = uint8_t(~researched[k].v);
+			for(uint32_t j = range.first; j < range.second; ++j) {
+				bitfield_type const* const prerequisite = ws.w.nation_s.active_technologies.get_row(ws.w.technology_s.invention_prerequisites[j], row_size).data();
+				for(int32_t k = 0; k < byte_count; ++k)
+					candidates[k].v &= prerequisite[k].v;
+			}
+		});
 	}
 
 	void apply_tech_modifiers(world_state& ws, nations::country_tag this_nation, tech_definition const& def) {
@@ -85,6 +126,7 @@ namespace technologies {
 			return;
 
 		apply_technology(ws, this_nation, tech);
+		update_invention_candidates(ws, this_nation);
 		// if(is_valid_index(ws.s.technology_m.technologies_container[tech].unit_adjustment))
 		//  	military::update_all_unit_attributes(ws, this_nation);
 		ws.w.nation_s.nations.get<nation::base_prestige>(this_nation) += ws.s.technology_m.technologies_container[tech].shared_prestige / float(ws.w.technology_s.discovery_count[tech]);
@@ -129,6 +171,8 @@ namespace technologies {
 		Eigen::Map<Eigen::Matrix<float, -1, 1>>(
 			ws.w.nation_s.rebel_org_gain.get_row(this_nation).data(),
 			rebel_types_count) = Eigen::Matrix<float, -1, 1>::Zero(rebel_types_count);
+
+		update_invention_candidates(ws, this_nation);
 	}
 
 	void restore_technologies(world_state& ws, nations::country_tag this_nation) {
@@ -197,6 +241,8 @@ namespace technologies {
 		return true;
 	}
 
+	constexpr uint32_t invention_update_frequency = 32;
+
 	void daily_update(world_state& ws) {
 		ve::execute_serial<nations::country_tag>(ws.w.nation_s.nations.vector_size(), [
 			&ws,
@@ -224,42 +270,45 @@ namespace technologies {
 			}
 		});
 
-		auto const invention_offset = to_index(ws.w.current_date) & 31;
-		concurrency::parallel_for(uint32_t(invention_offset), uint32_t(ws.s.technology_m.inventions.size()), 32ui32, [&ws, &pending_new_techs](uint32_t index) {
-			auto const this_invention = ws.s.technology_m.inventions[index];
-			auto const vsize = ws.w.nation_s.nations.vector_size();
-			ve::execute_serial_fast<nations::country_tag>(vsize, [&ws, &pending_new_techs, vsize, this_invention](auto tags) {
-				auto const inventions_researched = ve::mask_vector(ve::load(tags, ws.w.nation_s.active_technologies.get_row(this_invention, vsize)))
-					& !(nations::nation_exists(ws, tags)); // if nation does not exist -> mark as invented to ignore
-
-				if(ve::compress_mask(inventions_researched) != ve::full_mask) {
-					auto const invention_allowed = triggers::test_contiguous_trigger(
-						ws.s.trigger_m.trigger_data.data() + to_index(ws.s.technology_m.technologies_container[this_invention].allow),
-						ws,
-						tags, tags, ve::contiguous_tags<union_tag>()) & !inventions_researched;
-					if(ve::compress_mask(invention_allowed) != ve::empty_mask) {
-						auto const invention_chance = ve::select(invention_allowed, get_invention_chance(this_invention, ws, tags), 0.0f);
-						ve::apply(tags, invention_chance, [&pending_new_techs, &ws, this_invention](nations::country_tag n, float chance) {
-							if(chance > 0.0f) {
-								std::uniform_real_distribution<float> dist(0, 1.0f);
-								auto const random_result = dist(get_local_generator());
-								if(random_result <= chance) {
-									pending_new_techs.push(std::pair<nations::country_tag, technologies::tech_tag >(n, this_invention));
-
-									messages::new_invention(ws, n, this_invention);
+		ws.w.update_schedule.run(int32_t(current_state::amortized_phase::inventions), invention_update_frequency, 1ui32, uint32_t(ws.s.technology_m.inventions.size()), [&ws, &pending_new_techs](schedule_slice s) {
+			concurrency::parallel_for(s.first, s.last, [&ws, &pending_new_techs](uint32_t index) {
+				auto const this_invention = ws.s.technology_m.inventions[index];
+				auto const vsize = ws.w.nation_s.nations.vector_size();
+				ve::execute_serial_fast<nations::country_tag>(vsize, [&ws, &pending_new_techs, vsize, this_invention](auto tags) {
+					// blocks without a nation that has the prerequisite technologies are skipped before evaluating the trigger
+					auto const candidates = ve::mask_vector(ve::load(tags, ws.w.nation_s.invention_candidates.get_row(this_invention, vsize)))
+						& nations::nation_exists(ws, tags);
+
+					if(ve::compress_mask(candidates) != ve::empty_mask) {
+						auto const invention_allowed = triggers::test_contiguous_trigger(
+							ws.s.trigger_m.trigger_data.data() + to_index(ws.s.technology_m.technologies_container[this_invention].allow),
+							ws,
+							tags, tags, ve::contiguous_tags<union_tag>()) & candidates;
+						if(ve::compress_mask(invention_allowed) != ve::empty_mask) {
+							auto const invention_chance = ve::select(invention_allowed, get_invention_chance(this_invention, ws, tags), 0.0f);
+							ve::apply(tags, invention_chance, [&pending_new_techs, &ws, this_invention](nations::country_tag n, float chance) {
+								if(chance > 0.0f) {
+									std::uniform_real_distribution<float> dist(0, 1.0f);
+									auto const random_result = dist(get_local_generator());
+									if(random_result <= chance) {
+										pending_new_techs.push(std::pair<nations::country_tag, technologies::tech_tag >(n, this_invention));
+
+										messages::new_invention(ws, n, this_invention);
+									}
 								}
-							}
-						});
+							});
+						}
 					}
-				}
+				});
 			});
-			auto const nations = ve::contiguous_tags_base<nations::country_tag>(uint32_t(index));
-			
 		});
 
 		std::pair<nations::country_tag, technologies::tech_tag> p;
 		while(pending_new_techs.try_pop(p)) {
 			technologies::apply_single_technology(ws, p.first, p.second);
 		}
+
+		// every nation gained research points
+		ws.w.gui_m.publish_change_for_all(ui::world_data::nation_research, uint32_t(ws.w.nation_s.nations.size()));
 	}
 }
@@ -12,6 +12,11 @@ namespace technologies {
 	void restore_technologies(world_state& ws, nations::country_tag this_nation); // reset technologies and base unit stats first
 	void reset_technologies(world_state& ws, nations::country_tag this_nation);
 
+	// invention candidates: nations that have the technologies an invention requires and do not have the invention;
+	// kept up to date by the functions above, otherwise to be called after changing the nation's active technologies
+	void update_invention_candidates(world_state& ws, nations::country_tag this_nation);
+	void rebuild_invention_candidates(world_state& ws); // for all nations at once
+
 	template<typename T, typename U = float>
 	auto daily_research_points(world_state const& ws, T this_nation, U base = 0.0f) -> decltype(ve::widen_to<T>(0.0f));
 
@@ -9,6 +9,11 @@ namespace technologies {
 	void close_button::button_function(ui::simple_button<close_button>&, world_state& ws) {
 		ws.w.technologies_w.hide_technology_window(ws.w.gui_m);
 	}
+	void tech_window_base::update(world_state& ws) {
+		// research progress and the known technologies and inventions are the player's
+		if(auto player = ws.w.local_player_nation; player)
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_research, uint16_t(to_index(player)) });
+	}
 
 	void tech_school_text_box::update(ui::tagged_gui_object box, ui::text_box_line_manager& lm, ui::text_format& fmt, world_state& ws) {
 		if(auto player = ws.w.local_player_nation; player) {
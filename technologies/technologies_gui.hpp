@@ -107,6 +107,7 @@ namespace technologies {
 
 		template<typename W>
 		void on_create(W& w, world_state&);
+		void update(world_state& ws);
 	};
 
 	class close_button {
@@ -468,7 +469,7 @@ namespace technologies {
 		if(auto player = ws.w.local_player_nation; player) {
 			if(auto pid = player; ws.w.nation_s.nations.is_valid_index(pid)) {
 				for(auto i : ws.s.technology_m.inventions) {
-					if(ws.w.nation_s.active_technologies.get(pid, i) == false &&
+					if(ws.w.nation_s.invention_candidates.get(pid, i) &&
 						(!is_valid_index(ws.s.technology_m.technologies_container[i].allow) ||
 							triggers::test_trigger(ws.s.trigger_m.trigger_data.data() + to_index(ws.s.technology_m.technologies_container[i].allow), ws, player, player, triggers::const_parameter()))) {
 						data.emplace_back(i, get_invention_chance(i, ws, player));
@@ -4596,7 +4596,11 @@ namespace triggers {
 		jsf_prng generator_copy,
 		bool show_condition
 	) {
-		return _make_effect_description(ws, container, cursor_in, lm, fmt, tval, primary_slot, this_slot, from_slot, generator_copy, show_condition);
+		return ws.w.trigger_descriptions.describe(ws, true,
+			description_cache::make_key(cursor_in, fmt, tval, primary_slot, this_slot, from_slot, show_condition), &generator_copy, container, lm,
+			[&]() {
+				return _make_effect_description(ws, container, cursor_in, lm, fmt, tval, primary_slot, this_slot, from_slot, generator_copy, show_condition);
+			});
 	}
 }
 
@@ -16,4 +16,29 @@ namespace triggers {
 		});
 		return result;
 	}
+
+	namespace {
+		void append_required_technologies(uint16_t const* tval, std::vector<technologies::tech_tag>& out) {
+			if((tval[0] & trigger_codes::is_scope) != 0) {
+				if((tval[0] & trigger_codes::code_mask) == trigger_codes::generic_scope && (tval[0] & trigger_codes::is_disjunctive_scope) == 0) {
+					const auto source_size = 1 + get_trigger_payload_size(tval);
+
+					auto sub_units_start = tval + 2 + trigger_scope_data_payload(tval[0]);
+					while(sub_units_start < tval + source_size) {
+						append_required_technologies(sub_units_start, out);
+						sub_units_start += 1 + get_trigger_payload_size(sub_units_start);
+					}
+				}
+			} else if((tval[0] & trigger_codes::code_mask) == trigger_codes::technology) {
+				auto const association = tval[0] & trigger_codes::association_mask;
+				if(association != trigger_codes::association_ne && association != trigger_codes::association_gt && association != trigger_codes::association_lt)
+					out.push_back(trigger_payload(tval[2]).tech);
+			}
+		}
+	}
+
+	void append_required_technologies(trigger_tag t, world_state const& ws, std::vector<technologies::tech_tag>& out) {
+		if(is_valid_index(t))
+			append_required_technologies(ws.s.trigger_m.trigger_data.data() + to_index(t), out);
+	}
 }
@@ -6,4 +6,6 @@ class world_state;
 
 namespace triggers {
 	bool refers_to_technology(trigger_tag t, technologies::tech_tag tech, world_state const& ws);
+	// appends the technologies tested for by the trigger that every nation satisfying it must have (those reached only through "and" scopes)
+	void append_required_technologies(trigger_tag t, world_state const& ws, std::vector<technologies::tech_tag>& out);
 }
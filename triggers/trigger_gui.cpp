@@ -6615,6 +6615,106 @@ namespace triggers {
 		tf_party_loyalty_generic,
 	};
 
+	bool description_cache::key::operator<(key const& o) const {
+		return std::make_tuple(tval, primary_slot, this_slot, from_slot, cursor.x, cursor.y, color, font_handle, font_size, show_condition)
+			< std::make_tuple(o.tval, o.primary_slot, o.this_slot, o.from_slot, o.cursor.x, o.cursor.y, o.color, o.font_handle, o.font_size, o.show_condition);
+	}
+
+	description_cache::key description_cache::make_key(ui::xy_pair cursor_in, ui::text_format const& fmt, uint16_t const* tval, const_parameter primary_slot,
+		const_parameter this_slot, const_parameter from_slot, bool show_condition) {
+
+		key k;
+		k.tval = tval;
+		k.primary_slot = primary_slot.value;
+		k.this_slot = this_slot.value;
+		k.from_slot = from_slot.value;
+		k.cursor = cursor_in;
+		k.color = fmt.color;
+		k.font_handle = uint8_t(to_index(fmt.font_handle));
+		k.font_size = fmt.font_size;
+		k.show_condition = show_condition;
+		return k;
+	}
+
+	void description_cache::refresh(date_tag current_date) {
+		const auto current_generation = generation.load(std::memory_order_acquire);
+		if(current_generation != cached_generation || current_date != cached_date) {
+			trigger_descriptions.clear();
+			effect_descriptions.clear();
+			cached_generation = current_generation;
+			cached_date = current_date;
+		}
+	}
+
+	ui::xy_pair description_cache::describe(world_state& ws, bool effect, key const& k, jsf_prng const* generator, ui::tagged_gui_object container,
+		ui::unlimited_line_manager& lm, std::function<ui::xy_pair()> const& generate) {
+
+		if(lm.is_recording() || lm.wraps_lines())
+			return generate();
+
+		refresh(ws.w.current_date);
+		auto& descriptions = effect ? effect_descriptions : trigger_descriptions;
+
+		if(auto it = descriptions.find(k); it != descriptions.end() && (!generator || it->second.generator == *generator)) {
+			it->second.lines.replay(ws.w.gui_m, container, lm);
+			return it->second.cursor_out;
+		}
+
+		int32_t children_before = 0;
+		ui::for_each_child(ws.w.gui_m, container, [&children_before](ui::tagged_gui_object) { ++children_before; });
+
+		description d;
+		lm.start_recording(d.lines);
+		const auto cursor_out = generate();
+		lm.stop_recording();
+		d.cursor_out = cursor_out;
+
+		// anything placed without going through lm could not be replayed
+		int32_t children_after = 0;
+		ui::for_each_child(ws.w.gui_m, container, [&children_after](ui::tagged_gui_object) { ++children_after; });
+
+		if(children_after - children_before == int32_t(d.lines.added.size()) && d.lines.complete(ws.w.gui_m)) {
+			if(generator)
+				d.generator = *generator;
+			if(descriptions.size() >= max_entries)
+				descriptions.clear();
+			descriptions.insert_or_assign(k, std::move(d));
+		}
+
+		return cursor_out;
+	}
+
+	namespace {
+		ui::xy_pair generate_trigger_description(
+			world_state& ws,
+			ui::tagged_gui_object container,
+			ui::xy_pair cursor_in,
+			ui::unlimited_line_manager& lm,
+			ui::text_format const& fmt,
+			uint16_t const* tval,
+			const_parameter primary_slot,
+			const_parameter this_slot,
+			const_parameter from_slot,
+			bool show_condition
+		) {
+			if(show_condition) {
+				if(triggers::test_trigger(tval, ws, primary_slot, this_slot, from_slot)) {
+					ui::text_format local_fmt{ui::text_color::green, fmt.font_handle, fmt.font_size};
+					cursor_in = ui::add_text(cursor_in, u"\u2714 ", local_fmt, ws, container, lm);
+				} else {
+					ui::text_format local_fmt{ ui::text_color::red, fmt.font_handle, fmt.font_size };
+					cursor_in = ui::add_text(cursor_in, u"\u274C ", local_fmt, ws, container, lm);
+				}
+			}
+
+			if((*tval & trigger_codes::is_scope) != 0) {
+				return scope_functions[*tval & trigger_codes::code_mask](tval, ws, container, cursor_in, lm, fmt, primary_slot, this_slot, from_slot, show_condition);
+			} else {
+				return trigger_functions[*tval & trigger_codes::code_mask](tval, ws, container, cursor_in, lm, fmt, primary_slot, this_slot, from_slot);
+			}
+		}
+	}
+
 	ui::xy_pair make_trigger_description(
 		world_state& ws,
 		ui::tagged_gui_object container,
@@ -6627,20 +6727,10 @@ namespace triggers {
 		const_parameter from_slot,
 		bool show_condition
 	) {
-		if(show_condition) {
-			if(triggers::test_trigger(tval, ws, primary_slot, this_slot, from_slot)) {
-				ui::text_format local_fmt{ui::text_color::green, fmt.font_handle, fmt.font_size};
-				cursor_in = ui::add_text(cursor_in, u"\u2714 ", local_fmt, ws, container, lm);
-			} else {
-				ui::text_format local_fmt{ ui::text_color::red, fmt.font_handle, fmt.font_size };
-				cursor_in = ui::add_text(cursor_in, u"\u274C ", local_fmt, ws, container, lm);
-			}
-		}
-
-		if((*tval & trigger_codes::is_scope) != 0) {
-			return scope_functions[*tval & trigger_codes::code_mask](tval, ws, container, cursor_in, lm, fmt, primary_slot, this_slot, from_slot, show_condition);
-		} else {
-			return trigger_functions[*tval & trigger_codes::code_mask](tval, ws, container, cursor_in, lm, fmt, primary_slot, this_slot, from_slot);
-		}
+		return ws.w.trigger_descriptions.describe(ws, false,
+			description_cache::make_key(cursor_in, fmt, tval, primary_slot, this_slot, from_slot, show_condition), nullptr, container, lm,
+			[&]() {
+				return generate_trigger_description(ws, container, cursor_in, lm, fmt, tval, primary_slot, this_slot, from_slot, show_condition);
+			});
 	}
 }
@@ -6,6 +6,53 @@
 class world_state;
 
 namespace triggers {
+	// Descriptions made by make_trigger_description and make_effect_description, kept as the lines they placed so that
+	// showing the same description again replays those lines instead of walking the bytecode and formatting its text
+	// again. Entries are dropped when the date changes and when invalidate is called, which the update thread does after
+	// executing commands; otherwise the cache is only used by the thread that creates the gui. Descriptions placed
+	// through a line manager that wraps lines, or made while an enclosing description is being recorded, are not cached.
+	class description_cache {
+	public:
+		static constexpr size_t max_entries = 256; // per kind of description, before they are all dropped
+
+		struct key {
+			uint16_t const* tval = nullptr;
+			int32_t primary_slot = 0;
+			int32_t this_slot = 0;
+			int32_t from_slot = 0;
+			ui::xy_pair cursor;
+			ui::text_color color = ui::text_color::black;
+			uint8_t font_handle = 0;
+			uint32_t font_size = 0;
+			bool show_condition = true;
+
+			bool operator<(key const& o) const;
+		};
+		struct description {
+			ui::line_recording lines;
+			ui::xy_pair cursor_out;
+			jsf_prng generator; // the generator the effects were described with; unused for triggers
+		};
+
+		boost::container::flat_map<key, description> trigger_descriptions;
+		boost::container::flat_map<key, description> effect_descriptions;
+
+		static key make_key(ui::xy_pair cursor_in, ui::text_format const& fmt, uint16_t const* tval, const_parameter primary_slot,
+			const_parameter this_slot, const_parameter from_slot, bool show_condition);
+
+		// replays the description cached under k, or records the one placed by generate and caches it; generator is
+		// null for triggers
+		ui::xy_pair describe(world_state& ws, bool effect, key const& k, jsf_prng const* generator, ui::tagged_gui_object container,
+			ui::unlimited_line_manager& lm, std::function<ui::xy_pair()> const& generate);
+		void invalidate() { generation.fetch_add(1, std::memory_order_acq_rel); }
+	private:
+		std::atomic<uint32_t> generation = 0;
+		uint32_t cached_generation = 0;
+		date_tag cached_date;
+
+		void refresh(date_tag current_date);
+	};
+
 	ui::xy_pair make_trigger_description(
 		world_state& ws,
 		ui::tagged_gui_object container,
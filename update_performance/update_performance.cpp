@@ -7,6 +7,10 @@
 #include "scenario\\scenario_io.h"
 #include <ppl.h>
 #include "provinces\province_functions.h"
+#include "economy\economy_functions.h"
+#include "population\population_functions.h"
+#include "graphics\map_modes.h"
+#include "triggers\trigger_gui.h"
 
 class single_world_step {
 public:
@@ -55,6 +59,186 @@ public:
 	}
 };
 
+// one economy day under the given price solver. Returns the mean relative movement of all state prices since the
+// previous call in parts per million, so the printed sum measures how far prices still wander next to the cost
+template<economy::price_solver mode>
+class economy_price_day {
+public:
+	world_state& ws;
+	std::vector<float> previous_prices;
+
+	economy_price_day(world_state& s) : ws(s) {
+		ws.w.economy_s.price_mode = mode;
+	}
+
+	int test_function() {
+		economy::economy_update_tick(ws);
+
+		std::vector<float> prices;
+		ws.w.nation_s.states.for_each([this, &prices](nations::state_tag si) {
+			auto row = economy::state_current_prices(ws, si);
+			prices.insert(prices.end(), row.data(), row.data() + ws.s.economy_m.goods_count);
+		});
+
+		double movement = 0.0;
+		if(previous_prices.size() == prices.size()) {
+			for(size_t i = 0; i < prices.size(); ++i)
+				movement += std::abs(prices[i] - previous_prices[i]) / std::max(previous_prices[i], 0.01f);
+			movement /= double(std::max(prices.size(), size_t(1)));
+		}
+		previous_prices = std::move(prices);
+		return int(movement * 1'000'000.0);
+	}
+};
+
+// a read pass over the pop columns the size change and demographic passes take together: the type, religion and culture
+// tags plus size, militancy, consciousness and literacy. Run directly on the pop container, which stores them as the
+// per_pop column group, and on a copy of the same values laid out one column per array as they were before grouping
+template<typename TYPES, typename RELIGIONS, typename CULTURES, typename SIZES, typename VALUES>
+float pop_column_pass(uint32_t count, TYPES types, RELIGIONS religions, CULTURES cultures, SIZES sizes, VALUES militancy, VALUES consciousness, VALUES literacy) {
+	ve::fp_vector total;
+	ve::execute_serial<population::pop_tag>(count, [&](auto executor) {
+		auto const has_categories = (ve::load(executor, types) != ve::tagged_vector<population::pop_type_tag>())
+			& (ve::load(executor, religions) != ve::tagged_vector<cultures::religion_tag>())
+			& (ve::load(executor, cultures) != ve::tagged_vector<cultures::culture_tag>());
+		auto const weighted = ve::load(executor, sizes) * (ve::load(executor, militancy) + ve::load(executor, consciousness) + ve::load(executor, literacy));
+		total = total + ve::select(has_categories, weighted, ve::fp_vector());
+	});
+	return total.reduce();
+}
+
+class separate_pop_pass {
+public:
+	world_state& ws;
+	std::vector<population::pop_type_tag, aligned_allocator_64<population::pop_type_tag>> types;
+	std::vector<cultures::religion_tag, aligned_allocator_64<cultures::religion_tag>> religions;
+	std::vector<cultures::culture_tag, aligned_allocator_64<cultures::culture_tag>> cultures;
+	std::vector<float, aligned_allocator_64<float>> values[4]; // size, militancy, consciousness, literacy
+
+	separate_pop_pass(world_state& s) : ws(s) {
+		auto const& pops = ws.w.population_s.pops;
+		uint32_t const count = ve::to_vector_size(uint32_t(pops.size()));
+		types.resize(count);
+		religions.resize(count);
+		cultures.resize(count);
+		for(auto& v : values)
+			v.resize(count);
+		for(int32_t i = 0; i < pops.size(); ++i) {
+			population::pop_tag p = population::pop_tag(population::pop_tag::value_base_t(i));
+			types[i] = pops.get<pop::type>(p);
+			religions[i] = pops.get<pop::religion>(p);
+			cultures[i] = pops.get<pop::culture>(p);
+			values[0][i] = pops.get<pop::size>(p);
+			values[1][i] = pops.get<pop::militancy>(p);
+			values[2][i] = pops.get<pop::consciousness>(p);
+			values[3][i] = pops.get<pop::literacy>(p);
+		}
+	}
+
+	int test_function() {
+		auto view = [](auto& v) {
+			return tagged_array_view<std::remove_reference_t<decltype(v[0])> const, population::pop_tag>(v.data(), int32_t(v.size()));
+		};
+		return int(pop_column_pass(uint32_t(ws.w.population_s.pops.size()), view(types), view(religions), view(cultures),
+			view(values[0]), view(values[1]), view(values[2]), view(values[3])));
+	}
+};
+
+class grouped_pop_pass {
+public:
+	world_state& ws;
+
+	grouped_pop_pass(world_state& s) : ws(s) {}
+
+	int test_function() {
+		auto const& pops = ws.w.population_s.pops;
+		return int(pop_column_pass(uint32_t(pops.size()), pops.get_row<pop::type>(), pops.get_row<pop::religion>(), pops.get_row<pop::culture>(),
+			pops.get_row<pop::size>(), pops.get_row<pop::militancy>(), pops.get_row<pop::consciousness>(), pops.get_row<pop::literacy>()));
+	}
+};
+
+// literacy, militancy and consciousness of every pop: one sweep that gathers each block of provinces and updates each
+// block of pops once for all three, against three passes that each gather and sweep the pop columns again
+class fused_pop_attitudes {
+public:
+	world_state& ws;
+
+	fused_pop_attitudes(world_state& s) : ws(s) {}
+
+	int test_function() {
+		population::update_all_pop_attitudes(ws);
+		return int(ws.w.population_s.pops.get<pop::consciousness>(population::pop_tag(90)) * 1000.0f);
+	}
+};
+
+class separate_pop_attitudes {
+public:
+	world_state& ws;
+
+	separate_pop_attitudes(world_state& s) : ws(s) {}
+
+	int test_function() {
+		population::update_all_pop_attitudes_separately(ws);
+		return int(ws.w.population_s.pops.get<pop::consciousness>(population::pop_tag(90)) * 1000.0f);
+	}
+};
+
+// one full recoloring of the provinces in the given map mode, as done whenever the map mode changes
+template<map_mode::type mode>
+class map_mode_colors {
+public:
+	world_state& ws;
+
+	map_mode_colors(world_state& s) : ws(s) {
+		if(ws.w.map.colors.primary_color_data() == nullptr)
+			ws.w.map.colors.init_color_data(uint32_t(ws.s.province_m.province_container.size()));
+		ws.w.map_view.mode = mode;
+	}
+
+	int test_function() {
+		ws.w.map_view.changed.store(true, std::memory_order_release);
+		map_mode::update_map_colors(ws);
+		return int(ws.w.map.colors.primary_color_data()[90 * 3]);
+	}
+};
+
+// the tooltip of the decision with the longest allow condition, described from its bytecode every time, or replayed
+// from the description cache after the first time
+template<bool cached>
+class decision_tooltip {
+public:
+	world_state& ws;
+	ui::tagged_gui_object tooltip_window;
+	uint16_t const* allow = nullptr;
+
+	decision_tooltip(world_state& s) : ws(s), tooltip_window(s.w.gui_m.gui_objects.emplace()) {
+		int32_t longest = 0;
+		for(auto const& d : ws.s.event_m.decision_container) {
+			if(!d.allow)
+				continue;
+			auto const condition = ws.s.trigger_m.trigger_data.data() + to_index(d.allow);
+			if(auto const length = triggers::get_trigger_payload_size(condition); length > longest) {
+				longest = length;
+				allow = condition;
+			}
+		}
+	}
+	~decision_tooltip() {
+		ws.w.gui_m.destroy(tooltip_window);
+	}
+
+	int test_function() {
+		if constexpr(!cached)
+			ws.w.trigger_descriptions.invalidate();
+
+		ui::clear_children(ws.w.gui_m, tooltip_window);
+		ui::unlimited_line_manager lm;
+		const auto cursor = triggers::make_trigger_description(ws, tooltip_window, ui::xy_pair{ 0, 0 }, lm, ui::tooltip_text_format, allow,
+			triggers::const_parameter(nations::country_tag(0)), triggers::const_parameter(nations::country_tag(0)), triggers::const_parameter());
+		return int(cursor.y);
+	}
+};
+
 int main() {
 	logging_object log;
 
@@ -66,6 +250,10 @@ int main() {
 	serialization::deserialize_from_file(u"D:\\VS2007Projects\\open_v2_test_data\\test_scenario.bin", ws.s, tg);
 	tg.wait();
 
+	file_system fs;
+	fs.set_root(u"D:\\programs\\V2");
+	scenario::ready_scenario(ws.s, fs.get_root()); // the tooltips need the metrics fonts
+
 	ready_world_state(ws);
 	serialization::deserialize_from_file(u"D:\\VS2007Projects\\open_v2_test_data\\test_save_cmp.bin", ws.w, ws);
 
@@ -81,6 +269,66 @@ int main() {
 		std::cout << to.log_function(log, "variant pathwise distance") << std::endl;
 	}
 	
+	{
+		test_object<20, 100, separate_pop_pass> to(ws);
+		std::cout << to.log_function(log, "pop column pass, separate columns") << std::endl;
+	}
+
+	{
+		test_object<20, 100, grouped_pop_pass> to(ws);
+		std::cout << to.log_function(log, "pop column pass, per_pop group") << std::endl;
+	}
+
+	{
+		test_object<20, 100, separate_pop_attitudes> to(ws);
+		std::cout << to.log_function(log, "pop attitudes, separate passes") << std::endl;
+	}
+
+	{
+		test_object<20, 100, fused_pop_attitudes> to(ws);
+		std::cout << to.log_function(log, "pop attitudes, fused sweep") << std::endl;
+	}
+
+	{
+		test_object<5, 10, economy_price_day<economy::price_solver::dampened>> to(ws);
+		std::cout << "price movement (ppm): " << to.log_function(log, "economy day, dampened prices") << std::endl;
+	}
+
+	{
+		test_object<5, 10, economy_price_day<economy::price_solver::market_clearing>> to(ws);
+		std::cout << "price movement (ppm): " << to.log_function(log, "economy day, market clearing prices") << std::endl;
+	}
+
+	{
+		test_object<20, 100, map_mode_colors<map_mode::type::political>> to(ws);
+		std::cout << to.log_function(log, "map colors, political") << std::endl;
+	}
+
+	{
+		test_object<20, 100, map_mode_colors<map_mode::type::population>> to(ws);
+		std::cout << to.log_function(log, "map colors, population") << std::endl;
+	}
+
+	{
+		test_object<20, 100, map_mode_colors<map_mode::type::culture>> to(ws);
+		std::cout << to.log_function(log, "map colors, culture") << std::endl;
+	}
+
+	{
+		test_object<20, 100, map_mode_colors<map_mode::type::rgo>> to(ws);
+		std::cout << to.log_function(log, "map colors, rgo") << std::endl;
+	}
+
+	{
+		test_object<20, 100, decision_tooltip<false>> to(ws);
+		std::cout << to.log_function(log, "decision tooltip, described") << std::endl;
+	}
+
+	{
+		test_object<20, 100, decision_tooltip<true>> to(ws);
+		std::cout << to.log_function(log, "decision tooltip, replayed") << std::endl;
+	}
+
 	{
 		// test_object<20, 100, single_world_step> to(ws);
 		// std::cout << to.log_function(log, "world state 100 steps update") << std::endl;
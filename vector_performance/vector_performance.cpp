@@ -204,6 +204,96 @@ public:
 
 concurrency::combinable<moveable_concurrent_cache_aligned_buffer<float, int32_t, true, vsize>> combiner_usage_d::combiner;
 
+constexpr int32_t grouped_size = 40000;
+constexpr int32_t grouped_segments = 2700;
+
+struct grouped_data {
+	std::vector<float, aligned_allocator_64<float>> values;
+	std::vector<int32_t, aligned_allocator_64<int32_t>> bins;
+	std::vector<int32_t, aligned_allocator_64<int32_t>> starts;
+	std::vector<float, aligned_allocator_64<float>> totals;
+	std::vector<int32_t, aligned_allocator_64<int32_t>> selected;
+
+	grouped_data() : values(grouped_size, 0.0f), bins(grouped_size, 0), starts(grouped_segments + 1, 0), totals(grouped_segments, 0.0f), selected(grouped_size, 0) {
+		auto fdist = std::uniform_real_distribution<float>(0.0f, 1.0f);
+		auto bdist = std::uniform_int_distribution<int32_t>(0, grouped_segments - 1);
+		for(int32_t i = 0; i < grouped_size; ++i) {
+			values[i] = fdist(get_local_generator());
+			bins[i] = bdist(get_local_generator());
+		}
+		for(int32_t i = 0; i <= grouped_segments; ++i)
+			starts[i] = int32_t((int64_t(i) * grouped_size) / grouped_segments);
+	}
+};
+
+grouped_data grouped;
+
+class scalar_segmented_sum {
+public:
+	int test_function() {
+		for(int32_t s = 0; s < grouped_segments; ++s) {
+			float sum = 0.0f;
+			for(int32_t i = grouped.starts[s]; i < grouped.starts[s + 1]; ++i)
+				sum += grouped.values[i];
+			grouped.totals[s] = sum;
+		}
+		return int(grouped.totals[27]);
+	}
+};
+
+class ve_segmented_sum {
+public:
+	int test_function() {
+		ve::segmented_reduce(uint32_t(grouped_segments), tagged_array_view<int32_t const, int32_t>(grouped.starts.data(), grouped_segments + 1),
+			tagged_array_view<float const, int32_t>(grouped.values.data(), grouped_size), tagged_array_view<float, int32_t>(grouped.totals.data(), grouped_segments));
+		return int(grouped.totals[27]);
+	}
+};
+
+class scalar_weighted_histogram {
+public:
+	int test_function() {
+		std::fill(grouped.totals.begin(), grouped.totals.end(), 0.0f);
+		for(int32_t i = 0; i < grouped_size; ++i)
+			grouped.totals[grouped.bins[i]] += grouped.values[i];
+		return int(grouped.totals[27]);
+	}
+};
+
+template<typename policy>
+class ve_weighted_histogram {
+public:
+	int test_function() {
+		std::fill(grouped.totals.begin(), grouped.totals.end(), 0.0f);
+		ve::weighted_histogram(uint32_t(grouped_size), tagged_array_view<int32_t const, int32_t>(grouped.bins.data(), grouped_size),
+			tagged_array_view<float const, int32_t>(grouped.values.data(), grouped_size), uint32_t(grouped_segments),
+			tagged_array_view<float, int32_t>(grouped.totals.data(), grouped_segments), policy());
+		return int(grouped.totals[27]);
+	}
+};
+
+class scalar_compress {
+public:
+	int test_function() {
+		int32_t count = 0;
+		for(int32_t i = 0; i < grouped_size; ++i) {
+			if(grouped.values[i] > 0.75f)
+				grouped.selected[count++] = i;
+		}
+		return count;
+	}
+};
+
+template<typename policy>
+class ve_compress {
+public:
+	int test_function() {
+		return int(ve::compress_to_indices(uint32_t(grouped_size), [v = grouped.values.data()](auto executor) {
+			return ve::load(executor, v) > 0.75f;
+		}, tagged_array_view<int32_t, int32_t>(grouped.selected.data(), grouped_size), policy()));
+	}
+};
+
 int main() {
 	logging_object log;
 
@@ -273,4 +363,38 @@ int main() {
 		test_object<40, 1000, combiner_usage_d> to;
 		std::cout << to.log_function(log, "combiner usage static") << std::endl;
 	}
+	std::cout << cc.clear() << std::endl;
+
+	{
+		test_object<40, 1000, scalar_segmented_sum> to;
+		std::cout << to.log_function(log, "scalar segmented sum") << std::endl;
+	}
+	{
+		test_object<40, 1000, ve_segmented_sum> to;
+		std::cout << to.log_function(log, "vector engine segmented sum") << std::endl;
+	}
+	{
+		test_object<40, 1000, scalar_weighted_histogram> to;
+		std::cout << to.log_function(log, "scalar weighted histogram") << std::endl;
+	}
+	{
+		test_object<40, 1000, ve_weighted_histogram<ve::serial>> to;
+		std::cout << to.log_function(log, "vector engine weighted histogram") << std::endl;
+	}
+	{
+		test_object<40, 1000, ve_weighted_histogram<ve::par>> to;
+		std::cout << to.log_function(log, "vector engine parallel weighted histogram") << std::endl;
+	}
+	{
+		test_object<40, 1000, scalar_compress> to;
+		std::cout << to.log_function(log, "scalar compress to indices") << std::endl;
+	}
+	{
+		test_object<40, 1000, ve_compress<ve::serial>> to;
+		std::cout << to.log_function(log, "vector engine compress to indices") << std::endl;
+	}
+	{
+		test_object<40, 1000, ve_compress<ve::par>> to;
+		std::cout << to.log_function(log, "vector engine parallel compress to indices") << std::endl;
+	}
 }
\ No newline at end of file
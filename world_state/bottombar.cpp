@@ -15,6 +15,10 @@ namespace current_state {
 	void menu_button::button_function(ui::simple_button<menu_button>& self, world_state & ws) {
 		ws.w.menu_w.show_menu_window(ws);
 	}
+	void bottombar_base::update(world_state& ws) {
+		// the rest of the bar only changes with what the player does
+		ui::subscribe(ws, ui::data_key{ ui::world_data::message_log });
+	}
 	void ledger_button::button_function(ui::simple_button<ledger_button>& self, world_state & ws) {}
 	void goto_button::button_function(ui::simple_button<goto_button>& self, world_state & ws) {
 		ws.w.find_w.show_find_window(ws);
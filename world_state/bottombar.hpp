@@ -65,6 +65,7 @@ namespace current_state {
 
 		template<typename W>
 		void on_create(W& w, world_state& ws);
+		void update(world_state& ws);
 	};
 
 	class message_log_base : public ui::visible_region {
@@ -206,6 +206,7 @@ namespace messages {
 
 	void submit_log_item(world_state& ws, int32_t category, log_display_function&& f) {
 		ws.w.message_w.pending_log_items.push(log_message_instance{ std::move(f), category });
+		ws.w.gui_m.publish_change(ui::data_key{ ui::world_data::message_log });
 	}
 
 
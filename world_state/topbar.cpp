@@ -8,6 +8,19 @@
 
 namespace current_state {
 
+	void topbar_base::update(world_state& ws) {
+		// the topbar sums up the player's nation: its budget, research, population, scores and diplomacy. The ranks
+		// and the date subscribe on their own
+		if(auto player = ws.w.local_player_nation; player) {
+			auto const index = uint16_t(to_index(player));
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_economy, index });
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_research, index });
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_demographics, index });
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_scores, index });
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_relations, index });
+		}
+	}
+
 	void player_flag::update(ui::masked_flag<player_flag>& self, world_state& ws) {
 		auto player = ws.w.local_player_nation;
 		if(player)
@@ -517,21 +530,25 @@ namespace current_state {
 
 	void topbar_overall_rank::update(ui::tagged_gui_object box, ui::text_box_line_manager & lm, ui::text_format & fmt, world_state & ws) {
 		if(auto player = ws.w.local_player_nation; player) {
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_rank, uint16_t(to_index(player)) });
 			ui::add_text(ui::xy_pair{ 0,0 }, text_data::integer{ ws.w.nation_s.nations.get<nation::overall_rank>(player) }, fmt, ws, box, lm);
 		}
 	}
 	void topbar_prestige_rank::update(ui::tagged_gui_object box, ui::text_box_line_manager & lm, ui::text_format & fmt, world_state & ws) {
 		if(auto player = ws.w.local_player_nation; player) {
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_rank, uint16_t(to_index(player)) });
 			ui::add_text(ui::xy_pair{ 0,0 }, text_data::integer{ ws.w.nation_s.nations.get<nation::prestige_rank>(player) }, fmt, ws, box, lm);
 		}
 	}
 	void topbar_military_rank::update(ui::tagged_gui_object box, ui::text_box_line_manager & lm, ui::text_format & fmt, world_state & ws) {
 		if(auto player = ws.w.local_player_nation; player) {
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_rank, uint16_t(to_index(player)) });
 			ui::add_text(ui::xy_pair{ 0,0 }, text_data::integer{ ws.w.nation_s.nations.get<nation::military_rank>(player) }, fmt, ws, box, lm);
 		}
 	}
 	void topbar_industrial_rank::update(ui::tagged_gui_object box, ui::text_box_line_manager & lm, ui::text_format & fmt, world_state & ws) {
 		if(auto player = ws.w.local_player_nation; player) {
+			ui::subscribe(ws, ui::data_key{ ui::world_data::nation_rank, uint16_t(to_index(player)) });
 			ui::add_text(ui::xy_pair{ 0,0 }, text_data::integer{ ws.w.nation_s.nations.get<nation::industrial_rank>(player) }, fmt, ws, box, lm);
 		}
 	}
@@ -578,6 +595,7 @@ namespace current_state {
 			self.set_frame(ws.w.gui_m, uint32_t(ws.w.speed));
 	}
 	void topbar_date::update(ui::tagged_gui_object box, ui::text_box_line_manager & lm, ui::text_format & fmt, world_state & ws) {
+		ui::subscribe(ws, ui::data_key{ ui::world_data::date });
 		ui::add_text(ui::xy_pair{ 0,0 }, ws.w.current_date, fmt, ws, box, lm);
 	}
 	topbar::topbar() : win(std::make_unique<topbar_t>()) {}
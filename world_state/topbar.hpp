@@ -25,6 +25,7 @@ namespace current_state {
 	public:
 		template<typename W>
 		void on_create(W& w, world_state&);
+		void update(world_state& ws);
 	};
 
 	template<int32_t nth>
@@ -4,6 +4,7 @@
 #include "nations\\nations_functions.h"
 #include "cultures\\cultures_functions.h"
 #include "population\\population_functions.hpp"
+#include "population\\population_rollup.h"
 #include "variables\\variables_functions.h"
 #include "military\\military_functions.h"
 #include "economy\\economy_functions.h"
@@ -14,6 +15,7 @@
 #include "events\\event_functions.h"
 #include "scenario\\settings.h"
 #include "governments\governments_functions.h"
+#include "concurrency_tools\\access_profiling.h"
 #include <chrono>
 
 #include <Windows.h>
@@ -22,62 +24,117 @@
 #undef max
 
 void world_state_non_ai_update(world_state & ws) {
+	ws.w.update_schedule.begin_tick();
 
-	population::update_literacy(ws);
-	population::update_militancy(ws);
-	population::update_consciousness(ws);
+	CONTAINER_ACCESS_PHASE("population::update_pop_attitudes");
+	population::update_pop_attitudes(ws);
+	CONTAINER_ACCESS_PHASE("population::update_pop_ideology_and_issues");
 	population::update_pop_ideology_and_issues(ws);
+	CONTAINER_ACCESS_PHASE("population::calculate_promotion_and_demotion_qnty");
 	population::calculate_promotion_and_demotion_qnty(ws);
+	CONTAINER_ACCESS_PHASE("population::calculate_migration_qnty");
 	population::calculate_migration_qnty(ws);
+	CONTAINER_ACCESS_PHASE("population::calculate_assimilation_qnty");
 	population::calculate_assimilation_qnty(ws);
+	CONTAINER_ACCESS_PHASE("population::execute_size_changes");
 	population::execute_size_changes(ws);
 
-	provinces::update_province_demographics(ws);
-	nations::update_state_nation_demographics(ws);
+	CONTAINER_ACCESS_PHASE("population::update_demographics");
+	population::update_demographics(ws);
 
+	CONTAINER_ACCESS_PHASE("governments::government_composition_update");
 	governments::government_composition_update(ws);
 
+	CONTAINER_ACCESS_PHASE("provinces::update_crime");
 	provinces::update_crime(ws);
 
+	CONTAINER_ACCESS_PHASE("population::update_independence_movements");
 	population::update_independence_movements(ws);
+	CONTAINER_ACCESS_PHASE("population::update_local_rebels_and_movements");
 	population::update_local_rebels_and_movements(ws);
 
+	CONTAINER_ACCESS_PHASE("economy::economy_update_tick");
 	economy::economy_update_tick(ws);
+	CONTAINER_ACCESS_PHASE("military::update_cb_construction");
 	military::update_cb_construction(ws);
+	CONTAINER_ACCESS_PHASE("military::update_player_cb_state");
 	military::update_player_cb_state(ws);
 
+	CONTAINER_ACCESS_PHASE("technologies::daily_update");
 	technologies::daily_update(ws);
 
+	CONTAINER_ACCESS_PHASE("nations::daily_influence_update");
 	nations::daily_influence_update(ws);
 
-	ws.w.nation_s.nations.parallel_for_each([&ws](nations::country_tag n) {
+	CONTAINER_ACCESS_PHASE("nation scores and administration");
+	std::vector<uint8_t> rescored(ws.w.nation_s.nations.size(), uint8_t(0));
+	ws.w.nation_s.nations.parallel_for_each([&ws, &rescored](nations::country_tag n) {
 		nations::update_movement_support(ws, n);
 
-		ws.w.nation_s.nations.set<nation::military_score>(n, int16_t(nations::calculate_military_score(ws, n)));
-		ws.w.nation_s.nations.set<nation::industrial_score>(n, int16_t(nations::calculate_industrial_score(ws, n)));
+		auto const military_score = int16_t(nations::calculate_military_score(ws, n));
+		auto const industrial_score = int16_t(nations::calculate_industrial_score(ws, n));
+		auto const admin_efficiency = nations::calculate_national_administrative_efficiency(ws, n);
+		bool changed = military_score != ws.w.nation_s.nations.get<nation::military_score>(n)
+			|| industrial_score != ws.w.nation_s.nations.get<nation::industrial_score>(n)
+			|| admin_efficiency != ws.w.nation_s.nations.get<nation::national_administrative_efficiency>(n);
 
-		ws.w.nation_s.nations.set<nation::national_administrative_efficiency>(n, nations::calculate_national_administrative_efficiency(ws, n));
+		ws.w.nation_s.nations.set<nation::military_score>(n, military_score);
+		ws.w.nation_s.nations.set<nation::industrial_score>(n, industrial_score);
+		ws.w.nation_s.nations.set<nation::national_administrative_efficiency>(n, admin_efficiency);
 
 		auto admin_req = issues::administrative_requirement(ws, n);
 		auto member_states = get_range(ws.w.nation_s.state_arrays, ws.w.nation_s.nations.get<nation::member_states>(n));
-		for(auto s = member_states.first; s != member_states.second; ++s)
-			ws.w.nation_s.states.set<state::administrative_efficiency>(s->state, nations::calculate_state_administrative_efficiency(ws, s->state, admin_req));
+		for(auto s = member_states.first; s != member_states.second; ++s) {
+			auto const state_efficiency = nations::calculate_state_administrative_efficiency(ws, s->state, admin_req);
+			changed = changed || state_efficiency != ws.w.nation_s.states.get<state::administrative_efficiency>(s->state);
+			ws.w.nation_s.states.set<state::administrative_efficiency>(s->state, state_efficiency);
+		}
+
+		rescored[size_t(to_index(n))] = uint8_t(changed);
 	});
+	{
+		std::vector<ui::data_key> changed;
+		for(size_t i = 0; i < rescored.size(); ++i) {
+			if(rescored[i] != 0)
+				changed.push_back(ui::data_key{ ui::world_data::nation_scores, uint16_t(i) });
+		}
+		ws.w.gui_m.publish_changes(changed);
+	}
 
+	CONTAINER_ACCESS_PHASE("events::daily_update");
 	events::daily_update(ws);
 
+	CONTAINER_ACCESS_PHASE("nations::update_nation_ranks");
 	nations::update_nation_ranks(ws);
 
+	CONTAINER_ACCESS_PHASE("modifier reset");
 	ws.w.nation_s.modifier_values.reset();
 	ws.w.province_s.modifier_values.reset();
 
 	
 	modifiers::reset_provincial_modifiers(ws);
 	modifiers::reset_national_modifiers(ws);
+
+	CONTAINER_ACCESS_PHASE(nullptr);
+}
+
+namespace {
+	// microseconds of each day the amortized updates may take before the interface refresh is put off to a later
+	// tick: a quarter of the time between days at the current speed. It never changes what the updates process
+	float amortized_update_budget(int32_t speed) {
+		switch(speed) {
+			case 1: return 375'000.0f;
+			case 2: return 200'000.0f;
+			case 3: return 75'000.0f;
+			case 4: return 25'000.0f;
+			default: return staggered_scheduler::default_budget_microseconds;
+		}
+	}
 }
 
 void world_state_update_loop(world_state & ws) {
 	auto last_tick = std::chrono::steady_clock::now();
+	bool refresh_deferred = false;
 
 	while(ws.w.end_game.load(std::memory_order_acquire) == false) {
 
@@ -115,23 +172,49 @@ void world_state_update_loop(world_state & ws) {
 		if(perform_update) {
 			last_tick = std::chrono::steady_clock::now();
 
+			ws.w.update_schedule.set_budget(amortized_update_budget(ws.w.speed.load(std::memory_order_acquire)));
 			world_state_non_ai_update(ws);
 
-			ws.w.pending_commands.execute(ws);
+			const bool commands_executed = ws.w.pending_commands.execute(ws);
 			
 			ws.w.single_step_pending.store(false, std::memory_order_release);
 
 			ws.w.current_date = date_tag(to_index(ws.w.current_date) + 1);
-			ws.w.gui_m.flag_update();
-			ws.w.map_view.changed.store(true, std::memory_order_release);
+
+			// a tick only refreshes the gui objects subscribed to data that changed; commands can change anything,
+			// so they still request a full update
+			ws.w.gui_m.publish_change(ui::data_key{ ui::world_data::date });
+			for(auto n : ws.w.nation_s.rank_changed_nations)
+				ws.w.gui_m.publish_change(ui::data_key{ ui::world_data::nation_rank, uint16_t(to_index(n)) });
+			// on a tick that ran over its budget the refresh waits for a tick with time to spare, or for the
+			// next idle iteration; the published changes accumulate until then
+			if(commands_executed) {
+				ws.w.gui_m.flag_update();
+				ws.w.map_view.changed.store(true, std::memory_order_release);
+				refresh_deferred = false;
+			} else if(ws.w.update_schedule.over_budget()) {
+				refresh_deferred = true;
+			} else {
+				ws.w.gui_m.flag_data_update();
+				ws.w.map_view.changed.store(true, std::memory_order_release);
+				refresh_deferred = false;
+			}
 		} else {
 			if(ws.w.pending_commands.execute(ws)) {
+				ws.w.trigger_descriptions.invalidate(); // a new date takes care of this after a tick
 				ws.w.gui_m.flag_update();
 				ws.w.map_view.changed.store(true, std::memory_order_release);
+				refresh_deferred = false;
+			} else if(refresh_deferred) {
+				ws.w.gui_m.flag_data_update();
+				ws.w.map_view.changed.store(true, std::memory_order_release);
+				refresh_deferred = false;
 			}
 			Sleep(1);
 		}
 	}
+
+	CONTAINER_ACCESS_REPORT("container_access_profile.txt");
 }
 
 void ready_world_state(world_state& ws) {
@@ -30,9 +30,11 @@
 #include "find.h"
 #include "menu.h"
 #include "graphics/map_modes.h"
+#include "triggers\\trigger_gui.h"
 #include "nations\nations_containers.h"
 #include "provinces\province_containers.h"
 #include "population\population_containers.h"
+#include "concurrency_tools\staggered_scheduler.h"
 
 #undef small
 
@@ -69,6 +71,22 @@ namespace current_state {
 
 	struct player_cb_state;
 
+	// the updates that process a slice of their work set each day, scheduled by state::update_schedule
+	enum class amortized_phase : int32_t {
+		pop_attitudes, // literacy, militancy and consciousness
+		pop_ideology_and_issues,
+		promotion_and_demotion,
+		migration,
+		assimilation,
+		size_changes,
+		independence_movements,
+		local_rebels,
+		province_events,
+		national_events,
+		inventions,
+		count
+	};
+
 	class state {
 	public:
 		graphics::map_display map;
@@ -89,6 +107,7 @@ namespace current_state {
 		crisis_state current_crisis;
 		//other global state
 		date_tag current_date;
+		staggered_scheduler update_schedule = staggered_scheduler(int32_t(amortized_phase::count));
 		bool great_wars_enabled = false;
 		bool world_wars_enabled = false;
 
@@ -103,6 +122,7 @@ namespace current_state {
 
 		//gui state
 		map_mode::state map_view;
+		triggers::description_cache trigger_descriptions;
 
 		nations::diplomacy_window diplomacy_w;
 		provinces::province_window province_w;
@@ -139,10 +139,15 @@ void serialization::serializer<current_state::state>::serialize_object(std::byte
 
 	serialize(output, obj.local_player_nation);
 	serialize(output, obj.local_player_data, ws);
+
+	serialize(output, obj.update_schedule);
+
+	uint8_t const price_mode = uint8_t(obj.economy_s.price_mode);
+	serialize(output, price_mode);
 }
 
 void serialization::serializer<current_state::state>::deserialize_object(std::byte const *& input, current_state::state & obj, uint64_t version, world_state & ws) {
-	if(version != 1ui64)
+	if(version == 0ui64 || version > file_version)
 		std::abort();
 
 	provinces::reset_state(obj.province_s);
@@ -175,6 +180,19 @@ void serialization::serializer<current_state::state>::deserialize_object(std::by
 	deserialize(input, obj.local_player_nation);
 	deserialize(input, obj.local_player_data, ws);
 
+	if(version >= 2ui64)
+		deserialize(input, obj.update_schedule);
+	else
+		obj.update_schedule = staggered_scheduler(int32_t(current_state::amortized_phase::count));
+
+	if(version >= 3ui64) {
+		uint8_t price_mode = 0ui8;
+		deserialize(input, price_mode);
+		obj.economy_s.price_mode = economy::price_solver(price_mode);
+	} else {
+		obj.economy_s.price_mode = economy::price_solver::dampened;
+	}
+
 	restore_world_state(ws);
 }
 
@@ -194,7 +212,9 @@ size_t serialization::serializer<current_state::state>::size(current_state::stat
 		serialize_size(obj.great_wars_enabled) +
 		serialize_size(obj.world_wars_enabled) +
 		serialize_size(obj.local_player_data, ws) +
-		sizeof(nations::country_tag); // player id
+		sizeof(nations::country_tag) + // player id
+		serialize_size(obj.update_schedule) +
+		sizeof(uint8_t); // price mode
 }
 
 void restore_world_state(world_state& ws) {
@@ -289,6 +309,7 @@ void restore_world_state(world_state& ws) {
 	ws.w.nation_s.nations.parallel_for_each([&ws](nations::country_tag n) {
 		technologies::restore_technologies(ws, n);
 	});
+	technologies::rebuild_invention_candidates(ws);
 	modifiers::reset_national_modifiers(ws);
 
 	ws.w.nation_s.nations.for_each([&ws](nations::country_tag n) {
@@ -336,6 +357,6 @@ void restore_world_state(world_state& ws) {
 		}
 	});
 
-	nations::update_nation_ranks(ws);
+	nations::rebuild_nation_ranks(ws);
 	military::init_player_cb_state(ws);
 }
@@ -33,6 +33,10 @@ class serialization::serializer<current_state::state> {
 public:
 	static constexpr bool has_static_size = false;
 	static constexpr bool has_simple_serialize = false;
+	// 1: the original layout
+	// 2: the amortized update schedule is appended
+	// 3: the price solver mode is appended
+	static constexpr uint64_t file_version = 3ui64;
 
 	static void serialize_object(std::byte* &output, current_state::state const& obj, world_state const& ws);
 	static void deserialize_object(std::byte const* &input, current_state::state& obj, uint64_t version, world_state& ws);